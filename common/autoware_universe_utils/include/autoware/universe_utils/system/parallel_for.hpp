@@ -0,0 +1,151 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__UNIVERSE_UTILS__SYSTEM__PARALLEL_FOR_HPP_
+#define AUTOWARE__UNIVERSE_UTILS__SYSTEM__PARALLEL_FOR_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace autoware::universe_utils
+{
+
+/**
+ * @brief Resolve a num_threads parameter.
+ *
+ * @param num_threads The number of threads, 0 uses all the hardware threads.
+ * @return The number of threads, at least 1.
+ */
+inline size_t resolveNumThreads(const size_t num_threads)
+{
+  if (num_threads > 0) return num_threads;
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+/**
+ * @brief Number of workers parallelFor() uses.
+ *
+ * @param size The number of items.
+ * @param num_threads The maximum number of workers.
+ * @param min_size_per_worker The minimum number of items per worker.
+ */
+inline size_t numParallelWorkers(
+  const size_t size, const size_t num_threads, const size_t min_size_per_worker)
+{
+  return std::max<size_t>(
+    1, std::min(num_threads, size / std::max<size_t>(1, min_size_per_worker)));
+}
+
+namespace detail
+{
+// Runs work() on num_workers threads including the calling one, the first exception is rethrown
+// after all the threads are joined
+template <typename Work>
+void runWorkers(const size_t num_workers, Work && work)
+{
+  std::exception_ptr exception;
+  std::mutex exception_mutex;
+  const auto guarded_work = [&](const size_t worker) {
+    try {
+      work(worker);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(exception_mutex);
+      if (!exception) exception = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(num_workers - 1);
+  for (size_t worker = 1; worker < num_workers; ++worker) {
+    workers.emplace_back(guarded_work, worker);
+  }
+  guarded_work(0);
+  for (auto & worker : workers) {
+    worker.join();
+  }
+  if (exception) std::rethrow_exception(exception);
+}
+}  // namespace detail
+
+/**
+ * @brief Call func(begin, end, worker) on contiguous ranges of [0, size), one range per worker.
+ *
+ * Every worker gets at least min_size_per_worker items and the first range runs on the calling
+ * thread. The ranges only depend on the number of workers, so a worker can write to its own
+ * buffer indexed by worker. The first exception is rethrown after all the workers are joined.
+ *
+ * @param size The number of items.
+ * @param num_threads The maximum number of workers.
+ * @param min_size_per_worker The minimum number of items per worker.
+ * @param func The function called on each range.
+ * @return The number of workers used.
+ */
+template <typename Func>
+size_t parallelFor(
+  const size_t size, const size_t num_threads, const size_t min_size_per_worker, Func && func)
+{
+  const size_t num_workers = numParallelWorkers(size, num_threads, min_size_per_worker);
+  if (num_workers == 1) {
+    func(size_t{0}, size, size_t{0});
+    return 1;
+  }
+  detail::runWorkers(num_workers, [&](const size_t worker) {
+    func(size * worker / num_workers, size * (worker + 1) / num_workers, worker);
+  });
+  return num_workers;
+}
+
+/**
+ * @brief Call func(i) for each i in [0, size) on num_threads threads, the calling thread being
+ * one of them.
+ *
+ * The indices are handed out one at a time, which balances the load when the cost per item varies
+ * a lot. func must only write the data of its index. The first exception stops handing out
+ * indices and is rethrown after all the workers are joined.
+ *
+ * @param size The number of items.
+ * @param num_threads The maximum number of workers.
+ * @param func The function called on each index.
+ */
+template <typename Func>
+void parallelForEach(const size_t size, const size_t num_threads, Func && func)
+{
+  const size_t num_workers = std::min(num_threads, size);
+  if (num_workers <= 1) {
+    for (size_t i = 0; i < size; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next_index{0};
+  detail::runWorkers(num_workers, [&](const size_t /*worker*/) {
+    try {
+      for (size_t i = next_index++; i < size; i = next_index++) {
+        func(i);
+      }
+    } catch (...) {
+      next_index = size;
+      throw;
+    }
+  });
+}
+
+}  // namespace autoware::universe_utils
+
+#endif  // AUTOWARE__UNIVERSE_UTILS__SYSTEM__PARALLEL_FOR_HPP_
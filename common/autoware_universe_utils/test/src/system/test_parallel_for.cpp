@@ -0,0 +1,87 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/universe_utils/system/parallel_for.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+using autoware::universe_utils::numParallelWorkers;
+using autoware::universe_utils::parallelFor;
+using autoware::universe_utils::parallelForEach;
+using autoware::universe_utils::resolveNumThreads;
+
+TEST(parallel_for, resolveNumThreads)
+{
+  EXPECT_EQ(resolveNumThreads(3), 3u);
+  EXPECT_GE(resolveNumThreads(0), 1u);
+}
+
+TEST(parallel_for, numParallelWorkers)
+{
+  EXPECT_EQ(numParallelWorkers(0, 4, 10), 1u);
+  EXPECT_EQ(numParallelWorkers(25, 4, 10), 2u);
+  EXPECT_EQ(numParallelWorkers(1000, 4, 10), 4u);
+  EXPECT_EQ(numParallelWorkers(1000, 4, 0), 4u);
+}
+
+TEST(parallel_for, parallelForCoversRangesOnce)
+{
+  for (const size_t num_threads : {1u, 2u, 3u, 8u}) {
+    std::vector<int> visits(1001, 0);
+    std::vector<size_t> worker_items(num_threads, 0);
+    const size_t num_workers =
+      parallelFor(visits.size(), num_threads, 100, [&](size_t begin, size_t end, size_t worker) {
+        for (size_t i = begin; i < end; ++i) {
+          ++visits[i];
+        }
+        worker_items[worker] = end - begin;
+      });
+    EXPECT_EQ(num_workers, numParallelWorkers(visits.size(), num_threads, 100));
+    for (const int count : visits) {
+      EXPECT_EQ(count, 1);
+    }
+    for (size_t worker = 0; worker < num_workers; ++worker) {
+      EXPECT_GE(worker_items[worker], 100u);
+    }
+  }
+}
+
+TEST(parallel_for, parallelForEachVisitsAllIndices)
+{
+  for (const size_t num_threads : {1u, 2u, 8u}) {
+    std::vector<int> visits(500, 0);
+    parallelForEach(visits.size(), num_threads, [&](size_t i) { ++visits[i]; });
+    for (const int count : visits) {
+      EXPECT_EQ(count, 1);
+    }
+  }
+}
+
+TEST(parallel_for, exceptionIsRethrown)
+{
+  const auto throw_at = [](size_t i) {
+    if (i == 7) throw std::runtime_error("item 7");
+  };
+  EXPECT_THROW(
+    parallelFor(
+      1000, 4, 10,
+      [&](size_t begin, size_t end, size_t) {
+        for (size_t i = begin; i < end; ++i) throw_at(i);
+      }),
+    std::runtime_error);
+  EXPECT_THROW(parallelForEach(100, 4, throw_at), std::runtime_error);
+}
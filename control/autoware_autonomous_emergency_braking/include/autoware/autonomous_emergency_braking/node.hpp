@@ -15,6 +15,7 @@
 #ifndef AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__NODE_HPP_
 #define AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__NODE_HPP_
 
+#include "autoware/autonomous_emergency_braking/point_cloud_fast_path.hpp"
 #include "autoware_utils/system/time_keeper.hpp"
 
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
@@ -464,6 +465,17 @@ public:
     const PointCloud::Ptr obstacle_points_ptr,
     const PointCloud::Ptr points_belonging_to_cluster_hulls, MarkerArray & debug_markers);
 
+  /**
+   * @brief Same as cropPointCloudWithEgoFootprintPath and getPointsBelongingToClusterHulls, but
+   * done by point_cloud_fast_path_ on the raw input point cloud
+   * @param ego_polys Polygons representing the ego vehicle footprint
+   * @param filtered_objects output: the downsampled points in the ego path
+   * @param points_belonging_to_cluster_hulls output: the points belonging to cluster hulls
+   */
+  void getPointsBelongingToClusterHullsFastPath(
+    const std::vector<Polygon2d> & ego_polys, PointCloud & filtered_objects,
+    PointCloud & points_belonging_to_cluster_hulls, MarkerArray & debug_markers);
+
   /**
    * @brief Create object data using predicted objects
    * @param ego_path Ego vehicle path
@@ -535,6 +547,13 @@ public:
 
   // Member variables
   PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr_{nullptr};
+  // fast path: the raw input point cloud and its transform to base_link, and the reused outputs
+  PointCloud2::ConstSharedPtr input_pointcloud_ptr_{nullptr};
+  Eigen::Affine3f input_pointcloud_transform_{Eigen::Affine3f::Identity()};
+  PointCloudFastPath point_cloud_fast_path_;
+  CycleTimeHistogram point_cloud_fast_path_histogram_;
+  PointCloud::Ptr fast_path_filtered_objects_{pcl::make_shared<PointCloud>()};
+  PointCloud::Ptr fast_path_cluster_hull_points_{pcl::make_shared<PointCloud>()};
   VelocityReport::ConstSharedPtr current_velocity_ptr_{nullptr};
   Vector3::SharedPtr angular_velocity_ptr_{nullptr};
   Trajectory::ConstSharedPtr predicted_traj_ptr_{nullptr};
@@ -558,6 +577,7 @@ public:
   bool limit_imu_path_lat_dev_;
   bool limit_imu_path_length_;
   bool use_pointcloud_data_;
+  bool use_pointcloud_fast_path_;
   bool use_predicted_object_data_;
   bool use_object_velocity_calculation_;
   bool check_autoware_state_;
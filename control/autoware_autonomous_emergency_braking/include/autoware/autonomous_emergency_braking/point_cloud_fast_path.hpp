@@ -0,0 +1,144 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__POINT_CLOUD_FAST_PATH_HPP_
+#define AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__POINT_CLOUD_FAST_PATH_HPP_
+
+#include <Eigen/Geometry>
+#include <autoware_utils/geometry/boost_geometry.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+using autoware_utils::Polygon2d;
+
+/**
+ * @brief Histogram of cycle times with fixed bins, to follow the worst case and not only the
+ * average
+ */
+class CycleTimeHistogram
+{
+public:
+  void add(const double time_ms);
+  /**
+   * @brief Summary of the histogram, e.g. "cycle time [ms] <0.5: 10, <1: 3, ..., >=100: 0, max:
+   * 0.82"
+   */
+  [[nodiscard]] std::string toString() const;
+
+private:
+  static constexpr std::array<double, 8> bin_upper_bounds_ms_{0.5, 1.0,  2.0,  5.0,
+                                                              10.0, 20.0, 50.0, 100.0};
+  std::array<std::size_t, bin_upper_bounds_ms_.size() + 1> counts_{};
+  double max_ms_{0.0};
+};
+
+/**
+ * @brief Point cloud path of AEB working on the PointCloud2 buffer. The transform, the height
+ * filter and the crop with the convex hull of the ego path footprints are done in one pass over
+ * the points, then only the kept points are downsampled on a voxel grid and clustered on a hash
+ * grid. The buffers are kept between the calls, so once they have grown to the size of the
+ * clouds no memory is allocated.
+ */
+class PointCloudFastPath
+{
+public:
+  struct Parameters
+  {
+    float min_height{0.0f};
+    float max_height{0.0f};
+    float voxel_grid_x{0.1f};
+    float voxel_grid_y{0.1f};
+    float voxel_grid_z{0.5f};
+    float cluster_tolerance{0.15f};
+    float cluster_minimum_height{0.1f};
+    int minimum_cluster_size{10};
+    int maximum_cluster_size{10000};
+  };
+
+  void setParameters(const Parameters & parameters) { parameters_ = parameters; }
+
+  /**
+   * @brief Extract the vertices of the 2d convex hulls of the clusters in the ego path corridor
+   * @param cloud input cloud with float32 x, y and z fields
+   * @param transform transform from the frame of the cloud to base_link
+   * @param path_polygons footprints of the ego paths, the corridor is their convex hull
+   * @param corridor_points output: the downsampled points in the corridor
+   * @param hull_points output: the hull vertices of the clusters higher than
+   * cluster_minimum_height, the hull i is [hullOffsets()[i], hullOffsets()[i + 1])
+   * @return false if the cloud has no float32 x, y and z fields
+   */
+  bool process(
+    const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Affine3f & transform,
+    const std::vector<Polygon2d> & path_polygons, pcl::PointCloud<pcl::PointXYZ> & corridor_points,
+    pcl::PointCloud<pcl::PointXYZ> & hull_points);
+
+  [[nodiscard]] const std::vector<std::uint32_t> & hullOffsets() const { return hull_offsets_; }
+
+private:
+  struct Cell
+  {
+    std::uint64_t key;
+    // Range of the points of the cell in the sorted points
+    std::uint32_t begin;
+    std::uint32_t end;
+  };
+
+  void setCorridor(const std::vector<Polygon2d> & path_polygons);
+  bool isInCorridor(const float x, const float y) const;
+  /// One pass over the buffer: transform, height filter and crop with the corridor
+  void cropPoints(
+    const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Affine3f & transform,
+    const std::array<std::uint32_t, 3> & offsets);
+  void downsample(pcl::PointCloud<pcl::PointXYZ> & corridor_points);
+  void cluster(const pcl::PointCloud<pcl::PointXYZ> & corridor_points);
+  void extractHulls(
+    const pcl::PointCloud<pcl::PointXYZ> & corridor_points,
+    pcl::PointCloud<pcl::PointXYZ> & hull_points);
+  std::uint32_t findRoot(std::uint32_t idx);
+
+  Parameters parameters_;
+
+  // corridor: the convex hull as half planes a * x + b * y + c >= 0, and its bounding box
+  std::vector<std::pair<double, double>> corridor_vertices_;
+  std::vector<std::array<double, 3>> corridor_half_planes_;
+  std::array<double, 4> corridor_bounds_{};  // min x, min y, max x, max y
+
+  // Buffers reused between calls
+  std::vector<pcl::PointXYZ> cropped_points_;
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> point_keys_;
+  std::vector<Cell> cells_;
+  std::vector<std::uint32_t> sorted_points_;
+  std::vector<std::uint32_t> parents_;
+  std::vector<std::uint32_t> cluster_labels_;
+  std::vector<std::uint32_t> cluster_offsets_;
+  std::vector<std::uint32_t> clustered_points_;
+  std::vector<pcl::PointXYZ> hull_input_;
+  std::vector<std::uint32_t> hull_stack_;
+  std::vector<std::uint32_t> hull_offsets_;
+};
+}  // namespace autoware::motion::control::autonomous_emergency_braking
+
+#endif  // AUTOWARE__AUTONOMOUS_EMERGENCY_BRAKING__POINT_CLOUD_FAST_PATH_HPP_
@@ -22,6 +22,7 @@
 #include <autoware_utils/geometry/geometry.hpp>
 #include <autoware_utils/ros/marker_helper.hpp>
 #include <autoware_utils/ros/update_param.hpp>
+#include <autoware_utils/system/stop_watch.hpp>
 #include <pcl_ros/transforms.hpp>
 #include <rclcpp/node.hpp>
 #include <tf2/utils.hpp>
@@ -164,6 +165,7 @@ AEB::AEB(const rclcpp::NodeOptions & node_options)
   limit_imu_path_lat_dev_ = declare_parameter<bool>("limit_imu_path_lat_dev");
   limit_imu_path_length_ = declare_parameter<bool>("limit_imu_path_length");
   use_pointcloud_data_ = declare_parameter<bool>("use_pointcloud_data");
+  use_pointcloud_fast_path_ = declare_parameter<bool>("use_pointcloud_fast_path");
   use_predicted_object_data_ = declare_parameter<bool>("use_predicted_object_data");
   use_object_velocity_calculation_ = declare_parameter<bool>("use_object_velocity_calculation");
   check_autoware_state_ = declare_parameter<bool>("check_autoware_state");
@@ -227,6 +229,7 @@ rcl_interfaces::msg::SetParametersResult AEB::onParameter(
   update_param<bool>(parameters, "limit_imu_path_lat_dev", limit_imu_path_lat_dev_);
   update_param<bool>(parameters, "limit_imu_path_length", limit_imu_path_length_);
   update_param<bool>(parameters, "use_pointcloud_data", use_pointcloud_data_);
+  update_param<bool>(parameters, "use_pointcloud_fast_path", use_pointcloud_fast_path_);
   update_param<bool>(parameters, "use_predicted_object_data", use_predicted_object_data_);
   update_param<bool>(
     parameters, "use_object_velocity_calculation", use_object_velocity_calculation_);
@@ -292,6 +295,29 @@ void AEB::onImu(const Imu::ConstSharedPtr input_msg)
 void AEB::onPointCloud(const PointCloud2::ConstSharedPtr input_msg)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  if (use_pointcloud_fast_path_) {
+    // the points are processed in checkCollision, once the ego path is known
+    if (input_msg->header.frame_id == "base_link") {
+      input_pointcloud_transform_ = Eigen::Affine3f::Identity();
+    } else {
+      RCLCPP_ERROR_STREAM(
+        get_logger(),
+        "[AEB]: Input point cloud frame is not base_link and it is " << input_msg->header.frame_id);
+      const auto logger = get_logger();
+      const auto transform_stamped =
+        utils::getTransform("base_link", input_msg->header.frame_id, tf_buffer_, logger);
+      if (!transform_stamped.has_value()) return;
+      input_pointcloud_transform_.matrix() =
+        tf2::transformToEigen(transform_stamped.value().transform).matrix().cast<float>();
+    }
+    input_pointcloud_ptr_ = input_msg;
+    if (!obstacle_ros_pointcloud_ptr_) {
+      obstacle_ros_pointcloud_ptr_ = std::make_shared<PointCloud2>();
+    }
+    obstacle_ros_pointcloud_ptr_->header = input_msg->header;
+    return;
+  }
+
   PointCloud::Ptr pointcloud_ptr(new PointCloud);
   pcl::fromROSMsg(*input_msg, *pointcloud_ptr);
 
@@ -555,6 +581,7 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
                               : generateEgoPath(*predicted_traj_ptr_);
 
   PointCloud::Ptr filtered_objects = pcl::make_shared<PointCloud>();
+  PointCloud::Ptr points_belonging_to_cluster_hulls = pcl::make_shared<PointCloud>();
   if (use_pointcloud_data_) {
     const std::vector<Path> paths = [&]() {
       std::vector<Path> paths;
@@ -567,14 +594,20 @@ bool AEB::checkCollision(MarkerArray & debug_markers)
 
     if (paths.empty()) return false;
     const std::vector<Polygon2d> merged_path_polygons = merge_expanded_path_polys(paths);
-    // Data of filtered point cloud
-    cropPointCloudWithEgoFootprintPath(merged_path_polygons, filtered_objects);
+    if (use_pointcloud_fast_path_ && input_pointcloud_ptr_) {
+      filtered_objects = fast_path_filtered_objects_;
+      points_belonging_to_cluster_hulls = fast_path_cluster_hull_points_;
+      getPointsBelongingToClusterHullsFastPath(
+        merged_path_polygons, *filtered_objects, *points_belonging_to_cluster_hulls,
+        debug_markers);
+    } else {
+      // Data of filtered point cloud
+      cropPointCloudWithEgoFootprintPath(merged_path_polygons, filtered_objects);
+      getPointsBelongingToClusterHulls(
+        filtered_objects, points_belonging_to_cluster_hulls, debug_markers);
+    }
   }
 
-  PointCloud::Ptr points_belonging_to_cluster_hulls = pcl::make_shared<PointCloud>();
-  getPointsBelongingToClusterHulls(
-    filtered_objects, points_belonging_to_cluster_hulls, debug_markers);
-
   const auto imu_path_objects =
     (!use_imu_path_ || !angular_velocity_ptr_)
       ? std::vector<ObjectData>{}
@@ -924,6 +957,52 @@ void AEB::getPointsBelongingToClusterHulls(
   }
 }
 
+void AEB::getPointsBelongingToClusterHullsFastPath(
+  const std::vector<Polygon2d> & ego_polys, PointCloud & filtered_objects,
+  PointCloud & points_belonging_to_cluster_hulls, MarkerArray & debug_markers)
+{
+  autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
+  autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+
+  PointCloudFastPath::Parameters parameters;
+  parameters.min_height = static_cast<float>(detection_range_min_height_);
+  parameters.max_height =
+    static_cast<float>(vehicle_info_.vehicle_height_m + detection_range_max_height_margin_);
+  parameters.voxel_grid_x = static_cast<float>(voxel_grid_x_);
+  parameters.voxel_grid_y = static_cast<float>(voxel_grid_y_);
+  parameters.voxel_grid_z = static_cast<float>(voxel_grid_z_);
+  parameters.cluster_tolerance = static_cast<float>(cluster_tolerance_);
+  parameters.cluster_minimum_height = static_cast<float>(cluster_minimum_height_);
+  parameters.minimum_cluster_size = minimum_cluster_size_;
+  parameters.maximum_cluster_size = maximum_cluster_size_;
+  point_cloud_fast_path_.setParameters(parameters);
+
+  if (!point_cloud_fast_path_.process(
+        *input_pointcloud_ptr_, input_pointcloud_transform_, ego_polys, filtered_objects,
+        points_belonging_to_cluster_hulls)) {
+    RCLCPP_ERROR_THROTTLE(
+      get_logger(), *get_clock(), 5000, "[AEB]: Input point cloud has no float32 x, y and z");
+  }
+  pcl_conversions::toPCL(input_pointcloud_ptr_->header, filtered_objects.header);
+
+  // the worst cycles matter for AEB, so the distribution is reported and not only the last time
+  point_cloud_fast_path_histogram_.add(stop_watch.toc());
+  time_keeper_->comment(point_cloud_fast_path_histogram_.toString());
+
+  const auto & hull_offsets = point_cloud_fast_path_.hullOffsets();
+  if (publish_debug_markers_ && hull_offsets.size() > 1) {
+    std::vector<Polygon3d> hull_polygons(hull_offsets.size() - 1);
+    for (std::size_t i = 0; i + 1 < hull_offsets.size(); ++i) {
+      for (auto j = hull_offsets[i]; j < hull_offsets[i + 1]; ++j) {
+        const auto & p = points_belonging_to_cluster_hulls[j];
+        appendPointToPolygon(hull_polygons[i], autoware_utils::create_point(p.x, p.y, p.z));
+      }
+    }
+    constexpr colorTuple debug_color = {255.0 / 256.0, 51.0 / 256.0, 255.0 / 256.0, 0.999};
+    addClusterHullMarkers(now(), hull_polygons, debug_color, "hulls", debug_markers);
+  }
+}
+
 void AEB::getClosestObjectsOnPath(
   const Path & ego_path, const rclcpp::Time & stamp,
   const PointCloud::Ptr points_belonging_to_cluster_hulls, std::vector<ObjectData> & objects)
@@ -0,0 +1,444 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <autoware/autonomous_emergency_braking/point_cloud_fast_path.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace autoware::motion::control::autonomous_emergency_braking
+{
+namespace
+{
+// 21 bits per coordinate, so that the keys of the cells are in (x, y, z) lexicographic order
+constexpr std::int64_t cell_offset = std::int64_t{1} << 20;
+constexpr double max_cell_coordinate = static_cast<double>(cell_offset - 2);
+
+std::int64_t toCellCoordinate(const double value, const double inverse_cell_size)
+{
+  const double coordinate = std::floor(value * inverse_cell_size);
+  // far cells are merged, the distances are still checked on the points
+  return static_cast<std::int64_t>(
+    std::clamp(coordinate, -max_cell_coordinate, max_cell_coordinate));
+}
+
+std::uint64_t toCellKey(const std::int64_t x, const std::int64_t y, const std::int64_t z)
+{
+  return (static_cast<std::uint64_t>(x + cell_offset) << 42) |
+         (static_cast<std::uint64_t>(y + cell_offset) << 21) |
+         static_cast<std::uint64_t>(z + cell_offset);
+}
+
+std::int64_t cellX(const std::uint64_t key)
+{
+  return static_cast<std::int64_t>(key >> 42) - cell_offset;
+}
+
+std::int64_t cellY(const std::uint64_t key)
+{
+  return static_cast<std::int64_t>((key >> 21) & 0x1fffffULL) - cell_offset;
+}
+
+std::int64_t cellZ(const std::uint64_t key)
+{
+  return static_cast<std::int64_t>(key & 0x1fffffULL) - cell_offset;
+}
+
+/**
+ * @brief Monotone chain convex hull of points sorted by (x, y)
+ * @param hull output: indices of the counter-clockwise hull vertices, collinear points dropped
+ */
+template <typename GetX, typename GetY>
+void buildConvexHull(
+  const std::size_t num_points, const GetX & get_x, const GetY & get_y,
+  std::vector<std::uint32_t> & hull)
+{
+  hull.clear();
+  if (num_points < 3) {
+    for (std::uint32_t i = 0; i < num_points; ++i) {
+      hull.push_back(i);
+    }
+    return;
+  }
+  const auto cross = [&](const std::uint32_t o, const std::uint32_t a, const std::uint32_t b) {
+    return (static_cast<double>(get_x(a)) - get_x(o)) * (static_cast<double>(get_y(b)) - get_y(o)) -
+           (static_cast<double>(get_y(a)) - get_y(o)) * (static_cast<double>(get_x(b)) - get_x(o));
+  };
+  for (std::uint32_t i = 0; i < num_points; ++i) {
+    while (hull.size() >= 2 && cross(hull[hull.size() - 2], hull.back(), i) <= 0.0) {
+      hull.pop_back();
+    }
+    hull.push_back(i);
+  }
+  const std::size_t lower_size = hull.size() + 1;
+  for (std::uint32_t i = static_cast<std::uint32_t>(num_points) - 1; i-- > 0;) {
+    while (hull.size() >= lower_size && cross(hull[hull.size() - 2], hull.back(), i) <= 0.0) {
+      hull.pop_back();
+    }
+    hull.push_back(i);
+  }
+  hull.pop_back();  // the first point again
+}
+}  // namespace
+
+void CycleTimeHistogram::add(const double time_ms)
+{
+  std::size_t bin = 0;
+  while (bin < bin_upper_bounds_ms_.size() && time_ms >= bin_upper_bounds_ms_[bin]) {
+    ++bin;
+  }
+  ++counts_[bin];
+  max_ms_ = std::max(max_ms_, time_ms);
+}
+
+std::string CycleTimeHistogram::toString() const
+{
+  std::string text = "cycle time [ms]";
+  char buffer[32];
+  for (std::size_t bin = 0; bin < counts_.size(); ++bin) {
+    if (bin < bin_upper_bounds_ms_.size()) {
+      std::snprintf(
+        buffer, sizeof(buffer), " <%g: %zu,", bin_upper_bounds_ms_[bin], counts_[bin]);
+    } else {
+      std::snprintf(
+        buffer, sizeof(buffer), " >=%g: %zu,", bin_upper_bounds_ms_.back(), counts_[bin]);
+    }
+    text += buffer;
+  }
+  std::snprintf(buffer, sizeof(buffer), " max: %.3f", max_ms_);
+  text += buffer;
+  return text;
+}
+
+bool PointCloudFastPath::process(
+  const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Affine3f & transform,
+  const std::vector<Polygon2d> & path_polygons, pcl::PointCloud<pcl::PointXYZ> & corridor_points,
+  pcl::PointCloud<pcl::PointXYZ> & hull_points)
+{
+  corridor_points.clear();
+  hull_points.clear();
+  hull_offsets_.assign(1, 0);
+
+  setCorridor(path_polygons);
+  cropped_points_.clear();
+  if (!corridor_half_planes_.empty()) {
+    std::array<std::uint32_t, 3> offsets{};
+    const std::array<const char *, 3> names{"x", "y", "z"};
+    for (std::size_t i = 0; i < 3; ++i) {
+      const auto field = std::find_if(
+        cloud.fields.begin(), cloud.fields.end(),
+        [&](const auto & cloud_field) { return cloud_field.name == names[i]; });
+      if (
+        field == cloud.fields.end() ||
+        field->datatype != sensor_msgs::msg::PointField::FLOAT32 ||
+        field->offset + sizeof(float) > cloud.point_step) {
+        return false;
+      }
+      offsets[i] = field->offset;
+    }
+    cropPoints(cloud, transform, offsets);
+  }
+
+  downsample(corridor_points);
+  cluster(corridor_points);
+  extractHulls(corridor_points, hull_points);
+  return true;
+}
+
+void PointCloudFastPath::setCorridor(const std::vector<Polygon2d> & path_polygons)
+{
+  corridor_vertices_.clear();
+  corridor_half_planes_.clear();
+  for (const auto & polygon : path_polygons) {
+    for (const auto & point : polygon.outer()) {
+      corridor_vertices_.emplace_back(point.x(), point.y());
+    }
+  }
+  std::sort(corridor_vertices_.begin(), corridor_vertices_.end());
+  buildConvexHull(
+    corridor_vertices_.size(), [&](const std::uint32_t i) { return corridor_vertices_[i].first; },
+    [&](const std::uint32_t i) { return corridor_vertices_[i].second; }, hull_stack_);
+  if (hull_stack_.size() < 3) {
+    return;  // no area, nothing is in the corridor
+  }
+
+  corridor_bounds_ = {
+    std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+    std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+  for (std::size_t i = 0; i < hull_stack_.size(); ++i) {
+    const auto & [x1, y1] = corridor_vertices_[hull_stack_[i]];
+    const auto & [x2, y2] = corridor_vertices_[hull_stack_[(i + 1) % hull_stack_.size()]];
+    // counter-clockwise, so the inside is on the left of the edges
+    const double a = -(y2 - y1);
+    const double b = x2 - x1;
+    corridor_half_planes_.push_back({a, b, -(a * x1 + b * y1)});
+    corridor_bounds_[0] = std::min(corridor_bounds_[0], x1);
+    corridor_bounds_[1] = std::min(corridor_bounds_[1], y1);
+    corridor_bounds_[2] = std::max(corridor_bounds_[2], x1);
+    corridor_bounds_[3] = std::max(corridor_bounds_[3], y1);
+  }
+}
+
+bool PointCloudFastPath::isInCorridor(const float x, const float y) const
+{
+  // also rejects NaN
+  if (!(x >= corridor_bounds_[0] && y >= corridor_bounds_[1] && x <= corridor_bounds_[2] &&
+        y <= corridor_bounds_[3])) {
+    return false;
+  }
+  for (const auto & [a, b, c] : corridor_half_planes_) {
+    if (a * x + b * y + c < 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void PointCloudFastPath::cropPoints(
+  const sensor_msgs::msg::PointCloud2 & cloud, const Eigen::Affine3f & transform,
+  const std::array<std::uint32_t, 3> & offsets)
+{
+  // rows beyond the end of the buffer are ignored
+  const std::size_t num_rows =
+    cloud.row_step == 0 ? 0
+                        : std::min<std::size_t>(cloud.height, cloud.data.size() / cloud.row_step);
+  const std::size_t num_columns =
+    cloud.point_step == 0 ? 0
+                          : std::min<std::size_t>(cloud.width, cloud.row_step / cloud.point_step);
+  cropped_points_.reserve(num_rows * num_columns);
+  for (std::size_t row = 0; row < num_rows; ++row) {
+    const std::uint8_t * row_data = cloud.data.data() + row * cloud.row_step;
+    for (std::size_t column = 0; column < num_columns; ++column) {
+      const std::uint8_t * point_data = row_data + column * cloud.point_step;
+      Eigen::Vector3f point;
+      std::memcpy(&point.x(), point_data + offsets[0], sizeof(float));
+      std::memcpy(&point.y(), point_data + offsets[1], sizeof(float));
+      std::memcpy(&point.z(), point_data + offsets[2], sizeof(float));
+      point = transform * point;
+      // inclusive limits like pcl::PassThrough, NaN is rejected
+      if (!(point.z() >= parameters_.min_height && point.z() <= parameters_.max_height)) {
+        continue;
+      }
+      if (!isInCorridor(point.x(), point.y())) {
+        continue;
+      }
+      cropped_points_.emplace_back(point.x(), point.y(), point.z());
+    }
+  }
+}
+
+void PointCloudFastPath::downsample(pcl::PointCloud<pcl::PointXYZ> & corridor_points)
+{
+  if (
+    !(parameters_.voxel_grid_x > 0.0f && parameters_.voxel_grid_y > 0.0f &&
+      parameters_.voxel_grid_z > 0.0f)) {
+    for (const auto & point : cropped_points_) {
+      corridor_points.push_back(point);
+    }
+    return;
+  }
+
+  // centroids of the points of each voxel, like pcl::VoxelGrid
+  const double inverse_x = 1.0 / parameters_.voxel_grid_x;
+  const double inverse_y = 1.0 / parameters_.voxel_grid_y;
+  const double inverse_z = 1.0 / parameters_.voxel_grid_z;
+  point_keys_.clear();
+  for (std::uint32_t i = 0; i < cropped_points_.size(); ++i) {
+    const auto & point = cropped_points_[i];
+    point_keys_.emplace_back(
+      toCellKey(
+        toCellCoordinate(point.x, inverse_x), toCellCoordinate(point.y, inverse_y),
+        toCellCoordinate(point.z, inverse_z)),
+      i);
+  }
+  std::sort(point_keys_.begin(), point_keys_.end());
+
+  for (std::size_t begin = 0; begin < point_keys_.size();) {
+    std::size_t end = begin;
+    double sum_x = 0.0;
+    double sum_y = 0.0;
+    double sum_z = 0.0;
+    for (; end < point_keys_.size() && point_keys_[end].first == point_keys_[begin].first; ++end) {
+      const auto & point = cropped_points_[point_keys_[end].second];
+      sum_x += point.x;
+      sum_y += point.y;
+      sum_z += point.z;
+    }
+    const double num_points = static_cast<double>(end - begin);
+    corridor_points.push_back(pcl::PointXYZ(
+      static_cast<float>(sum_x / num_points), static_cast<float>(sum_y / num_points),
+      static_cast<float>(sum_z / num_points)));
+    begin = end;
+  }
+}
+
+std::uint32_t PointCloudFastPath::findRoot(std::uint32_t idx)
+{
+  while (parents_[idx] != idx) {
+    parents_[idx] = parents_[parents_[idx]];  // path halving
+    idx = parents_[idx];
+  }
+  return idx;
+}
+
+void PointCloudFastPath::cluster(const pcl::PointCloud<pcl::PointXYZ> & corridor_points)
+{
+  cells_.clear();
+  sorted_points_.clear();
+  const std::size_t num_points = corridor_points.size();
+  if (num_points == 0 || !(parameters_.cluster_tolerance > 0.0f)) {
+    parents_.clear();
+    return;
+  }
+
+  // 1) Sort the points by cell, the cells are slightly larger than the tolerance so that rounding
+  // never puts two neighbors two cells away
+  const double inverse_cell_size = 1.0 / (1.0001 * parameters_.cluster_tolerance);
+  point_keys_.clear();
+  for (std::uint32_t i = 0; i < num_points; ++i) {
+    const auto & point = corridor_points[i];
+    point_keys_.emplace_back(
+      toCellKey(
+        toCellCoordinate(point.x, inverse_cell_size), toCellCoordinate(point.y, inverse_cell_size),
+        toCellCoordinate(point.z, inverse_cell_size)),
+      i);
+  }
+  std::sort(point_keys_.begin(), point_keys_.end());
+  for (std::uint32_t i = 0; i < point_keys_.size(); ++i) {
+    const auto [key, point_idx] = point_keys_[i];
+    sorted_points_.push_back(point_idx);
+    if (cells_.empty() || cells_.back().key != key) {
+      cells_.push_back({key, i, i});
+    }
+    cells_.back().end = i + 1;
+  }
+
+  // 2) Union the points closer than the tolerance, in the 3x3x3 cells around each cell. The cells
+  // of a (x, y) column are consecutive, so each column is one range of points
+  parents_.resize(num_points);
+  for (std::uint32_t i = 0; i < num_points; ++i) {
+    parents_[i] = i;
+  }
+  const float squared_tolerance = parameters_.cluster_tolerance * parameters_.cluster_tolerance;
+  const auto compare = [](const Cell & cell, const std::uint64_t key) { return cell.key < key; };
+  for (const auto & cell : cells_) {
+    const std::int64_t x = cellX(cell.key);
+    const std::int64_t y = cellY(cell.key);
+    const std::int64_t z = cellZ(cell.key);
+    for (std::int64_t dx = -1; dx <= 1; ++dx) {
+      for (std::int64_t dy = -1; dy <= 1; ++dy) {
+        const auto first =
+          std::lower_bound(cells_.begin(), cells_.end(), toCellKey(x + dx, y + dy, z - 1), compare);
+        const auto last =
+          std::lower_bound(first, cells_.end(), toCellKey(x + dx, y + dy, z + 2), compare);
+        if (first == last) continue;
+        const std::uint32_t column_begin = first->begin;
+        const std::uint32_t column_end = std::prev(last)->end;
+        for (std::uint32_t i = cell.begin; i < cell.end; ++i) {
+          const auto & p = corridor_points[sorted_points_[i]];
+          // each pair once
+          for (std::uint32_t j = std::max(column_begin, i + 1); j < column_end; ++j) {
+            const auto & q = corridor_points[sorted_points_[j]];
+            const float diff_x = p.x - q.x;
+            const float diff_y = p.y - q.y;
+            const float diff_z = p.z - q.z;
+            if (diff_x * diff_x + diff_y * diff_y + diff_z * diff_z >= squared_tolerance) {
+              continue;
+            }
+            const std::uint32_t root_i = findRoot(i);
+            const std::uint32_t root_j = findRoot(j);
+            // the smaller index stays the root, so the result does not depend on the merge order
+            if (root_i < root_j) {
+              parents_[root_j] = root_i;
+            } else if (root_j < root_i) {
+              parents_[root_i] = root_j;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // 3) Group the points by cluster, in the order of their first point
+  cluster_labels_.resize(num_points);
+  cluster_offsets_.assign(1, 0);
+  for (std::uint32_t i = 0; i < num_points; ++i) {
+    const std::uint32_t root = findRoot(i);
+    if (root == i) {
+      cluster_labels_[i] = static_cast<std::uint32_t>(cluster_offsets_.size() - 1);
+      cluster_offsets_.push_back(0);
+    } else {
+      cluster_labels_[i] = cluster_labels_[root];
+    }
+    ++cluster_offsets_[cluster_labels_[i] + 1];
+  }
+  for (std::size_t label = 1; label < cluster_offsets_.size(); ++label) {
+    cluster_offsets_[label] += cluster_offsets_[label - 1];
+  }
+  // parents_ is reused as the insertion position of each cluster
+  parents_.assign(cluster_offsets_.begin(), cluster_offsets_.end() - 1);
+  clustered_points_.resize(num_points);
+  for (std::uint32_t i = 0; i < num_points; ++i) {
+    clustered_points_[parents_[cluster_labels_[i]]++] = sorted_points_[i];
+  }
+}
+
+void PointCloudFastPath::extractHulls(
+  const pcl::PointCloud<pcl::PointXYZ> & corridor_points,
+  pcl::PointCloud<pcl::PointXYZ> & hull_points)
+{
+  if (sorted_points_.empty()) {
+    return;
+  }
+  for (std::size_t label = 0; label + 1 < cluster_offsets_.size(); ++label) {
+    const std::uint32_t begin = cluster_offsets_[label];
+    const std::uint32_t end = cluster_offsets_[label + 1];
+    const auto cluster_size = static_cast<int>(end - begin);
+    if (
+      cluster_size < parameters_.minimum_cluster_size ||
+      cluster_size > parameters_.maximum_cluster_size) {
+      continue;
+    }
+
+    bool cluster_surpasses_threshold_height = false;
+    hull_input_.clear();
+    for (std::uint32_t i = begin; i < end; ++i) {
+      const auto & point = corridor_points[clustered_points_[i]];
+      cluster_surpasses_threshold_height |= point.z > parameters_.cluster_minimum_height;
+      hull_input_.push_back(point);
+    }
+    if (!cluster_surpasses_threshold_height) continue;
+
+    // 2d convex hull, the vertices keep their height
+    std::sort(
+      hull_input_.begin(), hull_input_.end(), [](const pcl::PointXYZ & a, const pcl::PointXYZ & b) {
+        return a.x < b.x || (a.x == b.x && a.y < b.y);
+      });
+    buildConvexHull(
+      hull_input_.size(), [&](const std::uint32_t i) { return hull_input_[i].x; },
+      [&](const std::uint32_t i) { return hull_input_[i].y; }, hull_stack_);
+    for (const auto i : hull_stack_) {
+      hull_points.push_back(hull_input_[i]);
+    }
+    hull_offsets_.push_back(static_cast<std::uint32_t>(hull_points.size()));
+  }
+}
+
+}  // namespace autoware::motion::control::autonomous_emergency_braking
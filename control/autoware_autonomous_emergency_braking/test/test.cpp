@@ -422,4 +422,66 @@ TEST_F(TestAEB, TestCropPointCloud)
   ASSERT_TRUE(filtered_objects->points.size() == 2 * n_points);
 }
 
+TEST_F(TestAEB, TestPointCloudFastPath)
+{
+  constexpr double longitudinal_velocity = 3.0;
+  constexpr double yaw_rate = 0.05;
+  const auto imu_path = aeb_node_->generateEgoPath(longitudinal_velocity, yaw_rate);
+  ASSERT_FALSE(imu_path.empty());
+
+  // a 5x3 grid cluster in the path, a point too low, a point too high and a point outside
+  constexpr size_t n_points{15};
+  pcl::PointCloud<pcl::PointXYZ> obstacle_points;
+  for (size_t i = 0; i < n_points; ++i) {
+    const double offset_x = static_cast<double>(i % 5) * 0.02;
+    const double offset_y = static_cast<double>(i / 5) * 0.02;
+    obstacle_points.push_back(pcl::PointXYZ(1.0 + offset_x, offset_y, 0.5));
+  }
+  obstacle_points.push_back(pcl::PointXYZ(1.0, 0.0, -5.0));
+  obstacle_points.push_back(pcl::PointXYZ(1.0, 0.0, 5.0));
+  obstacle_points.push_back(pcl::PointXYZ(100.0, 100.0, 0.5));
+  PointCloud2 obstacle_ros_pointcloud;
+  pcl::toROSMsg(obstacle_points, obstacle_ros_pointcloud);
+
+  PointCloudFastPath::Parameters parameters;
+  parameters.min_height = -1.0f;
+  parameters.max_height = 2.0f;
+  // no downsampling
+  parameters.voxel_grid_x = 0.0f;
+  parameters.cluster_tolerance = 0.05f;
+  parameters.minimum_cluster_size = 5;
+  PointCloudFastPath fast_path;
+  fast_path.setParameters(parameters);
+
+  const auto footprint = aeb_node_->generatePathFootprint(imu_path, 0.0);
+  pcl::PointCloud<pcl::PointXYZ> filtered_objects;
+  pcl::PointCloud<pcl::PointXYZ> hull_points;
+  ASSERT_TRUE(fast_path.process(
+    obstacle_ros_pointcloud, Eigen::Affine3f::Identity(), footprint, filtered_objects,
+    hull_points));
+  EXPECT_EQ(filtered_objects.size(), n_points);
+  // one cluster, its hull is made of the corners of the grid
+  ASSERT_EQ(fast_path.hullOffsets().size(), 2u);
+  EXPECT_EQ(hull_points.size(), 4u);
+
+  // the same with the points given in another frame
+  const Eigen::Affine3f transform(Eigen::Translation3f(0.0f, 0.0f, 1.0f));
+  pcl::PointCloud<pcl::PointXYZ> lowered_points;
+  for (const auto & p : obstacle_points) {
+    lowered_points.push_back(pcl::PointXYZ(p.x, p.y, p.z - 1.0f));
+  }
+  pcl::toROSMsg(lowered_points, obstacle_ros_pointcloud);
+  ASSERT_TRUE(fast_path.process(
+    obstacle_ros_pointcloud, transform, footprint, filtered_objects, hull_points));
+  EXPECT_EQ(filtered_objects.size(), n_points);
+  EXPECT_EQ(hull_points.size(), 4u);
+
+  // too small clusters are discarded
+  parameters.minimum_cluster_size = static_cast<int>(n_points) + 1;
+  fast_path.setParameters(parameters);
+  ASSERT_TRUE(fast_path.process(
+    obstacle_ros_pointcloud, transform, footprint, filtered_objects, hull_points));
+  EXPECT_TRUE(hull_points.empty());
+}
+
 }  // namespace autoware::motion::control::autonomous_emergency_braking::test
@@ -0,0 +1,185 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare the construction of the condensed MPC matrices by the formulation of
+// MPC::generateMPCMatrix before MPCMatrixBuilder (dynamic matrices allocated every cycle, block
+// products with temporaries) with MPCMatrixBuilder, for the vehicle models and horizons from 25
+// to 100 steps. Whether both give bitwise the same Aex, Bex and Wex is printed next to the timings.
+
+#include "autoware/mpc_lateral_controller/mpc_matrix_builder.hpp"
+#include "autoware/mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_dynamics.hpp"
+#include "autoware/mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_kinematics.hpp"
+#include "autoware/mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_kinematics_no_delay.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using autoware::motion::control::mpc_lateral_controller::DynamicsBicycleModel;
+using autoware::motion::control::mpc_lateral_controller::KinematicsBicycleModel;
+using autoware::motion::control::mpc_lateral_controller::KinematicsBicycleModelNoDelay;
+using autoware::motion::control::mpc_lateral_controller::MPCMatrix;
+using autoware::motion::control::mpc_lateral_controller::MPCMatrixBuilder;
+using autoware::motion::control::mpc_lateral_controller::VehicleModelInterface;
+using Eigen::MatrixXd;
+
+namespace
+{
+constexpr int nb_iterations = 200;
+
+struct Step
+{
+  MatrixXd Ad;
+  MatrixXd Bd;
+  MatrixXd Wd;
+  MatrixXd Cd;
+  MatrixXd Q;
+  MatrixXd R;
+  MatrixXd Uref;
+};
+
+// a curvy reference at varying speed, with the weights of the default parameters
+std::vector<Step> makeSteps(VehicleModelInterface & model, const int horizon)
+{
+  std::vector<Step> steps;
+  for (int i = 0; i < horizon; ++i) {
+    Step step;
+    step.Ad.resize(model.getDimX(), model.getDimX());
+    step.Bd.resize(model.getDimX(), model.getDimU());
+    step.Wd.resize(model.getDimX(), 1);
+    step.Cd.resize(model.getDimY(), model.getDimX());
+    step.Uref.resize(model.getDimU(), 1);
+    model.setVelocity(8.0 + 2.0 * std::sin(0.05 * i));
+    model.setCurvature(0.02 * std::sin(0.1 * i));
+    model.calculateDiscreteMatrix(step.Ad, step.Bd, step.Cd, step.Wd, 0.1);
+    model.calculateReferenceInput(step.Uref);
+    step.Q = MatrixXd::Zero(model.getDimY(), model.getDimY());
+    step.Q(0, 0) = 0.1;
+    step.Q(1, 1) = 0.0;
+    step.R = MatrixXd::Zero(model.getDimU(), model.getDimU());
+    step.R(0, 0) = 1.0;
+    steps.push_back(step);
+  }
+  return steps;
+}
+
+// the formulation of MPC::generateMPCMatrix before MPCMatrixBuilder
+MPCMatrix buildReference(const std::vector<Step> & steps, const int DIM_U, const int DIM_Y)
+{
+  const int N = static_cast<int>(steps.size());
+  const int DIM_X = static_cast<int>(steps.front().Ad.rows());
+  MPCMatrix m;
+  m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
+  m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
+  m.Wex = MatrixXd::Zero(DIM_X * N, 1);
+  m.Cex = MatrixXd::Zero(DIM_Y * N, DIM_X * N);
+  m.Qex = MatrixXd::Zero(DIM_Y * N, DIM_Y * N);
+  m.R1ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
+  m.R2ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
+  m.Uref_ex = MatrixXd::Zero(DIM_U * N, 1);
+  for (int i = 0; i < N; ++i) {
+    const auto & [Ad, Bd, Wd, Cd, Q, R, Uref] = steps[i];
+    const int idx_x_i = i * DIM_X;
+    const int idx_u_i = i * DIM_U;
+    const int idx_y_i = i * DIM_Y;
+    if (i == 0) {
+      m.Aex.block(0, 0, DIM_X, DIM_X) = Ad;
+      m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
+      m.Wex.block(0, 0, DIM_X, 1) = Wd;
+    } else {
+      const int idx_x_i_prev = (i - 1) * DIM_X;
+      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
+      for (int j = 0; j < i; ++j) {
+        const int idx_u_j = j * DIM_U;
+        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
+          Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
+      }
+      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
+    }
+    m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
+    m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
+    m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q;
+    m.R1ex.block(idx_u_i, idx_u_i, DIM_U, DIM_U) = R;
+    m.Uref_ex.block(idx_u_i, 0, DIM_U, 1) = Uref;
+  }
+  return m;
+}
+
+template <typename F>
+double averageMs(F && f)
+{
+  double total_ms = 0.0;
+  for (int i = 0; i <= nb_iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    if (i > 0) {  // the first run is a warm-up
+      total_ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+  }
+  return total_ms / nb_iterations;
+}
+
+void run(const std::string & name, VehicleModelInterface & model)
+{
+  const int dim_u = model.getDimU();
+  const int dim_y = model.getDimY();
+  std::cout << name << " (" << model.getDimX() << " states)\n";
+  for (const int horizon : {25, 50, 75, 100}) {
+    const auto steps = makeSteps(model, horizon);
+
+    MPCMatrix reference;
+    const double reference_ms =
+      averageMs([&]() { reference = buildReference(steps, dim_u, dim_y); });
+
+    MPCMatrixBuilder builder;
+    MPCMatrix * built = nullptr;
+    const double builder_ms = averageMs([&]() {
+      builder.reset(horizon, model.getDimX(), dim_u, dim_y);
+      for (int i = 0; i < horizon; ++i) {
+        const auto & [Ad, Bd, Wd, Cd, Q, R, Uref] = steps[i];
+        builder.setStep(i, Ad, Bd, Wd, Cd, Q, R, Uref);
+      }
+      built = &builder.build();
+    });
+
+    const bool identical = built->Aex == reference.Aex && built->Bex == reference.Bex &&
+                           built->Wex == reference.Wex && built->Cex == reference.Cex &&
+                           built->Qex == reference.Qex && built->R1ex == reference.R1ex &&
+                           built->Uref_ex == reference.Uref_ex;
+    const double max_difference = std::max(
+      {(built->Aex - reference.Aex).cwiseAbs().maxCoeff(),
+       (built->Bex - reference.Bex).cwiseAbs().maxCoeff(),
+       (built->Wex - reference.Wex).cwiseAbs().maxCoeff()});
+    std::cout << "  N = " << horizon << ": reference " << reference_ms << " ms, builder "
+              << builder_ms << " ms (x" << reference_ms / builder_ms
+              << "), identical: " << (identical ? "yes" : "NO")
+              << ", max difference: " << max_difference << "\n";
+  }
+}
+}  // namespace
+
+int main()
+{
+  KinematicsBicycleModel kinematics(2.79, 0.7, 0.27);
+  KinematicsBicycleModelNoDelay kinematics_no_delay(2.79, 0.7);
+  DynamicsBicycleModel dynamics(2.79, 600.0, 600.0, 600.0, 600.0, 155494.663, 155494.663);
+  run("kinematics", kinematics);
+  run("kinematics_no_delay", kinematics_no_delay);
+  run("dynamics", dynamics);
+  return 0;
+}
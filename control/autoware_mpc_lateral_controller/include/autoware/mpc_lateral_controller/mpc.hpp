@@ -16,6 +16,7 @@
 #define AUTOWARE__MPC_LATERAL_CONTROLLER__MPC_HPP_
 
 #include "autoware/mpc_lateral_controller/lowpass_filter.hpp"
+#include "autoware/mpc_lateral_controller/mpc_matrix_builder.hpp"
 #include "autoware/mpc_lateral_controller/mpc_trajectory.hpp"
 #include "autoware/mpc_lateral_controller/qp_solver/qp_solver_interface.hpp"
 #include "autoware/mpc_lateral_controller/steering_predictor.hpp"
@@ -171,26 +172,6 @@ struct MPCData
   MPCData() = default;
 };
 
-/**
- * MPC matrix with the following format:
- * Xex = Aex * X0 + Bex * Uex * Wex
- * Yex = Cex * Xex
- * Cost = Xex' * Qex * Xex + (Uex - Uref_ex)' * R1ex * (Uex - Uref_ex) +  Uex' * R2ex * Uex
- */
-struct MPCMatrix
-{
-  MatrixXd Aex;
-  MatrixXd Bex;
-  MatrixXd Wex;
-  MatrixXd Cex;
-  MatrixXd Qex;
-  MatrixXd R1ex;
-  MatrixXd R2ex;
-  MatrixXd Uref_ex;
-
-  MPCMatrix() = default;
-};
-
 struct ResultWithReason
 {
   bool result{false};
@@ -227,6 +208,9 @@ private:
 
   bool m_is_forward_shift = true;  // Flag indicating if the shift is in the forward direction.
 
+  // Builder of the MPC matrix, its matrices are reused while the horizon does not change.
+  MPCMatrixBuilder m_mpc_matrix_builder;
+
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_frenet_predicted_trajectory_pub;
   rclcpp::Publisher<Trajectory>::SharedPtr m_debug_resampled_reference_trajectory_pub;
   /**
@@ -261,9 +245,9 @@ private:
    * @brief Generate the MPC matrix using the reference trajectory and vehicle model.
    * @param reference_trajectory The reference trajectory used for linearization.
    * @param prediction_dt The prediction time step.
-   * @return The generated MPC matrix.
+   * @return The generated MPC matrix, valid until the next call.
    */
-  MPCMatrix generateMPCMatrix(
+  const MPCMatrix & generateMPCMatrix(
     const MPCTrajectory & reference_trajectory, const double prediction_dt);
 
   /**
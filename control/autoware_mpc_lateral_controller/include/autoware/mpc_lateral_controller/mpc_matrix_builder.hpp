@@ -0,0 +1,95 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__MPC_LATERAL_CONTROLLER__MPC_MATRIX_BUILDER_HPP_
+#define AUTOWARE__MPC_LATERAL_CONTROLLER__MPC_MATRIX_BUILDER_HPP_
+
+#include <Eigen/Core>
+
+namespace autoware::motion::control::mpc_lateral_controller
+{
+
+/**
+ * MPC matrix with the following format:
+ * Xex = Aex * X0 + Bex * Uex * Wex
+ * Yex = Cex * Xex
+ * Cost = Xex' * Qex * Xex + (Uex - Uref_ex)' * R1ex * (Uex - Uref_ex) +  Uex' * R2ex * Uex
+ */
+struct MPCMatrix
+{
+  Eigen::MatrixXd Aex;
+  Eigen::MatrixXd Bex;
+  Eigen::MatrixXd Wex;
+  Eigen::MatrixXd Cex;
+  Eigen::MatrixXd Qex;
+  Eigen::MatrixXd R1ex;
+  Eigen::MatrixXd R2ex;
+  Eigen::MatrixXd Uref_ex;
+
+  MPCMatrix() = default;
+};
+
+/**
+ * @brief Builder of the condensed MPC matrices from the discrete model and the weights of each
+ * step of the horizon.
+ *
+ * The matrices are allocated only when the horizon or the dimensions change and are reused in the
+ * next cycles. Aex, Bex and Wex are built with the recursion of the prediction: the blocks of the
+ * row i are the ones of the row i - 1 multiplied by Ad_i, so only the block-lower-triangular part
+ * of Bex is computed. The products are done on fixed size blocks for the dimensions of the
+ * vehicle models (2, 3 and 4 states, 1 input).
+ */
+class MPCMatrixBuilder
+{
+public:
+  /**
+   * @brief Prepare the matrices for a new horizon. All the steps have to be set before build().
+   * @param horizon The number of steps of the prediction.
+   * @param dim_x The dimension of the state.
+   * @param dim_u The dimension of the input.
+   * @param dim_y The dimension of the output.
+   */
+  void reset(const int horizon, const int dim_x, const int dim_u, const int dim_y);
+
+  /**
+   * @brief Set the discrete model, the weights and the reference input of the step i.
+   */
+  void setStep(
+    const int i, const Eigen::MatrixXd & Ad, const Eigen::MatrixXd & Bd, const Eigen::MatrixXd & Wd,
+    const Eigen::MatrixXd & Cd, const Eigen::MatrixXd & Q, const Eigen::MatrixXd & R,
+    const Eigen::MatrixXd & Uref);
+
+  /**
+   * @brief Compute Aex, Bex and Wex from the steps.
+   * @return The MPC matrix. It is valid until the next call to reset().
+   */
+  MPCMatrix & build();
+
+private:
+  template <int DIM_X, int DIM_U>
+  void buildPrediction();
+
+  int m_horizon = 0;
+  int m_dim_x = 0;
+  int m_dim_u = 0;
+  int m_dim_y = 0;
+
+  MPCMatrix m_matrix;
+
+  // Ad and Wd of each step, side by side.
+  Eigen::MatrixXd m_Ad_steps;
+  Eigen::MatrixXd m_Wd_steps;
+};
+}  // namespace autoware::motion::control::mpc_lateral_controller
+#endif  // AUTOWARE__MPC_LATERAL_CONTROLLER__MPC_MATRIX_BUILDER_HPP_
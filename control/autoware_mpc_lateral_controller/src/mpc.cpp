@@ -83,7 +83,7 @@ ResultWithReason MPC::calculateMPC(
   }
 
   // generate mpc matrix : predict equation Xec = Aex * x0 + Bex * Uex + Wex
-  const auto mpc_matrix = generateMPCMatrix(mpc_resampled_ref_trajectory, prediction_dt);
+  const auto & mpc_matrix = generateMPCMatrix(mpc_resampled_ref_trajectory, prediction_dt);
 
   // solve Optimization problem
   const auto [opt_result, Uex] = executeOptimization(
@@ -437,7 +437,7 @@ MPCTrajectory MPC::applyVelocityDynamicsFilter(
  * cost function: J = Xex' * Qex * Xex + (Uex - Uref)' * R1ex * (Uex - Uref_ex) + Uex' * R2ex * Uex
  * Qex = diag([Q,Q,...]), R1ex = diag([R,R,...])
  */
-MPCMatrix MPC::generateMPCMatrix(
+const MPCMatrix & MPC::generateMPCMatrix(
   const MPCTrajectory & reference_trajectory, const double prediction_dt)
 {
   const int N = m_param.prediction_horizon;
@@ -446,15 +446,7 @@ MPCMatrix MPC::generateMPCMatrix(
   const int DIM_U = m_vehicle_model_ptr->getDimU();
   const int DIM_Y = m_vehicle_model_ptr->getDimY();
 
-  MPCMatrix m;
-  m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
-  m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
-  m.Wex = MatrixXd::Zero(DIM_X * N, 1);
-  m.Cex = MatrixXd::Zero(DIM_Y * N, DIM_X * N);
-  m.Qex = MatrixXd::Zero(DIM_Y * N, DIM_Y * N);
-  m.R1ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
-  m.R2ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
-  m.Uref_ex = MatrixXd::Zero(DIM_U * N, 1);
+  m_mpc_matrix_builder.reset(N, DIM_X, DIM_U, DIM_Y);
 
   // weight matrix depends on the vehicle model
   MatrixXd Q = MatrixXd::Zero(DIM_Y, DIM_Y);
@@ -500,38 +492,20 @@ MPCMatrix MPC::generateMPCMatrix(
     Q_adaptive(1, 1) += ref_vx_squared * mpc_weight.heading_error_squared_vel;
     R_adaptive(0, 0) += ref_vx_squared * mpc_weight.steering_input_squared_vel;
 
-    // update mpc matrix
-    int idx_x_i = i * DIM_X;
-    int idx_u_i = i * DIM_U;
-    int idx_y_i = i * DIM_Y;
-    if (i == 0) {
-      m.Aex.block(0, 0, DIM_X, DIM_X) = Ad;
-      m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
-      m.Wex.block(0, 0, DIM_X, 1) = Wd;
-    } else {
-      int idx_x_i_prev = (i - 1) * DIM_X;
-      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
-      for (int j = 0; j < i; ++j) {
-        int idx_u_j = j * DIM_U;
-        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
-          Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
-      }
-      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
-    }
-    m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
-    m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
-    m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q_adaptive;
-    m.R1ex.block(idx_u_i, idx_u_i, DIM_U, DIM_U) = R_adaptive;
-
     // get reference input (feed-forward)
     m_vehicle_model_ptr->setCurvature(ref_smooth_k);
     m_vehicle_model_ptr->calculateReferenceInput(Uref);
     if (std::fabs(Uref(0, 0)) < autoware_utils::deg2rad(m_param.zero_ff_steer_deg)) {
       Uref(0, 0) = 0.0;  // ignore curvature noise
     }
-    m.Uref_ex.block(i * DIM_U, 0, DIM_U, 1) = Uref;
+
+    // update mpc matrix
+    m_mpc_matrix_builder.setStep(i, Ad, Bd, Wd, Cd, Q_adaptive, R_adaptive, Uref);
   }
 
+  // predict equation from the steps
+  MPCMatrix & m = m_mpc_matrix_builder.build();
+
   // add lateral jerk : weight for (v * {u(i) - u(i-1)} )^2
   for (int i = 0; i < N - 1; ++i) {
     const double ref_vx = reference_trajectory.vx.at(i);
@@ -0,0 +1,142 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/mpc_lateral_controller/mpc_matrix_builder.hpp"
+
+namespace autoware::motion::control::mpc_lateral_controller
+{
+using Eigen::MatrixXd;
+
+void MPCMatrixBuilder::reset(const int horizon, const int dim_x, const int dim_u, const int dim_y)
+{
+  const int N = horizon;
+  auto & m = m_matrix;
+  if (horizon == m_horizon && dim_x == m_dim_x && dim_u == m_dim_u && dim_y == m_dim_y) {
+    // Only the diagonal blocks of Cex, Qex and the lower blocks of Bex are set by the steps, the
+    // other blocks are still zero. The weights added on R1ex and R2ex after build() are cleared.
+    m.R1ex.setZero();
+    m.R2ex.setZero();
+    return;
+  }
+
+  m_horizon = horizon;
+  m_dim_x = dim_x;
+  m_dim_u = dim_u;
+  m_dim_y = dim_y;
+  m.Aex = MatrixXd::Zero(dim_x * N, dim_x);
+  m.Bex = MatrixXd::Zero(dim_x * N, dim_u * N);
+  m.Wex = MatrixXd::Zero(dim_x * N, 1);
+  m.Cex = MatrixXd::Zero(dim_y * N, dim_x * N);
+  m.Qex = MatrixXd::Zero(dim_y * N, dim_y * N);
+  m.R1ex = MatrixXd::Zero(dim_u * N, dim_u * N);
+  m.R2ex = MatrixXd::Zero(dim_u * N, dim_u * N);
+  m.Uref_ex = MatrixXd::Zero(dim_u * N, 1);
+  m_Ad_steps = MatrixXd::Zero(dim_x, dim_x * N);
+  m_Wd_steps = MatrixXd::Zero(dim_x, N);
+}
+
+void MPCMatrixBuilder::setStep(
+  const int i, const MatrixXd & Ad, const MatrixXd & Bd, const MatrixXd & Wd, const MatrixXd & Cd,
+  const MatrixXd & Q, const MatrixXd & R, const MatrixXd & Uref)
+{
+  auto & m = m_matrix;
+  const int idx_x_i = i * m_dim_x;
+  const int idx_u_i = i * m_dim_u;
+  const int idx_y_i = i * m_dim_y;
+  m_Ad_steps.middleCols(idx_x_i, m_dim_x) = Ad;
+  m_Wd_steps.col(i) = Wd;
+  m.Bex.block(idx_x_i, idx_u_i, m_dim_x, m_dim_u) = Bd;
+  m.Cex.block(idx_y_i, idx_x_i, m_dim_y, m_dim_x) = Cd;
+  m.Qex.block(idx_y_i, idx_y_i, m_dim_y, m_dim_y) = Q;
+  m.R1ex.block(idx_u_i, idx_u_i, m_dim_u, m_dim_u) = R;
+  m.Uref_ex.block(idx_u_i, 0, m_dim_u, 1) = Uref;
+}
+
+MPCMatrix & MPCMatrixBuilder::build()
+{
+  if (m_dim_u == 1 && m_dim_x == 2) {
+    buildPrediction<2, 1>();  // kinematics without delay
+  } else if (m_dim_u == 1 && m_dim_x == 3) {
+    buildPrediction<3, 1>();  // kinematics
+  } else if (m_dim_u == 1 && m_dim_x == 4) {
+    buildPrediction<4, 1>();  // dynamics
+  } else {
+    buildPrediction<Eigen::Dynamic, Eigen::Dynamic>();
+  }
+  return m_matrix;
+}
+
+namespace
+{
+/*
+ * dst = lhs * rhs, with the sums in the order of the inner index like the lazy product of the
+ * dynamic matrices. The unrolled fixed size product sums in another order, so the result would
+ * differ in the last bits from the unstructured formulation.
+ */
+template <typename Lhs, typename Rhs, typename Dst>
+void multiplyInOrder(const Lhs & lhs, const Rhs & rhs, Dst && dst)
+{
+  for (Eigen::Index col = 0; col < rhs.cols(); ++col) {
+    for (Eigen::Index row = 0; row < lhs.rows(); ++row) {
+      double sum = lhs(row, 0) * rhs(0, col);
+      for (Eigen::Index k = 1; k < lhs.cols(); ++k) {
+        sum += lhs(row, k) * rhs(k, col);
+      }
+      dst(row, col) = sum;
+    }
+  }
+}
+}  // namespace
+
+/*
+ * Aex_i = Ad_i * Aex_{i-1}
+ * Bex_ij = Ad_i * Bex_{i-1,j} (j < i), Bex_ii = Bd_i
+ * Wex_i = Ad_i * Wex_{i-1} + Wd_i
+ */
+template <int DIM_X, int DIM_U>
+void MPCMatrixBuilder::buildPrediction()
+{
+  const int N = m_horizon;
+  const int dim_x = m_dim_x;
+  const int dim_u = m_dim_u;
+  auto & m = m_matrix;
+  if (N == 0) {
+    return;
+  }
+
+  m.Aex.template block<DIM_X, DIM_X>(0, 0, dim_x, dim_x) =
+    m_Ad_steps.template block<DIM_X, DIM_X>(0, 0, dim_x, dim_x);
+  m.Wex.template block<DIM_X, 1>(0, 0, dim_x, 1) =
+    m_Wd_steps.template block<DIM_X, 1>(0, 0, dim_x, 1);
+  for (int i = 1; i < N; ++i) {
+    const Eigen::Matrix<double, DIM_X, DIM_X> Ad =
+      m_Ad_steps.template block<DIM_X, DIM_X>(0, i * dim_x, dim_x, dim_x);
+    const int idx_x_i = i * dim_x;
+    const int idx_x_i_prev = (i - 1) * dim_x;
+    multiplyInOrder(
+      Ad, m.Aex.template block<DIM_X, DIM_X>(idx_x_i_prev, 0, dim_x, dim_x),
+      m.Aex.template block<DIM_X, DIM_X>(idx_x_i, 0, dim_x, dim_x));
+    for (int j = 0; j < i; ++j) {
+      const int idx_u_j = j * dim_u;
+      multiplyInOrder(
+        Ad, m.Bex.template block<DIM_X, DIM_U>(idx_x_i_prev, idx_u_j, dim_x, dim_u),
+        m.Bex.template block<DIM_X, DIM_U>(idx_x_i, idx_u_j, dim_x, dim_u));
+    }
+    auto Wex_i = m.Wex.template block<DIM_X, 1>(idx_x_i, 0, dim_x, 1);
+    multiplyInOrder(Ad, m.Wex.template block<DIM_X, 1>(idx_x_i_prev, 0, dim_x, 1), Wex_i);
+    Wex_i += m_Wd_steps.template block<DIM_X, 1>(0, i, dim_x, 1);
+  }
+}
+
+}  // namespace autoware::motion::control::mpc_lateral_controller
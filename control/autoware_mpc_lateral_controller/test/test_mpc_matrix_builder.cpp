@@ -0,0 +1,166 @@
+// Copyright 2025 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/mpc_lateral_controller/mpc_matrix_builder.hpp"
+#include "autoware/mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_dynamics.hpp"
+#include "autoware/mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_kinematics.hpp"
+#include "autoware/mpc_lateral_controller/vehicle_model/vehicle_model_bicycle_kinematics_no_delay.hpp"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using autoware::motion::control::mpc_lateral_controller::DynamicsBicycleModel;
+using autoware::motion::control::mpc_lateral_controller::KinematicsBicycleModel;
+using autoware::motion::control::mpc_lateral_controller::KinematicsBicycleModelNoDelay;
+using autoware::motion::control::mpc_lateral_controller::MPCMatrix;
+using autoware::motion::control::mpc_lateral_controller::MPCMatrixBuilder;
+using autoware::motion::control::mpc_lateral_controller::VehicleModelInterface;
+using Eigen::MatrixXd;
+
+struct Step
+{
+  MatrixXd Ad;
+  MatrixXd Bd;
+  MatrixXd Wd;
+  MatrixXd Cd;
+  MatrixXd Q;
+  MatrixXd R;
+  MatrixXd Uref;
+};
+
+std::vector<Step> makeSteps(VehicleModelInterface & model, const int horizon, const double phase)
+{
+  std::vector<Step> steps;
+  for (int i = 0; i < horizon; ++i) {
+    Step step;
+    step.Ad.resize(model.getDimX(), model.getDimX());
+    step.Bd.resize(model.getDimX(), model.getDimU());
+    step.Wd.resize(model.getDimX(), 1);
+    step.Cd.resize(model.getDimY(), model.getDimX());
+    step.Uref.resize(model.getDimU(), 1);
+    model.setVelocity(5.0 + 3.0 * std::sin(0.1 * i + phase));
+    model.setCurvature(0.05 * std::cos(0.2 * i + phase));
+    model.calculateDiscreteMatrix(step.Ad, step.Bd, step.Cd, step.Wd, 0.1);
+    model.calculateReferenceInput(step.Uref);
+    step.Q = MatrixXd::Identity(model.getDimY(), model.getDimY()) * (1.0 + i);
+    step.R = MatrixXd::Identity(model.getDimU(), model.getDimU()) * (2.0 + i);
+    steps.push_back(step);
+  }
+  return steps;
+}
+
+// the formulation of MPC::generateMPCMatrix before the builder
+MPCMatrix buildReference(const std::vector<Step> & steps, const int dim_u, const int dim_y)
+{
+  const int N = static_cast<int>(steps.size());
+  const int DIM_X = static_cast<int>(steps.front().Ad.rows());
+  const int DIM_U = dim_u;
+  const int DIM_Y = dim_y;
+  MPCMatrix m;
+  m.Aex = MatrixXd::Zero(DIM_X * N, DIM_X);
+  m.Bex = MatrixXd::Zero(DIM_X * N, DIM_U * N);
+  m.Wex = MatrixXd::Zero(DIM_X * N, 1);
+  m.Cex = MatrixXd::Zero(DIM_Y * N, DIM_X * N);
+  m.Qex = MatrixXd::Zero(DIM_Y * N, DIM_Y * N);
+  m.R1ex = MatrixXd::Zero(DIM_U * N, DIM_U * N);
+  m.Uref_ex = MatrixXd::Zero(DIM_U * N, 1);
+  for (int i = 0; i < N; ++i) {
+    const auto & [Ad, Bd, Wd, Cd, Q, R, Uref] = steps.at(i);
+    const int idx_x_i = i * DIM_X;
+    const int idx_u_i = i * DIM_U;
+    const int idx_y_i = i * DIM_Y;
+    if (i == 0) {
+      m.Aex.block(0, 0, DIM_X, DIM_X) = Ad;
+      m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
+      m.Wex.block(0, 0, DIM_X, 1) = Wd;
+    } else {
+      const int idx_x_i_prev = (i - 1) * DIM_X;
+      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
+      for (int j = 0; j < i; ++j) {
+        const int idx_u_j = j * DIM_U;
+        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
+          Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
+      }
+      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
+    }
+    m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
+    m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
+    m.Qex.block(idx_y_i, idx_y_i, DIM_Y, DIM_Y) = Q;
+    m.R1ex.block(idx_u_i, idx_u_i, DIM_U, DIM_U) = R;
+    m.Uref_ex.block(idx_u_i, 0, DIM_U, 1) = Uref;
+  }
+  return m;
+}
+
+const MPCMatrix & buildWithBuilder(
+  MPCMatrixBuilder & builder, const std::vector<Step> & steps, const int dim_u, const int dim_y)
+{
+  const int N = static_cast<int>(steps.size());
+  builder.reset(N, static_cast<int>(steps.front().Ad.rows()), dim_u, dim_y);
+  for (int i = 0; i < N; ++i) {
+    const auto & [Ad, Bd, Wd, Cd, Q, R, Uref] = steps.at(i);
+    builder.setStep(i, Ad, Bd, Wd, Cd, Q, R, Uref);
+  }
+  return builder.build();
+}
+
+void expectSameMatrix(const MPCMatrix & a, const MPCMatrix & b)
+{
+  // The sums are done in the same order. The tolerance is only for the compilers contracting the
+  // products into fused multiply-adds differently.
+  constexpr double eps = 1.0e-12;
+  EXPECT_TRUE(a.Aex.isApprox(b.Aex, eps));
+  EXPECT_TRUE(a.Bex.isApprox(b.Bex, eps));
+  EXPECT_TRUE(a.Wex.isApprox(b.Wex, eps));
+  EXPECT_EQ(a.Cex, b.Cex);
+  EXPECT_EQ(a.Qex, b.Qex);
+  EXPECT_EQ(a.R1ex, b.R1ex);
+  EXPECT_EQ(a.Uref_ex, b.Uref_ex);
+}
+
+void testModel(VehicleModelInterface & model)
+{
+  MPCMatrixBuilder builder;
+  for (const int horizon : {1, 2, 50, 50, 25}) {
+    // the same horizon twice to check that the reused matrices are reset
+    const auto steps = makeSteps(model, horizon, 0.1 * horizon);
+    const auto & matrix = buildWithBuilder(builder, steps, model.getDimU(), model.getDimY());
+    expectSameMatrix(matrix, buildReference(steps, model.getDimU(), model.getDimY()));
+    // the weights added on the built matrix do not remain in the next cycle
+    builder.build().R1ex.setOnes();
+  }
+}
+}  // namespace
+
+TEST(TestMPCMatrixBuilder, KinematicsBicycleModel)
+{
+  KinematicsBicycleModel model(2.7, 0.6, 0.1);
+  testModel(model);
+}
+
+TEST(TestMPCMatrixBuilder, KinematicsBicycleModelNoDelay)
+{
+  KinematicsBicycleModelNoDelay model(2.7, 0.6);
+  testModel(model);
+}
+
+TEST(TestMPCMatrixBuilder, DynamicsBicycleModel)
+{
+  DynamicsBicycleModel model(2.7, 600.0, 600.0, 600.0, 600.0, 155494.663, 155494.663);
+  testModel(model);
+}
@@ -406,7 +406,7 @@ class transform_model_to_c:
         self.pred_only_state = self.transform.rotated_error_prediction
         self.pred_with_diff = self.transform.rot_and_d_rot_error_prediction_with_diff
         self.pred_with_poly_diff = self.transform.rot_and_d_rot_error_prediction_with_poly_diff
-        self.Pred = self.transform.Rotated_error_prediction
+        self.Pred = self.transform.Rotated_error_prediction_batch
 
 
 class transform_model_with_memory_to_c:
@@ -468,5 +468,5 @@ class transform_model_with_memory_to_c:
         self.pred_with_diff = self.transform.rot_and_d_rot_error_prediction_with_diff
         self.pred_with_memory_diff = self.transform.rot_and_d_rot_error_prediction_with_memory_diff
         self.pred_with_poly_diff = self.transform.rot_and_d_rot_error_prediction_with_poly_diff
-        self.Pred = self.transform.Rotated_error_prediction
+        self.Pred = self.transform.Rotated_error_prediction_batch
         self.test_lstm = self.transform.error_prediction
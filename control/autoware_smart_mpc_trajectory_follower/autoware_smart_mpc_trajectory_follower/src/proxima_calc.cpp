@@ -20,6 +20,7 @@
 #include <pybind11/pybind11.h>
 
 #include <algorithm>
+#include <array>
 #include <iostream>
 #include <vector>
 namespace py = pybind11;
@@ -145,6 +146,139 @@ Eigen::MatrixXd get_polynomial_features_with_diff(
   }
   return result;
 }
+
+/*
+Batched counterparts of the functions above, used to evaluate the error model on many states per
+call. The columns of the matrices are the samples of the batch and the results are written to
+preallocated matrices, which are only reallocated when the batch size changes.
+The dimension of the input of the polynomial regression and of the error are fixed.
+*/
+constexpr int polynomial_reg_input_dim = 9;
+using PolynomialRegInputBatch = Eigen::Matrix<double, polynomial_reg_input_dim, Eigen::Dynamic>;
+using PolynomialFeaturesWithDiff =
+  Eigen::Matrix<double, Eigen::Dynamic, polynomial_reg_input_dim + 1>;
+using ErrorBatch = Eigen::Matrix<double, 6, Eigen::Dynamic>;
+
+void linear_relu_batch(
+  const Eigen::MatrixXd & weight, const Eigen::VectorXd & bias,
+  const Eigen::Ref<const Eigen::MatrixXd> & input, Eigen::MatrixXd & u, Eigen::MatrixXd & output)
+{
+  u.noalias() = weight * input;
+  u.colwise() += bias;
+  output = u.cwiseMax(0.0);
+}
+void states_to_vars_batch(const Eigen::MatrixXd & X, Eigen::MatrixXd & vars)
+{
+  const int x_dim = X.rows();
+  vars.resize(x_dim - 3, X.cols());
+  vars.row(0) = X.row(2);
+  vars.row(1) = X.row(4);
+  vars.row(2) = X.row(5);
+  vars.bottomRows(x_dim - 6) = X.bottomRows(x_dim - 6);
+}
+void get_polynomial_features_batch(
+  const PolynomialRegInputBatch & X, const int deg, const int dim, Eigen::MatrixXd & result)
+{
+  constexpr int n_features = polynomial_reg_input_dim;
+  result.resize(dim, X.cols());
+  result.topRows(n_features) = X;
+  if (deg >= 2) {
+    std::array<int, n_features + 1> index{};
+    std::array<int, n_features + 1> new_index{};
+    for (int feature_idx = 0; feature_idx < n_features + 1; feature_idx++) {
+      index[feature_idx] = feature_idx;
+    }
+    int current_idx = n_features;
+    for (int i = 0; i < deg - 1; i++) {
+      const int end = index[n_features];
+      for (int feature_idx = 0; feature_idx < n_features; feature_idx++) {
+        const int start = index[feature_idx];
+        new_index[feature_idx] = current_idx;
+        result.middleRows(current_idx, end - start) =
+          result.middleRows(start, end - start).array().rowwise() * X.row(feature_idx).array();
+        current_idx += end - start;
+      }
+      new_index[n_features] = current_idx;
+      index = new_index;
+    }
+  }
+}
+void get_polynomial_features_with_diff(
+  const Eigen::Matrix<double, polynomial_reg_input_dim, 1> & x, const int deg,
+  PolynomialFeaturesWithDiff & result)
+{
+  constexpr int n_features = polynomial_reg_input_dim;
+  result.setZero();
+  result.block<n_features, 1>(0, 0) = x;
+  result.block<n_features, n_features>(0, 1).setIdentity();
+  if (deg >= 2) {
+    std::array<int, n_features + 1> index{};
+    std::array<int, n_features + 1> new_index{};
+    for (int feature_idx = 0; feature_idx < n_features + 1; feature_idx++) {
+      index[feature_idx] = feature_idx;
+    }
+    int current_idx = n_features;
+    for (int i = 0; i < deg - 1; i++) {
+      const int end = index[n_features];
+      for (int feature_idx = 0; feature_idx < n_features; feature_idx++) {
+        const int start = index[feature_idx];
+        new_index[feature_idx] = current_idx;
+        result.middleRows(current_idx, end - start) =
+          x[feature_idx] * result.middleRows(start, end - start);
+        result.block(current_idx, feature_idx + 1, end - start, 1) +=
+          result.block(start, 0, end - start, 1);
+        current_idx += end - start;
+      }
+      new_index[n_features] = current_idx;
+      index = new_index;
+    }
+  }
+}
+void rotate_error_prediction_batch(
+  const Eigen::MatrixXd & X, const ErrorBatch & pred, ErrorBatch & rot_pred)
+{
+  rot_pred.resize(6, X.cols());
+  for (int i = 0; i < X.cols(); i++) {
+    const double theta = X(3, i);
+    const double v = X(2, i);
+    double coef = 2.0 * std::abs(v);
+    coef = coef * coef * coef * coef * coef * coef * coef;
+    if (coef > 1.0) {
+      coef = 1.0;
+    }
+    const double cos = std::cos(theta);
+    const double sin = std::sin(theta);
+    Eigen::Matrix2d Rot;
+    Rot << cos, -sin, sin, cos;
+    rot_pred.block<2, 1>(0, i) = coef * Rot * pred.block<2, 1>(0, i);
+    rot_pred.block<4, 1>(2, i) = coef * pred.block<4, 1>(2, i);
+  }
+}
+struct error_prediction_batch_workspace
+{
+  Eigen::MatrixXd vars;
+  Eigen::MatrixXd acc_sub, steer_sub, steer_input_full;
+  Eigen::MatrixXd u_acc_layer_1, acc_layer_1, u_steer_layer_1, steer_layer_1;
+  Eigen::MatrixXd u_acc_layer_2, acc_layer_2, u_steer_layer_2, steer_layer_2;
+  Eigen::MatrixXd h1, u2, h2, u3, h3, h4;
+  PolynomialRegInputBatch x_for_polynomial_reg;
+  Eigen::MatrixXd polynomial_features;
+  ErrorBatch y, rot_pred;
+};
+struct error_prediction_diff_workspace
+{
+  // relu masks of the batch, 1 where the pre-activation is non-negative
+  Eigen::MatrixXd mask_acc_layer_1, mask_steer_layer_1, mask_acc_layer_2, mask_steer_layer_2;
+  Eigen::MatrixXd mask_u2, mask_u3;
+  // gradients of the error of one sample
+  ErrorBatch dy_du3, dy_dh2, dy_du2, dy_dh1;
+  ErrorBatch dy_du_acc_layer_2, dy_da1, dy_du_acc_layer_1, dy_d_acc;
+  ErrorBatch dy_du_steer_layer_2, dy_ds1, dy_du_steer_layer_1, dy_d_steer;
+  ErrorBatch d_pred, rot_d_pred;
+  PolynomialFeaturesWithDiff polynomial_features_with_diff;
+  Eigen::Matrix<double, 6, polynomial_reg_input_dim> polynomial_reg_diff;
+  ErrorBatch rot_and_d_rot_pred_with_diff;
+};
 class transform_model_to_eigen
 {
 private:
@@ -177,6 +311,72 @@ private:
   double steer_normalize_{};
   static constexpr double max_acc_error_ = 20.0;
   static constexpr double max_steer_error_ = 20.0;
+  error_prediction_batch_workspace batch_ws_;
+  error_prediction_diff_workspace diff_ws_;
+
+  // error_prediction for the columns of vars, the result is stored in batch_ws_.y
+  void error_prediction_batch(const Eigen::MatrixXd & vars)
+  {
+    auto & ws = batch_ws_;
+    const int batch_size = vars.cols();
+    const int steer_head_size = bias_steer_layer_1_head_.size();
+    const int steer_tail_size = bias_steer_layer_1_tail_.size();
+    ws.acc_sub.resize(acc_ctrl_queue_size_ + 1, batch_size);
+    ws.acc_sub.row(0) = acc_normalize_ * vars.row(1);
+    ws.acc_sub.bottomRows(acc_ctrl_queue_size_) =
+      acc_normalize_ * vars.middleRows(3, acc_ctrl_queue_size_);
+    ws.steer_sub.resize(steer_ctrl_queue_size_core_ + 1, batch_size);
+    ws.steer_sub.row(0) = steer_normalize_ * vars.row(2);
+    ws.steer_sub.bottomRows(steer_ctrl_queue_size_core_) =
+      steer_normalize_ * vars.middleRows(3 + acc_ctrl_queue_size_, steer_ctrl_queue_size_core_);
+    ws.steer_input_full =
+      steer_normalize_ * vars.middleRows(3 + acc_ctrl_queue_size_, steer_ctrl_queue_size_);
+
+    linear_relu_batch(
+      weight_acc_layer_1_, bias_acc_layer_1_, ws.acc_sub, ws.u_acc_layer_1, ws.acc_layer_1);
+    ws.u_steer_layer_1.resize(steer_head_size + steer_tail_size, batch_size);
+    ws.u_steer_layer_1.topRows(steer_head_size).noalias() =
+      weight_steer_layer_1_head_ * ws.steer_sub;
+    ws.u_steer_layer_1.topRows(steer_head_size).colwise() += bias_steer_layer_1_head_;
+    ws.u_steer_layer_1.bottomRows(steer_tail_size).noalias() =
+      weight_steer_layer_1_tail_ * ws.steer_input_full;
+    ws.u_steer_layer_1.bottomRows(steer_tail_size).colwise() += bias_steer_layer_1_tail_;
+    ws.steer_layer_1 = ws.u_steer_layer_1.cwiseMax(0.0);
+    linear_relu_batch(
+      weight_acc_layer_2_, bias_acc_layer_2_, ws.acc_layer_1, ws.u_acc_layer_2, ws.acc_layer_2);
+    linear_relu_batch(
+      weight_steer_layer_2_, bias_steer_layer_2_, ws.steer_layer_1, ws.u_steer_layer_2,
+      ws.steer_layer_2);
+
+    const int acc_size = ws.acc_layer_2.rows();
+    const int steer_size = ws.steer_layer_2.rows();
+    ws.h1.resize(1 + acc_size + steer_size, batch_size);
+    ws.h1.row(0) = vel_normalize_ * vars.row(0);
+    ws.h1.middleRows(1, acc_size) = ws.acc_layer_2;
+    ws.h1.bottomRows(steer_size) = ws.steer_layer_2;
+    linear_relu_batch(weight_linear_relu_1_, bias_linear_relu_1_, ws.h1, ws.u2, ws.h2);
+    linear_relu_batch(weight_linear_relu_2_, bias_linear_relu_2_, ws.h2, ws.u3, ws.h3);
+    const int h3_size = ws.h3.rows();
+    ws.h4.resize(h3_size + acc_size + steer_size, batch_size);
+    ws.h4.topRows(h3_size) = ws.h3;
+    ws.h4.middleRows(h3_size, acc_size) = ws.acc_layer_2;
+    ws.h4.bottomRows(steer_size) = ws.steer_layer_2;
+
+    const int acc_start = 3 + std::max(acc_delay_step_ - 3, 0);
+    const int steer_start = 3 + acc_ctrl_queue_size_ + std::max(steer_delay_step_ - 3, 0);
+    ws.x_for_polynomial_reg.resize(polynomial_reg_input_dim, batch_size);
+    ws.x_for_polynomial_reg.topRows<3>() = vars.topRows(3);
+    ws.x_for_polynomial_reg.middleRows<3>(3) = vars.middleRows(acc_start, 3);
+    ws.x_for_polynomial_reg.bottomRows<3>() = vars.middleRows(steer_start, 3);
+    get_polynomial_features_batch(
+      ws.x_for_polynomial_reg, deg_, A_linear_reg_.cols(), ws.polynomial_features);
+
+    ws.y.noalias() = weight_finalize_ * ws.h4;
+    ws.y.noalias() += A_linear_reg_ * ws.polynomial_features;
+    ws.y.colwise() += bias_linear_finalize_ + b_linear_reg_;
+    ws.y.row(4) = ws.y.row(4).cwiseMax(-max_acc_error_).cwiseMin(max_acc_error_);
+    ws.y.row(5) = ws.y.row(5).cwiseMax(-max_steer_error_).cwiseMin(max_steer_error_);
+  }
 
 public:
   transform_model_to_eigen() {}
@@ -573,6 +773,120 @@ public:
     }
     return Pred;
   }
+  /*
+  Same as Rotated_error_prediction, with the layers evaluated for all the columns of X at once.
+  */
+  const ErrorBatch & Rotated_error_prediction_batch(const Eigen::MatrixXd & X)
+  {
+    states_to_vars_batch(X, batch_ws_.vars);
+    error_prediction_batch(batch_ws_.vars);
+    rotate_error_prediction_batch(X, batch_ws_.y, batch_ws_.rot_pred);
+    return batch_ws_.rot_pred;
+  }
+  /*
+  rot_and_d_rot_error_prediction_with_diff of each column of X. The 6 x (x_dim + 2) result of the
+  i-th column is stored in the columns from i * (x_dim + 2), which can be reshaped to
+  (6, X.cols(), x_dim + 2) in python. The Jacobians are computed by backpropagation from the
+  activations of the batched forward pass.
+  */
+  const ErrorBatch & rot_and_d_rot_error_prediction_with_diff_batch(const Eigen::MatrixXd & X)
+  {
+    const int x_dim = X.rows();
+    const int batch_size = X.cols();
+    auto & ws = batch_ws_;
+    auto & d = diff_ws_;
+    states_to_vars_batch(X, ws.vars);
+    error_prediction_batch(ws.vars);
+
+    d.mask_acc_layer_1 = (ws.u_acc_layer_1.array() >= 0.0).cast<double>();
+    d.mask_steer_layer_1 = (ws.u_steer_layer_1.array() >= 0.0).cast<double>();
+    d.mask_acc_layer_2 = (ws.u_acc_layer_2.array() >= 0.0).cast<double>();
+    d.mask_steer_layer_2 = (ws.u_steer_layer_2.array() >= 0.0).cast<double>();
+    d.mask_u2 = (ws.u2.array() >= 0.0).cast<double>();
+    d.mask_u3 = (ws.u3.array() >= 0.0).cast<double>();
+
+    const int h3_size = ws.h3.rows();
+    const int acc_size = ws.acc_layer_2.rows();
+    const int steer_size = ws.steer_layer_2.rows();
+    const int steer_head_size = bias_steer_layer_1_head_.size();
+    const int steer_tail_size = bias_steer_layer_1_tail_.size();
+    const int acc_start = 3 + std::max(acc_delay_step_ - 3, 0);
+    const int steer_start = 3 + acc_ctrl_queue_size_ + std::max(steer_delay_step_ - 3, 0);
+    d.polynomial_features_with_diff.resize(A_linear_reg_.cols(), polynomial_reg_input_dim + 1);
+    d.dy_d_steer.resize(6, steer_ctrl_queue_size_ + 1);
+    d.d_pred.resize(6, x_dim - 3);
+    d.rot_d_pred.resize(6, x_dim - 3);
+    d.rot_and_d_rot_pred_with_diff.setZero(6, batch_size * (x_dim + 2));
+
+    for (int i = 0; i < batch_size; i++) {
+      d.dy_du3.noalias() = weight_finalize_.leftCols(h3_size) * d.mask_u3.col(i).asDiagonal();
+      d.dy_dh2.noalias() = d.dy_du3.lazyProduct(weight_linear_relu_2_);
+      d.dy_du2.noalias() = d.dy_dh2 * d.mask_u2.col(i).asDiagonal();
+      d.dy_dh1.noalias() = d.dy_du2.lazyProduct(weight_linear_relu_1_);
+
+      d.dy_du_acc_layer_2.noalias() =
+        (d.dy_dh1.middleCols(1, acc_size) + weight_finalize_.middleCols(h3_size, acc_size)) *
+        d.mask_acc_layer_2.col(i).asDiagonal();
+      d.dy_da1.noalias() = d.dy_du_acc_layer_2.lazyProduct(weight_acc_layer_2_);
+      d.dy_du_acc_layer_1.noalias() = d.dy_da1 * d.mask_acc_layer_1.col(i).asDiagonal();
+      d.dy_d_acc.noalias() = d.dy_du_acc_layer_1.lazyProduct(weight_acc_layer_1_);
+
+      d.dy_du_steer_layer_2.noalias() =
+        (d.dy_dh1.middleCols(1 + acc_size, steer_size) +
+         weight_finalize_.middleCols(h3_size + acc_size, steer_size)) *
+        d.mask_steer_layer_2.col(i).asDiagonal();
+      d.dy_ds1.noalias() = d.dy_du_steer_layer_2.lazyProduct(weight_steer_layer_2_);
+      d.dy_du_steer_layer_1.noalias() = d.dy_ds1 * d.mask_steer_layer_1.col(i).asDiagonal();
+      d.dy_d_steer.setZero();
+      d.dy_d_steer.rightCols(steer_ctrl_queue_size_).noalias() +=
+        d.dy_du_steer_layer_1.rightCols(steer_tail_size) * weight_steer_layer_1_tail_;
+      d.dy_d_steer.leftCols(steer_ctrl_queue_size_core_ + 1).noalias() +=
+        d.dy_du_steer_layer_1.leftCols(steer_head_size) * weight_steer_layer_1_head_;
+
+      d.d_pred.setZero();
+      d.d_pred.col(0) = vel_normalize_ * d.dy_dh1.col(0);
+      d.d_pred.col(1) = acc_normalize_ * d.dy_d_acc.col(0);
+      d.d_pred.col(2) = steer_normalize_ * d.dy_d_steer.col(0);
+      d.d_pred.middleCols(3, acc_ctrl_queue_size_) =
+        acc_normalize_ * d.dy_d_acc.rightCols(acc_ctrl_queue_size_);
+      d.d_pred.middleCols(3 + acc_ctrl_queue_size_, steer_ctrl_queue_size_) =
+        steer_normalize_ * d.dy_d_steer.rightCols(steer_ctrl_queue_size_);
+
+      get_polynomial_features_with_diff(
+        ws.x_for_polynomial_reg.col(i), deg_, d.polynomial_features_with_diff);
+      d.polynomial_reg_diff.noalias() =
+        A_linear_reg_ * d.polynomial_features_with_diff.rightCols<polynomial_reg_input_dim>();
+      d.d_pred.leftCols<3>() += d.polynomial_reg_diff.leftCols<3>();
+      d.d_pred.middleCols<3>(acc_start) += d.polynomial_reg_diff.middleCols<3>(3);
+      d.d_pred.middleCols<3>(steer_start) += d.polynomial_reg_diff.rightCols<3>();
+
+      const double theta = X(3, i);
+      const double v = X(2, i);
+      double coef = 2.0 * std::abs(v);
+      coef = coef * coef * coef * coef * coef * coef * coef;
+      if (coef > 1.0) {
+        coef = 1.0;
+      }
+      const double cos = std::cos(theta);
+      const double sin = std::sin(theta);
+      Eigen::Matrix2d Rot;
+      Rot << cos, -sin, sin, cos;
+      Eigen::Matrix2d dRot;
+      dRot << -sin, -cos, cos, -sin;
+      d.rot_d_pred.topRows<2>().noalias() = Rot * d.d_pred.topRows<2>();
+      d.rot_d_pred.bottomRows<4>() = d.d_pred.bottomRows<4>();
+
+      auto result = d.rot_and_d_rot_pred_with_diff.middleCols(i * (x_dim + 2), x_dim + 2);
+      result.block<2, 1>(0, 0) = coef * (Rot * ws.y.block<2, 1>(0, i));
+      result.block<4, 1>(2, 0) = coef * ws.y.block<4, 1>(2, i);
+      result.block<2, 1>(0, 1) = coef * (dRot * ws.y.block<2, 1>(0, i));
+      result.col(2 + 2) = coef * d.rot_d_pred.col(0);
+      result.col(2 + 4) = coef * d.rot_d_pred.col(1);
+      result.col(2 + 5) = coef * d.rot_d_pred.col(2);
+      result.middleCols(2 + 6, x_dim - 6) = coef * d.rot_d_pred.middleCols(3, x_dim - 6);
+    }
+    return d.rot_and_d_rot_pred_with_diff;
+  }
 };
 class transform_model_with_memory_to_eigen
 {
@@ -615,6 +929,91 @@ private:
   Eigen::MatrixXd H_, C_;
   Eigen::MatrixXd dy_dhc_, dhc_dhc_, dhc_dx_;
   Eigen::MatrixXd dy_dhc_pre_, dhc_dx_pre_;
+  error_prediction_batch_workspace batch_ws_;
+  Eigen::MatrixXd lstm_gates_batch_, linear_relu_1_batch_;
+
+  // error_prediction(vars.col(i), i) for all the columns of vars, the result is stored in
+  // batch_ws_.y and the memory of the candidates H_, C_ is updated
+  void error_prediction_batch(const Eigen::MatrixXd & vars)
+  {
+    auto & ws = batch_ws_;
+    const int batch_size = vars.cols();
+    const int h_dim = h_.size();
+    const int steer_head_size = bias_steer_layer_1_head_.size();
+    const int steer_tail_size = bias_steer_layer_1_tail_.size();
+    ws.acc_sub.resize(acc_ctrl_queue_size_ + 1, batch_size);
+    ws.acc_sub.row(0) = acc_normalize_ * vars.row(1);
+    ws.acc_sub.bottomRows(acc_ctrl_queue_size_) =
+      acc_normalize_ * vars.middleRows(3, acc_ctrl_queue_size_);
+    ws.steer_sub.resize(steer_ctrl_queue_size_core_ + 1, batch_size);
+    ws.steer_sub.row(0) = steer_normalize_ * vars.row(2);
+    ws.steer_sub.bottomRows(steer_ctrl_queue_size_core_) =
+      steer_normalize_ * vars.middleRows(3 + acc_ctrl_queue_size_, steer_ctrl_queue_size_core_);
+    ws.steer_input_full =
+      steer_normalize_ * vars.middleRows(3 + acc_ctrl_queue_size_, steer_ctrl_queue_size_);
+
+    linear_relu_batch(
+      weight_acc_layer_1_, bias_acc_layer_1_, ws.acc_sub, ws.u_acc_layer_1, ws.acc_layer_1);
+    ws.u_steer_layer_1.resize(steer_head_size + steer_tail_size, batch_size);
+    ws.u_steer_layer_1.topRows(steer_head_size).noalias() =
+      weight_steer_layer_1_head_ * ws.steer_sub;
+    ws.u_steer_layer_1.topRows(steer_head_size).colwise() += bias_steer_layer_1_head_;
+    ws.u_steer_layer_1.bottomRows(steer_tail_size).noalias() =
+      weight_steer_layer_1_tail_ * ws.steer_input_full;
+    ws.u_steer_layer_1.bottomRows(steer_tail_size).colwise() += bias_steer_layer_1_tail_;
+    ws.steer_layer_1 = ws.u_steer_layer_1.cwiseMax(0.0);
+    linear_relu_batch(
+      weight_acc_layer_2_, bias_acc_layer_2_, ws.acc_layer_1, ws.u_acc_layer_2, ws.acc_layer_2);
+    linear_relu_batch(
+      weight_steer_layer_2_, bias_steer_layer_2_, ws.steer_layer_1, ws.u_steer_layer_2,
+      ws.steer_layer_2);
+
+    const int acc_size = ws.acc_layer_2.rows();
+    const int steer_size = ws.steer_layer_2.rows();
+    ws.h1.resize(1 + acc_size + steer_size, batch_size);
+    ws.h1.row(0) = vel_normalize_ * vars.row(0);
+    ws.h1.middleRows(1, acc_size) = ws.acc_layer_2;
+    ws.h1.bottomRows(steer_size) = ws.steer_layer_2;
+
+    // the gates i, f, g, o are the consecutive blocks of h_dim rows
+    lstm_gates_batch_.noalias() = weight_lstm_ih_ * ws.h1;
+    lstm_gates_batch_.noalias() += weight_lstm_hh_ * H_;
+    lstm_gates_batch_.colwise() += bias_lstm_ih_ + bias_lstm_hh_;
+    auto gates = lstm_gates_batch_.array();
+    gates.topRows(2 * h_dim) = 0.5 * (0.5 * gates.topRows(2 * h_dim)).tanh() + 0.5;
+    gates.middleRows(2 * h_dim, h_dim) = gates.middleRows(2 * h_dim, h_dim).tanh();
+    gates.bottomRows(h_dim) = 0.5 * (0.5 * gates.bottomRows(h_dim)).tanh() + 0.5;
+    C_.array() = gates.middleRows(h_dim, h_dim) * C_.array() +
+                 gates.topRows(h_dim) * gates.middleRows(2 * h_dim, h_dim);
+    H_.array() = gates.bottomRows(h_dim) * C_.array().tanh();
+
+    linear_relu_batch(
+      weight_linear_relu_1_, bias_linear_relu_1_, ws.h1, ws.u2, linear_relu_1_batch_);
+    ws.h2.resize(h_dim + linear_relu_1_batch_.rows(), batch_size);
+    ws.h2.topRows(h_dim) = H_;
+    ws.h2.bottomRows(linear_relu_1_batch_.rows()) = linear_relu_1_batch_;
+    linear_relu_batch(weight_linear_relu_2_, bias_linear_relu_2_, ws.h2, ws.u3, ws.h3);
+    const int h3_size = ws.h3.rows();
+    ws.h4.resize(h3_size + acc_size + steer_size, batch_size);
+    ws.h4.topRows(h3_size) = ws.h3;
+    ws.h4.middleRows(h3_size, acc_size) = ws.acc_layer_2;
+    ws.h4.bottomRows(steer_size) = ws.steer_layer_2;
+
+    const int acc_start = 3 + std::max(acc_delay_step_ - 3, 0);
+    const int steer_start = 3 + acc_ctrl_queue_size_ + std::max(steer_delay_step_ - 3, 0);
+    ws.x_for_polynomial_reg.resize(polynomial_reg_input_dim, batch_size);
+    ws.x_for_polynomial_reg.topRows<3>() = vars.topRows(3);
+    ws.x_for_polynomial_reg.middleRows<3>(3) = vars.middleRows(acc_start, 3);
+    ws.x_for_polynomial_reg.bottomRows<3>() = vars.middleRows(steer_start, 3);
+    get_polynomial_features_batch(
+      ws.x_for_polynomial_reg, deg_, A_linear_reg_.cols(), ws.polynomial_features);
+
+    ws.y.noalias() = weight_finalize_ * ws.h4;
+    ws.y.noalias() += A_linear_reg_ * ws.polynomial_features;
+    ws.y.colwise() += bias_linear_finalize_ + b_linear_reg_;
+    ws.y.row(4) = ws.y.row(4).cwiseMax(-max_acc_error_).cwiseMin(max_acc_error_);
+    ws.y.row(5) = ws.y.row(5).cwiseMax(-max_steer_error_).cwiseMin(max_steer_error_);
+  }
 
 public:
   transform_model_with_memory_to_eigen() {}
@@ -695,6 +1094,8 @@ public:
   }
   Eigen::VectorXd get_h() const { return h_; }
   Eigen::VectorXd get_c() const { return c_; }
+  Eigen::MatrixXd get_h_for_candidate() const { return H_; }
+  Eigen::MatrixXd get_c_for_candidate() const { return C_; }
   Eigen::MatrixXd get_dy_dhc() const { return dy_dhc_; }
   Eigen::MatrixXd get_dhc_dhc() const { return dhc_dhc_; }
   Eigen::MatrixXd get_dhc_dx() const { return dhc_dx_; }
@@ -1498,6 +1899,17 @@ public:
     }
     return Pred;
   }
+  /*
+  Same as Rotated_error_prediction, with the layers evaluated for all the candidates at once.
+  The memory of the candidates must have been set by set_lstm_for_candidate with X.cols().
+  */
+  const ErrorBatch & Rotated_error_prediction_batch(const Eigen::MatrixXd & X)
+  {
+    states_to_vars_batch(X, batch_ws_.vars);
+    error_prediction_batch(batch_ws_.vars);
+    rotate_error_prediction_batch(X, batch_ws_.y, batch_ws_.rot_pred);
+    return batch_ws_.rot_pred;
+  }
   void update_memory_by_state_history(const Eigen::MatrixXd & X)
   {
     const int X_cols = X.cols();
@@ -1528,7 +1940,12 @@ PYBIND11_MODULE(proxima_calc, m)
       "rot_and_d_rot_error_prediction_with_poly_diff",
       &transform_model_to_eigen::rot_and_d_rot_error_prediction_with_poly_diff)
     .def("rotated_error_prediction", &transform_model_to_eigen::rotated_error_prediction)
-    .def("Rotated_error_prediction", &transform_model_to_eigen::Rotated_error_prediction);
+    .def("Rotated_error_prediction", &transform_model_to_eigen::Rotated_error_prediction)
+    .def(
+      "Rotated_error_prediction_batch", &transform_model_to_eigen::Rotated_error_prediction_batch)
+    .def(
+      "rot_and_d_rot_error_prediction_with_diff_batch",
+      &transform_model_to_eigen::rot_and_d_rot_error_prediction_with_diff_batch);
   py::class_<transform_model_with_memory_to_eigen>(m, "transform_model_with_memory_to_eigen")
     .def(py::init())
     .def("set_params", &transform_model_with_memory_to_eigen::set_params)
@@ -1537,6 +1954,8 @@ PYBIND11_MODULE(proxima_calc, m)
     .def("set_lstm_for_candidate", &transform_model_with_memory_to_eigen::set_lstm_for_candidate)
     .def("get_h", &transform_model_with_memory_to_eigen::get_h)
     .def("get_c", &transform_model_with_memory_to_eigen::get_c)
+    .def("get_h_for_candidate", &transform_model_with_memory_to_eigen::get_h_for_candidate)
+    .def("get_c_for_candidate", &transform_model_with_memory_to_eigen::get_c_for_candidate)
     .def("get_dy_dhc", &transform_model_with_memory_to_eigen::get_dy_dhc)
     .def("get_dhc_dx", &transform_model_with_memory_to_eigen::get_dhc_dx)
     .def("get_dhc_dhc", &transform_model_with_memory_to_eigen::get_dhc_dhc)
@@ -1559,5 +1978,8 @@ PYBIND11_MODULE(proxima_calc, m)
     .def(
       "rotated_error_prediction", &transform_model_with_memory_to_eigen::rotated_error_prediction)
     .def(
-      "Rotated_error_prediction", &transform_model_with_memory_to_eigen::Rotated_error_prediction);
+      "Rotated_error_prediction", &transform_model_with_memory_to_eigen::Rotated_error_prediction)
+    .def(
+      "Rotated_error_prediction_batch",
+      &transform_model_with_memory_to_eigen::Rotated_error_prediction_batch);
 }
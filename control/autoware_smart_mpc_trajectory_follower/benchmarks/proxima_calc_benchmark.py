@@ -0,0 +1,96 @@
+# Copyright 2025 Proxima Technology Inc, TIER IV
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compare the states per second of the error model of proxima_calc one state at a time and batched.
+
+The models are the random models of test/proxima_calc_models.py. Run it in a sourced workspace:
+    python3 benchmarks/proxima_calc_benchmark.py
+"""
+
+from pathlib import Path
+import sys
+import time
+
+import numpy as np
+
+# the random models are shared with the test of the batched API
+sys.path.insert(0, str(Path(__file__).resolve().parents[1] / "test"))
+from proxima_calc_models import create_model  # noqa: E402
+from proxima_calc_models import create_model_with_memory  # noqa: E402
+from proxima_calc_models import hidden_layer_lstm  # noqa: E402
+from proxima_calc_models import prediction_with_diff  # noqa: E402
+from proxima_calc_models import prediction_with_diff_batch  # noqa: E402
+from proxima_calc_models import random_bias  # noqa: E402
+from proxima_calc_models import random_states  # noqa: E402
+
+nb_iterations = 20
+
+
+def average_sec(function, *args):
+    result = function(*args)  # warm up the workspaces
+    start = time.perf_counter()
+    for _ in range(nb_iterations):
+        function(*args)
+    return (time.perf_counter() - start) / nb_iterations, result
+
+
+def report(name, nb_states, before, after):
+    (time_before, result_before), (time_after, result_after) = before, after
+    max_diff = np.max(np.abs(result_before - result_after))
+    print(
+        f"  {name:<24} {nb_states / time_before:12.0f} -> {nb_states / time_after:12.0f} states/s"
+        f" (x{time_before / time_after:.1f}), max diff: {max_diff:.2e}"
+    )
+
+
+def prediction_with_memory(model, states, h, c):
+    model.set_lstm_for_candidate(h, c, states.shape[1])
+    return model.Rotated_error_prediction(states)
+
+
+def prediction_with_memory_batch(model, states, h, c):
+    model.set_lstm_for_candidate(h, c, states.shape[1])
+    return model.Rotated_error_prediction_batch(states)
+
+
+def main():
+    model = create_model()
+    model_with_memory = create_model_with_memory()
+    h = random_bias(hidden_layer_lstm)
+    c = random_bias(hidden_layer_lstm)
+    for nb_states in [10, 100, 1000]:
+        states = random_states(nb_states)
+        print(f"nb_states: {nb_states}")
+        report(
+            "prediction",
+            nb_states,
+            average_sec(model.Rotated_error_prediction, states),
+            average_sec(model.Rotated_error_prediction_batch, states),
+        )
+        report(
+            "prediction with diff",
+            nb_states,
+            average_sec(prediction_with_diff, model, states),
+            average_sec(prediction_with_diff_batch, model, states),
+        )
+        report(
+            "prediction with memory",
+            nb_states,
+            average_sec(prediction_with_memory, model_with_memory, states, h, c),
+            average_sec(prediction_with_memory_batch, model_with_memory, states, h, c),
+        )
+
+
+if __name__ == "__main__":
+    main()
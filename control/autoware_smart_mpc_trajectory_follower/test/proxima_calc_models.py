@@ -0,0 +1,142 @@
+# Copyright 2025 Proxima Technology Inc, TIER IV
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Random models of proxima_calc, shared by the test of the batched API and its benchmark.
+
+The models have the layer sizes of drive_NN with random weights, and the queue sizes, delays and
+normalizations of the parameters of the package.
+"""
+
+from math import comb
+
+from autoware_smart_mpc_trajectory_follower import proxima_calc
+from autoware_smart_mpc_trajectory_follower.scripts import drive_functions
+import numpy as np
+
+dim_steer_layer_1_head = 32
+dim_steer_layer_1_tail = 16
+dim_steer_layer_2 = 8
+dim_acc_layer_1 = 16
+dim_acc_layer_2 = 16
+hidden_layer_sizes = (32, 16)
+hidden_layer_lstm = 64
+deg = 3
+
+rng = np.random.default_rng(0)
+
+
+def random_weight(rows, cols):
+    return rng.uniform(-1.0, 1.0, (rows, cols)) / np.sqrt(cols)
+
+
+def random_bias(size):
+    return rng.uniform(-0.1, 0.1, size)
+
+
+def common_params():
+    acc_queue_size = drive_functions.acc_ctrl_queue_size
+    steer_queue_size = drive_functions.steer_ctrl_queue_size
+    steer_queue_size_core = drive_functions.steer_ctrl_queue_size_core
+    dim_h1 = 1 + dim_acc_layer_2 + dim_steer_layer_2
+    weights = [
+        random_weight(dim_acc_layer_1, acc_queue_size + 1),
+        random_weight(dim_steer_layer_1_head, steer_queue_size_core + 1),
+        random_weight(dim_steer_layer_1_tail, steer_queue_size),
+        random_weight(dim_acc_layer_2, dim_acc_layer_1),
+        random_weight(dim_steer_layer_2, dim_steer_layer_1_head + dim_steer_layer_1_tail),
+    ]
+    biases = [
+        random_bias(dim_acc_layer_1),
+        random_bias(dim_steer_layer_1_head),
+        random_bias(dim_steer_layer_1_tail),
+        random_bias(dim_acc_layer_2),
+        random_bias(dim_steer_layer_2),
+    ]
+    res_params = [
+        0.01 * random_weight(6, comb(9 + deg, deg) - 1),
+        random_bias(6),
+        deg,
+        drive_functions.acc_delay_step,
+        drive_functions.steer_delay_step,
+        acc_queue_size,
+        steer_queue_size,
+        steer_queue_size_core,
+        drive_functions.vel_normalize,
+        drive_functions.acc_normalize,
+        drive_functions.steer_normalize,
+    ]
+    return weights, biases, res_params, dim_h1
+
+
+def create_model():
+    weights, biases, res_params, dim_h1 = common_params()
+    dim_h4 = hidden_layer_sizes[1] + dim_acc_layer_2 + dim_steer_layer_2
+    model = proxima_calc.transform_model_to_eigen()
+    model.set_params(
+        *weights,
+        random_weight(hidden_layer_sizes[0], dim_h1),
+        random_weight(hidden_layer_sizes[1], hidden_layer_sizes[0]),
+        random_weight(6, dim_h4),
+        *biases,
+        random_bias(hidden_layer_sizes[0]),
+        random_bias(hidden_layer_sizes[1]),
+        random_bias(6),
+        *res_params,
+    )
+    return model
+
+
+def create_model_with_memory():
+    weights, biases, res_params, dim_h1 = common_params()
+    dim_h4 = hidden_layer_sizes[1] + dim_acc_layer_2 + dim_steer_layer_2
+    model = proxima_calc.transform_model_with_memory_to_eigen()
+    model.set_params(
+        *weights,
+        random_weight(4 * hidden_layer_lstm, dim_h1),
+        random_weight(4 * hidden_layer_lstm, hidden_layer_lstm),
+        random_weight(hidden_layer_sizes[0], dim_h1),
+        random_weight(hidden_layer_sizes[1], hidden_layer_lstm + hidden_layer_sizes[0]),
+        random_weight(6, dim_h4),
+        *biases,
+        random_bias(4 * hidden_layer_lstm),
+        random_bias(4 * hidden_layer_lstm),
+        random_bias(hidden_layer_sizes[0]),
+        random_bias(hidden_layer_sizes[1]),
+        random_bias(6),
+    )
+    model.set_params_res(*res_params)
+    return model
+
+
+def random_states(nb_states):
+    x_dim = 6 + drive_functions.acc_ctrl_queue_size + drive_functions.steer_ctrl_queue_size
+    states = rng.uniform(-0.5, 0.5, (x_dim, nb_states))
+    states[2] = rng.uniform(0.0, 10.0, nb_states)
+    states[3] = rng.uniform(-np.pi, np.pi, nb_states)
+    return states
+
+
+def prediction_with_diff(model, states):
+    x_dim, nb_states = states.shape
+    result = np.zeros((6, nb_states, x_dim + 2))
+    for i in range(nb_states):
+        result[:, i] = model.rot_and_d_rot_error_prediction_with_diff(states[:, i])
+    return result
+
+
+def prediction_with_diff_batch(model, states):
+    x_dim, nb_states = states.shape
+    return model.rot_and_d_rot_error_prediction_with_diff_batch(states).reshape(
+        6, nb_states, x_dim + 2
+    )
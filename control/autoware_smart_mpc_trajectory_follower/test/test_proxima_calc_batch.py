@@ -0,0 +1,106 @@
+# Copyright 2025 Proxima Technology Inc, TIER IV
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Check that the batched API of proxima_calc gives the same outputs as the per-state API.
+
+The models are the random models of proxima_calc_models.py. The batch sizes change between the
+calls, so that the workspaces of the batched API are reallocated and reused.
+"""
+
+import numpy as np
+from proxima_calc_models import create_model
+from proxima_calc_models import create_model_with_memory
+from proxima_calc_models import hidden_layer_lstm
+from proxima_calc_models import prediction_with_diff
+from proxima_calc_models import prediction_with_diff_batch
+from proxima_calc_models import random_bias
+from proxima_calc_models import random_states
+
+batch_sizes = [1, 7, 100, 7]
+tolerance = 1e-12
+
+
+def states_with_low_speed(nb_states):
+    # the error is scaled down below 0.5 m/s, and the speed of the first state is negative
+    states = random_states(nb_states)
+    states[2, : (nb_states + 1) // 2] = np.linspace(-0.2, 0.6, (nb_states + 1) // 2)
+    return states
+
+
+def test_prediction_batch():
+    model = create_model()
+    for nb_states in batch_sizes:
+        states = states_with_low_speed(nb_states)
+        np.testing.assert_allclose(
+            model.Rotated_error_prediction_batch(states),
+            model.Rotated_error_prediction(states),
+            rtol=0.0,
+            atol=tolerance,
+        )
+
+
+def test_prediction_with_diff_batch():
+    model = create_model()
+    for nb_states in batch_sizes:
+        states = states_with_low_speed(nb_states)
+        np.testing.assert_allclose(
+            prediction_with_diff_batch(model, states),
+            prediction_with_diff(model, states),
+            rtol=0.0,
+            atol=tolerance,
+        )
+
+
+def test_prediction_with_memory_batch():
+    model = create_model_with_memory()
+    h = random_bias(hidden_layer_lstm)
+    c = random_bias(hidden_layer_lstm)
+    for nb_states in batch_sizes:
+        # a rollout of several steps, each step starts from the memory left by the previous one
+        states = [states_with_low_speed(nb_states) for _ in range(3)]
+        model.set_lstm_for_candidate(h, c, nb_states)
+        expected = []
+        for step_states in states:
+            expected.append(
+                (
+                    model.Rotated_error_prediction(step_states),
+                    model.get_h_for_candidate(),
+                    model.get_c_for_candidate(),
+                )
+            )
+
+        model.set_lstm_for_candidate(h, c, nb_states)
+        for step, step_states in enumerate(states):
+            expected_prediction, expected_h, expected_c = expected[step]
+            np.testing.assert_allclose(
+                model.Rotated_error_prediction_batch(step_states),
+                expected_prediction,
+                rtol=0.0,
+                atol=tolerance,
+                err_msg=f"prediction, {nb_states} states, step {step}",
+            )
+            np.testing.assert_allclose(
+                model.get_h_for_candidate(),
+                expected_h,
+                rtol=0.0,
+                atol=tolerance,
+                err_msg=f"h, {nb_states} states, step {step}",
+            )
+            np.testing.assert_allclose(
+                model.get_c_for_candidate(),
+                expected_c,
+                rtol=0.0,
+                atol=tolerance,
+                err_msg=f"c, {nb_states} states, step {step}",
+            )
@@ -87,6 +87,7 @@ class PointcloudMapFilterPipeline:
                         "voxel_size_x": self.voxel_size,
                         "voxel_size_y": self.voxel_size,
                         "voxel_size_z": self.voxel_size,
+                        "num_threads": 1,
                     }
                 ],
                 extra_arguments=[
@@ -452,6 +452,7 @@ class GroundSegmentationPipeline:
                         "voxel_size_x": 0.04,
                         "voxel_size_y": 0.04,
                         "voxel_size_z": 0.08,
+                        "num_threads": 1,
                     }
                 ],
                 extra_arguments=[
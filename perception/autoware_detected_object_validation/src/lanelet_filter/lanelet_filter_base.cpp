@@ -52,6 +52,9 @@ namespace lanelet_filter
 {
 using TriangleMesh = std::vector<std::array<Eigen::Vector3d, 3>>;
 
+// 16M cells of 1 byte, a 4 km x 4 km map at a resolution of 1 m
+constexpr std::size_t max_lanelet_raster_cells = 1 << 24;
+
 template <typename ObjsMsgType, typename ObjMsgType>
 ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::ObjectLaneletFilterBase(
   const std::string & node_name, const rclcpp::NodeOptions & node_options)
@@ -89,6 +92,8 @@ ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::ObjectLaneletFilterBase(
 
   filter_settings_.lanelet_extra_margin =
     declare_parameter<double>("filter_settings.lanelet_extra_margin");
+  filter_settings_.lanelet_raster_resolution =
+    declare_parameter<double>("filter_settings.lanelet_raster_resolution");
   filter_settings_.debug = declare_parameter<bool>("filter_settings.debug");
 
   if (filter_settings_.min_elevation_threshold > filter_settings_.max_elevation_threshold) {
@@ -325,6 +330,41 @@ void ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::mapCallback(
   lanelet_frame_id_ = map_msg->header.frame_id;
   lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr_);
+  buildLaneletIndex();
+}
+
+// index the road lanelets and road shoulder lanelets of the map: a packed R-tree of their
+// polygons and a raster telling for most of the points whether they are on them
+template <typename ObjsMsgType, typename ObjMsgType>
+void ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::buildLaneletIndex()
+{
+  std::vector<BoxAndLanelet> lanelets_with_bbox;
+  std::vector<LaneletRaster::Ring> polygons;
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+    if (
+      !lanelet.hasAttribute(lanelet::AttributeName::Subtype) ||
+      (lanelet.attribute(lanelet::AttributeName::Subtype).value() !=
+         lanelet::AttributeValueString::Road &&
+       lanelet.attribute(lanelet::AttributeName::Subtype).value() != "road_shoulder")) {
+      continue;
+    }
+    auto polygon = getPolygon(lanelet);
+    Box boost_bbox;
+    bg::envelope(polygon, boost_bbox);
+    polygons.emplace_back(polygon.begin(), polygon.end());
+    lanelets_with_bbox.emplace_back(boost_bbox, PolygonAndLanelet{polygon, lanelet});
+  }
+
+  // the range constructor packs the tree
+  lanelet_rtree_ =
+    bgi::rtree<BoxAndLanelet, RtreeAlgo>(lanelets_with_bbox.begin(), lanelets_with_bbox.end());
+  lanelet_raster_.build(
+    polygons, filter_settings_.lanelet_raster_resolution, max_lanelet_raster_cells);
+  if (lanelet_raster_.resolution() > filter_settings_.lanelet_raster_resolution) {
+    RCLCPP_INFO(
+      get_logger(), "The lanelet raster resolution is set to %f m to fit the map.",
+      lanelet_raster_.resolution());
+  }
 }
 
 template <typename ObjsMsgType, typename ObjMsgType>
@@ -352,26 +392,17 @@ void ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::objectCallback(
   }
 
   if (!transformed_objects.objects.empty()) {
-    // calculate convex hull
-    const auto convex_hull = getConvexHull(transformed_objects);
-
-    // get intersected lanelets
-    std::vector<BoxAndLanelet> intersected_lanelets_with_bbox = getIntersectedLanelets(convex_hull);
-
-    // create R-Tree with intersected_lanelets for fast search
-    bgi::rtree<BoxAndLanelet, RtreeAlgo> local_rtree;
-    for (const auto & bbox_and_lanelet : intersected_lanelets_with_bbox) {
-      local_rtree.insert(bbox_and_lanelet);
-    }
-
     if (filter_settings_.debug) {
-      publishDebugMarkers(input_msg->header.stamp, convex_hull, intersected_lanelets_with_bbox);
+      // calculate convex hull and get intersected lanelets
+      const auto convex_hull = getConvexHull(transformed_objects);
+      publishDebugMarkers(
+        input_msg->header.stamp, convex_hull, getIntersectedLanelets(convex_hull));
     }
     // filtering process
     for (size_t index = 0; index < transformed_objects.objects.size(); ++index) {
       const auto & transformed_object = transformed_objects.objects.at(index);
       const auto & input_object = input_msg->objects.at(index);
-      filterObject(transformed_object, input_object, local_rtree, output_object_msg);
+      filterObject(transformed_object, input_object, output_object_msg);
     }
   }
 
@@ -393,12 +424,12 @@ void ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::objectCallback(
 template <typename ObjsMsgType, typename ObjMsgType>
 bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::filterObject(
   const ObjMsgType & transformed_object, const ObjMsgType & input_object,
-  const bgi::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree, ObjsMsgType & output_object_msg)
+  ObjsMsgType & output_object_msg)
 {
   const auto & label = transformed_object.classification.front().label;
   if (filter_target_.isTarget(label)) {
     // no tree, then no intersection
-    if (local_rtree.empty()) {
+    if (lanelet_rtree_.empty()) {
       return false;
     }
 
@@ -416,17 +447,22 @@ bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::filterObject(
       object_polygon = getConvexHullFromObjectFootprint(transformed_object);
     }
 
-    // create a bounding box from polygon for searching the local R-tree
+    bool filter_pass = true;
+    // 1. is polygon overlap with road lanelets or shoulder lanelets
+    if (filter_settings_.lanelet_xy_overlap_filter) {
+      filter_pass = isObjectOverlapLanelets(transformed_object, object_polygon);
+    }
+
+    // create a bounding box from polygon for searching the R-tree
     bg::model::box<bg::model::d2::point_xy<double>> bbox_of_convex_hull;
     bg::envelope(object_polygon, bbox_of_convex_hull);
     std::vector<BoxAndLanelet> candidates;
     // only use the lanelets that intersect with the object's bounding box
-    local_rtree.query(bgi::intersects(bbox_of_convex_hull), std::back_inserter(candidates));
-
-    bool filter_pass = true;
-    // 1. is polygon overlap with road lanelets or shoulder lanelets
-    if (filter_settings_.lanelet_xy_overlap_filter) {
-      filter_pass = isObjectOverlapLanelets(transformed_object, object_polygon, candidates);
+    if (
+      filter_pass &&
+      (filter_settings_.lanelet_direction_filter ||
+       filter_settings_.lanelet_object_elevation_filter)) {
+      lanelet_rtree_.query(bgi::intersects(bbox_of_convex_hull), std::back_inserter(candidates));
     }
 
     // 2. check if objects velocity is the same with the lanelet direction
@@ -530,31 +566,13 @@ std::vector<BoxAndLanelet> ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::get
   // convert convex_hull to a 2D bounding box for searching in the LaneletMap
   bg::model::box<bg::model::d2::point_xy<double>> bbox_of_convex_hull;
   bg::envelope(convex_hull, bbox_of_convex_hull);
-  const lanelet::BoundingBox2d bbox2d(
-    lanelet::BasicPoint2d(
-      bg::get<bg::min_corner, 0>(bbox_of_convex_hull),
-      bg::get<bg::min_corner, 1>(bbox_of_convex_hull)),
-    lanelet::BasicPoint2d(
-      bg::get<bg::max_corner, 0>(bbox_of_convex_hull),
-      bg::get<bg::max_corner, 1>(bbox_of_convex_hull)));
-
-  const lanelet::Lanelets candidate_lanelets = lanelet_map_ptr_->laneletLayer.search(bbox2d);
-  for (const auto & lanelet : candidate_lanelets) {
-    // only check the road lanelets and road shoulder lanelets
-    if (
-      lanelet.hasAttribute(lanelet::AttributeName::Subtype) &&
-      (lanelet.attribute(lanelet::AttributeName::Subtype).value() ==
-         lanelet::AttributeValueString::Road ||
-       lanelet.attribute(lanelet::AttributeName::Subtype).value() == "road_shoulder")) {
-      if (bg::intersects(convex_hull, lanelet.polygon2d().basicPolygon())) {
-        // create bbox using boost for making the R-tree in later phase
-        auto polygon = getPolygon(lanelet);
-        Box boost_bbox;
-        bg::envelope(polygon, boost_bbox);
-
-        intersected_lanelets_with_bbox.emplace_back(
-          std::make_pair(boost_bbox, PolygonAndLanelet{polygon, lanelet}));
-      }
+
+  // the R-tree only has the road lanelets and road shoulder lanelets
+  std::vector<BoxAndLanelet> candidates;
+  lanelet_rtree_.query(bgi::intersects(bbox_of_convex_hull), std::back_inserter(candidates));
+  for (const auto & candidate : candidates) {
+    if (bg::intersects(convex_hull, candidate.second.lanelet.polygon2d().basicPolygon())) {
+      intersected_lanelets_with_bbox.push_back(candidate);
     }
   }
 
@@ -584,21 +602,17 @@ lanelet::BasicPolygon2d ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::getPol
 
 template <typename ObjsMsgType, typename ObjMsgType>
 bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isObjectOverlapLanelets(
-  const ObjMsgType & object, const Polygon2d & polygon,
-  const std::vector<BoxAndLanelet> & lanelet_candidates)
+  const ObjMsgType & object, const Polygon2d & polygon)
 {
   // if object has bounding box, use polygon overlap
   if (utils::hasBoundingBox(object)) {
-    return isPolygonOverlapLanelets(polygon, lanelet_candidates);
+    return isPolygonOverlapLanelets(polygon);
   } else {
     for (const auto & point : object.shape.footprint.points) {
       const geometry_msgs::msg::Point32 point_transformed =
         autoware_utils::transform_point(point, object.kinematics.pose_with_covariance.pose);
-
-      for (const auto & candidate : lanelet_candidates) {
-        if (isInPolygon(point_transformed.x, point_transformed.y, candidate.second.polygon, 0.0)) {
-          return true;
-        }
+      if (isPointOnLanelets(point_transformed.x, point_transformed.y)) {
+        return true;
       }
     }
     return false;
@@ -607,8 +621,25 @@ bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isObjectOverlapLanelets(
 
 template <typename ObjsMsgType, typename ObjMsgType>
 bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isPolygonOverlapLanelets(
-  const Polygon2d & polygon, const std::vector<BoxAndLanelet> & lanelet_candidates)
+  const Polygon2d & polygon)
 {
+  // a vertex in a road cell is inside a lanelet
+  for (const auto & point : polygon.outer()) {
+    if (lanelet_raster_.at(point.x(), point.y()) == LaneletRaster::Cell::ROAD) {
+      return true;
+    }
+  }
+
+  bg::model::box<bg::model::d2::point_xy<double>> bbox;
+  bg::envelope(polygon, bbox);
+  const auto & min_corner = bbox.min_corner();
+  const auto & max_corner = bbox.max_corner();
+  if (lanelet_raster_.isNotRoad(min_corner.x(), min_corner.y(), max_corner.x(), max_corner.y())) {
+    return false;
+  }
+
+  std::vector<BoxAndLanelet> lanelet_candidates;
+  lanelet_rtree_.query(bgi::intersects(bbox), std::back_inserter(lanelet_candidates));
   for (const auto & box_and_lanelet : lanelet_candidates) {
     if (!bg::disjoint(polygon, box_and_lanelet.second.polygon)) {
       return true;
@@ -618,6 +649,30 @@ bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isPolygonOverlapLanelets(
   return false;
 }
 
+template <typename ObjsMsgType, typename ObjMsgType>
+bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isPointOnLanelets(
+  const double x, const double y)
+{
+  switch (lanelet_raster_.at(x, y)) {
+    case LaneletRaster::Cell::ROAD:
+      return true;
+    case LaneletRaster::Cell::NOT_ROAD:
+      return false;
+    default:
+      break;
+  }
+
+  // the point is near the edge of a lanelet
+  std::vector<BoxAndLanelet> lanelet_candidates;
+  lanelet_rtree_.query(bgi::intersects(Point2d(x, y)), std::back_inserter(lanelet_candidates));
+  for (const auto & candidate : lanelet_candidates) {
+    if (isInPolygon(x, y, candidate.second.polygon, 0.0)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 template <typename ObjsMsgType, typename ObjMsgType>
 bool ObjectLaneletFilterBase<ObjsMsgType, ObjMsgType>::isSameDirectionWithLanelets(
   const ObjMsgType & object, const std::vector<BoxAndLanelet> & lanelet_candidates)
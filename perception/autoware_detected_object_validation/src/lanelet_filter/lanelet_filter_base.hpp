@@ -16,6 +16,7 @@
 #define LANELET_FILTER__LANELET_FILTER_BASE_HPP_
 
 #include "autoware/detected_object_validation/utils/utils.hpp"
+#include "lanelet_raster.hpp"
 #include "autoware_lanelet2_extension/utility/utilities.hpp"
 #include "autoware_utils/geometry/geometry.hpp"
 #include "autoware_utils/ros/debug_publisher.hpp"
@@ -71,6 +72,7 @@ public:
 private:
   void objectCallback(const typename ObjsMsgType::ConstSharedPtr);
   void mapCallback(const autoware_map_msgs::msg::LaneletMapBin::ConstSharedPtr);
+  void buildLaneletIndex();
 
   void publishDebugMarkers(
     rclcpp::Time stamp, const LinearRing2d & hull, const std::vector<BoxAndLanelet> & lanelets);
@@ -85,6 +87,9 @@ private:
 
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   std::string lanelet_frame_id_;
+  // road and road shoulder lanelets of the map, indexed once per map
+  bgi::rtree<BoxAndLanelet, RtreeAlgo> lanelet_rtree_;
+  LaneletRaster lanelet_raster_;
 
   tf2_ros::Buffer tf_buffer_;
   tf2_ros::TransformListener tf_listener_;
@@ -104,21 +109,19 @@ private:
     double min_elevation_threshold = -std::numeric_limits<double>::infinity();
 
     double lanelet_extra_margin;
+    double lanelet_raster_resolution;
     bool debug;
   } filter_settings_;
 
   bool filterObject(
     const ObjMsgType & transformed_object, const ObjMsgType & input_object,
-    const bg::index::rtree<BoxAndLanelet, RtreeAlgo> & local_rtree,
     ObjsMsgType & output_object_msg);
   LinearRing2d getConvexHull(const ObjsMsgType &);
   Polygon2d getConvexHullFromObjectFootprint(const ObjMsgType & object);
   std::vector<BoxAndLanelet> getIntersectedLanelets(const LinearRing2d &);
-  bool isObjectOverlapLanelets(
-    const ObjMsgType & object, const Polygon2d & polygon,
-    const std::vector<BoxAndLanelet> & lanelet_candidates);
-  bool isPolygonOverlapLanelets(
-    const Polygon2d & polygon, const std::vector<BoxAndLanelet> & lanelet_candidates);
+  bool isObjectOverlapLanelets(const ObjMsgType & object, const Polygon2d & polygon);
+  bool isPolygonOverlapLanelets(const Polygon2d & polygon);
+  bool isPointOnLanelets(const double x, const double y);
   bool isSameDirectionWithLanelets(
     const ObjMsgType & object, const std::vector<BoxAndLanelet> & lanelet_candidates);
   bool isObjectAboveLanelet(
@@ -0,0 +1,177 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet_raster.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace lanelet_filter
+{
+namespace
+{
+// the cells within this distance of an edge are BOUNDARY, it covers the tolerance of isInPolygon
+constexpr double edge_margin = 1.0e-6;
+// above this number of cells, isNotRoad gives up and returns false
+constexpr std::size_t max_num_cells_to_check = 4096;
+}  // namespace
+
+void LaneletRaster::build(
+  const std::vector<Ring> & polygons, double resolution, const std::size_t max_num_cells)
+{
+  cells_.clear();
+  width_ = 0;
+  height_ = 0;
+
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & polygon : polygons) {
+    for (const auto & point : polygon) {
+      min_x = std::min(min_x, point.x());
+      min_y = std::min(min_y, point.y());
+      max_x = std::max(max_x, point.x());
+      max_y = std::max(max_y, point.y());
+    }
+  }
+  if (min_x > max_x) {
+    return;
+  }
+
+  // one cell of margin around the polygons
+  const auto num_cells = [&](const double span, const double cell_size) {
+    return static_cast<std::size_t>(std::ceil(span / cell_size)) + 2;
+  };
+  while (num_cells(max_x - min_x, resolution) * num_cells(max_y - min_y, resolution) >
+         max_num_cells) {
+    resolution *= 2.0;
+  }
+  resolution_ = resolution;
+  inv_resolution_ = 1.0 / resolution;
+  origin_x_ = min_x - resolution;
+  origin_y_ = min_y - resolution;
+  width_ = static_cast<int>(num_cells(max_x - min_x, resolution));
+  height_ = static_cast<int>(num_cells(max_y - min_y, resolution));
+  cells_.assign(static_cast<std::size_t>(width_) * height_, Cell::NOT_ROAD);
+
+  std::vector<std::uint8_t> is_boundary;
+  std::vector<std::pair<double, int>> crossings;
+  for (const auto & polygon : polygons) {
+    const std::size_t num_points = polygon.size();
+    if (num_points < 3) {
+      continue;
+    }
+
+    // cells of the bounding box of the polygon
+    Eigen::Vector2d polygon_min = polygon.front();
+    Eigen::Vector2d polygon_max = polygon.front();
+    for (const auto & point : polygon) {
+      polygon_min = polygon_min.cwiseMin(point);
+      polygon_max = polygon_max.cwiseMax(point);
+    }
+    const int ix_begin = cellIndex(polygon_min.x() - edge_margin, origin_x_, width_);
+    const int iy_begin = cellIndex(polygon_min.y() - edge_margin, origin_y_, height_);
+    const int ix_end = cellIndex(polygon_max.x() + edge_margin, origin_x_, width_) + 1;
+    const int iy_end = cellIndex(polygon_max.y() + edge_margin, origin_y_, height_) + 1;
+    const int local_width = ix_end - ix_begin;
+
+    // cells touched by the edges: the cells of the bounding box of each edge
+    is_boundary.assign(static_cast<std::size_t>(local_width) * (iy_end - iy_begin), 0);
+    for (std::size_t i = 0; i < num_points; ++i) {
+      const auto & a = polygon[i];
+      const auto & b = polygon[(i + 1) % num_points];
+      const int edge_ix_begin = cellIndex(std::min(a.x(), b.x()) - edge_margin, origin_x_, width_);
+      const int edge_iy_begin = cellIndex(std::min(a.y(), b.y()) - edge_margin, origin_y_, height_);
+      const int edge_ix_end = cellIndex(std::max(a.x(), b.x()) + edge_margin, origin_x_, width_);
+      const int edge_iy_end = cellIndex(std::max(a.y(), b.y()) + edge_margin, origin_y_, height_);
+      for (int iy = edge_iy_begin; iy <= edge_iy_end; ++iy) {
+        for (int ix = edge_ix_begin; ix <= edge_ix_end; ++ix) {
+          is_boundary[static_cast<std::size_t>(iy - iy_begin) * local_width + (ix - ix_begin)] = 1;
+        }
+      }
+    }
+
+    // scan the rows at the cell centers, the cells away from the edges are inside the polygon if
+    // their center is (non-zero winding rule)
+    for (int iy = iy_begin; iy < iy_end; ++iy) {
+      const double center_y = origin_y_ + (iy + 0.5) * resolution_;
+      crossings.clear();
+      for (std::size_t i = 0; i < num_points; ++i) {
+        const auto & a = polygon[i];
+        const auto & b = polygon[(i + 1) % num_points];
+        if ((a.y() <= center_y) == (b.y() <= center_y)) {
+          continue;
+        }
+        const double x = a.x() + (center_y - a.y()) * (b.x() - a.x()) / (b.y() - a.y());
+        crossings.emplace_back(x, b.y() > a.y() ? 1 : -1);
+      }
+      std::sort(crossings.begin(), crossings.end());
+
+      std::size_t crossing_i = 0;
+      int winding = 0;
+      const std::uint8_t * row_is_boundary =
+        is_boundary.data() + static_cast<std::size_t>(iy - iy_begin) * local_width;
+      Cell * row = cells_.data() + static_cast<std::size_t>(iy) * width_;
+      for (int ix = ix_begin; ix < ix_end; ++ix) {
+        const double center_x = origin_x_ + (ix + 0.5) * resolution_;
+        while (crossing_i < crossings.size() && crossings[crossing_i].first < center_x) {
+          winding += crossings[crossing_i].second;
+          ++crossing_i;
+        }
+        Cell & cell = row[ix];
+        if (row_is_boundary[ix - ix_begin]) {
+          cell = cell == Cell::ROAD ? Cell::ROAD : Cell::BOUNDARY;
+        } else if (winding != 0) {
+          cell = Cell::ROAD;
+        }
+      }
+    }
+  }
+}
+
+bool LaneletRaster::isNotRoad(
+  const double min_x, const double min_y, const double max_x, const double max_y) const
+{
+  const int ix_begin = std::max(0, cellIndex(min_x, origin_x_, width_));
+  const int iy_begin = std::max(0, cellIndex(min_y, origin_y_, height_));
+  const int ix_end = std::min(width_ - 1, cellIndex(max_x, origin_x_, width_));
+  const int iy_end = std::min(height_ - 1, cellIndex(max_y, origin_y_, height_));
+  if (ix_begin > ix_end || iy_begin > iy_end) {
+    return true;
+  }
+  if (
+    static_cast<std::size_t>(ix_end - ix_begin + 1) * (iy_end - iy_begin + 1) >
+    max_num_cells_to_check) {
+    return false;
+  }
+
+  for (int iy = iy_begin; iy <= iy_end; ++iy) {
+    const Cell * row = cells_.data() + static_cast<std::size_t>(iy) * width_;
+    for (int ix = ix_begin; ix <= ix_end; ++ix) {
+      if (row[ix] != Cell::NOT_ROAD) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace lanelet_filter
+}  // namespace autoware::detected_object_validation
@@ -0,0 +1,85 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET_FILTER__LANELET_RASTER_HPP_
+#define LANELET_FILTER__LANELET_RASTER_HPP_
+
+#include <Eigen/Core>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::detected_object_validation
+{
+namespace lanelet_filter
+{
+
+/**
+ * @brief Coarse raster of the lanelet polygons, built once per map. A ROAD cell is inside a
+ * polygon and a NOT_ROAD cell is outside of all the polygons, so the points in these cells need no
+ * polygon test. The BOUNDARY cells touch the edge of a polygon.
+ */
+class LaneletRaster
+{
+public:
+  enum class Cell : std::uint8_t { NOT_ROAD = 0, ROAD = 1, BOUNDARY = 2 };
+
+  using Ring = std::vector<Eigen::Vector2d>;
+
+  /**
+   * @brief Rasterizes the polygons, given as rings that may be closed or not. The resolution is
+   * increased when the map needs more than max_num_cells cells.
+   */
+  void build(const std::vector<Ring> & polygons, double resolution, std::size_t max_num_cells);
+
+  Cell at(const double x, const double y) const
+  {
+    const double ix = std::floor((x - origin_x_) * inv_resolution_);
+    const double iy = std::floor((y - origin_y_) * inv_resolution_);
+    // the cells outside of the raster are out of all the polygons
+    if (!(ix >= 0.0 && iy >= 0.0 && ix < width_ && iy < height_)) {
+      return Cell::NOT_ROAD;
+    }
+    return cells_[static_cast<std::size_t>(iy) * width_ + static_cast<std::size_t>(ix)];
+  }
+
+  /// @return True if all the cells overlapping the box are NOT_ROAD
+  bool isNotRoad(double min_x, double min_y, double max_x, double max_y) const;
+
+  bool empty() const { return cells_.empty(); }
+  double resolution() const { return resolution_; }
+
+private:
+  // cell index clamped to [-1, size]
+  int cellIndex(const double value, const double origin, const int size) const
+  {
+    const double index = std::floor((value - origin) * inv_resolution_);
+    return index < 0.0 ? -1 : (index > size ? size : static_cast<int>(index));
+  }
+
+  double origin_x_{0.0};
+  double origin_y_{0.0};
+  double resolution_{1.0};
+  double inv_resolution_{1.0};
+  int width_{0};
+  int height_{0};
+  std::vector<Cell> cells_;
+};
+
+}  // namespace lanelet_filter
+}  // namespace autoware::detected_object_validation
+
+#endif  // LANELET_FILTER__LANELET_RASTER_HPP_
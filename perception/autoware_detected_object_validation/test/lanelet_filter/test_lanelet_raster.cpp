@@ -0,0 +1,138 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../../src/lanelet_filter/lanelet_raster.hpp"
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using autoware::detected_object_validation::lanelet_filter::LaneletRaster;
+
+namespace
+{
+namespace bg = boost::geometry;
+using BoostPoint = bg::model::d2::point_xy<double>;
+using BoostPolygon = bg::model::polygon<BoostPoint, false, false>;
+
+BoostPolygon toBoostPolygon(const LaneletRaster::Ring & ring)
+{
+  BoostPolygon polygon;
+  for (const auto & point : ring) {
+    polygon.outer().emplace_back(point.x(), point.y());
+  }
+  bg::correct(polygon);
+  return polygon;
+}
+
+// a lane of the given width along an arc, as the polygon of a curved lanelet
+LaneletRaster::Ring createArcLane(
+  const double center_x, const double center_y, const double radius, const double width,
+  const double start_angle, const double end_angle)
+{
+  constexpr int num_points = 20;
+  LaneletRaster::Ring ring;
+  for (int i = 0; i <= num_points; ++i) {
+    const double angle = start_angle + (end_angle - start_angle) * i / num_points;
+    ring.emplace_back(
+      center_x + (radius + width / 2) * std::cos(angle),
+      center_y + (radius + width / 2) * std::sin(angle));
+  }
+  for (int i = num_points; i >= 0; --i) {
+    const double angle = start_angle + (end_angle - start_angle) * i / num_points;
+    ring.emplace_back(
+      center_x + (radius - width / 2) * std::cos(angle),
+      center_y + (radius - width / 2) * std::sin(angle));
+  }
+  return ring;
+}
+}  // namespace
+
+TEST(LaneletRasterTest, straightLane)
+{
+  // the lanelet of createSimpleLaneletMapMsg: 50 m long and 3 m wide
+  const std::vector<LaneletRaster::Ring> polygons{
+    {{0.0, 1.5}, {50.0, 1.5}, {50.0, -1.5}, {0.0, -1.5}}};
+  LaneletRaster raster;
+  raster.build(polygons, 1.0, 1 << 20);
+
+  EXPECT_EQ(raster.at(25.0, 0.0), LaneletRaster::Cell::ROAD);
+  EXPECT_EQ(raster.at(25.0, 1.5), LaneletRaster::Cell::BOUNDARY);
+  EXPECT_EQ(raster.at(25.0, 5.0), LaneletRaster::Cell::NOT_ROAD);
+  EXPECT_EQ(raster.at(-100.0, 0.0), LaneletRaster::Cell::NOT_ROAD);
+  EXPECT_EQ(raster.at(1.0e12, -1.0e12), LaneletRaster::Cell::NOT_ROAD);
+
+  EXPECT_TRUE(raster.isNotRoad(10.0, 4.0, 14.0, 6.0));
+  EXPECT_FALSE(raster.isNotRoad(10.0, 1.0, 14.0, 6.0));
+  EXPECT_TRUE(raster.isNotRoad(60.0, -1.0, 70.0, 1.0));
+}
+
+TEST(LaneletRasterTest, resolutionIsIncreasedForLargeMaps)
+{
+  const std::vector<LaneletRaster::Ring> polygons{
+    {{0.0, 1.5}, {1000.0, 1.5}, {1000.0, -1.5}, {0.0, -1.5}}};
+  LaneletRaster raster;
+  raster.build(polygons, 1.0, 1000);
+  EXPECT_GE(raster.resolution(), 2.0);
+  EXPECT_EQ(raster.at(500.0, 1.5), LaneletRaster::Cell::BOUNDARY);
+}
+
+TEST(LaneletRasterTest, sameAsPolygonTests)
+{
+  // overlapping curved and straight lanes, as in an intersection
+  std::vector<LaneletRaster::Ring> polygons;
+  polygons.push_back(createArcLane(0.0, 0.0, 20.0, 3.5, 0.0, M_PI / 2));
+  polygons.push_back(createArcLane(0.0, 0.0, 23.5, 3.5, 0.0, M_PI / 2));
+  polygons.push_back(createArcLane(40.0, 0.0, 20.0, 3.5, M_PI / 2, M_PI));
+  polygons.push_back({{-5.0, 8.0}, {45.0, 8.0}, {45.0, 11.5}, {-5.0, 11.5}});
+  // a closed ring
+  polygons.push_back({{10.0, -10.0}, {12.0, -3.0}, {14.0, -10.0}, {10.0, -10.0}});
+
+  std::vector<BoostPolygon> boost_polygons;
+  for (const auto & polygon : polygons) {
+    boost_polygons.push_back(toBoostPolygon(polygon));
+  }
+
+  for (const double resolution : {0.5, 1.0, 2.0}) {
+    LaneletRaster raster;
+    raster.build(polygons, resolution, 1 << 20);
+
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<double> x_dist(-10.0, 50.0);
+    std::uniform_real_distribution<double> y_dist(-15.0, 35.0);
+    std::size_t num_resolved = 0;
+    for (int i = 0; i < 20000; ++i) {
+      const BoostPoint point(x_dist(engine), y_dist(engine));
+      bool is_in_polygon = false;
+      for (const auto & polygon : boost_polygons) {
+        is_in_polygon |= bg::distance(point, polygon) < 1.0e-9;
+      }
+      const auto cell = raster.at(point.x(), point.y());
+      if (cell == LaneletRaster::Cell::BOUNDARY) {
+        continue;
+      }
+      ++num_resolved;
+      EXPECT_EQ(cell == LaneletRaster::Cell::ROAD, is_in_polygon)
+        << "resolution: " << resolution << ", point: " << point.x() << ", " << point.y();
+    }
+    // most of the points do not need a polygon test
+    EXPECT_GT(num_resolved, 20000 / 2);
+  }
+}
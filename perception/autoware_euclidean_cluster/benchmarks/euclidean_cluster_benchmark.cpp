@@ -0,0 +1,125 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare pcl::EuclideanClusterExtraction on a KD-tree with GridHashClusterExtraction on 2D
+// clouds of 20k, 50k and 200k points. Usage: euclidean_cluster_benchmark [tolerance]
+// Whether both give the same clusters is printed next to the timings.
+
+#include "autoware/euclidean_cluster/grid_hash_cluster.hpp"
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl/search/kdtree.h>
+#include <pcl/segmentation/extract_clusters.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::euclidean_cluster::GridHashClusterExtraction;
+
+namespace
+{
+constexpr int nb_iterations = 10;
+
+// Objects on a 10 m lattice around the vehicle mixed with sparse clutter, z flattened like the
+// 2D clustering of the nodes
+pcl::PointCloud<pcl::PointXYZ>::Ptr makeCloud(std::size_t num_points)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> uniform(-80.0f, 80.0f);
+  std::normal_distribution<float> normal(0.0f, 0.5f);
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZ>);
+  cloud->reserve(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    if (i % 4 == 0) {
+      cloud->push_back(pcl::PointXYZ(uniform(engine), uniform(engine), 0.0f));
+    } else {
+      const float cx = 10.0f * std::round(0.1f * uniform(engine));
+      const float cy = 10.0f * std::round(0.1f * uniform(engine));
+      cloud->push_back(pcl::PointXYZ(cx + 4.0f * normal(engine), cy + normal(engine), 0.0f));
+    }
+  }
+  return cloud;
+}
+
+template <typename F>
+double averageMs(F && f)
+{
+  double total_ms = 0.0;
+  for (int i = 0; i <= nb_iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    if (i > 0) {  // the first run is a warm-up
+      total_ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+  }
+  return total_ms / nb_iterations;
+}
+
+bool sameClusters(
+  const std::vector<pcl::PointIndices> & a, const std::vector<pcl::PointIndices> & b)
+{
+  if (a.size() != b.size()) return false;
+  // Both sort the indices of a cluster and the clusters by size, largest first. Clusters of equal
+  // sizes are in the same order since both sort them from the order of their smallest index.
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    if (a[i].indices != b[i].indices) return false;
+  }
+  return true;
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  const float tolerance = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 0.7f;
+  for (const std::size_t num_points : {20000u, 50000u, 200000u}) {
+    const auto cloud = makeCloud(num_points);
+    std::cout << num_points << " points, tolerance " << tolerance << " m\n";
+
+    std::vector<pcl::PointIndices> kdtree_clusters;
+    const double kdtree_ms = averageMs([&]() {
+      pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+      tree->setInputCloud(cloud);
+      pcl::EuclideanClusterExtraction<pcl::PointXYZ> extraction;
+      extraction.setClusterTolerance(tolerance);
+      extraction.setMinClusterSize(1);
+      extraction.setMaxClusterSize(std::numeric_limits<int>::max());
+      extraction.setSearchMethod(tree);
+      extraction.setInputCloud(cloud);
+      kdtree_clusters.clear();
+      extraction.extract(kdtree_clusters);
+    });
+    std::cout << "  kdtree:                 " << kdtree_ms << " ms, " << kdtree_clusters.size()
+              << " clusters\n";
+
+    for (const std::size_t num_threads : {1u, 2u, 4u, 8u}) {
+      GridHashClusterExtraction extraction;
+      extraction.setClusterTolerance(tolerance);
+      extraction.setNumThreads(num_threads);
+      std::vector<pcl::PointIndices> grid_hash_clusters;
+      const double grid_hash_ms =
+        averageMs([&]() { extraction.extract(*cloud, grid_hash_clusters); });
+      std::cout << "  grid_hash (" << num_threads << " threads): " << grid_hash_ms << " ms, "
+                << (sameClusters(kdtree_clusters, grid_hash_clusters) ? "same" : "DIFFERENT")
+                << " clusters\n";
+    }
+  }
+  return 0;
+}
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "autoware/euclidean_cluster/euclidean_cluster_interface.hpp"
+#include "autoware/euclidean_cluster/grid_hash_cluster.hpp"
 #include "autoware/euclidean_cluster/utils.hpp"
 
 #include <pcl/point_types.h>
@@ -40,6 +41,7 @@ public:
 
 private:
   float tolerance_;
+  GridHashClusterExtraction grid_hash_cluster_;
 };
 
 }  // namespace autoware::euclidean_cluster
@@ -22,10 +22,25 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <cstddef>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace autoware::euclidean_cluster
 {
+enum class ClusteringBackend {
+  KdTree,   // pcl::EuclideanClusterExtraction on a pcl::search::KdTree
+  GridHash  // GridHashClusterExtraction, only for the 2D clustering (use_height is false)
+};
+
+inline ClusteringBackend toClusteringBackend(const std::string & name)
+{
+  if (name == "kdtree") return ClusteringBackend::KdTree;
+  if (name == "grid_hash") return ClusteringBackend::GridHash;
+  throw std::invalid_argument("clustering_backend must be 'kdtree' or 'grid_hash': " + name);
+}
+
 class EuclideanClusterInterface
 {
 public:
@@ -40,6 +55,9 @@ public:
   void setUseHeight(bool use_height) { use_height_ = use_height; }
   void setMinClusterSize(int size) { min_cluster_size_ = size; }
   void setMaxClusterSize(int size) { max_cluster_size_ = size; }
+  void setClusteringBackend(ClusteringBackend backend) { clustering_backend_ = backend; }
+  // Number of threads of the GridHash backend, 0 uses all the hardware threads
+  void setNumThreads(std::size_t num_threads) { num_threads_ = num_threads; }
   virtual bool cluster(
     const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
     std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) = 0;
@@ -52,6 +70,8 @@ protected:
   bool use_height_ = true;
   int min_cluster_size_;
   int max_cluster_size_;
+  ClusteringBackend clustering_backend_ = ClusteringBackend::KdTree;
+  std::size_t num_threads_ = 1;
 };
 
 }  // namespace autoware::euclidean_cluster
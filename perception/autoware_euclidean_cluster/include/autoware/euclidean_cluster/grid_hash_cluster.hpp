@@ -0,0 +1,89 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <pcl/PointIndices.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+/**
+ * @brief 2D euclidean clustering on a hash grid, drop-in replacement of
+ * pcl::EuclideanClusterExtraction for clouds clustered on x and y only.
+ *
+ * The points are bucketed into square cells whose diagonal is the cluster tolerance, so all the
+ * points of a cell belong to the same cluster and the neighbors of a point are at most two cells
+ * away. Neighbor cells are merged with a union-find as soon as one pair of their points is within
+ * the tolerance (strictly, like the radius search of FLANN). The clusters are the same as the ones
+ * of PCL, in the same order (largest first), and the indices of a cluster are sorted.
+ *
+ * With several threads, the cells are split into column tiles that are merged in parallel, then
+ * the pairs of cells across tile borders are merged sequentially.
+ */
+class GridHashClusterExtraction
+{
+public:
+  void setClusterTolerance(float tolerance) { tolerance_ = tolerance; }
+  void setMinClusterSize(int min_cluster_size) { min_cluster_size_ = min_cluster_size; }
+  void setMaxClusterSize(int max_cluster_size) { max_cluster_size_ = max_cluster_size; }
+  /// 0 uses all the hardware threads
+  void setNumThreads(std::size_t num_threads);
+
+  void extract(
+    const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+    std::vector<pcl::PointIndices> & cluster_indices);
+
+private:
+  struct Cell
+  {
+    // Cell coordinates packed so that the order of the keys is the (x, y) lexicographic order
+    std::uint64_t key;
+    // Range of the points of the cell in sorted_points_
+    std::uint32_t begin;
+    std::uint32_t end;
+  };
+
+  std::uint32_t findRoot(std::uint32_t cell_idx);
+  void unite(std::uint32_t a, std::uint32_t b);
+  void mergeCellPair(std::uint32_t a, std::uint32_t b, float squared_tolerance);
+  /// Merge the cells [begin, end), pairs with a cell at or after end are stored in border_pairs
+  void mergeTile(
+    std::size_t begin, std::size_t end, float squared_tolerance,
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> & border_pairs);
+
+  float tolerance_{0.7f};
+  int min_cluster_size_{1};
+  int max_cluster_size_{std::numeric_limits<int>::max()};
+  std::size_t num_threads_{1};
+
+  static constexpr std::size_t min_cells_per_thread = 1024;
+
+  // Buffers reused between calls, the points are stored sorted by cell
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> point_keys_;
+  std::vector<std::uint32_t> sorted_points_;
+  std::vector<float> sorted_xs_;
+  std::vector<float> sorted_ys_;
+  std::vector<Cell> cells_;
+  std::vector<std::uint32_t> parents_;
+};
+
+}  // namespace autoware::euclidean_cluster
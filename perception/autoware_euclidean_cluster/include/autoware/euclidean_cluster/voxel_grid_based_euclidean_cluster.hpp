@@ -14,6 +14,7 @@
 
 #pragma once
 #include "autoware/euclidean_cluster/euclidean_cluster_interface.hpp"
+#include "autoware/euclidean_cluster/grid_hash_cluster.hpp"
 #include "autoware/euclidean_cluster/utils.hpp"
 
 #include <rclcpp/node.hpp>
@@ -56,6 +57,7 @@ private:
   int min_voxel_cluster_size_for_filtering_;
   int max_points_per_voxel_in_large_cluster_;
   int max_voxel_cluster_for_output_;
+  GridHashClusterExtraction grid_hash_cluster_;
 };
 
 }  // namespace autoware::euclidean_cluster
@@ -65,19 +65,27 @@ bool EuclideanCluster::cluster(
     pointcloud_ptr = pointcloud;
   }
 
-  // create tree
-  pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-  tree->setInputCloud(pointcloud_ptr);
-
   // clustering
   std::vector<pcl::PointIndices> cluster_indices;
-  pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
-  pcl_euclidean_cluster.setClusterTolerance(tolerance_);
-  pcl_euclidean_cluster.setMinClusterSize(min_cluster_size_);
-  pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
-  pcl_euclidean_cluster.setSearchMethod(tree);
-  pcl_euclidean_cluster.setInputCloud(pointcloud_ptr);
-  pcl_euclidean_cluster.extract(cluster_indices);
+  if (clustering_backend_ == ClusteringBackend::GridHash && !use_height_) {
+    grid_hash_cluster_.setClusterTolerance(tolerance_);
+    grid_hash_cluster_.setMinClusterSize(min_cluster_size_);
+    grid_hash_cluster_.setMaxClusterSize(max_cluster_size_);
+    grid_hash_cluster_.setNumThreads(num_threads_);
+    grid_hash_cluster_.extract(*pointcloud_ptr, cluster_indices);
+  } else {
+    // create tree
+    pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+    tree->setInputCloud(pointcloud_ptr);
+
+    pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
+    pcl_euclidean_cluster.setClusterTolerance(tolerance_);
+    pcl_euclidean_cluster.setMinClusterSize(min_cluster_size_);
+    pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
+    pcl_euclidean_cluster.setSearchMethod(tree);
+    pcl_euclidean_cluster.setInputCloud(pointcloud_ptr);
+    pcl_euclidean_cluster.extract(cluster_indices);
+  }
 
   // build output
   {
@@ -0,0 +1,264 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/euclidean_cluster/grid_hash_cluster.hpp"
+
+#include <autoware/universe_utils/system/parallel_for.hpp>
+
+#include <pcl/segmentation/extract_clusters.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace autoware::euclidean_cluster
+{
+namespace
+{
+constexpr std::int64_t cell_offset = std::int64_t{1} << 31;
+
+std::uint64_t toCellKey(std::int64_t x, std::int64_t y)
+{
+  return (static_cast<std::uint64_t>(x + cell_offset) << 32) |
+         static_cast<std::uint64_t>(static_cast<std::uint32_t>(y + cell_offset));
+}
+
+std::int64_t cellX(std::uint64_t key)
+{
+  return static_cast<std::int64_t>(key >> 32) - cell_offset;
+}
+
+std::int64_t cellY(std::uint64_t key)
+{
+  return static_cast<std::int64_t>(key & 0xffffffffULL) - cell_offset;
+}
+}  // namespace
+
+void GridHashClusterExtraction::setNumThreads(std::size_t num_threads)
+{
+  num_threads_ = universe_utils::resolveNumThreads(num_threads);
+}
+
+std::uint32_t GridHashClusterExtraction::findRoot(std::uint32_t cell_idx)
+{
+  while (parents_[cell_idx] != cell_idx) {
+    parents_[cell_idx] = parents_[parents_[cell_idx]];  // path halving
+    cell_idx = parents_[cell_idx];
+  }
+  return cell_idx;
+}
+
+void GridHashClusterExtraction::unite(std::uint32_t a, std::uint32_t b)
+{
+  a = findRoot(a);
+  b = findRoot(b);
+  if (a == b) return;
+  // The smaller index stays the root, so the result does not depend on the merge order
+  if (a < b) {
+    parents_[b] = a;
+  } else {
+    parents_[a] = b;
+  }
+}
+
+void GridHashClusterExtraction::mergeCellPair(
+  std::uint32_t a, std::uint32_t b, float squared_tolerance)
+{
+  if (findRoot(a) == findRoot(b)) return;
+
+  // One pair of points within the tolerance is enough, every cell is a single cluster. The
+  // comparison is strict like the radius search of FLANN.
+  const auto & cell_a = cells_[a];
+  const auto & cell_b = cells_[b];
+  for (std::uint32_t i = cell_a.begin; i < cell_a.end; ++i) {
+    for (std::uint32_t j = cell_b.begin; j < cell_b.end; ++j) {
+      const float dx = sorted_xs_[i] - sorted_xs_[j];
+      const float dy = sorted_ys_[i] - sorted_ys_[j];
+      if (dx * dx + dy * dy < squared_tolerance) {
+        unite(a, b);
+        return;
+      }
+    }
+  }
+}
+
+void GridHashClusterExtraction::mergeTile(
+  std::size_t begin, std::size_t end, float squared_tolerance,
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> & border_pairs)
+{
+  // Only the forward half of the 5x5 neighborhood is visited: (0, 1), (0, 2), then (1, -2..2) and
+  // (2, -2..2). The cells are sorted by (x, y), so the candidates of the next columns are found
+  // with pointers that only move forward.
+  std::size_t column_1_it = begin;
+  std::size_t column_2_it = begin;
+  const auto merge_or_defer = [&](std::size_t cell_idx, std::size_t neighbor_idx) {
+    if (neighbor_idx < end) {
+      mergeCellPair(
+        static_cast<std::uint32_t>(cell_idx), static_cast<std::uint32_t>(neighbor_idx),
+        squared_tolerance);
+    } else {
+      border_pairs.emplace_back(cell_idx, neighbor_idx);
+    }
+  };
+  const auto visit_column = [&](std::size_t cell_idx, std::int64_t dx, std::size_t & column_it) {
+    const std::int64_t x = cellX(cells_[cell_idx].key) + dx;
+    const std::int64_t y = cellY(cells_[cell_idx].key);
+    const std::uint64_t first_key = toCellKey(x, y - 2);
+    const std::uint64_t last_key = toCellKey(x, y + 2);
+    while (column_it < cells_.size() && cells_[column_it].key < first_key) {
+      ++column_it;
+    }
+    for (std::size_t k = column_it; k < cells_.size() && cells_[k].key <= last_key; ++k) {
+      merge_or_defer(cell_idx, k);
+    }
+  };
+
+  for (std::size_t cell_idx = begin; cell_idx < end; ++cell_idx) {
+    const std::uint64_t key = cells_[cell_idx].key;
+    const std::uint64_t last_key_in_column = toCellKey(cellX(key), cellY(key) + 2);
+    for (std::size_t k = cell_idx + 1; k < cells_.size() && cells_[k].key <= last_key_in_column;
+         ++k) {
+      merge_or_defer(cell_idx, k);
+    }
+    visit_column(cell_idx, 1, column_1_it);
+    visit_column(cell_idx, 2, column_2_it);
+  }
+}
+
+void GridHashClusterExtraction::extract(
+  const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
+  std::vector<pcl::PointIndices> & cluster_indices)
+{
+  cluster_indices.clear();
+  const std::size_t num_points = pointcloud.points.size();
+  if (num_points == 0) return;
+
+  // 1) Sort the points by cell
+  // Slightly below tolerance / sqrt(2), so that rounding never puts two points of a cell farther
+  // apart than the tolerance. The neighbors are still at most two cells away.
+  const float cell_size = 0.9999f * tolerance_ / std::sqrt(2.0f);
+  const float inverse_cell_size = 1.0f / cell_size;
+  point_keys_.clear();
+  point_keys_.reserve(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const auto & point = pointcloud.points[i];
+    if (!std::isfinite(point.x) || !std::isfinite(point.y)) {
+      continue;  // neighbor of no point, ends up in its own cluster
+    }
+    point_keys_.emplace_back(
+      toCellKey(
+        static_cast<std::int64_t>(std::floor(point.x * inverse_cell_size)),
+        static_cast<std::int64_t>(std::floor(point.y * inverse_cell_size))),
+      static_cast<std::uint32_t>(i));
+  }
+  std::sort(point_keys_.begin(), point_keys_.end());
+
+  sorted_points_.resize(point_keys_.size());
+  sorted_xs_.resize(point_keys_.size());
+  sorted_ys_.resize(point_keys_.size());
+  cells_.clear();
+  for (std::size_t i = 0; i < point_keys_.size(); ++i) {
+    const auto [key, point_idx] = point_keys_[i];
+    sorted_points_[i] = point_idx;
+    sorted_xs_[i] = pointcloud.points[point_idx].x;
+    sorted_ys_[i] = pointcloud.points[point_idx].y;
+    if (cells_.empty() || cells_.back().key != key) {
+      cells_.push_back({key, static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i)});
+    }
+    cells_.back().end = static_cast<std::uint32_t>(i + 1);
+  }
+
+  parents_.resize(cells_.size());
+  for (std::uint32_t i = 0; i < parents_.size(); ++i) {
+    parents_[i] = i;
+  }
+
+  // 2) Merge the neighbor cells in column tiles, a tile only writes the parents of its own cells
+  // Squared in double like pcl::KdTreeFLANN::radiusSearch, so that the ties are the same
+  const auto squared_tolerance =
+    static_cast<float>(static_cast<double>(tolerance_) * static_cast<double>(tolerance_));
+  const std::size_t num_workers =
+    universe_utils::numParallelWorkers(cells_.size(), num_threads_, min_cells_per_thread);
+  std::vector<std::size_t> tile_bounds{0};
+  for (std::size_t worker = 1; worker < num_workers; ++worker) {
+    std::size_t bound = std::max(tile_bounds.back(), cells_.size() * worker / num_workers);
+    while (bound > 0 && bound < cells_.size() &&
+           cellX(cells_[bound].key) == cellX(cells_[bound - 1].key)) {
+      ++bound;
+    }
+    tile_bounds.push_back(bound);
+  }
+  tile_bounds.push_back(cells_.size());
+
+  std::vector<std::vector<std::pair<std::uint32_t, std::uint32_t>>> border_pairs(num_workers);
+  // one tile per worker, the tiles are not of equal size
+  universe_utils::parallelFor(
+    num_workers, num_workers, 1, [&](std::size_t, std::size_t, std::size_t worker) {
+      mergeTile(
+        tile_bounds[worker], tile_bounds[worker + 1], squared_tolerance, border_pairs[worker]);
+    });
+  for (const auto & pairs : border_pairs) {
+    for (const auto & [a, b] : pairs) {
+      mergeCellPair(a, b, squared_tolerance);
+    }
+  }
+
+  // 3) Label the points, clusters are numbered in the order of their smallest point index, which
+  // is the order PCL finds them in
+  constexpr std::uint32_t no_label = std::numeric_limits<std::uint32_t>::max();
+  std::vector<std::uint32_t> point_labels(num_points, no_label);
+  std::vector<std::uint32_t> root_labels(cells_.size(), no_label);
+  std::vector<std::uint32_t> cluster_sizes;
+  std::vector<std::uint32_t> point_roots(num_points, no_label);
+  for (std::size_t cell_idx = 0; cell_idx < cells_.size(); ++cell_idx) {
+    const std::uint32_t root = findRoot(static_cast<std::uint32_t>(cell_idx));
+    for (std::uint32_t i = cells_[cell_idx].begin; i < cells_[cell_idx].end; ++i) {
+      point_roots[sorted_points_[i]] = root;
+    }
+  }
+  for (std::size_t i = 0; i < num_points; ++i) {
+    std::uint32_t & label = point_roots[i] == no_label ? point_labels[i]
+                                                       : root_labels[point_roots[i]];
+    if (label == no_label) {
+      label = static_cast<std::uint32_t>(cluster_sizes.size());
+      cluster_sizes.push_back(0);
+    }
+    point_labels[i] = label;
+    ++cluster_sizes[label];
+  }
+
+  // 4) Build the output, dropping the clusters outside of the size limits like PCL does
+  std::vector<std::uint32_t> output_index(cluster_sizes.size(), no_label);
+  for (std::size_t label = 0; label < cluster_sizes.size(); ++label) {
+    const auto cluster_size = static_cast<int>(cluster_sizes[label]);
+    if (cluster_size < min_cluster_size_ || cluster_size > max_cluster_size_) continue;
+    output_index[label] = static_cast<std::uint32_t>(cluster_indices.size());
+    cluster_indices.emplace_back();
+    cluster_indices.back().indices.reserve(cluster_size);
+  }
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const std::uint32_t output_idx = output_index[point_labels[i]];
+    if (output_idx != no_label) {
+      cluster_indices[output_idx].indices.push_back(static_cast<int>(i));
+    }
+  }
+
+  // 5) Largest cluster first. The same sort as pcl::EuclideanClusterExtraction on the same input
+  // order, so the clusters of equal sizes are in the same order too.
+  std::sort(cluster_indices.rbegin(), cluster_indices.rend(), pcl::comparePointClusters);
+}
+
+}  // namespace autoware::euclidean_cluster
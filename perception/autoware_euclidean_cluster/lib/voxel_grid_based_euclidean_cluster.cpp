@@ -89,18 +89,26 @@ bool VoxelGridBasedEuclideanCluster::cluster(
     pointcloud_2d_ptr->push_back(point2d);
   }
 
-  // 4) KD-tree + clustering
-  pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
-  tree->setInputCloud(pointcloud_2d_ptr);
-  // Perform clustering using EuclideanClusterExtraction
+  // 4) KD-tree or grid hash clustering
   std::vector<pcl::PointIndices> cluster_indices;
-  pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
-  pcl_euclidean_cluster.setClusterTolerance(tolerance_);
-  pcl_euclidean_cluster.setMinClusterSize(1);
-  pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
-  pcl_euclidean_cluster.setSearchMethod(tree);
-  pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
-  pcl_euclidean_cluster.extract(cluster_indices);
+  if (clustering_backend_ == ClusteringBackend::GridHash) {
+    grid_hash_cluster_.setClusterTolerance(tolerance_);
+    grid_hash_cluster_.setMinClusterSize(1);
+    grid_hash_cluster_.setMaxClusterSize(max_cluster_size_);
+    grid_hash_cluster_.setNumThreads(num_threads_);
+    grid_hash_cluster_.extract(*pointcloud_2d_ptr, cluster_indices);
+  } else {
+    pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+    tree->setInputCloud(pointcloud_2d_ptr);
+    // Perform clustering using EuclideanClusterExtraction
+    pcl::EuclideanClusterExtraction<pcl::PointXYZ> pcl_euclidean_cluster;
+    pcl_euclidean_cluster.setClusterTolerance(tolerance_);
+    pcl_euclidean_cluster.setMinClusterSize(1);
+    pcl_euclidean_cluster.setMaxClusterSize(max_cluster_size_);
+    pcl_euclidean_cluster.setSearchMethod(tree);
+    pcl_euclidean_cluster.setInputCloud(pointcloud_2d_ptr);
+    pcl_euclidean_cluster.extract(cluster_indices);
+  }
 
   // 5) Buffer preparation
   // Map to store the mapping between voxel grid indices and their corresponding cluster indices
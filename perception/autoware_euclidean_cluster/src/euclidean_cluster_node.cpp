@@ -16,7 +16,9 @@
 
 #include "autoware/euclidean_cluster/utils.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace autoware::euclidean_cluster
@@ -30,6 +32,10 @@ EuclideanClusterNode::EuclideanClusterNode(const rclcpp::NodeOptions & options)
   const float tolerance = this->declare_parameter<float>("tolerance");
   cluster_ =
     std::make_shared<EuclideanCluster>(use_height, min_cluster_size, max_cluster_size, tolerance);
+  cluster_->setClusteringBackend(
+    toClusteringBackend(this->declare_parameter<std::string>("clustering_backend")));
+  const int num_threads = static_cast<int>(this->declare_parameter<int>("num_threads"));
+  cluster_->setNumThreads(static_cast<size_t>(std::max(0, num_threads)));
 
   using std::placeholders::_1;
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
@@ -16,7 +16,9 @@
 
 #include "autoware/euclidean_cluster/utils.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <vector>
 namespace autoware::euclidean_cluster
 {
@@ -41,6 +43,10 @@ VoxelGridBasedEuclideanClusterNode::VoxelGridBasedEuclideanClusterNode(
     use_height, min_cluster_size, max_cluster_size, tolerance, voxel_leaf_size,
     min_points_number_per_voxel, min_voxel_cluster_size_for_filtering,
     max_points_per_voxel_in_large_cluster, max_voxel_cluster_for_output);
+  cluster_->setClusteringBackend(
+    toClusteringBackend(this->declare_parameter<std::string>("clustering_backend")));
+  const int num_threads = static_cast<int>(this->declare_parameter<int>("num_threads"));
+  cluster_->setNumThreads(static_cast<size_t>(std::max(0, num_threads)));
 
   using std::placeholders::_1;
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
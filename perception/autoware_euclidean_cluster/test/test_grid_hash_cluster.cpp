@@ -0,0 +1,170 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/euclidean_cluster/grid_hash_cluster.hpp"
+
+#include <pcl/search/kdtree.h>
+#include <pcl/segmentation/extract_clusters.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::euclidean_cluster::GridHashClusterExtraction;
+
+namespace
+{
+constexpr float tolerance = 0.7f;
+
+// Blobs on a 10 m lattice mixed with uniform noise, so that clusters of all sizes exist
+pcl::PointCloud<pcl::PointXYZ> makeCloud(std::size_t num_points, unsigned int seed)
+{
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<float> uniform(-60.0f, 60.0f);
+  std::normal_distribution<float> normal(0.0f, 0.6f);
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  for (std::size_t i = 0; i < num_points; ++i) {
+    if (i % 3 == 0) {
+      cloud.push_back(pcl::PointXYZ(uniform(engine), uniform(engine), uniform(engine)));
+    } else {
+      const float cx = 10.0f * std::round(0.1f * uniform(engine));
+      const float cy = 10.0f * std::round(0.1f * uniform(engine));
+      cloud.push_back(pcl::PointXYZ(cx + 3.0f * normal(engine), cy + normal(engine), 0.0f));
+    }
+  }
+  return cloud;
+}
+
+// pcl::EuclideanClusterExtraction on a KD-tree, with the cloud flattened like the 2D clustering of
+// EuclideanCluster
+std::vector<pcl::PointIndices> referenceClusters(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud, int min_cluster_size, int max_cluster_size)
+{
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cloud_2d(new pcl::PointCloud<pcl::PointXYZ>);
+  for (const auto & point : cloud.points) {
+    cloud_2d->push_back(pcl::PointXYZ(point.x, point.y, 0.0f));
+  }
+  pcl::search::KdTree<pcl::PointXYZ>::Ptr tree(new pcl::search::KdTree<pcl::PointXYZ>);
+  tree->setInputCloud(cloud_2d);
+  pcl::EuclideanClusterExtraction<pcl::PointXYZ> extraction;
+  extraction.setClusterTolerance(tolerance);
+  extraction.setMinClusterSize(min_cluster_size);
+  extraction.setMaxClusterSize(max_cluster_size);
+  extraction.setSearchMethod(tree);
+  extraction.setInputCloud(cloud_2d);
+  std::vector<pcl::PointIndices> clusters;
+  extraction.extract(clusters);
+  return clusters;
+}
+
+std::vector<pcl::PointIndices> extract(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud, int min_cluster_size, int max_cluster_size,
+  std::size_t num_threads)
+{
+  GridHashClusterExtraction extraction;
+  extraction.setClusterTolerance(tolerance);
+  extraction.setMinClusterSize(min_cluster_size);
+  extraction.setMaxClusterSize(max_cluster_size);
+  extraction.setNumThreads(num_threads);
+  std::vector<pcl::PointIndices> clusters;
+  extraction.extract(cloud, clusters);
+  return clusters;
+}
+
+void expectSameClusters(
+  const std::vector<pcl::PointIndices> & actual, const std::vector<pcl::PointIndices> & expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_EQ(actual[i].indices, expected[i].indices) << "cluster " << i;
+  }
+}
+}  // namespace
+
+TEST(GridHashClusterExtractionTest, MatchesReference)
+{
+  const auto cloud = makeCloud(3000, 0);
+  expectSameClusters(extract(cloud, 1, 3000, 1), referenceClusters(cloud, 1, 3000));
+}
+
+TEST(GridHashClusterExtractionTest, DropsClustersOutsideOfSizeLimits)
+{
+  const auto cloud = makeCloud(3000, 1);
+  const auto clusters = extract(cloud, 5, 40, 1);
+  expectSameClusters(clusters, referenceClusters(cloud, 5, 40));
+  for (const auto & cluster : clusters) {
+    EXPECT_GE(cluster.indices.size(), 5u);
+    EXPECT_LE(cluster.indices.size(), 40u);
+  }
+}
+
+TEST(GridHashClusterExtractionTest, SameResultWithThreads)
+{
+  // Large enough to be split into several tiles
+  const auto cloud = makeCloud(60000, 2);
+  const auto single_thread = extract(cloud, 1, std::numeric_limits<int>::max(), 1);
+  expectSameClusters(extract(cloud, 1, std::numeric_limits<int>::max(), 4), single_thread);
+  expectSameClusters(extract(cloud, 1, std::numeric_limits<int>::max(), 0), single_thread);
+}
+
+TEST(GridHashClusterExtractionTest, NonFinitePointIsSingleton)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(0.0f, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(0.5f, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(5.0f, 0.0f, 0.0f));
+
+  const auto clusters = extract(cloud, 1, 10, 1);
+  ASSERT_EQ(clusters.size(), 3u);
+  EXPECT_EQ(clusters[0].indices, (std::vector<int>{0, 2}));
+  const bool singletons_found =
+    (clusters[1].indices == std::vector<int>{1} && clusters[2].indices == std::vector<int>{3}) ||
+    (clusters[1].indices == std::vector<int>{3} && clusters[2].indices == std::vector<int>{1});
+  EXPECT_TRUE(singletons_found);
+}
+
+TEST(GridHashClusterExtractionTest, PointsAtToleranceAreNotNeighbors)
+{
+  // The radius search of FLANN is strict, points exactly at the tolerance are not merged
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  cloud.push_back(pcl::PointXYZ(0.0f, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(tolerance, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(10.0f, 0.0f, 0.0f));
+  cloud.push_back(pcl::PointXYZ(10.0f, 0.5f * tolerance, 0.0f));
+
+  const auto clusters = extract(cloud, 1, 10, 1);
+  expectSameClusters(clusters, referenceClusters(cloud, 1, 10));
+  ASSERT_EQ(clusters.size(), 3u);
+  EXPECT_EQ(clusters[0].indices, (std::vector<int>{2, 3}));
+}
+
+TEST(GridHashClusterExtractionTest, ClustersAreSortedBySize)
+{
+  const auto cloud = makeCloud(3000, 3);
+  const auto clusters = extract(cloud, 1, 3000, 1);
+  for (std::size_t i = 1; i < clusters.size(); ++i) {
+    EXPECT_GE(clusters[i - 1].indices.size(), clusters[i].indices.size());
+  }
+}
+
+TEST(GridHashClusterExtractionTest, EmptyCloud)
+{
+  EXPECT_TRUE(extract(pcl::PointCloud<pcl::PointXYZ>(), 1, 10, 4).empty());
+}
@@ -154,6 +154,9 @@ public:
     // set cell geometry
     setCellGeometry();
 
+    // group the cells into independent azimuth sectors
+    setSectors();
+
     // set initialized flag
     is_initialized_ = true;
   }
@@ -161,26 +164,52 @@ public:
   // method to add a point to the grid
   void addPoint(const float x, const float y, const float z, const size_t point_idx)
   {
-    const float x_fixed = x - origin_x_;
-    const float y_fixed = y - origin_y_;
-    const float radius = std::sqrt(x_fixed * x_fixed + y_fixed * y_fixed);
-    const float azimuth = pseudoArcTan2(y_fixed, x_fixed);
-
-    // calculate the grid id
-    const int grid_idx = getGridIdx(radius, azimuth);
+    float radius = 0.0f;
+    const int grid_idx = getPointGridIdx(x, y, radius);
 
     // check if the point is within the grid
     if (grid_idx < 0) {
       return;
     }
-    const size_t grid_idx_idx = static_cast<size_t>(grid_idx);
+    addPoint(grid_idx, Point{point_idx, radius, z});
+  }
 
-    // add the point to the cell
-    cells_[grid_idx_idx].point_list_.emplace_back(Point{point_idx, radius, z});
+  // method to add a point whose cell is already known
+  inline void addPoint(const int grid_idx, const Point & point)
+  {
+    cells_[static_cast<size_t>(grid_idx)].point_list_.push_back(point);
+  }
+
+  // method to get the grid id and the radius of a point, -1 means out of range
+  int getPointGridIdx(const float x, const float y, float & radius) const
+  {
+    const float x_fixed = x - origin_x_;
+    const float y_fixed = y - origin_y_;
+    radius = std::sqrt(x_fixed * x_fixed + y_fixed * y_fixed);
+    const float azimuth = pseudoArcTan2(y_fixed, x_fixed);
+
+    // calculate the grid id
+    return getGridIdx(radius, azimuth);
   }
 
   size_t getGridSize() const { return cells_.size(); }
 
+  // Azimuth sectors: the previous-cell links of a sector only reach cells of the same sector or a
+  // root cell (a cell without previous cell, the origin cell), so sectors are independent once
+  // the root cells are processed.
+  size_t getSectorNum() const { return sector_offsets_.size() - 1; }
+  const std::vector<int> & getRootCellIndices() const { return root_cell_indices_; }
+  // grid ids of the cells of the sectors [sector_begin, sector_end), in increasing order per sector
+  std::pair<const int *, const int *> getSectorCellIndices(
+    const size_t sector_begin, const size_t sector_end) const
+  {
+    return {
+      sector_cell_indices_.data() + sector_offsets_[sector_begin],
+      sector_cell_indices_.data() + sector_offsets_[sector_end]};
+  }
+  // sector of the cell, -1 for a root cell
+  inline int getCellSector(const int grid_idx) const { return cell_sectors_[grid_idx]; }
+
   // method to get the cell
   inline Cell & getCell(const int grid_idx)
   {
@@ -197,10 +226,7 @@ public:
     if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
     for (auto & cell : cells_) {
-      cell.point_list_.clear();
-      cell.is_processed_ = false;
-      cell.is_ground_initialized_ = false;
-      cell.has_ground_ = false;
+      resetCell(cell);
     }
   }
 
@@ -211,17 +237,31 @@ public:
 
     // iterate over grid cells
     for (Cell & cell : cells_) {
-      // find and link the scan-grid root cell
-      cell.scan_grid_root_idx_ = cell.prev_grid_idx_;
-      while (cell.scan_grid_root_idx_ >= 0) {
-        const auto & prev_cell = cells_[cell.scan_grid_root_idx_];
-        // if the previous cell has point, set the previous cell as the root cell
-        if (!prev_cell.isEmpty()) break;
-        // keep searching the previous cell
-        cell.scan_grid_root_idx_ = prev_cell.scan_grid_root_idx_;
-      }
-      // if the grid root idx reaches -1, finish the search
+      setCellConnection(cell);
+    }
+  }
+
+  // find and link the scan-grid root cell, the previous cells must be already linked
+  inline void setCellConnection(Cell & cell)
+  {
+    cell.scan_grid_root_idx_ = cell.prev_grid_idx_;
+    while (cell.scan_grid_root_idx_ >= 0) {
+      const auto & prev_cell = cells_[cell.scan_grid_root_idx_];
+      // if the previous cell has point, set the previous cell as the root cell
+      if (!prev_cell.isEmpty()) break;
+      // keep searching the previous cell
+      cell.scan_grid_root_idx_ = prev_cell.scan_grid_root_idx_;
     }
+    // if the grid root idx reaches -1, finish the search
+  }
+
+  // reset the per-scan state of a cell
+  inline void resetCell(Cell & cell)
+  {
+    cell.point_list_.clear();
+    cell.is_processed_ = false;
+    cell.is_ground_initialized_ = false;
+    cell.has_ground_ = false;
   }
 
 private:
@@ -248,6 +288,12 @@ private:
   // list of cells
   std::vector<Cell> cells_;
 
+  // sector table, computed once with the grid geometry
+  std::vector<int> root_cell_indices_;
+  std::vector<int> sector_cell_indices_;  // grid ids, sector by sector
+  std::vector<size_t> sector_offsets_;    // range of each sector in sector_cell_indices_
+  std::vector<int> cell_sectors_;
+
   // debug information
   std::shared_ptr<autoware_utils::TimeKeeper> time_keeper_;
 
@@ -427,6 +473,44 @@ private:
       cell.scan_grid_root_idx_ = -1;
     }
   }
+
+  // Group the cells into sectors, a sector is the tree of cells linked to one cell whose previous
+  // cell is a root cell. The previous cell always has a smaller grid id, so one pass is enough.
+  void setSectors()
+  {
+    std::unique_ptr<ScopedTimeTrack> st_ptr;
+    if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+    root_cell_indices_.clear();
+    cell_sectors_.assign(cells_.size(), -1);
+    std::vector<size_t> sector_sizes;
+    for (size_t idx = 0; idx < cells_.size(); ++idx) {
+      const int prev_grid_idx = cells_[idx].prev_grid_idx_;
+      if (prev_grid_idx < 0) {
+        root_cell_indices_.push_back(static_cast<int>(idx));
+        continue;
+      }
+      int sector = cell_sectors_[prev_grid_idx];
+      if (sector < 0) {
+        sector = static_cast<int>(sector_sizes.size());
+        sector_sizes.push_back(0);
+      }
+      cell_sectors_[idx] = sector;
+      ++sector_sizes[sector];
+    }
+
+    sector_offsets_.assign(sector_sizes.size() + 1, 0);
+    for (size_t sector = 0; sector < sector_sizes.size(); ++sector) {
+      sector_offsets_[sector + 1] = sector_offsets_[sector] + sector_sizes[sector];
+    }
+    sector_cell_indices_.resize(sector_offsets_.back());
+    std::vector<size_t> sector_ends(sector_offsets_.begin(), sector_offsets_.end() - 1);
+    for (size_t idx = 0; idx < cells_.size(); ++idx) {
+      const int sector = cell_sectors_[idx];
+      if (sector < 0) continue;
+      sector_cell_indices_[sector_ends[sector]++] = static_cast<int>(idx);
+    }
+  }
 };
 
 }  // namespace autoware::ground_segmentation
@@ -16,9 +16,15 @@
 
 #include "data.hpp"
 
+#include <autoware/universe_utils/system/parallel_for.hpp>
+
 #include <pcl/PointIndices.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace autoware::ground_segmentation
@@ -135,59 +141,63 @@ void GridGroundFilter::initializeGround(pcl::PointIndices & out_no_ground_indice
   const auto grid_size = grid_ptr_->getGridSize();
   // loop over grid cells
   for (size_t idx = 0; idx < grid_size; idx++) {
-    auto & cell = grid_ptr_->getCell(idx);
-    if (cell.is_ground_initialized_) continue;
-    // if the cell is empty, skip
-    if (cell.isEmpty()) continue;
-
-    // check scan root grid
-    if (cell.scan_grid_root_idx_ >= 0) {
-      const Cell & prev_cell = grid_ptr_->getCell(cell.scan_grid_root_idx_);
-      if (prev_cell.is_ground_initialized_) {
-        cell.is_ground_initialized_ = true;
-        continue;
-      }
-    }
+    initializeGroundCell(grid_ptr_->getCell(idx), out_no_ground_indices);
+  }
+}
 
-    // initialize ground in this cell
-    bool is_ground_found = false;
-    PointsCentroid ground_bin;
+void GridGroundFilter::initializeGroundCell(Cell & cell, pcl::PointIndices & out_no_ground_indices)
+{
+  if (cell.is_ground_initialized_) return;
+  // if the cell is empty, skip
+  if (cell.isEmpty()) return;
 
-    for (const auto & pt : cell.point_list_) {
-      const size_t & pt_idx = pt.index;
-      const float & radius = pt.distance;
-      const float & height = pt.height;
-
-      const float global_slope_threshold = param_.global_slope_max_ratio * radius;
-      if (height >= global_slope_threshold && height > param_.non_ground_height_threshold) {
-        // this point is obstacle
-        out_no_ground_indices.indices.push_back(pt_idx);
-      } else if (
-        std::abs(height) < global_slope_threshold &&
-        std::abs(height) < param_.non_ground_height_threshold) {
-        // this point is ground
-        ground_bin.addPoint(radius, height, pt_idx);
-        is_ground_found = true;
-      }
-      // else, this point is not classified, not ground nor obstacle
-    }
-    cell.is_processed_ = true;
-    cell.has_ground_ = is_ground_found;
-    if (is_ground_found) {
+  // check scan root grid
+  if (cell.scan_grid_root_idx_ >= 0) {
+    const Cell & prev_cell = grid_ptr_->getCell(cell.scan_grid_root_idx_);
+    if (prev_cell.is_ground_initialized_) {
       cell.is_ground_initialized_ = true;
-      ground_bin.processAverage();
-      cell.avg_height_ = ground_bin.getAverageHeight();
-      cell.avg_radius_ = ground_bin.getAverageRadius();
-      cell.max_height_ = ground_bin.getMaxHeight();
-      cell.min_height_ = ground_bin.getMinHeight();
-      cell.gradient_ = std::clamp(
-        cell.avg_height_ / cell.avg_radius_, -param_.global_slope_max_ratio,
-        param_.global_slope_max_ratio);
-      cell.intercept_ = 0.0f;
-    } else {
-      cell.is_ground_initialized_ = false;
+      return;
     }
   }
+
+  // initialize ground in this cell
+  bool is_ground_found = false;
+  PointsCentroid ground_bin;
+
+  for (const auto & pt : cell.point_list_) {
+    const size_t & pt_idx = pt.index;
+    const float & radius = pt.distance;
+    const float & height = pt.height;
+
+    const float global_slope_threshold = param_.global_slope_max_ratio * radius;
+    if (height >= global_slope_threshold && height > param_.non_ground_height_threshold) {
+      // this point is obstacle
+      out_no_ground_indices.indices.push_back(pt_idx);
+    } else if (
+      std::abs(height) < global_slope_threshold &&
+      std::abs(height) < param_.non_ground_height_threshold) {
+      // this point is ground
+      ground_bin.addPoint(radius, height, pt_idx);
+      is_ground_found = true;
+    }
+    // else, this point is not classified, not ground nor obstacle
+  }
+  cell.is_processed_ = true;
+  cell.has_ground_ = is_ground_found;
+  if (is_ground_found) {
+    cell.is_ground_initialized_ = true;
+    ground_bin.processAverage();
+    cell.avg_height_ = ground_bin.getAverageHeight();
+    cell.avg_radius_ = ground_bin.getAverageRadius();
+    cell.max_height_ = ground_bin.getMaxHeight();
+    cell.min_height_ = ground_bin.getMinHeight();
+    cell.gradient_ = std::clamp(
+      cell.avg_height_ / cell.avg_radius_, -param_.global_slope_max_ratio,
+      param_.global_slope_max_ratio);
+    cell.intercept_ = 0.0f;
+  } else {
+    cell.is_ground_initialized_ = false;
+  }
 }
 
 // segment the point in the cell, logic for the continuous cell
@@ -363,104 +373,108 @@ void GridGroundFilter::classify(pcl::PointIndices & out_no_ground_indices)
   // loop over grid cells
   const auto grid_size = grid_ptr_->getGridSize();
   for (size_t idx = 0; idx < grid_size; idx++) {
-    auto & cell = grid_ptr_->getCell(idx);
-    // if the cell is empty, skip
-    if (cell.isEmpty()) continue;
-    if (cell.is_processed_) continue;
-
-    // set a cell pointer for the previous cell
-    // check scan root grid
-    if (cell.scan_grid_root_idx_ < 0) continue;
-    const Cell & prev_cell = grid_ptr_->getCell(cell.scan_grid_root_idx_);
-    if (!(prev_cell.is_ground_initialized_)) continue;
-
-    // get current cell gradient and intercept
-    std::vector<int> grid_idcs;
-    {
-      const int search_count = param_.gnd_grid_buffer_size;
-      const int check_cell_idx = cell.scan_grid_root_idx_;
-      recursiveSearch(check_cell_idx, search_count, grid_idcs);
-    }
+    classifyCell(grid_ptr_->getCell(idx), out_no_ground_indices);
+  }
+}
 
-    // segment the ground and non-ground points
-    enum SegmentationMode { NONE, CONTINUOUS, DISCONTINUOUS, BREAK };
-    SegmentationMode mode = SegmentationMode::NONE;
-    {
-      const int front_radial_id =
-        grid_ptr_->getCell(grid_idcs.back()).radial_idx_ + grid_idcs.size();
-      const float radial_diff_between_cells = cell.center_radius_ - prev_cell.center_radius_;
-
-      if (radial_diff_between_cells < param_.gnd_grid_continual_thresh * cell.radial_size_) {
-        if (cell.radial_idx_ - front_radial_id < param_.gnd_grid_continual_thresh) {
-          mode = SegmentationMode::CONTINUOUS;
-        } else {
-          mode = SegmentationMode::DISCONTINUOUS;
-        }
+void GridGroundFilter::classifyCell(Cell & cell, pcl::PointIndices & out_no_ground_indices)
+{
+  // if the cell is empty, skip
+  if (cell.isEmpty()) return;
+  if (cell.is_processed_) return;
+
+  // set a cell pointer for the previous cell
+  // check scan root grid
+  if (cell.scan_grid_root_idx_ < 0) return;
+  const Cell & prev_cell = grid_ptr_->getCell(cell.scan_grid_root_idx_);
+  if (!(prev_cell.is_ground_initialized_)) return;
+
+  // get current cell gradient and intercept
+  std::vector<int> grid_idcs;
+  {
+    const int search_count = param_.gnd_grid_buffer_size;
+    const int check_cell_idx = cell.scan_grid_root_idx_;
+    recursiveSearch(check_cell_idx, search_count, grid_idcs);
+  }
+
+  // segment the ground and non-ground points
+  enum SegmentationMode { NONE, CONTINUOUS, DISCONTINUOUS, BREAK };
+  SegmentationMode mode = SegmentationMode::NONE;
+  {
+    const int front_radial_id =
+      grid_ptr_->getCell(grid_idcs.back()).radial_idx_ + grid_idcs.size();
+    const float radial_diff_between_cells = cell.center_radius_ - prev_cell.center_radius_;
+
+    if (radial_diff_between_cells < param_.gnd_grid_continual_thresh * cell.radial_size_) {
+      if (cell.radial_idx_ - front_radial_id < param_.gnd_grid_continual_thresh) {
+        mode = SegmentationMode::CONTINUOUS;
       } else {
-        mode = SegmentationMode::BREAK;
+        mode = SegmentationMode::DISCONTINUOUS;
       }
+    } else {
+      mode = SegmentationMode::BREAK;
     }
+  }
 
-    {
-      PointsCentroid ground_bin;
-      if (mode == SegmentationMode::CONTINUOUS) {
-        // calculate the gradient and intercept by least square method
-        float a, b;
-        fitLineFromGndGrid(grid_idcs, a, b);
-        cell.gradient_ = a;
-        cell.intercept_ = b;
-
-        SegmentContinuousCell(cell, ground_bin, out_no_ground_indices);
-      } else if (mode == SegmentationMode::DISCONTINUOUS) {
-        SegmentDiscontinuousCell(cell, ground_bin, out_no_ground_indices);
-      } else if (mode == SegmentationMode::BREAK) {
-        SegmentBreakCell(cell, ground_bin, out_no_ground_indices);
-      }
-
-      // recheck ground bin
-      if (
-        param_.use_recheck_ground_cluster && cell.avg_radius_ > param_.recheck_start_distance &&
-        ground_bin.getGroundPointNum() > 0) {
-        // recheck the ground cluster
-        float reference_height = 0;
-        if (param_.use_lowest_point) {
-          reference_height = ground_bin.getMinHeightOnly();
-        } else {
-          ground_bin.processAverage();
-          reference_height = ground_bin.getAverageHeight();
-        }
-        const float threshold = reference_height + param_.non_ground_height_threshold;
-        const std::vector<size_t> & gnd_indices = ground_bin.getIndicesRef();
-        const std::vector<float> & height_list = ground_bin.getHeightListRef();
-        for (size_t j = 0; j < height_list.size(); ++j) {
-          if (height_list.at(j) >= threshold) {
-            // fill the non-ground indices
-            out_no_ground_indices.indices.push_back(gnd_indices.at(j));
-            // mark the point as non-ground
-            ground_bin.is_ground_list.at(j) = false;
-          }
-        }
-      }
+  {
+    PointsCentroid ground_bin;
+    if (mode == SegmentationMode::CONTINUOUS) {
+      // calculate the gradient and intercept by least square method
+      float a, b;
+      fitLineFromGndGrid(grid_idcs, a, b);
+      cell.gradient_ = a;
+      cell.intercept_ = b;
+
+      SegmentContinuousCell(cell, ground_bin, out_no_ground_indices);
+    } else if (mode == SegmentationMode::DISCONTINUOUS) {
+      SegmentDiscontinuousCell(cell, ground_bin, out_no_ground_indices);
+    } else if (mode == SegmentationMode::BREAK) {
+      SegmentBreakCell(cell, ground_bin, out_no_ground_indices);
+    }
 
-      // finalize current cell, update the cell ground information
-      if (ground_bin.getGroundPointNum() > 0) {
-        ground_bin.processAverage();
-        cell.avg_height_ = ground_bin.getAverageHeight();
-        cell.avg_radius_ = ground_bin.getAverageRadius();
-        cell.max_height_ = ground_bin.getMaxHeight();
-        cell.min_height_ = ground_bin.getMinHeight();
-        cell.has_ground_ = true;
+    // recheck ground bin
+    if (
+      param_.use_recheck_ground_cluster && cell.avg_radius_ > param_.recheck_start_distance &&
+      ground_bin.getGroundPointNum() > 0) {
+      // recheck the ground cluster
+      float reference_height = 0;
+      if (param_.use_lowest_point) {
+        reference_height = ground_bin.getMinHeightOnly();
       } else {
-        // copy previous cell
-        cell.avg_radius_ = prev_cell.avg_radius_;
-        cell.avg_height_ = prev_cell.avg_height_;
-        cell.max_height_ = prev_cell.max_height_;
-        cell.min_height_ = prev_cell.min_height_;
-        cell.has_ground_ = false;
+        ground_bin.processAverage();
+        reference_height = ground_bin.getAverageHeight();
       }
+      const float threshold = reference_height + param_.non_ground_height_threshold;
+      const std::vector<size_t> & gnd_indices = ground_bin.getIndicesRef();
+      const std::vector<float> & height_list = ground_bin.getHeightListRef();
+      for (size_t j = 0; j < height_list.size(); ++j) {
+        if (height_list.at(j) >= threshold) {
+          // fill the non-ground indices
+          out_no_ground_indices.indices.push_back(gnd_indices.at(j));
+          // mark the point as non-ground
+          ground_bin.is_ground_list.at(j) = false;
+        }
+      }
+    }
 
-      cell.is_processed_ = true;
+    // finalize current cell, update the cell ground information
+    if (ground_bin.getGroundPointNum() > 0) {
+      ground_bin.processAverage();
+      cell.avg_height_ = ground_bin.getAverageHeight();
+      cell.avg_radius_ = ground_bin.getAverageRadius();
+      cell.max_height_ = ground_bin.getMaxHeight();
+      cell.min_height_ = ground_bin.getMinHeight();
+      cell.has_ground_ = true;
+    } else {
+      // copy previous cell
+      cell.avg_radius_ = prev_cell.avg_radius_;
+      cell.avg_height_ = prev_cell.avg_height_;
+      cell.max_height_ = prev_cell.max_height_;
+      cell.min_height_ = prev_cell.min_height_;
+      cell.has_ground_ = false;
     }
+
+    cell.is_processed_ = true;
   }
 }
 
@@ -477,6 +491,14 @@ void GridGroundFilter::process(
   // clear the output indices
   out_no_ground_indices.indices.clear();
 
+  // azimuth sectors are independent, process them in parallel if there are enough of them
+  const size_t num_workers = universe_utils::numParallelWorkers(
+    grid_ptr_->getSectorNum(), param_.num_threads, min_sectors_per_thread);
+  if (num_workers > 1) {
+    processParallel(num_workers, out_no_ground_indices);
+    return;
+  }
+
   // reset grid cells
   grid_ptr_->resetCells();
 
@@ -493,4 +515,205 @@ void GridGroundFilter::process(
   classify(out_no_ground_indices);
 }
 
+// assign the pointcloud data to the grid, each worker fills the cells of its own sectors
+void GridGroundFilter::convertParallel(const size_t num_workers)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  const size_t in_cloud_point_step = in_cloud_->point_step;
+  const size_t num_points =
+    in_cloud_point_step == 0 ? 0 : in_cloud_->data.size() / in_cloud_point_step;
+  point_grid_indices_.resize(num_points);
+  located_points_.resize(num_points);
+
+  // 1. locate the points, split by point range. The points are bucketed by the worker owning
+  // their cell, a worker owns a range of sectors and the first worker also owns the root cells.
+  const size_t num_sectors = grid_ptr_->getSectorNum();
+  owner_point_indices_.resize(num_workers * num_workers);
+  const auto locate_points = [&](const size_t worker) {
+    for (size_t owner = 0; owner < num_workers; ++owner) {
+      owner_point_indices_[worker * num_workers + owner].clear();
+    }
+    const size_t begin = num_points * worker / num_workers;
+    const size_t end = num_points * (worker + 1) / num_workers;
+    for (size_t i = begin; i < end; ++i) {
+      const size_t data_index = i * in_cloud_point_step;
+      pcl::PointXYZ input_point;
+      data_accessor_.getPoint(in_cloud_, data_index, input_point);
+      float radius = 0.0f;
+      const int grid_idx = grid_ptr_->getPointGridIdx(input_point.x, input_point.y, radius);
+      if (grid_idx < 0) continue;
+      point_grid_indices_[i] = grid_idx;
+      located_points_[i] = Point{data_index, radius, input_point.z};
+      const int sector = grid_ptr_->getCellSector(grid_idx);
+      const size_t owner =
+        sector < 0 ? 0 : static_cast<size_t>(sector) * num_workers / num_sectors;
+      owner_point_indices_[worker * num_workers + owner].push_back(static_cast<uint32_t>(i));
+    }
+  };
+
+  // 2. reset the cells and add the points, visiting the buckets in point order so that the points
+  // keep the same order in each cell as in convert
+  const auto fill_cells = [&](const size_t worker) {
+    if (worker == 0) {
+      for (const int grid_idx : grid_ptr_->getRootCellIndices()) {
+        grid_ptr_->resetCell(grid_ptr_->getCell(grid_idx));
+      }
+    }
+    // sectors whose owner, sector * num_workers / num_sectors, is this worker
+    const size_t sector_begin = (num_sectors * worker + num_workers - 1) / num_workers;
+    const size_t sector_end = (num_sectors * (worker + 1) + num_workers - 1) / num_workers;
+    const auto [cells_begin, cells_end] =
+      grid_ptr_->getSectorCellIndices(sector_begin, sector_end);
+    for (const int * it = cells_begin; it != cells_end; ++it) {
+      grid_ptr_->resetCell(grid_ptr_->getCell(*it));
+    }
+    for (size_t source = 0; source < num_workers; ++source) {
+      for (const uint32_t i : owner_point_indices_[source * num_workers + worker]) {
+        grid_ptr_->addPoint(point_grid_indices_[i], located_points_[i]);
+      }
+    }
+  };
+
+  const auto run_workers = [num_workers](const auto & task) {
+    universe_utils::parallelFor(
+      num_workers, num_workers, 1,
+      [&task](const size_t, const size_t, const size_t worker) { task(worker); });
+  };
+  run_workers(locate_points);
+  run_workers(fill_cells);
+}
+
+// link, initialize and classify the cells of the sectors taken from next_sector
+void GridGroundFilter::processSectors(const size_t worker, std::atomic<size_t> & next_sector)
+{
+  const auto worker_start = std::chrono::steady_clock::now();
+  auto & out_no_ground_indices = worker_no_ground_indices_[worker];
+  const size_t num_sectors = grid_ptr_->getSectorNum();
+  size_t num_processed_sectors = 0;
+
+  for (size_t chunk_begin = next_sector.fetch_add(sector_chunk_size); chunk_begin < num_sectors;
+       chunk_begin = next_sector.fetch_add(sector_chunk_size)) {
+    const size_t chunk_end = std::min(chunk_begin + sector_chunk_size, num_sectors);
+    for (size_t sector = chunk_begin; sector < chunk_end; ++sector) {
+      const auto sector_start = std::chrono::steady_clock::now();
+      const auto [cells_begin, cells_end] = grid_ptr_->getSectorCellIndices(sector, sector + 1);
+
+      // same steps as process: connections, then ground initialization, then classification
+      for (const int * it = cells_begin; it != cells_end; ++it) {
+        grid_ptr_->setCellConnection(grid_ptr_->getCell(*it));
+      }
+      for (const int * it = cells_begin; it != cells_end; ++it) {
+        auto & cell_output = cell_outputs_[*it];
+        cell_output.worker = static_cast<uint32_t>(worker);
+        cell_output.init_begin = static_cast<uint32_t>(out_no_ground_indices.indices.size());
+        initializeGroundCell(grid_ptr_->getCell(*it), out_no_ground_indices);
+        cell_output.init_end = static_cast<uint32_t>(out_no_ground_indices.indices.size());
+      }
+      for (const int * it = cells_begin; it != cells_end; ++it) {
+        auto & cell_output = cell_outputs_[*it];
+        cell_output.classify_begin = static_cast<uint32_t>(out_no_ground_indices.indices.size());
+        classifyCell(grid_ptr_->getCell(*it), out_no_ground_indices);
+        cell_output.classify_end = static_cast<uint32_t>(out_no_ground_indices.indices.size());
+      }
+
+      sector_times_ms_[sector] = std::chrono::duration<double, std::milli>(
+                                   std::chrono::steady_clock::now() - sector_start)
+                                   .count();
+      ++num_processed_sectors;
+    }
+  }
+
+  worker_sector_nums_[worker] = num_processed_sectors;
+  worker_times_ms_[worker] =
+    std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - worker_start)
+      .count();
+}
+
+// process the point cloud by azimuth sectors, the result is the same as the sequential process
+void GridGroundFilter::processParallel(
+  const size_t num_workers, pcl::PointIndices & out_no_ground_indices)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  // 1. assign points to grid cells
+  convertParallel(num_workers);
+
+  const size_t grid_size = grid_ptr_->getGridSize();
+  cell_outputs_.assign(grid_size, CellOutput{0, 0, 0, 0, 0});
+  worker_no_ground_indices_.resize(num_workers);
+  for (auto & indices : worker_no_ground_indices_) {
+    indices.indices.clear();
+  }
+  worker_times_ms_.assign(num_workers, 0.0);
+  worker_sector_nums_.assign(num_workers, 0);
+  sector_times_ms_.assign(grid_ptr_->getSectorNum(), 0.0);
+
+  // 2. root cells, shared by all the sectors
+  for (const int grid_idx : grid_ptr_->getRootCellIndices()) {
+    grid_ptr_->setCellConnection(grid_ptr_->getCell(grid_idx));
+  }
+  for (const int grid_idx : grid_ptr_->getRootCellIndices()) {
+    auto & cell_output = cell_outputs_[grid_idx];
+    auto & root_indices = worker_no_ground_indices_[0].indices;
+    cell_output.init_begin = static_cast<uint32_t>(root_indices.size());
+    initializeGroundCell(grid_ptr_->getCell(grid_idx), worker_no_ground_indices_[0]);
+    cell_output.init_end = static_cast<uint32_t>(root_indices.size());
+  }
+  for (const int grid_idx : grid_ptr_->getRootCellIndices()) {
+    auto & cell_output = cell_outputs_[grid_idx];
+    auto & root_indices = worker_no_ground_indices_[0].indices;
+    cell_output.classify_begin = static_cast<uint32_t>(root_indices.size());
+    classifyCell(grid_ptr_->getCell(grid_idx), worker_no_ground_indices_[0]);
+    cell_output.classify_end = static_cast<uint32_t>(root_indices.size());
+  }
+
+  // 3. sectors
+  {
+    std::unique_ptr<ScopedTimeTrack> inner_st_ptr;
+    if (time_keeper_)
+      inner_st_ptr = std::make_unique<ScopedTimeTrack>("processSectors", *time_keeper_);
+
+    std::atomic<size_t> next_sector{0};
+    universe_utils::parallelFor(
+      num_workers, num_workers, 1, [&](const size_t, const size_t, const size_t worker) {
+        processSectors(worker, next_sector);
+      });
+
+    // the time keeper only tracks the calling thread, the workers are reported as comments
+    if (time_keeper_) {
+      const double max_sector_time_ms =
+        *std::max_element(sector_times_ms_.begin(), sector_times_ms_.end());
+      for (size_t worker = 0; worker < num_workers; ++worker) {
+        time_keeper_->comment(
+          "worker " + std::to_string(worker) + ": " + std::to_string(worker_sector_nums_[worker]) +
+          " sectors in " + std::to_string(worker_times_ms_[worker]) + " ms");
+      }
+      time_keeper_->comment("slowest sector: " + std::to_string(max_sector_time_ms) + " ms");
+    }
+  }
+
+  // 4. gather the indices in the order of the sequential process: the cells in grid order for the
+  // ground initialization, then for the classification
+  size_t num_indices = 0;
+  for (const auto & indices : worker_no_ground_indices_) {
+    num_indices += indices.indices.size();
+  }
+  out_no_ground_indices.indices.resize(num_indices);
+  auto out_it = out_no_ground_indices.indices.begin();
+  for (const auto & cell_output : cell_outputs_) {
+    const auto & indices = worker_no_ground_indices_[cell_output.worker].indices;
+    out_it = std::copy(
+      indices.begin() + cell_output.init_begin, indices.begin() + cell_output.init_end, out_it);
+  }
+  for (const auto & cell_output : cell_outputs_) {
+    const auto & indices = worker_no_ground_indices_[cell_output.worker].indices;
+    out_it = std::copy(
+      indices.begin() + cell_output.classify_begin, indices.begin() + cell_output.classify_end,
+      out_it);
+  }
+}
+
 }  // namespace autoware::ground_segmentation
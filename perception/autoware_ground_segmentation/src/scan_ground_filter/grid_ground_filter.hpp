@@ -18,6 +18,7 @@
 #include "data.hpp"
 #include "grid.hpp"
 
+#include <autoware/universe_utils/system/parallel_for.hpp>
 #include <autoware_utils/system/time_keeper.hpp>
 #include <pcl/impl/point_types.hpp>
 
@@ -26,6 +27,7 @@
 #include <pcl/PointIndices.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <memory>
 #include <utility>
@@ -147,6 +149,9 @@ struct GridGroundFilterParameter
   int gnd_grid_buffer_size;
   float virtual_lidar_x;
   float virtual_lidar_y;
+
+  // number of threads processing the azimuth sectors, 0 uses all the hardware threads
+  size_t num_threads = 1;
 };
 
 class GridGroundFilter
@@ -158,6 +163,7 @@ public:
     param_.global_slope_max_ratio = std::tan(param_.global_slope_max_angle_rad);
     param_.local_slope_max_ratio = std::tan(param_.local_slope_max_angle_rad);
     param_.radial_dividers_num = std::ceil(2.0 * M_PI / param_.radial_divider_angle_rad);
+    param_.num_threads = universe_utils::resolveNumThreads(param_.num_threads);
 
     // initialize grid pointer
     grid_ptr_ = std::make_unique<Grid>(param_.virtual_lidar_x, param_.virtual_lidar_y);
@@ -183,7 +189,25 @@ public:
   }
   void process(const PointCloud2ConstPtr & in_cloud, pcl::PointIndices & out_no_ground_indices);
 
+  // processing time of each azimuth sector in the last parallel process [ms]
+  const std::vector<double> & getSectorProcessingTimes() const { return sector_times_ms_; }
+
 private:
+  // minimum number of sectors given to a worker, below it the scan is processed sequentially
+  static constexpr size_t min_sectors_per_thread = 16;
+  // number of sectors taken at once by a worker
+  static constexpr size_t sector_chunk_size = 4;
+
+  // ranges of the non-ground indices written by a cell in the buffer of a worker
+  struct CellOutput
+  {
+    uint32_t worker;
+    uint32_t init_begin;  // written by initializeGroundCell
+    uint32_t init_end;
+    uint32_t classify_begin;  // written by classifyCell
+    uint32_t classify_end;
+  };
+
   // parameters
   GridGroundFilterParameter param_;
 
@@ -205,6 +229,7 @@ private:
   void convert();
   void preprocess();
   void initializeGround(pcl::PointIndices & out_no_ground_indices);
+  void initializeGroundCell(Cell & cell, pcl::PointIndices & out_no_ground_indices);
 
   void SegmentContinuousCell(
     const Cell & cell, PointsCentroid & ground_bin, pcl::PointIndices & out_no_ground_indices);
@@ -213,6 +238,22 @@ private:
   void SegmentBreakCell(
     const Cell & cell, PointsCentroid & ground_bin, pcl::PointIndices & out_no_ground_indices);
   void classify(pcl::PointIndices & out_no_ground_indices);
+  void classifyCell(Cell & cell, pcl::PointIndices & out_no_ground_indices);
+
+  // the same steps as process, with the azimuth sectors spread over num_workers threads
+  void processParallel(size_t num_workers, pcl::PointIndices & out_no_ground_indices);
+  void convertParallel(size_t num_workers);
+  void processSectors(size_t worker, std::atomic<size_t> & next_sector);
+
+  // buffers of the parallel process, reused between scans
+  std::vector<int> point_grid_indices_;
+  std::vector<Point> located_points_;
+  std::vector<std::vector<uint32_t>> owner_point_indices_;  // [locating worker][owner worker]
+  std::vector<pcl::PointIndices> worker_no_ground_indices_;
+  std::vector<CellOutput> cell_outputs_;
+  std::vector<double> worker_times_ms_;
+  std::vector<size_t> worker_sector_nums_;
+  std::vector<double> sector_times_ms_;
 };
 
 }  // namespace autoware::ground_segmentation
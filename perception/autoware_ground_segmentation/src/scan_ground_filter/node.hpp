@@ -184,6 +184,7 @@ private:
   // grid parameters
   float grid_size_m_;
   uint16_t gnd_grid_buffer_size_;
+  size_t num_threads_;  // threads of the elevation grid mode, 0 uses all the hardware threads
 
   // grid ground filter processor
   std::unique_ptr<GridGroundFilter> grid_ground_filter_ptr_;
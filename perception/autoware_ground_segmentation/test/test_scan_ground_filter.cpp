@@ -127,8 +127,10 @@ protected:
     parameters.emplace_back(rclcpp::Parameter("use_lowest_point", use_lowest_point_));
     parameters.emplace_back(
       rclcpp::Parameter("publish_processing_time_detail", publish_processing_time_detail_));
+    parameters.emplace_back(rclcpp::Parameter("num_threads", num_threads_));
 
     options.parameter_overrides(parameters);
+    parameters_ = parameters;
 
     scan_ground_filter_ =
       std::make_shared<autoware::ground_segmentation::ScanGroundFilterComponent>(options);
@@ -173,12 +175,20 @@ public:
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr output_pointcloud_pub_;
 
   sensor_msgs::msg::PointCloud2::SharedPtr input_msg_ptr_;
+  std::vector<rclcpp::Parameter> parameters_;
 
   // wrapper function to test private function filter
   void filter(sensor_msgs::msg::PointCloud2 & out_cloud)
+  {
+    filter(*scan_ground_filter_, out_cloud);
+  }
+
+  void filter(
+    autoware::ground_segmentation::ScanGroundFilterComponent & scan_ground_filter,
+    sensor_msgs::msg::PointCloud2 & out_cloud)
   {
     autoware::pointcloud_preprocessor::TransformInfo transform_info;
-    scan_ground_filter_->faster_filter(input_msg_ptr_, nullptr, out_cloud, transform_info);
+    scan_ground_filter.faster_filter(input_msg_ptr_, nullptr, out_cloud, transform_info);
   }
 
   void parse_yaml()
@@ -206,6 +216,7 @@ public:
     recheck_start_distance_ = params["recheck_start_distance"].as<float>();
     use_lowest_point_ = params["use_lowest_point"].as<bool>();
     publish_processing_time_detail_ = params["publish_processing_time_detail"].as<bool>();
+    num_threads_ = params["num_threads"].as<int>();
   }
 
   float global_slope_max_angle_deg_ = 0.0;
@@ -225,6 +236,7 @@ public:
   float recheck_start_distance_;
   bool use_lowest_point_;
   bool publish_processing_time_detail_;
+  int num_threads_ = 1;
 };
 
 TEST_F(ScanGroundFilterTest, TestCase1)
@@ -253,3 +265,29 @@ TEST_F(ScanGroundFilterTest, TestCase1)
   //           << ",percentage:" << percent << std::endl;
   EXPECT_GE(percent, 0.9);
 }
+
+TEST_F(ScanGroundFilterTest, ParallelSectorsMatchSingleThread)
+{
+  sensor_msgs::msg::PointCloud2 out_cloud;
+  filter(out_cloud);
+
+  auto parameters = parameters_;
+  for (auto & parameter : parameters) {
+    if (parameter.get_name() == "num_threads") {
+      parameter = rclcpp::Parameter("num_threads", 4);
+    }
+  }
+  rclcpp::NodeOptions options;
+  options.parameter_overrides(parameters);
+  auto parallel_scan_ground_filter =
+    std::make_shared<autoware::ground_segmentation::ScanGroundFilterComponent>(options);
+
+  // run twice to check that the reused buffers are reset between scans
+  for (int i = 0; i < 2; ++i) {
+    sensor_msgs::msg::PointCloud2 parallel_out_cloud;
+    filter(*parallel_scan_ground_filter, parallel_out_cloud);
+
+    EXPECT_EQ(parallel_out_cloud.width, out_cloud.width);
+    EXPECT_EQ(parallel_out_cloud.data, out_cloud.data);
+  }
+}
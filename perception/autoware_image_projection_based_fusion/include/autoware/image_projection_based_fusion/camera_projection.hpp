@@ -24,7 +24,10 @@
 
 #include <image_geometry/pinhole_camera_model.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace autoware::image_projection_based_fusion
 {
@@ -43,6 +46,10 @@ public:
   CameraProjection() : cell_width_(1.0), cell_height_(1.0), unrectify_(false) {}
   void initialize();
   std::function<bool(const cv::Point3d &, Eigen::Vector2d &)> calcImageProjectedPoint;
+  std::size_t calcImageProjectedPoints(
+    const std::vector<cv::Point3d> & points3d, std::vector<Eigen::Vector2d> & projected_points,
+    std::vector<std::uint8_t> & is_on_image);
+  bool isHullOutsideImage(const std::vector<cv::Point3d> & vertices);
   sensor_msgs::msg::CameraInfo getCameraInfo();
   bool isOutsideHorizontalView(const float px, const float pz);
   bool isOutsideVerticalView(const float py, const float pz);
@@ -0,0 +1,88 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__ROI_CLUSTER_FUSION__CLUSTER_ROI_INDEX_HPP_
+#define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__ROI_CLUSTER_FUSION__CLUSTER_ROI_INDEX_HPP_
+
+#include <sensor_msgs/msg/region_of_interest.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::image_projection_based_fusion
+{
+
+/**
+ * @brief Cluster RoIs sorted by x_offset, to find the RoIs touching an image RoI without going
+ * through all of them. Two RoIs touch when their closed x and y ranges overlap: calcIoU, calcIoUX
+ * and calcIoUY return 0.0 for the RoIs that do not touch.
+ */
+class ClusterRoiIndex
+{
+public:
+  /**
+   * @brief Sanitizes the RoIs for the image size and sorts them.
+   * @param cluster_indices cluster_indices[i] is the index of the cluster of cluster_rois[i]
+   */
+  void build(
+    const std::vector<std::size_t> & cluster_indices,
+    const std::vector<sensor_msgs::msg::RegionOfInterest> & cluster_rois, const int image_width,
+    const int image_height);
+
+  /**
+   * @brief Calls func(cluster_index, cluster_roi) for the sanitized cluster RoIs touching the
+   * given sanitized RoI, in the order of their x_offset.
+   */
+  template <typename Func>
+  void forEachTouching(const sensor_msgs::msg::RegionOfInterest & roi, Func && func) const
+  {
+    const std::uint32_t x_begin = roi.x_offset;
+    const std::uint32_t x_end = roi.x_offset + roi.width;
+    const std::uint32_t y_begin = roi.y_offset;
+    const std::uint32_t y_end = roi.y_offset + roi.height;
+
+    // the entries touching the RoI start in [x_begin - max_width_, x_end]
+    const std::uint32_t min_x_offset = x_begin < max_width_ ? 0 : x_begin - max_width_;
+    auto it = std::lower_bound(
+      entries_.begin(), entries_.end(), min_x_offset,
+      [](const Entry & entry, const std::uint32_t x) { return entry.roi.x_offset < x; });
+    for (; it != entries_.end() && it->roi.x_offset <= x_end; ++it) {
+      const auto & entry_roi = it->roi;
+      if (
+        entry_roi.x_offset + entry_roi.width < x_begin ||
+        entry_roi.y_offset + entry_roi.height < y_begin || y_end < entry_roi.y_offset) {
+        continue;
+      }
+      func(it->cluster_index, entry_roi);
+    }
+  }
+
+  std::size_t size() const { return entries_.size(); }
+
+private:
+  struct Entry
+  {
+    std::size_t cluster_index;
+    sensor_msgs::msg::RegionOfInterest roi;
+  };
+
+  std::vector<Entry> entries_;
+  std::uint32_t max_width_{0};
+};
+
+}  // namespace autoware::image_projection_based_fusion
+
+#endif  // AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__ROI_CLUSTER_FUSION__CLUSTER_ROI_INDEX_HPP_
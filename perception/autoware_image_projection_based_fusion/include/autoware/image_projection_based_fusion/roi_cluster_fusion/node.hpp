@@ -16,10 +16,16 @@
 #define AUTOWARE__IMAGE_PROJECTION_BASED_FUSION__ROI_CLUSTER_FUSION__NODE_HPP_
 
 #include "autoware/image_projection_based_fusion/fusion_node.hpp"
+#include "autoware/image_projection_based_fusion/roi_cluster_fusion/cluster_roi_index.hpp"
 
+#include <Eigen/Geometry>
+
+#include <array>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 namespace autoware::image_projection_based_fusion
 {
 const std::map<std::string, uint8_t> IOU_MODE_MAP{{"iou", 0}, {"iou_x", 1}, {"iou_y", 2}};
@@ -36,6 +42,11 @@ private:
     const ClusterMsgType & input_cluster_msg, const Det2dStatus<RoiMsgType> & det2d_status,
     const RoiMsgType & input_rois_msg, ClusterMsgType & output_cluster_msg) override;
 
+  void fuse_on_images(
+    const ClusterMsgType & input_cluster_msg,
+    const std::vector<Det2dInput<RoiMsgType>> & det2d_inputs,
+    ClusterMsgType & output_cluster_msg) override;
+
   void postprocess(const ClusterMsgType & output_cluster_msg, ClusterMsgType & output_msg) override;
 
   std::string strict_iou_match_mode_{"iou"};
@@ -50,6 +61,53 @@ private:
   double fusion_distance_;
   double strict_iou_fusion_distance_;
   std::string rough_iou_match_mode_{"iou_x"};
+  int omp_num_threads_{1};
+
+  // points of the clusters to fuse, extracted once for all the cameras
+  struct ClusterPoints
+  {
+    std::vector<std::size_t> cluster_indices;
+    // the points of the k-th cluster are in [offsets[k], offsets[k + 1])
+    std::vector<std::size_t> offsets;
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    // corners of the axis-aligned bounding box of each cluster
+    std::vector<std::array<Eigen::Vector3f, 8>> box_corners;
+  };
+
+  // projection and association of the clusters on a camera
+  struct CameraFusion
+  {
+    bool has_transform{false};
+    // clusters projected on the image, and their RoIs
+    std::vector<std::size_t> cluster_indices;
+    std::vector<sensor_msgs::msg::RegionOfInterest> cluster_rois;
+    ClusterRoiIndex cluster_roi_index;
+    // associated cluster and IoU of each image RoI, -1 if none
+    std::vector<int> associated_cluster_indices;
+    std::vector<double> max_ious;
+    std::vector<Eigen::Vector2d> debug_obstacle_points;
+
+    // buffers of the projection
+    std::vector<std::size_t> candidate_cluster_indices;
+    std::vector<std::size_t> point_offsets;
+    std::vector<cv::Point3d> points3d;
+    std::vector<cv::Point3d> hull_vertices;
+    std::vector<Eigen::Vector2d> projected_points;
+    std::vector<std::uint8_t> is_on_image;
+  };
+
+  ClusterPoints cluster_points_;
+  std::vector<CameraFusion> camera_fusions_;
+
+  void extract_cluster_points(const ClusterMsgType & input_cluster_msg);
+  void project_clusters(
+    const Eigen::Affine3f & transform, CameraProjection & camera_projector,
+    const sensor_msgs::msg::CameraInfo & camera_info, CameraFusion & camera_fusion);
+  void associate_rois(
+    const ClusterMsgType & input_cluster_msg, const RoiMsgType & input_rois_msg,
+    const sensor_msgs::msg::CameraInfo & camera_info, CameraFusion & camera_fusion);
 
   bool is_far_enough(const ClusterObjType & obj, const double distance_threshold);
   bool out_of_scope(const ClusterObjType & obj);
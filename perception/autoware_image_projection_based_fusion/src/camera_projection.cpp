@@ -14,7 +14,10 @@
 
 #include "autoware/image_projection_based_fusion/camera_projection.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <vector>
 
 namespace autoware::image_projection_based_fusion
 {
@@ -212,6 +215,77 @@ bool CameraProjection::calcRawImageProjectedPointWithApproximation(
   return true;
 }
 
+/**
+ * @brief Batched version of calcImageProjectedPoint, the projection method is resolved once.
+ * @return Return the number of points projected on the image plane, is_on_image[i] tells whether
+ * projected_points[i] is set.
+ */
+std::size_t CameraProjection::calcImageProjectedPoints(
+  const std::vector<cv::Point3d> & points3d, std::vector<Eigen::Vector2d> & projected_points,
+  std::vector<std::uint8_t> & is_on_image)
+{
+  projected_points.resize(points3d.size());
+  is_on_image.resize(points3d.size());
+
+  const auto project_all = [&](auto && calc_projected_point) {
+    std::size_t num_projected = 0;
+    for (std::size_t i = 0; i < points3d.size(); ++i) {
+      is_on_image[i] = calc_projected_point(points3d[i], projected_points[i]);
+      num_projected += is_on_image[i];
+    }
+    return num_projected;
+  };
+
+  if (!unrectify_) {
+    return project_all([this](const cv::Point3d & point3d, Eigen::Vector2d & projected_point) {
+      return calcRectifiedImageProjectedPoint(point3d, projected_point);
+    });
+  }
+  if (use_approximation_) {
+    return project_all([this](const cv::Point3d & point3d, Eigen::Vector2d & projected_point) {
+      return calcRawImageProjectedPointWithApproximation(point3d, projected_point);
+    });
+  }
+  return project_all([this](const cv::Point3d & point3d, Eigen::Vector2d & projected_point) {
+    return calcRawImageProjectedPoint(point3d, projected_point);
+  });
+}
+
+/**
+ * @brief Check that no point in the convex hull of the vertices can be projected on the image
+ * plane. The points in front of the camera project into the convex hull of the projected
+ * vertices, so the projected bounding box of the vertices is checked against the image.
+ * @return Return false if it cannot be told, when a vertex is not in front of the camera.
+ */
+bool CameraProjection::isHullOutsideImage(const std::vector<cv::Point3d> & vertices)
+{
+  // margins covering the rounding of the points transformed in float
+  constexpr double min_depth = 1e-3;
+  constexpr double pixel_margin = 1.0;
+
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & vertex : vertices) {
+    if (vertex.z < min_depth) {
+      return false;
+    }
+    const cv::Point2d rectified_image_point = camera_model_.project3dToPixel(vertex);
+    min_x = std::min(min_x, rectified_image_point.x);
+    min_y = std::min(min_y, rectified_image_point.y);
+    max_x = std::max(max_x, rectified_image_point.x);
+    max_y = std::max(max_y, rectified_image_point.y);
+  }
+
+  // the approximation accepts the rectified points of the whole cache grid
+  const bool use_cache_grid = unrectify_ && use_approximation_;
+  const double width = use_cache_grid ? grid_width_ * cell_width_ : image_width_;
+  const double height = use_cache_grid ? grid_height_ * cell_height_ : image_height_;
+  return max_x < -pixel_margin || max_y < -pixel_margin || min_x >= width + pixel_margin ||
+         min_y >= height + pixel_margin;
+}
+
 sensor_msgs::msg::CameraInfo CameraProjection::getCameraInfo()
 {
   return camera_info_;
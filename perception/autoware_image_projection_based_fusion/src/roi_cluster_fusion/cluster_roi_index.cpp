@@ -0,0 +1,44 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/roi_cluster_fusion/cluster_roi_index.hpp"
+
+#include "autoware/image_projection_based_fusion/utils/geometry.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace autoware::image_projection_based_fusion
+{
+
+void ClusterRoiIndex::build(
+  const std::vector<std::size_t> & cluster_indices,
+  const std::vector<sensor_msgs::msg::RegionOfInterest> & cluster_rois, const int image_width,
+  const int image_height)
+{
+  entries_.clear();
+  entries_.reserve(cluster_rois.size());
+  max_width_ = 0;
+  for (std::size_t i = 0; i < cluster_rois.size(); ++i) {
+    Entry entry{cluster_indices.at(i), cluster_rois.at(i)};
+    sanitizeROI(entry.roi, image_width, image_height);
+    max_width_ = std::max(max_width_, entry.roi.width);
+    entries_.push_back(entry);
+  }
+  std::stable_sort(entries_.begin(), entries_.end(), [](const Entry & a, const Entry & b) {
+    return a.roi.x_offset < b.roi.x_offset;
+  });
+}
+
+}  // namespace autoware::image_projection_based_fusion
@@ -22,20 +22,13 @@
 #include <sensor_msgs/point_cloud2_iterator.hpp>
 
 #include <algorithm>
-#include <map>
+#include <array>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
-#ifdef ROS_DISTRO_GALACTIC
-#include <tf2_geometry_msgs/tf2_geometry_msgs.h>
-#include <tf2_sensor_msgs/tf2_sensor_msgs.h>
-#else
-#include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
-#include <tf2_sensor_msgs/tf2_sensor_msgs.hpp>
-#endif
-
 namespace autoware::image_projection_based_fusion
 {
 using autoware_utils::ScopedTimeTrack;
@@ -53,6 +46,7 @@ RoiClusterFusionNode::RoiClusterFusionNode(const rclcpp::NodeOptions & options)
   remove_unknown_ = declare_parameter<bool>("remove_unknown");
   fusion_distance_ = declare_parameter<double>("fusion_distance");
   strict_iou_fusion_distance_ = declare_parameter<double>("strict_iou_fusion_distance");
+  omp_num_threads_ = declare_parameter<int>("omp_params.num_threads");
 
   // publisher
   pub_ptr_ = this->create_publisher<ClusterMsgType>("output", rclcpp::QoS{1});
@@ -76,80 +70,228 @@ void RoiClusterFusionNode::preprocess(ClusterMsgType & output_cluster_msg)
 void RoiClusterFusionNode::fuse_on_single_image(
   const ClusterMsgType & input_cluster_msg, const Det2dStatus<RoiMsgType> & det2d_status,
   const RoiMsgType & input_rois_msg, ClusterMsgType & output_cluster_msg)
+{
+  fuse_on_images(
+    input_cluster_msg, {Det2dInput<RoiMsgType>{det2d_status, input_rois_msg}},
+    output_cluster_msg);
+}
+
+void RoiClusterFusionNode::fuse_on_images(
+  const ClusterMsgType & input_cluster_msg,
+  const std::vector<Det2dInput<RoiMsgType>> & det2d_inputs, ClusterMsgType & output_cluster_msg)
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  const sensor_msgs::msg::CameraInfo & camera_info =
-    det2d_status.camera_projector_ptr->getCameraInfo();
+  extract_cluster_points(input_cluster_msg);
 
   // get transform from cluster frame id to camera optical frame id
-  geometry_msgs::msg::TransformStamped transform_stamped;
-  {
+  std::vector<Eigen::Affine3f> transforms(det2d_inputs.size());
+  if (camera_fusions_.size() < det2d_inputs.size()) {
+    camera_fusions_.resize(det2d_inputs.size());
+  }
+  for (std::size_t camera_i = 0; camera_i < det2d_inputs.size(); ++camera_i) {
+    const auto & input_rois_msg = det2d_inputs.at(camera_i).rois_msg;
     const auto transform_stamped_optional = getTransformStamped(
       tf_buffer_, /*target*/ input_rois_msg.header.frame_id,
       /*source*/ input_cluster_msg.header.frame_id, input_rois_msg.header.stamp);
+    camera_fusions_.at(camera_i).has_transform = transform_stamped_optional.has_value();
     if (!transform_stamped_optional) {
       RCLCPP_WARN_STREAM(
         get_logger(), "Failed to get transform from " << input_cluster_msg.header.frame_id << " to "
                                                       << input_rois_msg.header.frame_id);
-      return;
+      continue;
+    }
+    // same transform as tf2::doTransform of a PointCloud2
+    const auto & transform = transform_stamped_optional->transform;
+    transforms.at(camera_i) =
+      Eigen::Translation3f(
+        transform.translation.x, transform.translation.y, transform.translation.z) *
+      Eigen::Quaternion<float>(
+        transform.rotation.w, transform.rotation.x, transform.rotation.y, transform.rotation.z);
+  }
+
+  // project the clusters and associate them with the image RoIs on each camera
+  const int num_cameras = static_cast<int>(det2d_inputs.size());
+#pragma omp parallel for num_threads(omp_num_threads_) schedule(dynamic)
+  for (int camera_i = 0; camera_i < num_cameras; ++camera_i) {
+    auto & camera_fusion = camera_fusions_.at(camera_i);
+    if (!camera_fusion.has_transform) {
+      continue;
     }
-    transform_stamped = transform_stamped_optional.value();
+    const auto & det2d_status = det2d_inputs.at(camera_i).det2d_status;
+    const sensor_msgs::msg::CameraInfo camera_info =
+      det2d_status.camera_projector_ptr->getCameraInfo();
+    project_clusters(
+      transforms.at(camera_i), *det2d_status.camera_projector_ptr, camera_info, camera_fusion);
+    associate_rois(
+      input_cluster_msg, det2d_inputs.at(camera_i).rois_msg, camera_info, camera_fusion);
   }
 
-  std::map<std::size_t, RegionOfInterest> m_cluster_roi;
+  // fuse in the camera order, a camera may overwrite the fusion of the previous ones
+  for (std::size_t camera_i = 0; camera_i < det2d_inputs.size(); ++camera_i) {
+    const auto & camera_fusion = camera_fusions_.at(camera_i);
+    if (!camera_fusion.has_transform) {
+      continue;
+    }
+    const auto & input_rois_msg = det2d_inputs.at(camera_i).rois_msg;
+
+    std::vector<sensor_msgs::msg::RegionOfInterest> debug_image_rois;
+    std::vector<double> debug_max_iou_for_image_rois;
+    for (std::size_t roi_i = 0; roi_i < input_rois_msg.feature_objects.size(); ++roi_i) {
+      const int index = camera_fusion.associated_cluster_indices.at(roi_i);
+      if (index < 0) {
+        continue;
+      }
+      const auto & feature_obj = input_rois_msg.feature_objects.at(roi_i);
+      const double max_iou = camera_fusion.max_ious.at(roi_i);
+      const bool is_roi_label_known =
+        feature_obj.object.classification.front().label != ObjectClassification::UNKNOWN;
+
+      if (!output_cluster_msg.feature_objects.empty()) {
+        auto & fused_object = output_cluster_msg.feature_objects.at(index).object;
+        const bool is_roi_existence_prob_higher =
+          fused_object.existence_probability <= feature_obj.object.existence_probability;
+        const bool is_roi_iou_over_threshold =
+          (is_roi_label_known && iou_threshold_ < max_iou) ||
+          (!is_roi_label_known && unknown_iou_threshold_ < max_iou);
+
+        if (is_roi_iou_over_threshold && is_roi_existence_prob_higher) {
+          fused_object.classification = feature_obj.object.classification;
+          // Update existence_probability for fused objects
+          fused_object.existence_probability =
+            std::clamp(feature_obj.object.existence_probability, min_roi_existence_prob_, 1.0f);
+        }
+      }
+      if (debugger_) debug_image_rois.push_back(feature_obj.feature.roi);
+      if (debugger_) debug_max_iou_for_image_rois.push_back(max_iou);
+    }
+
+    // note: debug objects are safely cleared in fusion_node.cpp
+    // TODO(badai-nguyen): revise the shared debugger_ usage
+    if (debugger_) {
+      debugger_->image_rois_ = debug_image_rois;
+      debugger_->obstacle_rois_ = camera_fusion.cluster_rois;
+      debugger_->obstacle_points_ = camera_fusion.debug_obstacle_points;
+      debugger_->max_iou_for_image_rois_ = debug_max_iou_for_image_rois;
+      debugger_->publishImage(
+        det2d_inputs.at(camera_i).det2d_status.id, input_rois_msg.header.stamp);
+    }
+  }
+}
 
-  std::vector<sensor_msgs::msg::RegionOfInterest> debug_image_rois;
-  std::vector<Eigen::Vector2d> debug_obstacle_points;
-  std::vector<sensor_msgs::msg::RegionOfInterest> debug_obstacle_rois;
-  std::vector<double> debug_max_iou_for_image_rois;
+void RoiClusterFusionNode::extract_cluster_points(const ClusterMsgType & input_cluster_msg)
+{
+  auto & points = cluster_points_;
+  points.cluster_indices.clear();
+  points.offsets.assign(1, 0);
+  points.x.clear();
+  points.y.clear();
+  points.z.clear();
+  points.box_corners.clear();
 
   for (std::size_t i = 0; i < input_cluster_msg.feature_objects.size(); ++i) {
-    if (input_cluster_msg.feature_objects.at(i).feature.cluster.data.empty()) {
+    const auto & feature_object = input_cluster_msg.feature_objects.at(i);
+    if (feature_object.feature.cluster.data.empty()) {
       continue;
     }
 
-    if (is_far_enough(input_cluster_msg.feature_objects.at(i), fusion_distance_)) {
+    if (is_far_enough(feature_object, fusion_distance_)) {
       continue;
     }
 
     // filter point out of scope
-    if (debugger_ && out_of_scope(input_cluster_msg.feature_objects.at(i))) {
+    if (debugger_ && out_of_scope(feature_object)) {
       continue;
     }
 
-    sensor_msgs::msg::PointCloud2 transformed_cluster;
-    tf2::doTransform(
-      input_cluster_msg.feature_objects.at(i).feature.cluster, transformed_cluster,
-      transform_stamped);
-
-    int min_x(camera_info.width), min_y(camera_info.height), max_x(0), max_y(0);
-    std::vector<Eigen::Vector2d> projected_points;
-    projected_points.reserve(transformed_cluster.data.size());
-    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(transformed_cluster, "x"),
-         iter_y(transformed_cluster, "y"), iter_z(transformed_cluster, "z");
+    const auto & cluster = feature_object.feature.cluster;
+    Eigen::Vector3f min_point = Eigen::Vector3f::Constant(std::numeric_limits<float>::max());
+    Eigen::Vector3f max_point = Eigen::Vector3f::Constant(std::numeric_limits<float>::lowest());
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cluster, "x"), iter_y(cluster, "y"),
+         iter_z(cluster, "z");
          iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-      if (*iter_z <= 0.0) {
+      const Eigen::Vector3f point(*iter_x, *iter_y, *iter_z);
+      min_point = min_point.cwiseMin(point);
+      max_point = max_point.cwiseMax(point);
+      points.x.push_back(point.x());
+      points.y.push_back(point.y());
+      points.z.push_back(point.z());
+    }
+
+    std::array<Eigen::Vector3f, 8> box_corners;
+    for (std::size_t corner_i = 0; corner_i < box_corners.size(); ++corner_i) {
+      box_corners.at(corner_i) << (corner_i & 1 ? max_point.x() : min_point.x()),
+        (corner_i & 2 ? max_point.y() : min_point.y()),
+        (corner_i & 4 ? max_point.z() : min_point.z());
+    }
+    points.cluster_indices.push_back(i);
+    points.offsets.push_back(points.x.size());
+    points.box_corners.push_back(box_corners);
+  }
+}
+
+void RoiClusterFusionNode::project_clusters(
+  const Eigen::Affine3f & transform, CameraProjection & camera_projector,
+  const sensor_msgs::msg::CameraInfo & camera_info, CameraFusion & camera_fusion)
+{
+  const auto & points = cluster_points_;
+  camera_fusion.candidate_cluster_indices.clear();
+  camera_fusion.point_offsets.assign(1, 0);
+  camera_fusion.points3d.clear();
+
+  // gather the points in front of the camera of the clusters that may be seen on the image
+  for (std::size_t k = 0; k < points.cluster_indices.size(); ++k) {
+    camera_fusion.hull_vertices.clear();
+    for (const auto & corner : points.box_corners.at(k)) {
+      const Eigen::Vector3f vertex = transform * corner;
+      camera_fusion.hull_vertices.emplace_back(vertex.x(), vertex.y(), vertex.z());
+    }
+    if (camera_projector.isHullOutsideImage(camera_fusion.hull_vertices)) {
+      continue;
+    }
+
+    for (std::size_t point_i = points.offsets.at(k); point_i < points.offsets.at(k + 1);
+         ++point_i) {
+      const Eigen::Vector3f point =
+        transform * Eigen::Vector3f(points.x[point_i], points.y[point_i], points.z[point_i]);
+      if (point.z() <= 0.0) {
         continue;
       }
+      camera_fusion.points3d.emplace_back(point.x(), point.y(), point.z());
+    }
+    camera_fusion.candidate_cluster_indices.push_back(points.cluster_indices.at(k));
+    camera_fusion.point_offsets.push_back(camera_fusion.points3d.size());
+  }
 
-      Eigen::Vector2d projected_point;
-      if (det2d_status.camera_projector_ptr->calcImageProjectedPoint(
-            cv::Point3d(*iter_x, *iter_y, *iter_z), projected_point)) {
-        const int px = static_cast<int>(projected_point.x());
-        const int py = static_cast<int>(projected_point.y());
-
-        min_x = std::min(px, min_x);
-        min_y = std::min(py, min_y);
-        max_x = std::max(px, max_x);
-        max_y = std::max(py, max_y);
+  camera_projector.calcImageProjectedPoints(
+    camera_fusion.points3d, camera_fusion.projected_points, camera_fusion.is_on_image);
 
-        projected_points.push_back(projected_point);
-        if (debugger_) debug_obstacle_points.push_back(projected_point);
+  // RoI of each cluster on the image
+  camera_fusion.cluster_indices.clear();
+  camera_fusion.cluster_rois.clear();
+  camera_fusion.debug_obstacle_points.clear();
+  for (std::size_t k = 0; k < camera_fusion.candidate_cluster_indices.size(); ++k) {
+    int min_x(camera_info.width), min_y(camera_info.height), max_x(0), max_y(0);
+    bool is_projected = false;
+    for (std::size_t point_i = camera_fusion.point_offsets.at(k);
+         point_i < camera_fusion.point_offsets.at(k + 1); ++point_i) {
+      if (!camera_fusion.is_on_image[point_i]) {
+        continue;
       }
+      const Eigen::Vector2d & projected_point = camera_fusion.projected_points[point_i];
+      const int px = static_cast<int>(projected_point.x());
+      const int py = static_cast<int>(projected_point.y());
+
+      min_x = std::min(px, min_x);
+      min_y = std::min(py, min_y);
+      max_x = std::max(px, max_x);
+      max_y = std::max(py, max_y);
+
+      is_projected = true;
+      if (debugger_) camera_fusion.debug_obstacle_points.push_back(projected_point);
     }
-    if (projected_points.empty()) {
+    if (!is_projected) {
       continue;
     }
 
@@ -158,70 +300,55 @@ void RoiClusterFusionNode::fuse_on_single_image(
     roi.y_offset = min_y;
     roi.width = max_x - min_x;
     roi.height = max_y - min_y;
-    m_cluster_roi.insert(std::make_pair(i, roi));
-    if (debugger_) debug_obstacle_rois.push_back(roi);
+    camera_fusion.cluster_indices.push_back(camera_fusion.candidate_cluster_indices.at(k));
+    camera_fusion.cluster_rois.push_back(roi);
   }
+}
 
-  for (const auto & feature_obj : input_rois_msg.feature_objects) {
+void RoiClusterFusionNode::associate_rois(
+  const ClusterMsgType & input_cluster_msg, const RoiMsgType & input_rois_msg,
+  const sensor_msgs::msg::CameraInfo & camera_info, CameraFusion & camera_fusion)
+{
+  camera_fusion.cluster_roi_index.build(
+    camera_fusion.cluster_indices, camera_fusion.cluster_rois, camera_info.width,
+    camera_info.height);
+  camera_fusion.associated_cluster_indices.assign(input_rois_msg.feature_objects.size(), -1);
+  camera_fusion.max_ious.assign(input_rois_msg.feature_objects.size(), 0.0);
+
+  for (std::size_t roi_i = 0; roi_i < input_rois_msg.feature_objects.size(); ++roi_i) {
+    const auto & feature_obj = input_rois_msg.feature_objects.at(roi_i);
     int index = -1;
-    bool associated = false;
     double max_iou = 0.0;
     const bool is_roi_label_known =
       feature_obj.object.classification.front().label != ObjectClassification::UNKNOWN;
-    for (const auto & cluster_map : m_cluster_roi) {
-      double iou(0.0);
-      bool use_rough_iou_match = is_far_enough(
-        input_cluster_msg.feature_objects.at(cluster_map.first), strict_iou_fusion_distance_);
-      auto image_roi = feature_obj.feature.roi;
-      auto cluster_roi = cluster_map.second;
-      sanitizeROI(image_roi, camera_info.width, camera_info.height);
-      sanitizeROI(cluster_roi, camera_info.width, camera_info.height);
-      if (use_rough_iou_match || (!is_roi_label_known)) {
-        iou = cal_iou_by_mode(cluster_roi, image_roi, rough_iou_match_mode_);
-      } else {
-        iou = cal_iou_by_mode(cluster_roi, image_roi, strict_iou_match_mode_);
-      }
-
-      const bool passed_inside_cluster_gate =
-        only_allow_inside_cluster_ ? is_inside(image_roi, cluster_roi, roi_scale_factor_) : true;
-      if (max_iou < iou && passed_inside_cluster_gate) {
-        index = cluster_map.first;
-        max_iou = iou;
-        associated = true;
-      }
-    }
-
-    if (!associated) {
-      continue;
-    }
-
-    if (!output_cluster_msg.feature_objects.empty()) {
-      auto & fused_object = output_cluster_msg.feature_objects.at(index).object;
-      const bool is_roi_existence_prob_higher =
-        fused_object.existence_probability <= feature_obj.object.existence_probability;
-      const bool is_roi_iou_over_threshold =
-        (is_roi_label_known && iou_threshold_ < max_iou) ||
-        (!is_roi_label_known && unknown_iou_threshold_ < max_iou);
-
-      if (is_roi_iou_over_threshold && is_roi_existence_prob_higher) {
-        fused_object.classification = feature_obj.object.classification;
-        // Update existence_probability for fused objects
-        fused_object.existence_probability =
-          std::clamp(feature_obj.object.existence_probability, min_roi_existence_prob_, 1.0f);
-      }
-    }
-    if (debugger_) debug_image_rois.push_back(feature_obj.feature.roi);
-    if (debugger_) debug_max_iou_for_image_rois.push_back(max_iou);
-  }
-
-  // note: debug objects are safely cleared in fusion_node.cpp
-  // TODO(badai-nguyen): revise the shared debugger_ usage
-  if (debugger_) {
-    debugger_->image_rois_ = debug_image_rois;
-    debugger_->obstacle_rois_ = debug_obstacle_rois;
-    debugger_->obstacle_points_ = debug_obstacle_points;
-    debugger_->max_iou_for_image_rois_ = debug_max_iou_for_image_rois;
-    debugger_->publishImage(det2d_status.id, input_rois_msg.header.stamp);
+    auto image_roi = feature_obj.feature.roi;
+    sanitizeROI(image_roi, camera_info.width, camera_info.height);
+
+    // the other clusters have an IoU of 0.0 with the image RoI
+    camera_fusion.cluster_roi_index.forEachTouching(
+      image_roi, [&](const std::size_t cluster_index, const RegionOfInterest & cluster_roi) {
+        double iou(0.0);
+        bool use_rough_iou_match = is_far_enough(
+          input_cluster_msg.feature_objects.at(cluster_index), strict_iou_fusion_distance_);
+        if (use_rough_iou_match || (!is_roi_label_known)) {
+          iou = cal_iou_by_mode(cluster_roi, image_roi, rough_iou_match_mode_);
+        } else {
+          iou = cal_iou_by_mode(cluster_roi, image_roi, strict_iou_match_mode_);
+        }
+
+        const bool passed_inside_cluster_gate =
+          only_allow_inside_cluster_ ? is_inside(image_roi, cluster_roi, roi_scale_factor_) : true;
+        // on a tie, keep the first cluster of the input
+        const bool is_first_max_iou = max_iou < iou || (index >= 0 && iou == max_iou &&
+                                                        static_cast<int>(cluster_index) < index);
+        if (is_first_max_iou && passed_inside_cluster_gate) {
+          index = static_cast<int>(cluster_index);
+          max_iou = iou;
+        }
+      });
+
+    camera_fusion.associated_cluster_indices.at(roi_i) = index;
+    camera_fusion.max_ious.at(roi_i) = max_iou;
   }
 }
 
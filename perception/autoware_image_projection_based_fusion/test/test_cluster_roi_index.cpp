@@ -0,0 +1,121 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/image_projection_based_fusion/roi_cluster_fusion/cluster_roi_index.hpp"
+#include "autoware/image_projection_based_fusion/utils/geometry.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+using autoware::image_projection_based_fusion::calcIoU;
+using autoware::image_projection_based_fusion::calcIoUX;
+using autoware::image_projection_based_fusion::calcIoUY;
+using autoware::image_projection_based_fusion::ClusterRoiIndex;
+using autoware::image_projection_based_fusion::sanitizeROI;
+using sensor_msgs::msg::RegionOfInterest;
+
+namespace
+{
+constexpr int image_width = 1440;
+constexpr int image_height = 1080;
+
+RegionOfInterest makeRoi(
+  const std::uint32_t x_offset, const std::uint32_t y_offset, const std::uint32_t width,
+  const std::uint32_t height)
+{
+  RegionOfInterest roi;
+  roi.x_offset = x_offset;
+  roi.y_offset = y_offset;
+  roi.width = width;
+  roi.height = height;
+  return roi;
+}
+
+std::set<std::size_t> findTouching(const ClusterRoiIndex & index, const RegionOfInterest & roi)
+{
+  std::set<std::size_t> cluster_indices;
+  index.forEachTouching(roi, [&](const std::size_t cluster_index, const RegionOfInterest &) {
+    cluster_indices.insert(cluster_index);
+  });
+  return cluster_indices;
+}
+}  // namespace
+
+TEST(ClusterRoiIndexTest, touching)
+{
+  // the RoI of cluster 7 is sanitized to an empty RoI at the right of the image
+  const std::vector<std::size_t> cluster_indices{3, 5, 7, 9};
+  const std::vector<RegionOfInterest> cluster_rois{
+    makeRoi(0, 0, 100, 100), makeRoi(100, 100, 50, 50), makeRoi(1500, 0, 10, 10),
+    makeRoi(1400, 1000, 100, 100)};
+  ClusterRoiIndex index;
+  index.build(cluster_indices, cluster_rois, image_width, image_height);
+  EXPECT_EQ(index.size(), 4u);
+
+  EXPECT_EQ(findTouching(index, makeRoi(50, 50, 10, 10)), (std::set<std::size_t>{3}));
+  // the closed ranges of the RoIs touch at (100, 100)
+  EXPECT_EQ(findTouching(index, makeRoi(90, 90, 10, 10)), (std::set<std::size_t>{3, 5}));
+  EXPECT_EQ(findTouching(index, makeRoi(151, 0, 10, 200)), (std::set<std::size_t>{}));
+  // cluster 9 is sanitized to (1400, 1000, 40, 80)
+  EXPECT_EQ(findTouching(index, makeRoi(1439, 1079, 1, 1)), (std::set<std::size_t>{9}));
+  EXPECT_EQ(findTouching(index, makeRoi(1441, 0, 5, 5)), (std::set<std::size_t>{}));
+}
+
+TEST(ClusterRoiIndexTest, sameAsNestedLoop)
+{
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<std::uint32_t> x_dist(0, image_width + 100);
+  std::uniform_int_distribution<std::uint32_t> y_dist(0, image_height + 100);
+  std::uniform_int_distribution<std::uint32_t> size_dist(0, 300);
+
+  std::vector<std::size_t> cluster_indices;
+  std::vector<RegionOfInterest> cluster_rois;
+  for (std::size_t i = 0; i < 300; ++i) {
+    cluster_indices.push_back(2 * i);
+    cluster_rois.push_back(makeRoi(x_dist(engine), y_dist(engine), size_dist(engine), 50));
+  }
+  // a cluster with a negative projected offset
+  cluster_indices.push_back(1);
+  cluster_rois.push_back(makeRoi(static_cast<std::uint32_t>(-20), 10, 100, 100));
+
+  ClusterRoiIndex index;
+  index.build(cluster_indices, cluster_rois, image_width, image_height);
+
+  for (std::size_t i = 0; i < 300; ++i) {
+    auto image_roi =
+      makeRoi(x_dist(engine), y_dist(engine), size_dist(engine), size_dist(engine));
+    sanitizeROI(image_roi, image_width, image_height);
+
+    // the clusters with a non-zero IoU in any mode
+    std::set<std::size_t> expected;
+    for (std::size_t j = 0; j < cluster_rois.size(); ++j) {
+      auto cluster_roi = cluster_rois.at(j);
+      sanitizeROI(cluster_roi, image_width, image_height);
+      if (
+        calcIoU(cluster_roi, image_roi) != 0.0 || calcIoUX(cluster_roi, image_roi) != 0.0 ||
+        calcIoUY(cluster_roi, image_roi) != 0.0) {
+        expected.insert(cluster_indices.at(j));
+      }
+    }
+
+    const auto touching = findTouching(index, image_roi);
+    for (const auto cluster_index : expected) {
+      EXPECT_EQ(touching.count(cluster_index), 1u);
+    }
+  }
+}
@@ -30,6 +30,7 @@
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_routing/LaneletPath.h>
 
+#include <optional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -91,6 +92,16 @@ struct ObjectData
   Maneuver output_maneuver{
     Maneuver::UNINITIALIZED};  // output maneuver considering previous one shot maneuvers
 };
+
+// Changes of the latest ObjectData of an object made by its prediction. The prediction only reads
+// the object history, so that the objects can be predicted in parallel, and these changes are
+// applied after all the objects are predicted.
+struct ObjectDataUpdate
+{
+  std::optional<Maneuver> one_shot_maneuver;
+  std::optional<Maneuver> output_maneuver;
+  lanelet::ConstLanelets future_possible_lanelets;  // appended if not already possible
+};
 struct Intention
 {
   rclcpp::Time last_crossing_intention_time;
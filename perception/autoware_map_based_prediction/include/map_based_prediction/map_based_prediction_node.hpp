@@ -43,9 +43,11 @@
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -97,6 +99,18 @@ private:
   // Object History
   std::unordered_map<std::string, std::deque<ObjectData>> road_users_history_;
 
+  // Per object data of objectsCallback, the objects are predicted in parallel and merged in order
+  struct ObjectPredictionTask
+  {
+    TrackedObject transformed_object;  // in the map frame
+    TrackedObject object;              // with the yaw and velocity updated, only for the vehicles
+    std::uint8_t label;
+    LaneletsData current_lanelets;
+    std::optional<PredictedObject> predicted_object;
+    std::optional<Maneuver> debug_maneuver;
+    ObjectDataUpdate object_data_update;
+  };
+
   // Lanelet Map Pointers
   std::shared_ptr<lanelet::LaneletMap> lanelet_map_ptr_;
   std::shared_ptr<lanelet::routing::RoutingGraph> routing_graph_ptr_;
@@ -164,6 +178,9 @@ private:
   double speed_limit_multiplier_;
   double acceleration_exponential_half_life_;
 
+  // Parallel prediction parameters
+  size_t num_threads_;
+
   ////// Member Functions
   // Node callbacks
   void mapCallback(const LaneletMapBin::ConstSharedPtr msg);
@@ -195,11 +212,13 @@ private:
   void updateRoadUsersHistory(
     const std_msgs::msg::Header & header, const TrackedObject & object,
     const LaneletsData & current_lanelets_data);
+  void applyObjectDataUpdate(const std::string & object_id, const ObjectDataUpdate & update);
 
   // Vehicle Maneuver Prediction
   Maneuver predictObjectManeuver(
     const std::string & object_id, const geometry_msgs::msg::Pose & object_pose,
-    const LaneletData & current_lanelet_data, const double object_detected_time);
+    const LaneletData & current_lanelet_data, const double object_detected_time,
+    ObjectDataUpdate & object_data_update);
   Maneuver predictObjectManeuverByTimeToLaneChange(
     const std::string & object_id, const LaneletData & current_lanelet_data,
     const double object_detected_time);
@@ -218,19 +237,20 @@ private:
   // Vehicle path process
   PredictedObject getPredictionForNonVehicleObject(
     const std_msgs::msg::Header & header, const TrackedObject & object);
-  std::optional<PredictedObject> getPredictionForVehicleObject(
-    const std_msgs::msg::Header & header, const TrackedObject & object,
-    const double objects_detected_time, visualization_msgs::msg::MarkerArray & debug_markers);
+  void getPredictionForVehicleObject(
+    const double objects_detected_time, ObjectPredictionTask & task);
   std::optional<size_t> searchProperStartingRefPathIndex(
     const TrackedObject & object, const PosePath & pose_path) const;
   std::vector<LaneletPathWithPathInfo> getPredictedReferencePath(
     const TrackedObject & object, const LaneletsData & current_lanelets_data,
-    const double object_detected_time, const double time_horizon);
+    const double object_detected_time, const double time_horizon,
+    ObjectDataUpdate & object_data_update);
   std::vector<PredictedRefPath> convertPredictedReferencePath(
     const TrackedObject & object,
     const std::vector<LaneletPathWithPathInfo> & lanelet_ref_paths) const;
   mutable autoware_utils::LRUCache<lanelet::routing::LaneletPath, std::pair<PosePath, double>>
     lru_cache_of_convert_path_type_{1000};
+  mutable std::mutex lru_cache_mutex_;  // the cache is shared by the prediction threads
   std::pair<PosePath, double> convertLaneletPathToPosePath(
     const lanelet::routing::LaneletPath & path) const;
 
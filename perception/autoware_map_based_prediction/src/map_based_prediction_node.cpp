@@ -22,6 +22,7 @@
 #include <autoware/motion_utils/resample/resample.hpp>
 #include <autoware/motion_utils/trajectory/trajectory.hpp>
 #include <autoware/object_recognition_utils/object_recognition_utils.hpp>
+#include <autoware/universe_utils/system/parallel_for.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_utils/autoware_utils.hpp>
 #include <autoware_utils/geometry/geometry.hpp>
@@ -431,6 +432,12 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
   acceleration_exponential_half_life_ =
     declare_parameter<double>("acceleration_exponential_half_life");
 
+  {  // parallel prediction, 0 uses all the hardware threads
+    const auto num_threads = declare_parameter<int>("num_threads");
+    num_threads_ =
+      autoware::universe_utils::resolveNumThreads(static_cast<size_t>(std::max(num_threads, 0)));
+  }
+
   // initialize VRU predictor
   predictor_vru_ = std::make_unique<PredictorVru>(*this);
 
@@ -513,6 +520,12 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
 
   // debug time keeper
   if (use_time_keeper) {
+    // TimeKeeper only tracks its own thread
+    if (num_threads_ > 1) {
+      RCLCPP_WARN(
+        get_logger(), "publish_processing_time_detail is enabled, predicting on a single thread.");
+      num_threads_ = 1;
+    }
     detailed_processing_time_publisher_ =
       this->create_publisher<autoware_utils::ProcessingTimeDetail>(
         "~/debug/processing_time_detail_ms", 1);
@@ -609,7 +622,10 @@ void MapBasedPredictionNode::mapCallback(const LaneletMapBin::ConstSharedPtr msg
   lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(
     *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
-  lru_cache_of_convert_path_type_.clear();  // clear cache
+  {
+    std::lock_guard<std::mutex> lock(lru_cache_mutex_);
+    lru_cache_of_convert_path_type_.clear();  // clear cache
+  }
   RCLCPP_DEBUG(get_logger(), "[Map Based Prediction]: Map is loaded");
 
   predictor_vru_->setLaneletMap(lanelet_map_ptr_);
@@ -674,9 +690,25 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
   // get current crosswalk users for later prediction
   predictor_vru_->loadCurrentCrosswalkUsers(*in_objects);
 
-  // for each object
-  for (const auto & object : in_objects->objects) {
-    TrackedObject transformed_object = object;
+  // The objects are predicted in stages, the per object work runs on num_threads_ threads:
+  // 1. transform the objects and search the current lanelets of the vehicles (parallel)
+  // 2. update the object history and predict the crosswalk users (serial, in the input order)
+  // 3. predict the vehicles and the unknown objects, only reading the object history (parallel)
+  // 4. apply the object history updates of the stage 3 and merge the results (serial, in order)
+  std::vector<ObjectPredictionTask> tasks(in_objects->objects.size());
+  const auto is_vehicle = [](const std::uint8_t label) {
+    return label == ObjectClassification::CAR || label == ObjectClassification::BUS ||
+           label == ObjectClassification::TRAILER || label == ObjectClassification::MOTORCYCLE ||
+           label == ObjectClassification::TRUCK;
+  };
+  const auto is_crosswalk_user = [](const std::uint8_t label) {
+    return label == ObjectClassification::PEDESTRIAN || label == ObjectClassification::BICYCLE;
+  };
+
+  autoware::universe_utils::parallelForEach(tasks.size(), num_threads_, [&](const size_t i) {
+    const auto & object = in_objects->objects.at(i);
+    auto & task = tasks.at(i);
+    task.transformed_object = object;
 
     // transform object frame if it's based on map frame
     if (is_object_not_in_map_frame) {
@@ -684,47 +716,67 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
       geometry_msgs::msg::PoseStamped pose_orig;
       pose_orig.pose = object.kinematics.pose_with_covariance.pose;
       tf2::doTransform(pose_orig, pose_in_map, *world2map_transform);
-      transformed_object.kinematics.pose_with_covariance.pose = pose_in_map.pose;
+      task.transformed_object.kinematics.pose_with_covariance.pose = pose_in_map.pose;
     }
 
     // get the maximum probability label from the classification array
-    const auto & label_ =
-      autoware::object_recognition_utils::getHighestProbLabel(transformed_object.classification);
+    const auto & label_ = autoware::object_recognition_utils::getHighestProbLabel(
+      task.transformed_object.classification);
     // overwrite the label for VRU in specific cases
-    const auto label = utils::changeVRULabelForPrediction(label_, object, lanelet_map_ptr_);
-
-    switch (label) {
-      case ObjectClassification::PEDESTRIAN:
-      case ObjectClassification::BICYCLE: {
-        // Run pedestrian/bicycle prediction
-        const auto predicted_vru =
-          getPredictionForNonVehicleObject(output.header, transformed_object);
-        output.objects.emplace_back(predicted_vru);
-        break;
-      }
-      case ObjectClassification::CAR:
-      case ObjectClassification::BUS:
-      case ObjectClassification::TRAILER:
-      case ObjectClassification::MOTORCYCLE:
-      case ObjectClassification::TRUCK: {
-        const auto predicted_object_opt = getPredictionForVehicleObject(
-          output.header, transformed_object, objects_detected_time, debug_markers);
-        if (predicted_object_opt) {
-          output.objects.push_back(predicted_object_opt.value());
-        }
-        break;
-      }
-      default: {
-        auto predicted_unknown_object = utils::convertToPredictedObject(transformed_object);
-        PredictedPath predicted_path = path_generator_->generatePathForNonVehicleObject(
-          transformed_object, prediction_time_horizon_.unknown);
-        predicted_path.confidence = 1.0;
-
-        predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
-        output.objects.push_back(predicted_unknown_object);
-        break;
+    task.label = utils::changeVRULabelForPrediction(label_, object, lanelet_map_ptr_);
+    if (!is_vehicle(task.label)) {
+      return;
+    }
+
+    // Update object yaw and velocity
+    task.object = task.transformed_object;
+    updateObjectData(task.object);
+
+    // Get Closest Lanelet
+    task.current_lanelets = utils::getCurrentLanelets(
+      task.object, lanelet_map_ptr_, road_users_history_, dist_threshold_for_searching_lanelet_,
+      delta_yaw_threshold_for_searching_lanelet_, sigma_lateral_offset_, sigma_yaw_angle_deg_);
+  });
+
+  for (auto & task : tasks) {
+    if (is_vehicle(task.label)) {
+      // Update Objects History
+      updateRoadUsersHistory(output.header, task.object, task.current_lanelets);
+    } else if (is_crosswalk_user(task.label)) {
+      // Run pedestrian/bicycle prediction, the predictor keeps the crosswalk users state
+      task.predicted_object =
+        getPredictionForNonVehicleObject(output.header, task.transformed_object);
+    }
+  }
+
+  autoware::universe_utils::parallelForEach(tasks.size(), num_threads_, [&](const size_t i) {
+    auto & task = tasks.at(i);
+    if (is_vehicle(task.label)) {
+      getPredictionForVehicleObject(objects_detected_time, task);
+    } else if (!is_crosswalk_user(task.label)) {
+      auto predicted_unknown_object = utils::convertToPredictedObject(task.transformed_object);
+      PredictedPath predicted_path = path_generator_->generatePathForNonVehicleObject(
+        task.transformed_object, prediction_time_horizon_.unknown);
+      predicted_path.confidence = 1.0;
+
+      predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
+      task.predicted_object = predicted_unknown_object;
+    }
+  });
+
+  for (auto & task : tasks) {
+    if (is_vehicle(task.label)) {
+      applyObjectDataUpdate(
+        autoware_utils::to_hex_string(task.object.object_id), task.object_data_update);
+      // Get Debug Marker for On Lane Vehicles
+      if (pub_debug_markers_ && task.debug_maneuver) {
+        debug_markers.markers.push_back(
+          getDebugMarker(task.object, *task.debug_maneuver, debug_markers.markers.size()));
       }
     }
+    if (task.predicted_object) {
+      output.objects.push_back(std::move(*task.predicted_object));
+    }
   }
 
   // process lost crosswalk users to tackle unstable detection
@@ -869,9 +921,37 @@ void MapBasedPredictionNode::updateRoadUsersHistory(
   }
 }
 
+void MapBasedPredictionNode::applyObjectDataUpdate(
+  const std::string & object_id, const ObjectDataUpdate & update)
+{
+  if (road_users_history_.count(object_id) == 0 || road_users_history_.at(object_id).empty()) {
+    return;
+  }
+  ObjectData & object_data = road_users_history_.at(object_id).back();
+
+  // update maneuver in object history
+  if (update.one_shot_maneuver) {
+    object_data.one_shot_maneuver = *update.one_shot_maneuver;
+  }
+  if (update.output_maneuver) {
+    object_data.output_maneuver = *update.output_maneuver;
+  }
+
+  // update future possible lanelets
+  std::vector<lanelet::ConstLanelet> & possible_lanelets = object_data.future_possible_lanelets;
+  for (const auto & lanelet : update.future_possible_lanelets) {
+    if (
+      std::find(possible_lanelets.begin(), possible_lanelets.end(), lanelet) ==
+      possible_lanelets.end()) {
+      possible_lanelets.push_back(lanelet);
+    }
+  }
+}
+
 std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferencePath(
   const TrackedObject & object, const LaneletsData & current_lanelets_data,
-  const double object_detected_time, const double time_horizon)
+  const double object_detected_time, const double time_horizon,
+  ObjectDataUpdate & object_data_update)
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
@@ -1046,8 +1126,8 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
     }
 
     // b. Predict Object Maneuver
-    const Maneuver predicted_maneuver =
-      predictObjectManeuver(object_id, object_pose, current_lanelet_data, object_detected_time);
+    const Maneuver predicted_maneuver = predictObjectManeuver(
+      object_id, object_pose, current_lanelet_data, object_detected_time, object_data_update);
 
     // c. Allocate probability for each predicted maneuver
     const float & path_prob = current_lanelet_data.probability;
@@ -1063,19 +1143,11 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
       lanelet_ref_paths.end(), ref_paths_per_lanelet.begin(), ref_paths_per_lanelet.end());
   }
 
-  // update future possible lanelets
-  if (road_users_history_.count(object_id) != 0) {
-    std::vector<lanelet::ConstLanelet> & possible_lanelets =
-      road_users_history_.at(object_id).back().future_possible_lanelets;
-    for (const auto & ref_path : lanelet_ref_paths) {
-      for (const auto & lanelet : ref_path.first) {
-        if (
-          std::find(possible_lanelets.begin(), possible_lanelets.end(), lanelet) ==
-          possible_lanelets.end()) {
-          possible_lanelets.push_back(lanelet);
-        }
-      }
-    }
+  // update future possible lanelets, applied to the object history after the prediction
+  for (const auto & ref_path : lanelet_ref_paths) {
+    object_data_update.future_possible_lanelets.insert(
+      object_data_update.future_possible_lanelets.end(), ref_path.first.begin(),
+      ref_path.first.end());
   }
 
   return lanelet_ref_paths;
@@ -1087,7 +1159,8 @@ std::vector<LaneletPathWithPathInfo> MapBasedPredictionNode::getPredictedReferen
  */
 Maneuver MapBasedPredictionNode::predictObjectManeuver(
   const std::string & object_id, const geometry_msgs::msg::Pose & object_pose,
-  const LaneletData & current_lanelet_data, const double object_detected_time)
+  const LaneletData & current_lanelet_data, const double object_detected_time,
+  ObjectDataUpdate & object_data_update)
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
@@ -1107,33 +1180,32 @@ Maneuver MapBasedPredictionNode::predictObjectManeuver(
   if (road_users_history_.count(object_id) == 0) {
     return current_maneuver;
   }
-  auto & object_info = road_users_history_.at(object_id);
+  const auto & object_info = road_users_history_.at(object_id);
 
-  // update maneuver in object history
-  if (!object_info.empty()) {
-    object_info.back().one_shot_maneuver = current_maneuver;
-  }
+  // update maneuver in object history, applied after the prediction
+  object_data_update.one_shot_maneuver = current_maneuver;
 
   // decide maneuver considering previous results
   if (object_info.size() < 2) {
-    object_info.back().output_maneuver = current_maneuver;
+    object_data_update.output_maneuver = current_maneuver;
     return current_maneuver;
   }
   // NOTE: The index of previous maneuver is not object_info.size() - 1
   const auto prev_output_maneuver =
     object_info.at(static_cast<int>(object_info.size()) - 2).output_maneuver;
 
-  for (int i = 0;
+  // NOTE: The latest one shot maneuver is current_maneuver, the check starts from the previous one
+  for (int i = 1;
        i < std::min(num_continuous_state_transition_, static_cast<int>(object_info.size())); ++i) {
     const auto & tmp_maneuver =
       object_info.at(static_cast<int>(object_info.size()) - 1 - i).one_shot_maneuver;
     if (tmp_maneuver != current_maneuver) {
-      object_info.back().output_maneuver = prev_output_maneuver;
+      object_data_update.output_maneuver = prev_output_maneuver;
       return prev_output_maneuver;
     }
   }
 
-  object_info.back().output_maneuver = current_maneuver;
+  object_data_update.output_maneuver = current_maneuver;
   return current_maneuver;
 }
 
@@ -1458,8 +1530,11 @@ std::pair<PosePath, double> MapBasedPredictionNode::convertLaneletPathToPosePath
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  if (lru_cache_of_convert_path_type_.contains(path)) {
-    return *lru_cache_of_convert_path_type_.get(path);
+  {
+    std::lock_guard<std::mutex> lock(lru_cache_mutex_);
+    if (lru_cache_of_convert_path_type_.contains(path)) {
+      return *lru_cache_of_convert_path_type_.get(path);
+    }
   }
 
   std::pair<PosePath, double> converted_path_and_width;
@@ -1555,6 +1630,8 @@ std::pair<PosePath, double> MapBasedPredictionNode::convertLaneletPathToPosePath
     converted_path_and_width = std::make_pair(resampled_converted_path, width);
   }
 
+  // NOTE: Another thread may have converted the same path meanwhile, the result is the same
+  std::lock_guard<std::mutex> lock(lru_cache_mutex_);
   lru_cache_of_convert_path_type_.put(path, converted_path_and_width);
   return converted_path_and_width;
 }
@@ -1565,22 +1642,13 @@ PredictedObject MapBasedPredictionNode::getPredictionForNonVehicleObject(
   return predictor_vru_->predict(header, object);
 }
 
-std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleObject(
-  const std_msgs::msg::Header & header, const TrackedObject & transformed_object,
-  const double objects_detected_time, visualization_msgs::msg::MarkerArray & debug_markers)
+void MapBasedPredictionNode::getPredictionForVehicleObject(
+  const double objects_detected_time, ObjectPredictionTask & task)
 {
-  auto object = transformed_object;
-
-  // Update object yaw and velocity
-  updateObjectData(object);
-
-  // Get Closest Lanelet
-  const auto current_lanelets = utils::getCurrentLanelets(
-    object, lanelet_map_ptr_, road_users_history_, dist_threshold_for_searching_lanelet_,
-    delta_yaw_threshold_for_searching_lanelet_, sigma_lateral_offset_, sigma_yaw_angle_deg_);
-
-  // Update Objects History
-  updateRoadUsersHistory(header, object, current_lanelets);
+  // NOTE: The object history is read only here, the changes go to task.object_data_update
+  const auto & transformed_object = task.transformed_object;
+  const auto & object = task.object;
+  const auto & current_lanelets = task.current_lanelets;
 
   // For off lane obstacles
   if (current_lanelets.empty()) {
@@ -1588,12 +1656,13 @@ std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleOb
       path_generator_->generatePathForOffLaneVehicle(object, prediction_time_horizon_.vehicle);
     predicted_path.confidence = 1.0;
     if (predicted_path.path.empty()) {
-      return std::nullopt;
+      return;
     }
 
     auto predicted_object_vehicle = utils::convertToPredictedObject(object);
     predicted_object_vehicle.kinematics.predicted_paths.push_back(predicted_path);
-    return predicted_object_vehicle;
+    task.predicted_object = predicted_object_vehicle;
+    return;
   }
 
   // For too-slow vehicle
@@ -1605,18 +1674,20 @@ std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleOb
       path_generator_->generatePathForLowSpeedVehicle(object, prediction_time_horizon_.vehicle);
     predicted_path.confidence = 1.0;
     if (predicted_path.path.empty()) {
-      return std::nullopt;
+      return;
     }
 
     auto predicted_slow_object = utils::convertToPredictedObject(object);
     predicted_slow_object.kinematics.predicted_paths.push_back(predicted_path);
-    return predicted_slow_object;
+    task.predicted_object = predicted_slow_object;
+    return;
   }
 
   // Get Predicted Reference Path for Each Maneuver and current lanelets
   // return: <probability, paths>
   const auto lanelet_ref_paths = getPredictedReferencePath(
-    object, current_lanelets, objects_detected_time, prediction_time_horizon_.vehicle);
+    object, current_lanelets, objects_detected_time, prediction_time_horizon_.vehicle,
+    task.object_data_update);
   const auto ref_paths = convertPredictedReferencePath(object, lanelet_ref_paths);
 
   // If predicted reference path is empty, assume this object is out of the lane
@@ -1625,24 +1696,23 @@ std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleOb
       path_generator_->generatePathForOffLaneVehicle(object, prediction_time_horizon_.vehicle);
     predicted_path.confidence = 1.0;
     if (predicted_path.path.empty()) {
-      return std::nullopt;
+      return;
     }
 
     auto predicted_object_out_of_lane = utils::convertToPredictedObject(object);
     predicted_object_out_of_lane.kinematics.predicted_paths.push_back(predicted_path);
-    return predicted_object_out_of_lane;
+    task.predicted_object = predicted_object_out_of_lane;
+    return;
   }
 
-  // Get Debug Marker for On Lane Vehicles
+  // Get Debug Marker for On Lane Vehicles, the markers are numbered in the merge
   if (pub_debug_markers_) {
     const auto max_prob_path = std::max_element(
       ref_paths.begin(), ref_paths.end(),
       [](const PredictedRefPath & a, const PredictedRefPath & b) {
         return a.probability < b.probability;
       });
-    const auto debug_marker =
-      getDebugMarker(object, max_prob_path->maneuver, debug_markers.markers.size());
-    debug_markers.markers.push_back(debug_marker);
+    task.debug_maneuver = max_prob_path->maneuver;
   }
 
   // Fix object angle if its orientation unreliable (e.g. far object by radar sensor)
@@ -1718,7 +1788,7 @@ std::optional<PredictedObject> MapBasedPredictionNode::getPredictionForVehicleOb
     if (predicted_object.kinematics.predicted_paths.size() >= 100) break;
     predicted_object.kinematics.predicted_paths.push_back(predicted_path);
   }
-  return predicted_object;
+  task.predicted_object = predicted_object;
 }
 
 std::optional<size_t> MapBasedPredictionNode::searchProperStartingRefPathIndex(
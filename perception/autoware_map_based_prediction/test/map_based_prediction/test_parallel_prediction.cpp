@@ -0,0 +1,229 @@
+// Copyright 2025 TIER IV, inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "map_based_prediction/map_based_prediction_node.hpp"
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware_lanelet2_extension/utility/message_conversion.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_utils/geometry/geometry.hpp>
+
+#include <autoware_perception_msgs/msg/predicted_objects.hpp>
+#include <autoware_perception_msgs/msg/tracked_objects.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/primitives/LineString.h>
+#include <lanelet2_core/primitives/Point.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware::map_based_prediction::MapBasedPredictionNode;
+using autoware::test_utils::AutowareTestManager;
+using autoware_map_msgs::msg::LaneletMapBin;
+using autoware_perception_msgs::msg::ObjectClassification;
+using autoware_perception_msgs::msg::PredictedObjects;
+using autoware_perception_msgs::msg::Shape;
+using autoware_perception_msgs::msg::TrackedObject;
+using autoware_perception_msgs::msg::TrackedObjectKinematics;
+using autoware_perception_msgs::msg::TrackedObjects;
+
+constexpr double lane_width = 3.5;
+constexpr double segment_length = 50.0;
+constexpr int num_lanes = 3;
+constexpr int num_segments = 4;
+
+/**
+ * @brief Create a map of num_lanes parallel straight lanes along x, the lane i is centered on
+ * y = i * lane_width. Each lane is a chain of num_segments lanelets and the lanes are separated by
+ * dashed lines, so that the routing graph has successors and lane changes.
+ */
+LaneletMapBin createStraightLanesMapMsg()
+{
+  // boundary_points[line][k] is the point of the line at x = k * segment_length
+  std::vector<std::vector<lanelet::Point3d>> boundary_points(num_lanes + 1);
+  for (int line = 0; line <= num_lanes; ++line) {
+    const double y = (line - 0.5) * lane_width;
+    for (int k = 0; k <= num_segments; ++k) {
+      boundary_points[line].emplace_back(lanelet::utils::getId(), k * segment_length, y, 0.0);
+    }
+  }
+
+  auto lanelet_map = std::make_shared<lanelet::LaneletMap>();
+  for (int k = 0; k < num_segments; ++k) {
+    std::vector<lanelet::LineString3d> lines;
+    for (int line = 0; line <= num_lanes; ++line) {
+      lanelet::LineString3d line_string(
+        lanelet::utils::getId(), {boundary_points[line][k], boundary_points[line][k + 1]});
+      const bool is_road_border = line == 0 || line == num_lanes;
+      line_string.attributes()[lanelet::AttributeName::Type] =
+        is_road_border ? lanelet::AttributeValueString::RoadBorder
+                       : lanelet::AttributeValueString::LineThin;
+      if (!is_road_border) {
+        line_string.attributes()[lanelet::AttributeName::Subtype] =
+          lanelet::AttributeValueString::Dashed;
+      }
+      lines.push_back(line_string);
+    }
+    for (int lane = 0; lane < num_lanes; ++lane) {
+      lanelet::Lanelet lanelet(lanelet::utils::getId(), lines[lane + 1], lines[lane]);
+      lanelet.attributes()[lanelet::AttributeName::Subtype] = lanelet::AttributeValueString::Road;
+      lanelet.attributes()[lanelet::AttributeName::SpeedLimit] = "50";
+      lanelet_map->add(lanelet);
+    }
+  }
+
+  LaneletMapBin map_bin_msg;
+  lanelet::utils::conversion::toBinMsg(lanelet_map, &map_bin_msg);
+  map_bin_msg.header.frame_id = "map";
+  return map_bin_msg;
+}
+
+TrackedObject createObject(
+  const std::uint8_t id, const std::uint8_t label, const double x, const double y,
+  const double vx, const double vy)
+{
+  TrackedObject object;
+  object.object_id.uuid.at(0) = id;
+  object.object_id.uuid.at(1) = 1;
+  object.existence_probability = 1.0;
+
+  ObjectClassification classification;
+  classification.label = label;
+  classification.probability = 1.0;
+  object.classification.push_back(classification);
+
+  auto & kinematics = object.kinematics;
+  kinematics.pose_with_covariance.pose.position = autoware_utils::create_point(x, y, 0.0);
+  kinematics.pose_with_covariance.pose.orientation = autoware_utils::create_quaternion_from_yaw(0.0);
+  kinematics.twist_with_covariance.twist.linear.x = vx;
+  kinematics.twist_with_covariance.twist.linear.y = vy;
+  kinematics.orientation_availability = TrackedObjectKinematics::SIGN_UNKNOWN;
+
+  const bool is_pedestrian = label == ObjectClassification::PEDESTRIAN;
+  object.shape.type = is_pedestrian ? Shape::CYLINDER : Shape::BOUNDING_BOX;
+  object.shape.dimensions =
+    is_pedestrian ? autoware_utils::create_vector3(0.6, 0.6, 1.7)
+                  : autoware_utils::create_vector3(4.5, 1.8, 1.5);
+  return object;
+}
+
+/**
+ * @brief Create a dense traffic frame: vehicles on every lane (some of them changing lane, some
+ * of them too slow for the map based prediction), vehicles off the map, pedestrians on the road
+ * side and unknown objects.
+ */
+TrackedObjects createObjects(const int frame, const double dt)
+{
+  TrackedObjects objects;
+  objects.header.frame_id = "map";
+  objects.header.stamp = rclcpp::Time(static_cast<int64_t>(frame * dt * 1e9), RCL_ROS_TIME);
+
+  const double t = frame * dt;
+  const std::uint8_t vehicle_labels[] = {
+    ObjectClassification::CAR, ObjectClassification::TRUCK, ObjectClassification::BUS,
+    ObjectClassification::MOTORCYCLE, ObjectClassification::TRAILER};
+  std::uint8_t id = 0;
+  for (int i = 0; i < 60; ++i, ++id) {
+    const double lateral_velocity = (i % 4 == 0) ? 0.8 : 0.0;  // drifting to the left lane
+    const double velocity = (i % 7 == 0) ? 0.5 : 10.0;
+    const double x = 5.0 + 3.0 * i + velocity * t;
+    const double y = (i % num_lanes) * lane_width + lateral_velocity * t;
+    objects.objects.push_back(
+      createObject(id, vehicle_labels[i % 5], x, y, velocity, lateral_velocity));
+  }
+  for (int i = 0; i < 3; ++i, ++id) {
+    objects.objects.push_back(
+      createObject(id, ObjectClassification::CAR, 20.0 * i + 10.0 * t, 40.0, 10.0, 0.0));
+  }
+  for (int i = 0; i < 10; ++i, ++id) {
+    objects.objects.push_back(
+      createObject(id, ObjectClassification::PEDESTRIAN, 15.0 * i, -4.0, 0.0, 1.2));
+  }
+  for (int i = 0; i < 5; ++i, ++id) {
+    objects.objects.push_back(
+      createObject(id, ObjectClassification::UNKNOWN, 30.0 * i + 7.0, 1.0, 2.0, 0.0));
+  }
+  return objects;
+}
+
+std::shared_ptr<MapBasedPredictionNode> generateNode(const std::string & name, const int num_threads)
+{
+  auto node_options = rclcpp::NodeOptions{};
+  const auto package_dir =
+    ament_index_cpp::get_package_share_directory("autoware_map_based_prediction");
+  node_options.arguments(
+    {"--ros-args", "--params-file", package_dir + "/config/map_based_prediction.param.yaml", "-r",
+     "__node:=" + name});
+  node_options.append_parameter_override("num_threads", num_threads);
+  // The node clock is used in the lane change detection, the simulated clock stays at 0
+  node_options.append_parameter_override("use_sim_time", true);
+  return std::make_shared<MapBasedPredictionNode>(node_options);
+}
+}  // namespace
+
+TEST(MapBasedPredictionNode, parallelPredictionMatchesSerial)
+{
+  auto test_manager = std::make_shared<AutowareTestManager>();
+  auto serial_node = generateNode("serial_prediction", 1);
+  auto parallel_node = generateNode("parallel_prediction", 4);
+
+  std::vector<PredictedObjects> serial_outputs;
+  std::vector<PredictedObjects> parallel_outputs;
+  test_manager->set_subscriber<PredictedObjects>(
+    "/serial_prediction/output/objects",
+    [&serial_outputs](const PredictedObjects::ConstSharedPtr msg) {
+      serial_outputs.push_back(*msg);
+    });
+  test_manager->set_subscriber<PredictedObjects>(
+    "/parallel_prediction/output/objects",
+    [&parallel_outputs](const PredictedObjects::ConstSharedPtr msg) {
+      parallel_outputs.push_back(*msg);
+    });
+
+  auto map_msg = createStraightLanesMapMsg();
+  const auto map_qos = rclcpp::QoS(1).transient_local();
+  test_manager->test_pub_msg<LaneletMapBin>(serial_node, "/vector_map", map_msg, map_qos);
+  test_manager->test_pub_msg<LaneletMapBin>(parallel_node, "/vector_map", map_msg, map_qos);
+
+  // Several frames, so that the object history and the lane change detection are used
+  constexpr int num_frames = 10;
+  constexpr double dt = 0.1;
+  for (int frame = 0; frame < num_frames; ++frame) {
+    auto objects = createObjects(frame, dt);
+    test_manager->test_pub_msg<TrackedObjects>(
+      serial_node, "/serial_prediction/input/objects", objects);
+    test_manager->test_pub_msg<TrackedObjects>(
+      parallel_node, "/parallel_prediction/input/objects", objects);
+  }
+
+  ASSERT_EQ(serial_outputs.size(), static_cast<size_t>(num_frames));
+  ASSERT_EQ(parallel_outputs.size(), serial_outputs.size());
+  for (size_t frame = 0; frame < serial_outputs.size(); ++frame) {
+    const auto & serial_objects = serial_outputs.at(frame).objects;
+    const auto & parallel_objects = parallel_outputs.at(frame).objects;
+    EXPECT_FALSE(serial_objects.empty());
+    ASSERT_EQ(serial_objects.size(), parallel_objects.size()) << "frame " << frame;
+    for (size_t i = 0; i < serial_objects.size(); ++i) {
+      // same objects in the same order, with the same predicted paths
+      EXPECT_EQ(serial_objects.at(i), parallel_objects.at(i)) << "frame " << frame << ", " << i;
+    }
+  }
+}
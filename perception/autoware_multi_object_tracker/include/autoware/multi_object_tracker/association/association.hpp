@@ -36,7 +36,6 @@
 #include <boost/geometry/geometries/point.hpp>
 #include <boost/geometry/index/rtree.hpp>
 
-#include <list>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -51,7 +50,7 @@ namespace bgi = boost::geometry::index;
 // Define point and box types for R-tree
 typedef bg::model::point<double, 2, bg::cs::cartesian> Point;
 typedef bg::model::box<Point> Box;
-typedef std::pair<Point, size_t> ValueType;  // Point and tracker index
+typedef std::pair<Point, size_t> ValueType;  // Point and index slot
 
 struct AssociatorConfig
 {
@@ -78,8 +77,30 @@ private:
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
   std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_;
 
-  // R-tree for spatial indexing of trackers
+  // R-tree for spatial indexing of trackers, kept between calls. A tracker is re-inserted only
+  // when it moved more than index_update_tolerance_ from its indexed point, and the queries are
+  // enlarged by this tolerance.
+  struct IndexSlot
+  {
+    Point point;
+    size_t tracker_idx{0};  // row of the tracker in the current score matrix
+    size_t generation{0};   // last calcScoreMatrix call which saw the tracker
+  };
+  static constexpr double index_update_tolerance_ = 1.0;  // [m]
   bgi::rtree<ValueType, bgi::quadratic<16>> rtree_;
+  std::vector<IndexSlot> index_slots_;
+  std::vector<size_t> free_index_slots_;
+  std::unordered_map<const Tracker *, size_t> tracker_index_slots_;
+  size_t index_generation_{0};
+
+  // Buffers reused between calls
+  std::vector<types::DynamicObject> tracked_objects_;
+  std::vector<std::uint8_t> tracker_labels_;
+  std::vector<TrackerType> tracker_types_;
+  std::vector<InverseCovariance2D> tracker_inverse_covariances_;
+
+  size_t num_threads_{1};
+
   // Cache of maximum squared distances per measurement class
   // For each measurement class, stores the maximum squared distance it could match with any tracker
   // class
@@ -91,8 +112,22 @@ private:
   /// Checker for (tracker_idx, measurement_idx) pairs flagged for significant shape change
   IndexPairChecker significant_shape_change_checker_;
 
+  struct ScoreEntry
+  {
+    size_t tracker_idx;
+    size_t measurement_idx;
+    double score;
+  };
+
   // Helper to compute max search distances from config
   void updateMaxSearchDistances();
+  // Compute the non-zero scores, one list per worker, and the significant shape change pairs
+  void calcScores(
+    const types::DynamicObjectList & measurements,
+    const std::vector<std::shared_ptr<Tracker>> & trackers,
+    std::vector<std::vector<ScoreEntry>> & worker_scores);
+  // Insert, move and remove the trackers of the R-tree so that it matches the tracker list
+  void updateSpatialIndex(const std::vector<std::shared_ptr<Tracker>> & trackers);
 
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -102,6 +137,9 @@ public:
   void assign(
     const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
     std::unordered_map<int, int> & reverse_assignment);
+  void assign(
+    const gnn_solver::SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
+    std::unordered_map<int, int> & reverse_assignment);
 
   double calculateScore(
     const types::DynamicObject & tracked_object, const std::uint8_t tracker_label,
@@ -110,7 +148,11 @@ public:
 
   Eigen::MatrixXd calcScoreMatrix(
     const types::DynamicObjectList & measurements,
-    const std::list<std::shared_ptr<Tracker>> & trackers);
+    const std::vector<std::shared_ptr<Tracker>> & trackers);
+  // Same scores as calcScoreMatrix, only the non-zero ones are stored
+  gnn_solver::SparseScoreMatrix calcSparseScoreMatrix(
+    const types::DynamicObjectList & measurements,
+    const std::vector<std::shared_ptr<Tracker>> & trackers);
 
   const double CHECK_GIOU_THRESHOLD = 0.7;
   const double AREA_RATIO_THRESHOLD = 1.3;
@@ -120,6 +162,9 @@ public:
   }
 
   void setTimeKeeper(std::shared_ptr<autoware_utils_debug::TimeKeeper> time_keeper_ptr);
+  // Number of threads used to build the score matrix and to solve the sparse assignment, 0 uses
+  // all the hardware threads
+  void setNumThreads(size_t num_threads);
 };
 
 }  // namespace autoware::multi_object_tracker
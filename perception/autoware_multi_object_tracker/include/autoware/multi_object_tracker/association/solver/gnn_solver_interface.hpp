@@ -15,6 +15,8 @@
 #ifndef AUTOWARE__MULTI_OBJECT_TRACKER__ASSOCIATION__SOLVER__GNN_SOLVER_INTERFACE_HPP_
 #define AUTOWARE__MULTI_OBJECT_TRACKER__ASSOCIATION__SOLVER__GNN_SOLVER_INTERFACE_HPP_
 
+#include <algorithm>
+#include <cstddef>
 #include <unordered_map>
 #include <vector>
 
@@ -22,6 +24,31 @@ namespace autoware::multi_object_tracker
 {
 namespace gnn_solver
 {
+/// Score matrix in the compressed sparse row (CSR) format, the rows are the trackers and the
+/// columns are the measurements. Only the non-zero scores are stored.
+struct SparseScoreMatrix
+{
+  size_t rows{0};
+  size_t cols{0};
+  // The scores of the row r are at [row_offsets[r], row_offsets[r + 1]), size is rows + 1
+  std::vector<size_t> row_offsets{0};
+  // Column of each score, increasing in a row
+  std::vector<int> col_indices;
+  std::vector<double> values;
+
+  size_t nonZeros() const { return values.size(); }
+
+  /// @return The score of (row, col), 0.0 if it is not stored
+  double get(const size_t row, const size_t col) const
+  {
+    const auto begin = col_indices.begin() + row_offsets[row];
+    const auto end = col_indices.begin() + row_offsets[row + 1];
+    const auto itr = std::lower_bound(begin, end, static_cast<int>(col));
+    if (itr == end || *itr != static_cast<int>(col)) return 0.0;
+    return values[row_offsets[row] + (itr - begin)];
+  }
+};
+
 class GnnSolverInterface
 {
 public:
@@ -31,6 +58,18 @@ public:
   virtual void maximizeLinearAssignment(
     const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
     std::unordered_map<int, int> * reverse_assignment) = 0;
+
+  /// Splits the sparse problem into its connected components and solves each of them with the
+  /// dense maximizeLinearAssignment, on num_threads threads. The dense solver must be reentrant.
+  virtual void maximizeLinearAssignment(
+    const SparseScoreMatrix & score, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment);
+
+  /// Number of threads for the sparse problems, 0 uses all the hardware threads
+  void setNumThreads(size_t num_threads);
+
+protected:
+  size_t num_threads_{1};
 };
 
 }  // namespace gnn_solver
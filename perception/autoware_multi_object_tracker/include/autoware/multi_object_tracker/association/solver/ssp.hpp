@@ -30,6 +30,8 @@ public:
   SSP() = default;
   ~SSP() = default;
 
+  using GnnSolverInterface::maximizeLinearAssignment;
+
   void maximizeLinearAssignment(
     const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
     std::unordered_map<int, int> * reverse_assignment) override
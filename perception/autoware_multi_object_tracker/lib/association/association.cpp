@@ -19,10 +19,12 @@
 #include "autoware/multi_object_tracker/object_model/types.hpp"
 
 #include <autoware/object_recognition_utils/object_recognition_utils.hpp>
+#include <autoware/universe_utils/system/parallel_for.hpp>
 
 #include <algorithm>
 #include <array>
-#include <list>
+#include <cmath>
+#include <iterator>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -31,10 +33,15 @@
 namespace
 {
 constexpr double INVALID_SCORE = 0.0;
+// Minimum work per thread, below it the thread creation costs more than it saves
+constexpr size_t min_trackers_per_thread = 64;
+constexpr size_t min_measurements_per_thread = 32;
 }  // namespace
 
 namespace autoware::multi_object_tracker
 {
+using autoware::universe_utils::parallelFor;
+using autoware::universe_utils::resolveNumThreads;
 using autoware_utils_debug::ScopedTimeTrack;
 using Label = autoware_perception_msgs::msg::ObjectClassification;
 
@@ -52,6 +59,12 @@ void DataAssociation::setTimeKeeper(
   time_keeper_ = std::move(time_keeper_ptr);
 }
 
+void DataAssociation::setNumThreads(size_t num_threads)
+{
+  num_threads_ = resolveNumThreads(num_threads);
+  gnn_solver_ptr_->setNumThreads(num_threads_);
+}
+
 void DataAssociation::updateMaxSearchDistances()
 {
   const int num_classes = config_.max_dist_matrix.cols();
@@ -104,6 +117,32 @@ void DataAssociation::assign(
   }
 }
 
+void DataAssociation::assign(
+  const gnn_solver::SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
+  std::unordered_map<int, int> & reverse_assignment)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  // Solve, the solver splits the problem into its connected components
+  gnn_solver_ptr_->maximizeLinearAssignment(src, &direct_assignment, &reverse_assignment);
+
+  for (auto itr = direct_assignment.begin(); itr != direct_assignment.end();) {
+    if (src.get(itr->first, itr->second) < score_threshold_) {
+      itr = direct_assignment.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+  for (auto itr = reverse_assignment.begin(); itr != reverse_assignment.end();) {
+    if (src.get(itr->second, itr->first) < score_threshold_) {
+      itr = reverse_assignment.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+}
+
 inline double getMahalanobisDistanceFast(double dx, double dy, const InverseCovariance2D & inv_cov)
 {
   return dx * dx * inv_cov.inv00 + 2.0 * dx * dy * inv_cov.inv01 + dy * dy * inv_cov.inv11;
@@ -130,9 +169,169 @@ inline InverseCovariance2D precomputeInverseCovarianceFromPose(
   return result;
 }
 
+void DataAssociation::updateSpatialIndex(const std::vector<std::shared_ptr<Tracker>> & trackers)
+{
+  ++index_generation_;
+  constexpr double squared_tolerance = index_update_tolerance_ * index_update_tolerance_;
+  for (size_t tracker_idx = 0; tracker_idx < trackers.size(); ++tracker_idx) {
+    const auto & position = tracked_objects_[tracker_idx].pose.position;
+    const Point point(position.x, position.y);
+
+    auto [slot_itr, is_new] = tracker_index_slots_.try_emplace(trackers[tracker_idx].get(), 0);
+    if (is_new) {
+      if (free_index_slots_.empty()) {
+        slot_itr->second = index_slots_.size();
+        index_slots_.emplace_back();
+      } else {
+        slot_itr->second = free_index_slots_.back();
+        free_index_slots_.pop_back();
+      }
+      index_slots_[slot_itr->second].point = point;
+      rtree_.insert(std::make_pair(point, slot_itr->second));
+    } else {
+      auto & slot = index_slots_[slot_itr->second];
+      const double dx = position.x - slot.point.get<0>();
+      const double dy = position.y - slot.point.get<1>();
+      if (dx * dx + dy * dy > squared_tolerance) {
+        rtree_.remove(std::make_pair(slot.point, slot_itr->second));
+        slot.point = point;
+        rtree_.insert(std::make_pair(point, slot_itr->second));
+      }
+    }
+    index_slots_[slot_itr->second].tracker_idx = tracker_idx;
+    index_slots_[slot_itr->second].generation = index_generation_;
+  }
+
+  // Remove the trackers which are not in the list anymore
+  for (auto itr = tracker_index_slots_.begin(); itr != tracker_index_slots_.end();) {
+    auto & slot = index_slots_[itr->second];
+    if (slot.generation == index_generation_) {
+      ++itr;
+      continue;
+    }
+    rtree_.remove(std::make_pair(slot.point, itr->second));
+    free_index_slots_.push_back(itr->second);
+    itr = tracker_index_slots_.erase(itr);
+  }
+}
+
+void DataAssociation::calcScores(
+  const types::DynamicObjectList & measurements,
+  const std::vector<std::shared_ptr<Tracker>> & trackers,
+  std::vector<std::vector<ScoreEntry>> & worker_scores)
+{
+  // Clear previous tracker/measurement pair that shape significantly changed
+  significant_shape_change_checker_.clear();
+
+  // Store tracker data, each tracker only updates its own cache
+  tracked_objects_.resize(trackers.size());
+  tracker_labels_.resize(trackers.size());
+  tracker_types_.resize(trackers.size());
+  tracker_inverse_covariances_.resize(trackers.size());
+  parallelFor(
+    trackers.size(), num_threads_, min_trackers_per_thread, [&](size_t begin, size_t end, size_t) {
+      for (size_t tracker_idx = begin; tracker_idx < end; ++tracker_idx) {
+        const auto & tracker = trackers[tracker_idx];
+        auto & tracked_object = tracked_objects_[tracker_idx];
+        tracker->getTrackedObject(measurements.header.stamp, tracked_object);
+        tracker_labels_[tracker_idx] = tracker->getHighestProbLabel();
+        tracker_types_[tracker_idx] = tracker->getTrackerType();
+        // Pre-compute inverse covariance for each tracker
+        tracker_inverse_covariances_[tracker_idx] =
+          precomputeInverseCovarianceFromPose(tracked_object.pose_covariance);
+      }
+    });
+
+  // Update the R-tree with the moved, new and removed trackers
+  updateSpatialIndex(trackers);
+
+  // For each measurement, find nearby trackers using R-tree. The measurements are split between
+  // the workers in increasing order, each worker collects its own non-zero scores.
+  worker_scores.assign(std::max<size_t>(1, num_threads_), {});
+  std::vector<std::vector<std::pair<size_t, size_t>>> shape_change_pairs(worker_scores.size());
+  parallelFor(
+    measurements.objects.size(), num_threads_, min_measurements_per_thread,
+    [&](size_t begin, size_t end, size_t worker) {
+      std::vector<ValueType> nearby_trackers;
+      nearby_trackers.reserve(std::min(size_t{100}, trackers.size()));
+      for (size_t measurement_idx = begin; measurement_idx < end; ++measurement_idx) {
+        const auto & measurement_object = measurements.objects[measurement_idx];
+        const auto measurement_label = autoware::object_recognition_utils::getHighestProbLabel(
+          measurement_object.classification);
+        if (measurement_label >= types::NUM_LABELS) {
+          RCLCPP_WARN(
+            rclcpp::get_logger("DataAssociation"),
+            "Measurement label %d is out of range. Skipping association.",
+            static_cast<int>(measurement_label));
+          continue;
+        }
+
+        // Get pre-computed maximum squared distance for this measurement class
+        const double max_squared_dist = max_squared_dist_per_class_[measurement_label];
+
+        Point measurement_point(
+          measurement_object.pose.position.x, measurement_object.pose.position.y);
+
+        // Compute search bounding box (square that contains the circle)
+        const double max_dist = std::sqrt(max_squared_dist);
+        const Box query_box(
+          Point(measurement_point.get<0>() - max_dist, measurement_point.get<1>() - max_dist),
+          Point(measurement_point.get<0>() + max_dist, measurement_point.get<1>() + max_dist));
+        // The indexed points may be off by the update tolerance, query an enlarged box and
+        // check the current tracker positions against the search box
+        const double index_max_dist = max_dist + index_update_tolerance_;
+        const Box index_query_box(
+          Point(
+            measurement_point.get<0>() - index_max_dist,
+            measurement_point.get<1>() - index_max_dist),
+          Point(
+            measurement_point.get<0>() + index_max_dist,
+            measurement_point.get<1>() + index_max_dist));
+        nearby_trackers.clear();
+        rtree_.query(bgi::within(index_query_box), std::back_inserter(nearby_trackers));
+
+        // Process nearby trackers
+        for (const auto & tracker_value : nearby_trackers) {
+          const size_t tracker_idx = index_slots_[tracker_value.second].tracker_idx;
+          const auto & tracked_object = tracked_objects_[tracker_idx];
+          const Point tracker_point(
+            tracked_object.pose.position.x, tracked_object.pose.position.y);
+          if (!bg::within(tracker_point, query_box)) continue;
+
+          // Check if this tracker can be assigned to the measurement
+          const auto tracker_type = tracker_types_[tracker_idx];
+          bool can_assign =
+            config_.can_assign_map.at(tracker_type)[static_cast<int>(measurement_label)];
+          if (!can_assign) continue;
+
+          // Calculate score for this tracker-measurement pair
+          const auto tracker_label = tracker_labels_[tracker_idx];
+
+          bool has_significant_shape_change = false;
+          double score = calculateScore(
+            tracked_object, tracker_label, measurement_object, measurement_label,
+            tracker_inverse_covariances_[tracker_idx], has_significant_shape_change);
+          if (score > INVALID_SCORE) {
+            worker_scores[worker].push_back({tracker_idx, measurement_idx, score});
+          }
+
+          if (has_significant_shape_change) {
+            shape_change_pairs[worker].emplace_back(tracker_idx, measurement_idx);
+          }
+        }
+      }
+    });
+
+  for (const auto & pairs : shape_change_pairs) {
+    for (const auto & [tracker_idx, measurement_idx] : pairs) {
+      significant_shape_change_checker_.addPair(tracker_idx, measurement_idx);
+    }
+  }
+}
+
 Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   const types::DynamicObjectList & measurements,
-  const std::list<std::shared_ptr<Tracker>> & trackers)
+  const std::vector<std::shared_ptr<Tracker>> & trackers)
 {
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
@@ -142,106 +341,60 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
     return Eigen::MatrixXd();
   }
 
+  std::vector<std::vector<ScoreEntry>> worker_scores;
+  calcScores(measurements, trackers, worker_scores);
+
   // Initialize the score matrix
   Eigen::MatrixXd score_matrix =
     Eigen::MatrixXd::Zero(trackers.size(), measurements.objects.size());
-
-  // Clear previous tracker/measurement pair that shape significantly changed
-  significant_shape_change_checker_.clear();
-
-  // Pre-allocate vectors to avoid reallocations
-  std::vector<types::DynamicObject> tracked_objects;
-  std::vector<std::uint8_t> tracker_labels;
-  std::vector<TrackerType> tracker_types;
-  tracked_objects.reserve(trackers.size());
-  tracker_labels.reserve(trackers.size());
-  tracker_types.reserve(trackers.size());
-  // Build R-tree and store tracker data
-  {
-    size_t tracker_idx = 0;
-    std::vector<ValueType> rtree_points;
-    rtree_.clear();
-    rtree_points.reserve(trackers.size());
-    for (const auto & tracker : trackers) {
-      types::DynamicObject tracked_object;
-      tracker->getTrackedObject(measurements.header.stamp, tracked_object);
-      tracked_objects.push_back(tracked_object);
-      tracker_labels.push_back(tracker->getHighestProbLabel());
-      tracker_types.push_back(tracker->getTrackerType());
-
-      Point p(tracked_object.pose.position.x, tracked_object.pose.position.y);
-      rtree_points.push_back(std::make_pair(p, tracker_idx));
-      ++tracker_idx;
+  for (const auto & scores : worker_scores) {
+    for (const auto & entry : scores) {
+      score_matrix(entry.tracker_idx, entry.measurement_idx) = entry.score;
     }
-    rtree_.insert(rtree_points.begin(), rtree_points.end());
   }
+  return score_matrix;
+}
 
-  // Pre-compute inverse covariance for each tracker
-  std::vector<InverseCovariance2D> tracker_inverse_covariances;
-  tracker_inverse_covariances.reserve(tracked_objects.size());
-  for (const auto & tracked_object : tracked_objects) {
-    tracker_inverse_covariances.push_back(
-      precomputeInverseCovarianceFromPose(tracked_object.pose_covariance));
+gnn_solver::SparseScoreMatrix DataAssociation::calcSparseScoreMatrix(
+  const types::DynamicObjectList & measurements,
+  const std::vector<std::shared_ptr<Tracker>> & trackers)
+{
+  std::unique_ptr<ScopedTimeTrack> st_ptr;
+  if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
+
+  gnn_solver::SparseScoreMatrix score_matrix;
+  score_matrix.rows = trackers.size();
+  score_matrix.cols = measurements.objects.size();
+  score_matrix.row_offsets.assign(score_matrix.rows + 1, 0);
+  // Ensure that the detected_objects and list_tracker are not empty
+  if (measurements.objects.empty() || trackers.empty()) {
+    return score_matrix;
   }
 
-  // For each measurement, find nearby trackers using R-tree
-
-  for (size_t measurement_idx = 0; measurement_idx < measurements.objects.size();
-       ++measurement_idx) {
-    const auto & measurement_object = measurements.objects[measurement_idx];
-    const auto measurement_label =
-      autoware::object_recognition_utils::getHighestProbLabel(measurement_object.classification);
-    if (measurement_label >= types::NUM_LABELS) {
-      RCLCPP_WARN(
-        rclcpp::get_logger("DataAssociation"),
-        "Measurement label %d is out of range. Skipping association.",
-        static_cast<int>(measurement_label));
-      continue;
-    }
+  std::vector<std::vector<ScoreEntry>> worker_scores;
+  calcScores(measurements, trackers, worker_scores);
 
-    // Get pre-computed maximum squared distance for this measurement class
-    const double max_squared_dist = max_squared_dist_per_class_[measurement_label];
-
-    // Use circle query instead of box for more precise filtering
-    Point measurement_point(measurement_object.pose.position.x, measurement_object.pose.position.y);
-
-    std::vector<ValueType> nearby_trackers;
-    nearby_trackers.reserve(std::min(size_t{100}, trackers.size()));  // Reasonable initial capacity
-
-    // Compute search bounding box (square that contains the circle)
-    const double max_dist = std::sqrt(max_squared_dist);
-    const Box query_box(
-      Point(measurement_point.get<0>() - max_dist, measurement_point.get<1>() - max_dist),
-      Point(measurement_point.get<0>() + max_dist, measurement_point.get<1>() + max_dist));
-    // Initial R-tree box query
-    rtree_.query(bgi::within(query_box), std::back_inserter(nearby_trackers));
-
-    // Process nearby trackers
-    for (const auto & tracker_value : nearby_trackers) {
-      const size_t tracker_idx = tracker_value.second;
-      const auto tracker_type = tracker_types[tracker_idx];
-
-      // Check if this tracker can be assigned to the measurement
-      bool can_assign =
-        config_.can_assign_map.at(tracker_type)[static_cast<int>(measurement_label)];
-      if (!can_assign) continue;
-
-      // Calculate score for this tracker-measurement pair
-      const auto & tracked_object = tracked_objects[tracker_idx];
-      const auto tracker_label = tracker_labels[tracker_idx];
-
-      bool has_significant_shape_change = false;
-      double score = calculateScore(
-        tracked_object, tracker_label, measurement_object, measurement_label,
-        tracker_inverse_covariances[tracker_idx], has_significant_shape_change);
-      score_matrix(tracker_idx, measurement_idx) = score;
-
-      if (has_significant_shape_change) {
-        significant_shape_change_checker_.addPair(tracker_idx, measurement_idx);
-      }
+  // Bucket the scores by tracker. The workers hold increasing measurement ranges, so the columns
+  // of each row end up sorted.
+  for (const auto & scores : worker_scores) {
+    for (const auto & entry : scores) {
+      ++score_matrix.row_offsets[entry.tracker_idx + 1];
+    }
+  }
+  for (size_t row = 0; row < score_matrix.rows; ++row) {
+    score_matrix.row_offsets[row + 1] += score_matrix.row_offsets[row];
+  }
+  score_matrix.col_indices.resize(score_matrix.row_offsets.back());
+  score_matrix.values.resize(score_matrix.row_offsets.back());
+  std::vector<size_t> row_ends(
+    score_matrix.row_offsets.begin(), score_matrix.row_offsets.end() - 1);
+  for (const auto & scores : worker_scores) {
+    for (const auto & entry : scores) {
+      const size_t position = row_ends[entry.tracker_idx]++;
+      score_matrix.col_indices[position] = static_cast<int>(entry.measurement_idx);
+      score_matrix.values[position] = entry.score;
     }
   }
-
   return score_matrix;
 }
 
@@ -0,0 +1,149 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/multi_object_tracker/association/solver/gnn_solver_interface.hpp"
+
+#include <autoware/universe_utils/system/parallel_for.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::multi_object_tracker
+{
+namespace gnn_solver
+{
+using autoware::universe_utils::parallelFor;
+using autoware::universe_utils::resolveNumThreads;
+
+namespace
+{
+constexpr size_t no_component = std::numeric_limits<size_t>::max();
+// Most of the components are a few pairs, below this count the threads cost more than they save
+constexpr size_t min_components_per_thread = 8;
+
+size_t findRoot(std::vector<size_t> & parents, size_t node)
+{
+  while (parents[node] != node) {
+    parents[node] = parents[parents[node]];  // path halving
+    node = parents[node];
+  }
+  return node;
+}
+
+struct Component
+{
+  std::vector<int> rows;
+  std::vector<int> cols;
+  std::vector<std::pair<int, int>> assignment;
+};
+}  // namespace
+
+void GnnSolverInterface::setNumThreads(size_t num_threads)
+{
+  num_threads_ = resolveNumThreads(num_threads);
+}
+
+void GnnSolverInterface::maximizeLinearAssignment(
+  const SparseScoreMatrix & score, std::unordered_map<int, int> * direct_assignment,
+  std::unordered_map<int, int> * reverse_assignment)
+{
+  if (score.nonZeros() == 0) {
+    return;
+  }
+
+  // 1) Union-find on the bipartite graph, the trackers are the nodes [0, rows) and the
+  // measurements are the nodes [rows, rows + cols)
+  std::vector<size_t> parents(score.rows + score.cols);
+  std::iota(parents.begin(), parents.end(), size_t{0});
+  for (size_t row = 0; row < score.rows; ++row) {
+    for (size_t k = score.row_offsets[row]; k < score.row_offsets[row + 1]; ++k) {
+      const size_t a = findRoot(parents, row);
+      const size_t b = findRoot(parents, score.rows + score.col_indices[k]);
+      if (a != b) {
+        parents[std::max(a, b)] = std::min(a, b);
+      }
+    }
+  }
+
+  // 2) Collect the rows and columns of each component with at least one score, in index order
+  std::vector<size_t> component_of_root(parents.size(), no_component);
+  std::vector<Component> components;
+  const auto get_component = [&](size_t node) -> Component & {
+    const size_t root = findRoot(parents, node);
+    if (component_of_root[root] == no_component) {
+      component_of_root[root] = components.size();
+      components.emplace_back();
+    }
+    return components[component_of_root[root]];
+  };
+  std::vector<bool> is_col_used(score.cols, false);
+  for (size_t row = 0; row < score.rows; ++row) {
+    if (score.row_offsets[row] == score.row_offsets[row + 1]) continue;
+    get_component(row).rows.push_back(static_cast<int>(row));
+    for (size_t k = score.row_offsets[row]; k < score.row_offsets[row + 1]; ++k) {
+      is_col_used[score.col_indices[k]] = true;
+    }
+  }
+  // Local index of each column in its component
+  std::vector<int> local_cols(score.cols, -1);
+  for (size_t col = 0; col < score.cols; ++col) {
+    if (!is_col_used[col]) continue;
+    auto & component = get_component(score.rows + col);
+    local_cols[col] = static_cast<int>(component.cols.size());
+    component.cols.push_back(static_cast<int>(col));
+  }
+
+  // 3) Solve the components independently, a single pair is assigned directly
+  const auto solve_component = [&](Component & component) {
+    if (component.rows.size() == 1 && component.cols.size() == 1) {
+      component.assignment.emplace_back(component.rows.front(), component.cols.front());
+      return;
+    }
+    std::vector<std::vector<double>> dense_score(
+      component.rows.size(), std::vector<double>(component.cols.size(), 0.0));
+    for (size_t local_row = 0; local_row < component.rows.size(); ++local_row) {
+      const size_t row = static_cast<size_t>(component.rows[local_row]);
+      for (size_t k = score.row_offsets[row]; k < score.row_offsets[row + 1]; ++k) {
+        dense_score[local_row][local_cols[score.col_indices[k]]] = score.values[k];
+      }
+    }
+    std::unordered_map<int, int> local_direct_assignment;
+    std::unordered_map<int, int> local_reverse_assignment;
+    maximizeLinearAssignment(dense_score, &local_direct_assignment, &local_reverse_assignment);
+    for (const auto & [local_row, local_col] : local_direct_assignment) {
+      component.assignment.emplace_back(component.rows[local_row], component.cols[local_col]);
+    }
+  };
+  parallelFor(
+    components.size(), num_threads_, min_components_per_thread,
+    [&](size_t begin, size_t end, size_t) {
+      for (size_t i = begin; i < end; ++i) {
+        solve_component(components[i]);
+      }
+    });
+
+  for (const auto & component : components) {
+    for (const auto & [row, col] : component.assignment) {
+      (*direct_assignment)[row] = col;
+      (*reverse_assignment)[col] = row;
+    }
+  }
+}
+
+}  // namespace gnn_solver
+}  // namespace autoware::multi_object_tracker
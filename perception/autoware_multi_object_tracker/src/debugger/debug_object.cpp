@@ -71,7 +71,7 @@ void TrackerObjectDebugger::reset()
 }
 
 void TrackerObjectDebugger::collect(
-  const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+  const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
   const types::DynamicObjectList & detected_objects,
   const std::unordered_map<int, int> & direct_assignment,
   const std::unordered_map<int, int> & /*reverse_assignment*/)
@@ -82,7 +82,7 @@ private:
 
 public:
   void collect(
-    const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+    const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
     const types::DynamicObjectList & detected_objects,
     const std::unordered_map<int, int> & direct_assignment,
     const std::unordered_map<int, int> & reverse_assignment);
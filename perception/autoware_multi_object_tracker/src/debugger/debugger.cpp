@@ -15,7 +15,6 @@
 #include "debugger.hpp"
 
 #include <algorithm>
-#include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -290,7 +289,7 @@ void TrackerDebugger::endPublishTime(const rclcpp::Time & now, const rclcpp::Tim
 }
 
 void TrackerDebugger::collectObjectInfo(
-  const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+  const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
   const types::DynamicObjectList & detected_objects,
   const std::unordered_map<int, int> & direct_assignment,
   const std::unordered_map<int, int> & reverse_assignment)
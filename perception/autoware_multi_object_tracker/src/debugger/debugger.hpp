@@ -28,7 +28,6 @@
 #include <autoware_perception_msgs/msg/tracked_objects.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 
-#include <list>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -123,7 +122,7 @@ public:
   void checkAllTiming(diagnostic_updater::DiagnosticStatusWrapper & stat);
   // Debug object
   void collectObjectInfo(
-    const rclcpp::Time & message_time, const std::list<std::shared_ptr<Tracker>> & list_tracker,
+    const rclcpp::Time & message_time, const std::vector<std::shared_ptr<Tracker>> & list_tracker,
     const types::DynamicObjectList & detected_objects,
     const std::unordered_map<int, int> & direct_assignment,
     const std::unordered_map<int, int> & reverse_assignment);
@@ -248,6 +248,7 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
         declare_parameter<bool>("enable_unknown_object_velocity_estimation");
       config.enable_unknown_object_motion_output =
         declare_parameter<bool>("enable_unknown_object_motion_output");
+      config.num_threads = static_cast<size_t>(declare_parameter<int>("num_threads"));
     }
 
     AssociatorConfig associator_config;
@@ -20,6 +20,7 @@
 #include "autoware/multi_object_tracker/tracker/tracker.hpp"
 
 #include <autoware/object_recognition_utils/object_recognition_utils.hpp>
+#include <autoware/universe_utils/system/parallel_for.hpp>
 
 #include <autoware_perception_msgs/msg/tracked_objects.hpp>
 
@@ -41,16 +42,27 @@
 
 namespace autoware::multi_object_tracker
 {
+using autoware::universe_utils::parallelFor;
+using autoware::universe_utils::resolveNumThreads;
 using autoware_utils_debug::ScopedTimeTrack;
 using Label = autoware_perception_msgs::msg::ObjectClassification;
 using LabelType = autoware_perception_msgs::msg::ObjectClassification::_label_type;
 
+namespace
+{
+// Minimum number of trackers per thread, below it the thread creation costs more than it saves
+constexpr size_t min_trackers_per_thread = 32;
+}  // namespace
+
 TrackerProcessor::TrackerProcessor(
   const TrackerProcessorConfig & config, const AssociatorConfig & associator_config,
   const std::vector<types::InputChannel> & channels_config)
-: config_(config), channels_config_(channels_config)
+: config_(config),
+  channels_config_(channels_config),
+  num_threads_(resolveNumThreads(config.num_threads))
 {
   association_ = std::make_unique<DataAssociation>(associator_config);
+  association_->setNumThreads(num_threads_);
 }
 
 void TrackerProcessor::predict(
@@ -61,9 +73,14 @@ void TrackerProcessor::predict(
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  for (auto itr = list_tracker_.begin(); itr != list_tracker_.end(); ++itr) {
-    (*itr)->predict(time);
-  }
+  // Each tracker only touches its own state
+  parallelFor(
+    list_tracker_.size(), num_threads_, min_trackers_per_thread,
+    [&](size_t begin, size_t end, size_t) {
+      for (size_t tracker_idx = begin; tracker_idx < end; ++tracker_idx) {
+        list_tracker_[tracker_idx]->predict(time);
+      }
+    });
 }
 
 void TrackerProcessor::associate(
@@ -75,8 +92,8 @@ void TrackerProcessor::associate(
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
   const auto & tracker_list = list_tracker_;
-  // global nearest neighbor
-  Eigen::MatrixXd score_matrix = association_->calcScoreMatrix(
+  // global nearest neighbor, only the pairs of nearby trackers and measurements have a score
+  const auto score_matrix = association_->calcSparseScoreMatrix(
     detected_objects, tracker_list);  // row : tracker, col : measurement
   association_->assign(score_matrix, direct_assignment, reverse_assignment);
 }
@@ -88,28 +105,32 @@ void TrackerProcessor::update(
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  int tracker_idx = 0;
   const auto & time = detected_objects.header.stamp;
-  for (auto tracker_itr = list_tracker_.begin(); tracker_itr != list_tracker_.end();
-       ++tracker_itr, ++tracker_idx) {
-    auto it = direct_assignment.find(tracker_idx);
-    if (it != direct_assignment.end()) {
-      // found
-      size_t measurement_idx = static_cast<size_t>(it->second);
-      const auto & associated_object = detected_objects.objects.at(measurement_idx);
-      const types::InputChannel channel_info = channels_config_[associated_object.channel_index];
-
-      // do conditioned update based on significant shape change info
-      bool has_significant_shape_change =
-        association_->hasSignificantShapeChange(tracker_idx, measurement_idx);
-      (*(tracker_itr))
-        ->updateWithMeasurement(
-          associated_object, time, channel_info, has_significant_shape_change);
-    } else {
-      // not found
-      (*(tracker_itr))->updateWithoutMeasurement(time);
-    }
-  }
+  // Each tracker only touches its own state, the assignment is only read
+  parallelFor(
+    list_tracker_.size(), num_threads_, min_trackers_per_thread,
+    [&](size_t begin, size_t end, size_t) {
+      for (size_t tracker_idx = begin; tracker_idx < end; ++tracker_idx) {
+        const auto & tracker = list_tracker_[tracker_idx];
+        auto it = direct_assignment.find(static_cast<int>(tracker_idx));
+        if (it != direct_assignment.end()) {
+          // found
+          size_t measurement_idx = static_cast<size_t>(it->second);
+          const auto & associated_object = detected_objects.objects.at(measurement_idx);
+          const types::InputChannel & channel_info =
+            channels_config_[associated_object.channel_index];
+
+          // do conditioned update based on significant shape change info
+          bool has_significant_shape_change =
+            association_->hasSignificantShapeChange(tracker_idx, measurement_idx);
+          tracker->updateWithMeasurement(
+            associated_object, time, channel_info, has_significant_shape_change);
+        } else {
+          // not found
+          tracker->updateWithoutMeasurement(time);
+        }
+      }
+    });
 }
 
 void TrackerProcessor::spawn(
@@ -204,15 +225,15 @@ void TrackerProcessor::removeOldTracker(const rclcpp::Time & time)
   std::unique_ptr<ScopedTimeTrack> st_ptr;
   if (time_keeper_) st_ptr = std::make_unique<ScopedTimeTrack>(__func__, *time_keeper_);
 
-  // Check elapsed time from last update
-  for (auto itr = list_tracker_.begin(); itr != list_tracker_.end(); ++itr) {
-    // If the tracker is expired, delete it
-    if ((*itr)->isExpired(time, adaptive_threshold_cache_, ego_pose_)) {
-      auto erase_itr = itr;
-      --itr;
-      list_tracker_.erase(erase_itr);
-    }
-  }
+  // Check elapsed time from last update, if the tracker is expired, delete it
+  // The remaining trackers are compacted in order
+  list_tracker_.erase(
+    std::remove_if(
+      list_tracker_.begin(), list_tracker_.end(),
+      [&](const std::shared_ptr<Tracker> & tracker) {
+        return tracker->isExpired(time, adaptive_threshold_cache_, ego_pose_);
+      }),
+    list_tracker_.end());
 }
 
 inline double calcGeneralizedIoUThresholdUnknown(
@@ -321,25 +342,36 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
 
   std::vector<TrackerData> valid_trackers;
   valid_trackers.reserve(list_tracker_.size());
-
-  // First pass: collect valid trackers and their data
   for (const auto & tracker : list_tracker_) {
-    TrackerData data(tracker);
-
-    // Get tracked object and basic data
-    if (!tracker->getTrackedObject(time, data.object)) {
-      continue;
-    }
+    valid_trackers.emplace_back(tracker);
+  }
 
-    data.label = tracker->getHighestProbLabel();
-    data.is_unknown = (data.label == Label::UNKNOWN);
-    data.tracker_priority = tracker->getTrackerPriority();
-    data.measurement_count = tracker->getTotalMeasurementCount();
-    data.elapsed_time = tracker->getElapsedTimeFromLastUpdate(time);
-    data.is_valid = true;
+  // First pass: collect valid trackers and their data, in parallel per tracker
+  parallelFor(
+    valid_trackers.size(), num_threads_, min_trackers_per_thread,
+    [&](size_t begin, size_t end, size_t) {
+      for (size_t i = begin; i < end; ++i) {
+        auto & data = valid_trackers[i];
+        const auto & tracker = data.tracker;
+
+        // Get tracked object and basic data
+        if (!tracker->getTrackedObject(time, data.object)) {
+          continue;
+        }
 
-    valid_trackers.push_back(std::move(data));
-  }
+        data.label = tracker->getHighestProbLabel();
+        data.is_unknown = (data.label == Label::UNKNOWN);
+        data.tracker_priority = tracker->getTrackerPriority();
+        data.measurement_count = tracker->getTotalMeasurementCount();
+        data.elapsed_time = tracker->getElapsedTimeFromLastUpdate(time);
+        data.is_valid = true;
+      }
+    });
+  valid_trackers.erase(
+    std::remove_if(
+      valid_trackers.begin(), valid_trackers.end(),
+      [](const TrackerData & data) { return !data.is_valid; }),
+    valid_trackers.end());
 
   // Sort valid trackers by priority
   std::sort(
@@ -454,9 +486,13 @@ void TrackerProcessor::mergeOverlappedTracker(const rclcpp::Time & time)
   }
 
   // Remove all marked trackers in a single pass
-  list_tracker_.remove_if([&trackers_to_remove](const std::shared_ptr<Tracker> & tracker) {
-    return trackers_to_remove.count(tracker) > 0;
-  });
+  list_tracker_.erase(
+    std::remove_if(
+      list_tracker_.begin(), list_tracker_.end(),
+      [&trackers_to_remove](const std::shared_ptr<Tracker> & tracker) {
+        return trackers_to_remove.count(tracker) > 0;
+      }),
+    list_tracker_.end());
 }
 
 bool TrackerProcessor::canMergeOverlappedTarget(
@@ -26,7 +26,6 @@
 #include "autoware_perception_msgs/msg/detected_objects.hpp"
 #include "autoware_perception_msgs/msg/tracked_objects.hpp"
 
-#include <list>
 #include <memory>
 #include <optional>
 #include <string>
@@ -50,6 +49,7 @@ struct TrackerProcessorConfig
   double pruning_static_object_speed;                                 // [m/s]
   double pruning_moving_object_speed;                                 // [m/s]
   double pruning_static_iou_threshold;                                // [ratio]
+  size_t num_threads{1};  // threads of the per-tracker processes, 0 uses all the hardware threads
 };
 
 class TrackerProcessor
@@ -59,7 +59,7 @@ public:
     const TrackerProcessorConfig & config, const AssociatorConfig & associator_config,
     const std::vector<types::InputChannel> & channels_config);
 
-  const std::list<std::shared_ptr<Tracker>> & getListTracker() const { return list_tracker_; }
+  const std::vector<std::shared_ptr<Tracker>> & getListTracker() const { return list_tracker_; }
   // tracker processes
   void predict(const rclcpp::Time & time, const std::optional<geometry_msgs::msg::Pose> & ego_pose);
   void associate(
@@ -96,7 +96,11 @@ private:
 
   mutable rclcpp::Time last_prune_time_;
 
-  std::list<std::shared_ptr<Tracker>> list_tracker_;
+  // Trackers in creation order, the index of a tracker is its row in the score matrix. The
+  // trackers are polymorphic (one class per motion model) and shared with the debugger, so the
+  // vector holds the handles contiguously rather than the trackers themselves.
+  std::vector<std::shared_ptr<Tracker>> list_tracker_;
+  size_t num_threads_;
   void removeOldTracker(const rclcpp::Time & time);
   void mergeOverlappedTracker(const rclcpp::Time & time);
   bool canMergeOverlappedTarget(
@@ -0,0 +1,190 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/multi_object_tracker/association/association.hpp"
+#include "autoware/multi_object_tracker/association/solver/gnn_solver.hpp"
+#include "test_bench.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using autoware::multi_object_tracker::DataAssociation;
+using autoware::multi_object_tracker::gnn_solver::GnnSolverInterface;
+using autoware::multi_object_tracker::gnn_solver::MuSSP;
+using autoware::multi_object_tracker::gnn_solver::SparseScoreMatrix;
+using autoware::multi_object_tracker::gnn_solver::SSP;
+
+namespace
+{
+// Dense traffic like scores: the objects are spread over lanes, each measurement is its object
+// moved by a noise, and the pairs closer than 2 m have a positive score
+std::vector<std::vector<double>> makeScores(const size_t num_objects, const unsigned seed)
+{
+  std::mt19937 rng(seed);
+  const double length = 10.0 * static_cast<double>(num_objects) / 8.0;  // 8 lanes, 10 m gap
+  std::uniform_real_distribution<double> x_dist(0.0, length);
+  std::uniform_int_distribution<int> lane_dist(0, 7);
+  std::normal_distribution<double> noise(0.0, 0.7);
+
+  std::vector<std::pair<double, double>> objects(num_objects);
+  for (auto & [x, y] : objects) {
+    x = x_dist(rng);
+    y = 3.5 * lane_dist(rng);
+  }
+  std::vector<std::vector<double>> scores(num_objects, std::vector<double>(num_objects, 0.0));
+  for (size_t measurement = 0; measurement < num_objects; ++measurement) {
+    const double x = objects[measurement].first + noise(rng);
+    const double y = objects[measurement].second + noise(rng) * 0.3;
+    for (size_t tracker = 0; tracker < num_objects; ++tracker) {
+      const double distance = std::hypot(x - objects[tracker].first, y - objects[tracker].second);
+      scores[tracker][measurement] = std::max(0.0, 1.0 - distance / 2.0);
+    }
+  }
+  return scores;
+}
+
+SparseScoreMatrix toSparse(const std::vector<std::vector<double>> & scores)
+{
+  SparseScoreMatrix sparse;
+  sparse.rows = scores.size();
+  sparse.cols = scores.empty() ? 0 : scores.front().size();
+  for (const auto & row : scores) {
+    for (size_t col = 0; col < row.size(); ++col) {
+      if (row[col] > 0.0) {
+        sparse.col_indices.push_back(static_cast<int>(col));
+        sparse.values.push_back(row[col]);
+      }
+    }
+    sparse.row_offsets.push_back(sparse.values.size());
+  }
+  return sparse;
+}
+
+Eigen::MatrixXd toEigen(const std::vector<std::vector<double>> & scores)
+{
+  Eigen::MatrixXd matrix(scores.size(), scores.front().size());
+  for (size_t row = 0; row < scores.size(); ++row) {
+    for (size_t col = 0; col < scores[row].size(); ++col) {
+      matrix(row, col) = scores[row][col];
+    }
+  }
+  return matrix;
+}
+
+// Checks that the assignment is one-to-one on positive scores and returns its total score
+double checkAssignment(
+  const std::vector<std::vector<double>> & scores,
+  const std::unordered_map<int, int> & direct_assignment,
+  const std::unordered_map<int, int> & reverse_assignment)
+{
+  EXPECT_EQ(direct_assignment.size(), reverse_assignment.size());
+  double total_score = 0.0;
+  for (const auto & [tracker, measurement] : direct_assignment) {
+    EXPECT_EQ(reverse_assignment.at(measurement), tracker);
+    EXPECT_GT(scores[tracker][measurement], 0.0);
+    total_score += scores[tracker][measurement];
+  }
+  return total_score;
+}
+
+void checkSparseMatchesDense(GnnSolverInterface & solver)
+{
+  for (const size_t num_objects : {1u, 10u, 50u, 200u}) {
+    for (unsigned seed = 0; seed < 5; ++seed) {
+      const auto scores = makeScores(num_objects, seed);
+      std::unordered_map<int, int> dense_direct;
+      std::unordered_map<int, int> dense_reverse;
+      solver.maximizeLinearAssignment(scores, &dense_direct, &dense_reverse);
+      std::unordered_map<int, int> sparse_direct;
+      std::unordered_map<int, int> sparse_reverse;
+      solver.maximizeLinearAssignment(toSparse(scores), &sparse_direct, &sparse_reverse);
+
+      // The components are independent, the optimum is the same
+      const double dense_total = checkAssignment(scores, dense_direct, dense_reverse);
+      const double sparse_total = checkAssignment(scores, sparse_direct, sparse_reverse);
+      EXPECT_NEAR(dense_total, sparse_total, 1e-9) << num_objects << " objects, seed " << seed;
+    }
+  }
+}
+}  // namespace
+
+TEST(SparseScoreMatrixTest, Get)
+{
+  const std::vector<std::vector<double>> scores = {
+    {0.0, 0.5, 0.0}, {0.0, 0.0, 0.0}, {0.2, 0.0, 0.9}};
+  const auto sparse = toSparse(scores);
+  EXPECT_EQ(sparse.nonZeros(), 3u);
+  for (size_t row = 0; row < scores.size(); ++row) {
+    for (size_t col = 0; col < scores[row].size(); ++col) {
+      EXPECT_DOUBLE_EQ(sparse.get(row, col), scores[row][col]);
+    }
+  }
+}
+
+TEST(GnnSolverTest, SparseMatchesDenseMuSSP)
+{
+  MuSSP solver;
+  checkSparseMatchesDense(solver);
+}
+
+TEST(GnnSolverTest, SparseMatchesDenseSSP)
+{
+  SSP solver;
+  checkSparseMatchesDense(solver);
+}
+
+TEST(GnnSolverTest, SparseIsIndependentOfThreads)
+{
+  const auto sparse = toSparse(makeScores(300, 0));
+  MuSSP solver;
+  std::unordered_map<int, int> reference_direct;
+  std::unordered_map<int, int> reference_reverse;
+  solver.maximizeLinearAssignment(sparse, &reference_direct, &reference_reverse);
+  for (const size_t num_threads : {2u, 4u, 0u}) {
+    solver.setNumThreads(num_threads);
+    std::unordered_map<int, int> direct;
+    std::unordered_map<int, int> reverse;
+    solver.maximizeLinearAssignment(sparse, &direct, &reverse);
+    EXPECT_EQ(direct, reference_direct);
+    EXPECT_EQ(reverse, reference_reverse);
+  }
+}
+
+TEST(GnnSolverTest, SparseMatchesDenseAssociation)
+{
+  // DataAssociation::assign gives an assignment of the same total score with both score matrices
+  for (const size_t num_objects : {100u, 300u, 1000u}) {
+    const auto scores = makeScores(num_objects, 0);
+    const Eigen::MatrixXd dense = toEigen(scores);
+    const SparseScoreMatrix sparse = toSparse(scores);
+    DataAssociation association(createAssociatorConfig());
+
+    std::unordered_map<int, int> dense_direct;
+    std::unordered_map<int, int> dense_reverse;
+    association.assign(dense, dense_direct, dense_reverse);
+    std::unordered_map<int, int> sparse_direct;
+    std::unordered_map<int, int> sparse_reverse;
+    association.assign(sparse, sparse_direct, sparse_reverse);
+
+    EXPECT_NEAR(
+      checkAssignment(scores, dense_direct, dense_reverse),
+      checkAssignment(scores, sparse_direct, sparse_reverse), 1e-9)
+      << num_objects << " objects";
+  }
+}
@@ -147,11 +147,13 @@ FunctionTimings runIterationsAssociation(
 
 FunctionTimings runIterations(
   int num_iterations, const ScenarioParams & config, bool print_frame_stats = false,
-  bool write_bag = false)
+  bool write_bag = false, size_t num_threads = 1,
+  std::vector<autoware_perception_msgs::msg::TrackedObjects> * tracked_objects_history = nullptr)
 {
   RosbagWriterHelper writer(write_bag);
 
   auto processor_config = createProcessorConfig();
+  processor_config.num_threads = num_threads;
   const auto associator_config = createAssociatorConfig();
   const auto input_channels_config = createInputChannelsConfig();
 
@@ -211,6 +213,9 @@ FunctionTimings runIterations(
     processor->getTrackedObjects(current_time, latest_tracked_objects);
 
     latest_tracked_objects.header.frame_id = "map";
+    if (tracked_objects_history) {
+      tracked_objects_history->push_back(latest_tracked_objects);
+    }
 
     writer.write(
       toDetectedObjectsMsg(detections), "/perception/object_recognition/detection/objects",
@@ -250,6 +255,44 @@ void runPerformanceTest()
   timings.printSummary();
 }
 
+void runDenseTrafficTest()
+{
+  // 500 objects: 400 cars on 10 lanes, 60 pedestrians and 40 unknown objects
+  ScenarioParams params;
+  params.num_lanes = 10;
+  params.cars_per_lane = 40;
+  params.pedestrian_clusters = 10;
+  params.pedestrians_per_cluster = 6;
+  params.unknown_objects = 40;
+  constexpr int num_iterations = 30;
+
+  std::vector<autoware_perception_msgs::msg::TrackedObjects> reference_history;
+  for (const size_t num_threads : {1u, 2u, 4u, 0u}) {
+    std::vector<autoware_perception_msgs::msg::TrackedObjects> history;
+    runIterations(num_iterations, params, false, false, num_threads, &history);
+
+    // The tracking result does not depend on the number of threads
+    if (reference_history.empty()) {
+      reference_history = std::move(history);
+      continue;
+    }
+    ASSERT_EQ(history.size(), reference_history.size());
+    for (size_t frame = 0; frame < history.size(); ++frame) {
+      const auto & objects = history[frame].objects;
+      const auto & reference_objects = reference_history[frame].objects;
+      ASSERT_EQ(objects.size(), reference_objects.size()) << "frame " << frame;
+      for (size_t i = 0; i < objects.size(); ++i) {
+        const auto & position = objects[i].kinematics.pose_with_covariance.pose.position;
+        const auto & reference_position =
+          reference_objects[i].kinematics.pose_with_covariance.pose.position;
+        EXPECT_NEAR(position.x, reference_position.x, 1e-6) << "frame " << frame;
+        EXPECT_NEAR(position.y, reference_position.y, 1e-6) << "frame " << frame;
+        EXPECT_EQ(objects[i].classification.size(), reference_objects[i].classification.size());
+      }
+    }
+  }
+}
+
 void runPerformanceTestWithRosbag(const std::string & rosbag_path, bool write_bag = false)
 {
   // === Setup ===
@@ -508,6 +551,13 @@ TEST_F(MultiObjectTrackerTest, SimulatedDataPerformanceTest)
   runPerformanceTest();
 }
 
+TEST_F(MultiObjectTrackerTest, DenseTrafficThreadConsistencyTest)
+{
+  // This test runs the 500 objects scenario with several numbers of threads and checks that the
+  // tracking results are the same
+  runDenseTrafficTest();
+}
+
 TEST_F(MultiObjectTrackerTest, RealDataRosbagPerformanceTest)
 {
   // This test runs the tracker using a real rosbag for evaluation
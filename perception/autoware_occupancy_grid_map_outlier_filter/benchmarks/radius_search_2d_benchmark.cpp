@@ -0,0 +1,189 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare the neighbor counting of the radius search 2d filter on a pcl::search::KdTree with
+// RadiusSearch2dGrid. Usage: radius_search_2d_benchmark [cloud.pcd ...]
+// Without argument, clouds of obstacles in rain noise are generated. With recorded clouds (in the
+// frame of the vehicle), every point is checked, like the single input filter of the node.
+// Whether both give the same inliers is printed next to the timings.
+
+#include "autoware/occupancy_grid_map_outlier_filter/radius_search_2d_grid.hpp"
+
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl/search/kdtree.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using autoware::occupancy_grid_map_outlier_filter::RadiusSearch2dGrid;
+
+namespace
+{
+constexpr int nb_iterations = 10;
+
+// Default parameters of the node
+constexpr float search_radius = 1.0f;
+constexpr float min_points_and_distance_ratio = 400.0f;
+constexpr int min_points = 4;
+constexpr int max_points = 70;
+
+struct Scene
+{
+  std::string name;
+  pcl::PointCloud<pcl::PointXY>::Ptr cloud;
+  // the first num_queries points are the low confidence points
+  std::size_t num_queries;
+};
+
+// Obstacles on a 10 m lattice as high confidence points, rain and dust around the vehicle as low
+// confidence points with some of the obstacle returns
+Scene makeNoisyScene(std::size_t num_noise_points, std::size_t num_obstacle_points)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> uniform(-60.0f, 60.0f);
+  std::normal_distribution<float> normal(0.0f, 0.5f);
+  std::exponential_distribution<float> noise_range(0.15f);
+  std::uniform_real_distribution<float> angle(-M_PI, M_PI);
+  pcl::PointCloud<pcl::PointXY>::Ptr cloud(new pcl::PointCloud<pcl::PointXY>);
+  const auto obstacle_point = [&]() {
+    const float cx = 10.0f * std::round(0.1f * uniform(engine));
+    const float cy = 10.0f * std::round(0.1f * uniform(engine));
+    pcl::PointXY point;
+    point.x = cx + 2.0f * normal(engine);
+    point.y = cy + normal(engine);
+    return point;
+  };
+  for (std::size_t i = 0; i < num_noise_points; ++i) {
+    if (i % 5 == 0) {
+      cloud->push_back(obstacle_point());
+    } else {
+      const float range = 1.0f + noise_range(engine);
+      const float theta = angle(engine);
+      pcl::PointXY point;
+      point.x = range * std::cos(theta);
+      point.y = range * std::sin(theta);
+      cloud->push_back(point);
+    }
+  }
+  for (std::size_t i = 0; i < num_obstacle_points; ++i) {
+    cloud->push_back(obstacle_point());
+  }
+  return {
+    std::to_string(num_noise_points) + " noise + " + std::to_string(num_obstacle_points) +
+      " obstacle points",
+    cloud, num_noise_points};
+}
+
+std::vector<int> computeMinPoints(const pcl::PointCloud<pcl::PointXY> & cloud, std::size_t size)
+{
+  std::vector<int> thresholds(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const float distance = std::hypot(cloud.points[i].x, cloud.points[i].y);
+    thresholds[i] = std::min(
+      std::max(static_cast<int>(std::lround(min_points_and_distance_ratio / distance)), min_points),
+      max_points);
+  }
+  return thresholds;
+}
+
+template <typename F>
+double averageMs(F && f)
+{
+  double total_ms = 0.0;
+  for (int i = 0; i <= nb_iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    if (i > 0) {  // the first run is a warm-up
+      total_ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+  }
+  return total_ms / nb_iterations;
+}
+
+void run(const Scene & scene)
+{
+  const auto thresholds = computeMinPoints(*scene.cloud, scene.num_queries);
+
+  std::vector<std::uint8_t> kd_tree_inliers(scene.num_queries);
+  pcl::search::KdTree<pcl::PointXY> kd_tree(false);
+  const double kd_tree_ms = averageMs([&]() {
+    std::vector<int> k_indices(scene.cloud->points.size());
+    std::vector<float> k_distances(scene.cloud->points.size());
+    kd_tree.setInputCloud(scene.cloud);
+    for (std::size_t i = 0; i < scene.num_queries; ++i) {
+      const int points_num =
+        kd_tree.radiusSearch(i, search_radius, k_indices, k_distances, thresholds[i]);
+      kd_tree_inliers[i] = thresholds[i] <= points_num;
+    }
+  });
+  const auto num_inliers = std::count(kd_tree_inliers.begin(), kd_tree_inliers.end(), 1);
+  std::cout << scene.name << ", " << scene.num_queries << " queries, " << num_inliers
+            << " inliers\n  KdTree: " << kd_tree_ms << " ms\n";
+
+  const int hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+  for (const int num_threads : {1, 4, hardware_threads}) {
+    RadiusSearch2dGrid grid;
+    std::vector<std::uint8_t> grid_inliers;
+    const double grid_ms = averageMs([&]() {
+      grid.setInputCloud(*scene.cloud, search_radius);
+      grid.findInliers(thresholds, grid_inliers, num_threads);
+    });
+    std::cout << "  grid, " << num_threads << " threads: " << grid_ms << " ms (x"
+              << kd_tree_ms / grid_ms
+              << "), same inliers: " << (grid_inliers == kd_tree_inliers ? "yes" : "NO") << "\n";
+  }
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  std::vector<Scene> scenes;
+  if (argc > 1) {
+    for (int i = 1; i < argc; ++i) {
+      pcl::PointCloud<pcl::PointXYZ> xyz_cloud;
+      if (pcl::io::loadPCDFile(argv[i], xyz_cloud) != 0) {
+        std::cerr << "failed to load " << argv[i] << "\n";
+        return 1;
+      }
+      pcl::PointCloud<pcl::PointXY>::Ptr cloud(new pcl::PointCloud<pcl::PointXY>);
+      for (const auto & xyz_point : xyz_cloud.points) {
+        pcl::PointXY point;
+        point.x = xyz_point.x;
+        point.y = xyz_point.y;
+        cloud->push_back(point);
+      }
+      scenes.push_back({argv[i], cloud, cloud->points.size()});
+    }
+  } else {
+    // max_filter_points_nb is 15000 by default
+    scenes.push_back(makeNoisyScene(2000, 30000));
+    scenes.push_back(makeNoisyScene(15000, 30000));
+    scenes.push_back(makeNoisyScene(15000, 100000));
+  }
+
+  for (const auto & scene : scenes) {
+    run(scene);
+  }
+  return 0;
+}
@@ -0,0 +1,80 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__OCCUPANCY_GRID_MAP_OUTLIER_FILTER__RADIUS_SEARCH_2D_GRID_HPP_
+#define AUTOWARE__OCCUPANCY_GRID_MAP_OUTLIER_FILTER__RADIUS_SEARCH_2D_GRID_HPP_
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace autoware::occupancy_grid_map_outlier_filter
+{
+/**
+ * @brief Neighbor counting on a 2D hash grid, replacement of the radiusSearch of a
+ * pcl::search::KdTree<pcl::PointXY> for the radius outlier filter.
+ *
+ * The points are bucketed into square cells of the search radius, so the neighbors of a point are
+ * in the 3x3 cells around it. A point has enough neighbors when at least min_points points of the
+ * cloud, itself included, are strictly closer than the radius. This is the same test as
+ * min_points <= radiusSearch(index, radius, indices, distances, min_points) on the KD-tree, the
+ * distances being computed the same way in float.
+ */
+class RadiusSearch2dGrid
+{
+public:
+  void setInputCloud(const pcl::PointCloud<pcl::PointXY> & cloud, float radius);
+
+  /**
+   * @brief Check the first min_points.size() points of the cloud. The cells are processed in
+   * parallel, the result does not depend on the number of threads.
+   * @param min_points minimum number of neighbors of each point
+   * @param is_inlier 1 if the point has enough neighbors, 0 otherwise
+   */
+  void findInliers(
+    const std::vector<int> & min_points, std::vector<std::uint8_t> & is_inlier,
+    int num_threads = 1) const;
+
+private:
+  struct Cell
+  {
+    // Cell coordinates packed so that the order of the keys is the (x, y) lexicographic order
+    std::uint64_t key;
+    // Range of the points of the cell in sorted_points_
+    std::uint32_t begin;
+    std::uint32_t end;
+  };
+
+  /// Range of the points of the cells (x, y_begin) to (x, y_end) in sorted_points_
+  void findColumnRange(
+    std::int64_t x, std::int64_t y_begin, std::int64_t y_end, std::uint32_t & begin,
+    std::uint32_t & end) const;
+
+  float squared_radius_{0.0f};
+
+  // Buffers reused between calls, the points are stored sorted by cell
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> point_keys_;
+  std::vector<std::uint32_t> sorted_points_;
+  std::vector<float> sorted_xs_;
+  std::vector<float> sorted_ys_;
+  std::vector<Cell> cells_;
+};
+
+}  // namespace autoware::occupancy_grid_map_outlier_filter
+
+#endif  // AUTOWARE__OCCUPANCY_GRID_MAP_OUTLIER_FILTER__RADIUS_SEARCH_2D_GRID_HPP_
@@ -116,9 +116,44 @@ RadiusSearch2dFilter::RadiusSearch2dFilter(rclcpp::Node & node)
   max_points_ = node.declare_parameter<int>("radius_search_2d_filter.max_points");
   max_filter_points_nb_ =
     node.declare_parameter<int>("radius_search_2d_filter.max_filter_points_nb");
+  use_grid_search_ = node.declare_parameter<bool>("radius_search_2d_filter.use_grid_search");
+  num_threads_ = node.declare_parameter<int>("radius_search_2d_filter.num_threads");
   kd_tree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
 }
 
+void RadiusSearch2dFilter::findInliers(
+  const pcl::PointCloud<pcl::PointXY>::Ptr & xy_cloud, const std::size_t num_queries,
+  const Pose & pose, std::vector<std::uint8_t> & is_inlier)
+{
+  std::vector<int> min_points_thresholds(num_queries);
+  for (size_t i = 0; i < num_queries; ++i) {
+    const float distance =
+      std::hypot(xy_cloud->points[i].x - pose.position.x, xy_cloud->points[i].y - pose.position.y);
+    min_points_thresholds[i] = std::min(
+      std::max(
+        static_cast<int>(std::lround(min_points_and_distance_ratio_ / distance)), min_points_),
+      max_points_);
+  }
+
+  if (use_grid_search_) {
+    // same inliers as the KD-tree, the neighbors are counted in the 3x3 cells around each point
+    grid_.setInputCloud(*xy_cloud, search_radius_);
+    grid_.findInliers(min_points_thresholds, is_inlier, num_threads_);
+    return;
+  }
+
+  std::vector<int> k_indices(xy_cloud->points.size());
+  std::vector<float> k_distances(xy_cloud->points.size());
+  kd_tree_->setInputCloud(xy_cloud);
+  is_inlier.resize(num_queries);
+  for (size_t i = 0; i < num_queries; ++i) {
+    const int min_points_threshold = min_points_thresholds[i];
+    const int points_num =
+      kd_tree_->radiusSearch(i, search_radius_, k_indices, k_distances, min_points_threshold);
+    is_inlier[i] = min_points_threshold <= points_num;
+  }
+}
+
 void RadiusSearch2dFilter::filter(
   const PointCloud2 & input, const Pose & pose, PointCloud2 & output, PointCloud2 & outlier)
 {
@@ -132,22 +167,12 @@ void RadiusSearch2dFilter::filter(
     std::memcpy(&xy_cloud->points[i].y, &input.data[i * point_step + y_offset], sizeof(float));
   }
 
-  std::vector<int> k_indices(xy_cloud->points.size());
-  std::vector<float> k_distances(xy_cloud->points.size());
-  kd_tree_->setInputCloud(xy_cloud);
+  std::vector<std::uint8_t> is_inlier;
+  findInliers(xy_cloud, xy_cloud->points.size(), pose, is_inlier);
   size_t output_size = 0;
   size_t outlier_size = 0;
   for (size_t i = 0; i < xy_cloud->points.size(); ++i) {
-    const float distance =
-      std::hypot(xy_cloud->points[i].x - pose.position.x, xy_cloud->points[i].y - pose.position.y);
-    const int min_points_threshold = std::min(
-      std::max(
-        static_cast<int>(std::lround(min_points_and_distance_ratio_ / distance)), min_points_),
-      max_points_);
-    const int points_num =
-      kd_tree_->radiusSearch(i, search_radius_, k_indices, k_distances, min_points_threshold);
-
-    if (min_points_threshold <= points_num) {
+    if (is_inlier[i]) {
       std::memcpy(&output.data[output_size], &input.data[i * point_step], point_step);
       output_size += point_step;
     } else {
@@ -192,23 +217,15 @@ void RadiusSearch2dFilter::filter(
       &high_conf_xyz_cloud.data[high_conf_xyz_cloud_index * point_step + y_offset], sizeof(float));
   }
 
-  std::vector<int> k_indices(xy_cloud->points.size());
-  std::vector<float> k_distances(xy_cloud->points.size());
-  kd_tree_->setInputCloud(xy_cloud);
+  const size_t num_low_conf_points =
+    low_conf_xyz_cloud.data.size() / low_conf_xyz_cloud.point_step;
+  std::vector<std::uint8_t> is_inlier;
+  findInliers(xy_cloud, num_low_conf_points, pose, is_inlier);
 
   size_t output_size = 0;
   size_t outlier_size = 0;
-  for (size_t i = 0; i < low_conf_xyz_cloud.data.size() / low_conf_xyz_cloud.point_step; ++i) {
-    const float distance =
-      std::hypot(xy_cloud->points[i].x - pose.position.x, xy_cloud->points[i].y - pose.position.y);
-    const int min_points_threshold = std::min(
-      std::max(
-        static_cast<int>(std::lround(min_points_and_distance_ratio_ / distance)), min_points_),
-      max_points_);
-    const int points_num =
-      kd_tree_->radiusSearch(i, search_radius_, k_indices, k_distances, min_points_threshold);
-
-    if (min_points_threshold <= points_num) {
+  for (size_t i = 0; i < num_low_conf_points; ++i) {
+    if (is_inlier[i]) {
       std::memcpy(
         &output.data[output_size], &low_conf_xyz_cloud.data[i * low_conf_xyz_cloud.point_step],
         low_conf_xyz_cloud.point_step);
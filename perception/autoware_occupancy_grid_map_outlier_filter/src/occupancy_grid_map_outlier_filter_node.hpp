@@ -15,6 +15,7 @@
 #ifndef OCCUPANCY_GRID_MAP_OUTLIER_FILTER_NODE_HPP_
 #define OCCUPANCY_GRID_MAP_OUTLIER_FILTER_NODE_HPP_
 
+#include "autoware/occupancy_grid_map_outlier_filter/radius_search_2d_grid.hpp"
 #include "autoware/pointcloud_preprocessor/filter.hpp"
 #include "autoware_utils/ros/published_time_publisher.hpp"
 #include "autoware_utils/system/time_keeper.hpp"
@@ -38,8 +39,10 @@
 #include <tf2_ros/message_filter.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::occupancy_grid_map_outlier_filter
 {
@@ -59,12 +62,20 @@ public:
     PointCloud2 & output, PointCloud2 & outlier);
 
 private:
+  // the first num_queries points of xy_cloud are checked against all the points of xy_cloud
+  void findInliers(
+    const pcl::PointCloud<pcl::PointXY>::Ptr & xy_cloud, const std::size_t num_queries,
+    const Pose & pose, std::vector<std::uint8_t> & is_inlier);
+
   float search_radius_;
   float min_points_and_distance_ratio_;
   int min_points_;
   int max_points_;
   long unsigned int max_filter_points_nb_;
+  bool use_grid_search_;
+  int num_threads_;
   pcl::search::Search<pcl::PointXY>::Ptr kd_tree_;
+  RadiusSearch2dGrid grid_;
 };
 
 class OccupancyGridMapOutlierFilterComponent : public rclcpp::Node
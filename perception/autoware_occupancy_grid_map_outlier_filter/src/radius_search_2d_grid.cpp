@@ -0,0 +1,170 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/occupancy_grid_map_outlier_filter/radius_search_2d_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <vector>
+
+namespace autoware::occupancy_grid_map_outlier_filter
+{
+namespace
+{
+constexpr std::int64_t cell_offset = std::int64_t{1} << 31;
+// Far enough from the limits of the keys for the neighbor cells of any cell
+constexpr double max_cell_coordinate = static_cast<double>(std::int64_t{1} << 30);
+
+std::uint64_t toCellKey(std::int64_t x, std::int64_t y)
+{
+  return (static_cast<std::uint64_t>(x + cell_offset) << 32) |
+         static_cast<std::uint64_t>(static_cast<std::uint32_t>(y + cell_offset));
+}
+
+std::int64_t cellX(std::uint64_t key)
+{
+  return static_cast<std::int64_t>(key >> 32) - cell_offset;
+}
+
+std::int64_t cellY(std::uint64_t key)
+{
+  return static_cast<std::int64_t>(key & 0xffffffffULL) - cell_offset;
+}
+
+std::int64_t toCellCoordinate(float value, double inverse_cell_size)
+{
+  const double coordinate = std::floor(static_cast<double>(value) * inverse_cell_size);
+  return static_cast<std::int64_t>(
+    std::clamp(coordinate, -max_cell_coordinate, max_cell_coordinate));
+}
+}  // namespace
+
+void RadiusSearch2dGrid::setInputCloud(
+  const pcl::PointCloud<pcl::PointXY> & cloud, const float radius)
+{
+  // Same squared radius as pcl::KdTreeFLANN
+  squared_radius_ = static_cast<float>(static_cast<double>(radius) * radius);
+  point_keys_.clear();
+  sorted_points_.clear();
+  sorted_xs_.clear();
+  sorted_ys_.clear();
+  cells_.clear();
+  if (!(radius > 0.0f) || !std::isfinite(radius)) {
+    return;  // no point is closer than the radius
+  }
+
+  // 1) Sort the points by cell
+  // Slightly above the radius, so that rounding never puts a neighbor two cells away
+  const double inverse_cell_size = 1.0 / (1.0001 * radius);
+  point_keys_.reserve(cloud.points.size());
+  for (std::size_t i = 0; i < cloud.points.size(); ++i) {
+    const auto & point = cloud.points[i];
+    if (!std::isfinite(point.x) || !std::isfinite(point.y)) {
+      continue;  // neighbor of no point, like in the KD-tree
+    }
+    point_keys_.emplace_back(
+      toCellKey(
+        toCellCoordinate(point.x, inverse_cell_size), toCellCoordinate(point.y, inverse_cell_size)),
+      static_cast<std::uint32_t>(i));
+  }
+  std::sort(point_keys_.begin(), point_keys_.end());
+
+  sorted_points_.resize(point_keys_.size());
+  sorted_xs_.resize(point_keys_.size());
+  sorted_ys_.resize(point_keys_.size());
+  for (std::size_t i = 0; i < point_keys_.size(); ++i) {
+    const auto [key, point_idx] = point_keys_[i];
+    sorted_points_[i] = point_idx;
+    sorted_xs_[i] = cloud.points[point_idx].x;
+    sorted_ys_[i] = cloud.points[point_idx].y;
+    if (cells_.empty() || cells_.back().key != key) {
+      cells_.push_back({key, static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(i)});
+    }
+    cells_.back().end = static_cast<std::uint32_t>(i + 1);
+  }
+}
+
+void RadiusSearch2dGrid::findColumnRange(
+  const std::int64_t x, const std::int64_t y_begin, const std::int64_t y_end, std::uint32_t & begin,
+  std::uint32_t & end) const
+{
+  // The cells of a column are consecutive, so are their points
+  const auto compare = [](const Cell & cell, const std::uint64_t key) { return cell.key < key; };
+  const auto first =
+    std::lower_bound(cells_.begin(), cells_.end(), toCellKey(x, y_begin), compare);
+  const auto last = std::lower_bound(first, cells_.end(), toCellKey(x, y_end + 1), compare);
+  if (first == last) {
+    begin = end = 0;
+    return;
+  }
+  begin = first->begin;
+  end = std::prev(last)->end;
+}
+
+void RadiusSearch2dGrid::findInliers(
+  const std::vector<int> & min_points, std::vector<std::uint8_t> & is_inlier,
+  const int num_threads) const
+{
+  const std::size_t num_queries = min_points.size();
+  // The points out of the grid have no neighbor
+  is_inlier.resize(num_queries);
+  for (std::size_t i = 0; i < num_queries; ++i) {
+    is_inlier[i] = min_points[i] <= 0;
+  }
+
+  // Each cell writes the results of its own points only
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 64)
+  for (std::size_t cell_idx = 0; cell_idx < cells_.size(); ++cell_idx) {
+    const auto & cell = cells_[cell_idx];
+    bool has_query = false;
+    for (std::uint32_t i = cell.begin; i < cell.end && !has_query; ++i) {
+      has_query = sorted_points_[i] < num_queries;
+    }
+    if (!has_query) {
+      continue;
+    }
+
+    std::uint32_t column_begins[3];
+    std::uint32_t column_ends[3];
+    const std::int64_t x = cellX(cell.key);
+    const std::int64_t y = cellY(cell.key);
+    for (std::int64_t dx = -1; dx <= 1; ++dx) {
+      findColumnRange(x + dx, y - 1, y + 1, column_begins[dx + 1], column_ends[dx + 1]);
+    }
+
+    for (std::uint32_t i = cell.begin; i < cell.end; ++i) {
+      const std::uint32_t point_idx = sorted_points_[i];
+      if (point_idx >= num_queries) {
+        continue;
+      }
+      const int min_points_of_point = min_points[point_idx];
+      const float query_x = sorted_xs_[i];
+      const float query_y = sorted_ys_[i];
+      int points_num = 0;
+      for (int column = 0; column < 3 && points_num < min_points_of_point; ++column) {
+        for (std::uint32_t j = column_begins[column]; j < column_ends[column]; ++j) {
+          const float dx = query_x - sorted_xs_[j];
+          const float dy = query_y - sorted_ys_[j];
+          if (dx * dx + dy * dy < squared_radius_ && ++points_num >= min_points_of_point) {
+            break;
+          }
+        }
+      }
+      is_inlier[point_idx] = min_points_of_point <= points_num;
+    }
+  }
+}
+
+}  // namespace autoware::occupancy_grid_map_outlier_filter
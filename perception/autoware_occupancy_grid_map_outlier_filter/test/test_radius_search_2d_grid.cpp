@@ -0,0 +1,220 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/occupancy_grid_map_outlier_filter/radius_search_2d_grid.hpp"
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl/search/kdtree.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::occupancy_grid_map_outlier_filter::RadiusSearch2dGrid;
+
+namespace
+{
+pcl::PointXY makePoint(const float x, const float y)
+{
+  pcl::PointXY point;
+  point.x = x;
+  point.y = y;
+  return point;
+}
+
+// Neighbor counting of the radius search 2d filter before the grid, on the same cloud
+std::vector<std::uint8_t> findInliersWithKdTree(
+  const pcl::PointCloud<pcl::PointXY>::Ptr & cloud, const float radius,
+  const std::vector<int> & min_points)
+{
+  pcl::search::KdTree<pcl::PointXY> kd_tree(false);
+  kd_tree.setInputCloud(cloud);
+  std::vector<int> k_indices(cloud->points.size());
+  std::vector<float> k_distances(cloud->points.size());
+  std::vector<std::uint8_t> is_inlier(min_points.size());
+  for (size_t i = 0; i < min_points.size(); ++i) {
+    const int points_num = kd_tree.radiusSearch(
+      static_cast<int>(i), radius, k_indices, k_distances, min_points[i]);
+    is_inlier[i] = min_points[i] <= points_num;
+  }
+  return is_inlier;
+}
+
+// Counts every pair with the float distance and the strict comparison of pcl::KdTreeFLANN
+std::vector<std::uint8_t> findInliersWithLinearScan(
+  const pcl::PointCloud<pcl::PointXY> & cloud, const float radius,
+  const std::vector<int> & min_points)
+{
+  const float squared_radius = static_cast<float>(static_cast<double>(radius) * radius);
+  std::vector<std::uint8_t> is_inlier(min_points.size());
+  for (size_t i = 0; i < min_points.size(); ++i) {
+    int points_num = 0;
+    for (const auto & point : cloud.points) {
+      const float dx = cloud.points[i].x - point.x;
+      const float dy = cloud.points[i].y - point.y;
+      if (dx * dx + dy * dy < squared_radius) {
+        ++points_num;
+      }
+    }
+    is_inlier[i] = min_points[i] <= points_num;
+  }
+  return is_inlier;
+}
+
+std::vector<std::uint8_t> findInliersWithGrid(
+  const pcl::PointCloud<pcl::PointXY> & cloud, const float radius,
+  const std::vector<int> & min_points, const int num_threads)
+{
+  RadiusSearch2dGrid grid;
+  grid.setInputCloud(cloud, radius);
+  std::vector<std::uint8_t> is_inlier;
+  grid.findInliers(min_points, is_inlier, num_threads);
+  return is_inlier;
+}
+
+// Clusters of points on a lattice of the radius, so that many distances are exactly the radius,
+// with duplicates and scattered points
+pcl::PointCloud<pcl::PointXY>::Ptr makeRandomCloud(
+  const float radius, const size_t size, std::mt19937 & engine)
+{
+  std::uniform_int_distribution<int> lattice(-8, 8);
+  std::uniform_real_distribution<float> uniform(-8.0f * radius, 8.0f * radius);
+  std::uniform_int_distribution<int> kind(0, 3);
+  pcl::PointCloud<pcl::PointXY>::Ptr cloud(new pcl::PointCloud<pcl::PointXY>);
+  for (size_t i = 0; i < size; ++i) {
+    const int point_kind = kind(engine);
+    if (point_kind == 0 && !cloud->points.empty()) {
+      cloud->push_back(cloud->points[std::uniform_int_distribution<size_t>(
+        0, cloud->points.size() - 1)(engine)]);
+    } else if (point_kind == 1) {
+      cloud->push_back(makePoint(uniform(engine), uniform(engine)));
+    } else {
+      cloud->push_back(makePoint(lattice(engine) * radius, lattice(engine) * radius));
+    }
+  }
+  return cloud;
+}
+
+std::vector<int> makeRandomMinPoints(const size_t size, std::mt19937 & engine)
+{
+  std::uniform_int_distribution<int> distribution(1, 6);
+  std::vector<int> min_points(size);
+  for (auto & value : min_points) {
+    value = distribution(engine);
+  }
+  return min_points;
+}
+}  // namespace
+
+TEST(RadiusSearch2dGrid, PointsAtTheRadiusAreNotNeighbors)
+{
+  // All the coordinates and distances are exact in float
+  pcl::PointCloud<pcl::PointXY> cloud;
+  cloud.push_back(makePoint(0.0f, 0.0f));
+  cloud.push_back(makePoint(0.0f, 5.0f));   // at the radius
+  cloud.push_back(makePoint(3.0f, -4.0f));  // at the radius
+  cloud.push_back(makePoint(0.0f, -4.75f));
+  cloud.push_back(makePoint(-10.0f, 0.0f));
+  cloud.push_back(makePoint(-6.0f, 3.0f));  // at the radius of the previous point
+
+  const std::vector<int> min_points{3, 2, 2, 2, 2, 2};
+  for (const int num_threads : {1, 4}) {
+    const auto is_inlier = findInliersWithGrid(cloud, 5.0f, min_points, num_threads);
+    const std::vector<std::uint8_t> expected{0, 0, 1, 1, 0, 0};
+    EXPECT_EQ(is_inlier, expected) << num_threads << " threads";
+  }
+}
+
+TEST(RadiusSearch2dGrid, DuplicatePointsAreNeighbors)
+{
+  pcl::PointCloud<pcl::PointXY> cloud;
+  for (int i = 0; i < 3; ++i) {
+    cloud.push_back(makePoint(1.5f, -2.5f));
+  }
+  cloud.push_back(makePoint(20.0f, 20.0f));
+
+  const auto is_inlier = findInliersWithGrid(cloud, 0.5f, {3, 4, 1, 1}, 1);
+  const std::vector<std::uint8_t> expected{1, 0, 1, 1};
+  EXPECT_EQ(is_inlier, expected);
+}
+
+TEST(RadiusSearch2dGrid, NonFinitePointsHaveNoNeighbor)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const float inf = std::numeric_limits<float>::infinity();
+  pcl::PointCloud<pcl::PointXY> cloud;
+  cloud.push_back(makePoint(nan, 0.0f));
+  cloud.push_back(makePoint(0.0f, inf));
+  cloud.push_back(makePoint(0.0f, 0.0f));
+  cloud.push_back(makePoint(nan, nan));
+  cloud.push_back(makePoint(0.0f, 0.5f));
+
+  // A non-finite point is not even its own neighbor, and it is no neighbor of the finite points
+  const auto is_inlier = findInliersWithGrid(cloud, 1.0f, {1, 1, 2, 0, 3}, 1);
+  const std::vector<std::uint8_t> expected{0, 0, 1, 1, 0};
+  EXPECT_EQ(is_inlier, expected);
+}
+
+TEST(RadiusSearch2dGrid, InvalidRadiusHasNoNeighbor)
+{
+  pcl::PointCloud<pcl::PointXY> cloud;
+  cloud.push_back(makePoint(0.0f, 0.0f));
+  cloud.push_back(makePoint(0.0f, 0.0f));
+  for (const float radius : {0.0f, -1.0f, std::numeric_limits<float>::quiet_NaN()}) {
+    const auto is_inlier = findInliersWithGrid(cloud, radius, {1, 0}, 1);
+    const std::vector<std::uint8_t> expected{0, 1};
+    EXPECT_EQ(is_inlier, expected) << radius;
+  }
+}
+
+TEST(RadiusSearch2dGrid, MatchesLinearScan)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::mt19937 engine(0);
+  for (const float radius : {0.1f, 0.3f, 1.0f, 2.5f}) {
+    for (int trial = 0; trial < 10; ++trial) {
+      auto cloud = makeRandomCloud(radius, 2000, engine);
+      for (size_t i = 0; i < cloud->points.size(); i += 97) {
+        cloud->points[i].x = nan;
+      }
+      // only a part of the points are queries, like the low confidence points
+      const auto min_points = makeRandomMinPoints(cloud->points.size() / 2, engine);
+      const auto expected = findInliersWithLinearScan(*cloud, radius, min_points);
+      for (const int num_threads : {1, 2, 4, 8}) {
+        EXPECT_EQ(findInliersWithGrid(*cloud, radius, min_points, num_threads), expected)
+          << "radius " << radius << ", trial " << trial << ", " << num_threads << " threads";
+      }
+    }
+  }
+}
+
+TEST(RadiusSearch2dGrid, MatchesKdTree)
+{
+  std::mt19937 engine(1);
+  for (const float radius : {0.25f, 1.0f, 4.0f}) {
+    for (int trial = 0; trial < 5; ++trial) {
+      const auto cloud = makeRandomCloud(radius, 2000, engine);
+      const auto min_points = makeRandomMinPoints(cloud->points.size(), engine);
+      const auto expected = findInliersWithKdTree(cloud, radius, min_points);
+      for (const int num_threads : {1, 4}) {
+        EXPECT_EQ(findInliersWithGrid(*cloud, radius, min_points, num_threads), expected)
+          << "radius " << radius << ", trial " << trial << ", " << num_threads << " threads";
+      }
+    }
+  }
+}
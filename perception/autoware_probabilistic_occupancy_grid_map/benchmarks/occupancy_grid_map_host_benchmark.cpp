@@ -0,0 +1,179 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Update time of the host occupancy grid maps on a 150 m x 150 m map with a 0.5 m resolution (the
+// default parameters) for a 200k points scan, with 1 to 8 threads. Usage:
+// occupancy_grid_map_host_benchmark [num_random_points]
+// Whether the costs are the same as with 1 thread is printed next to the timings.
+
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_fixed.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_projective.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapFixedBlindSpot;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapInterface;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapProjectiveBlindSpot;
+using geometry_msgs::msg::Pose;
+using sensor_msgs::msg::PointCloud2;
+
+constexpr int nb_iterations = 5;
+
+constexpr double map_length = 150.0;
+constexpr double map_resolution = 0.5;
+constexpr unsigned int num_cells = map_length / map_resolution;
+
+struct Scene
+{
+  PointCloud2 raw_pointcloud;
+  PointCloud2 obstacle_pointcloud;
+};
+
+PointCloud2 createPointCloud(const std::vector<std::array<float, 3>> & points)
+{
+  PointCloud2 pointcloud;
+  pointcloud.header.frame_id = "base_link";
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(pointcloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point[0];
+    *iter_y = point[1];
+    *iter_z = point[2];
+    ++iter_x, ++iter_y, ++iter_z;
+  }
+  return pointcloud;
+}
+
+// Rings of ground points around the vehicle and random points over the map, the ones above 0.3 m
+// being obstacles
+Scene createScene(const std::size_t num_random_points)
+{
+  std::vector<std::array<float, 3>> raw_points;
+  std::vector<std::array<float, 3>> obstacle_points;
+  for (float angle = 0.0; angle < 2.0 * M_PI; angle += 0.002) {
+    for (float range = 2.0; range < 60.0; range += 1.5) {
+      raw_points.push_back({range * std::cos(angle), range * std::sin(angle), 0.0});
+    }
+  }
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> xy(-70.0, 70.0);
+  std::uniform_real_distribution<float> height(-0.5, 2.5);
+  for (std::size_t i = 0; i < num_random_points; ++i) {
+    const std::array<float, 3> point{xy(engine), xy(engine), height(engine)};
+    raw_points.push_back(point);
+    if (point[2] > 0.3) {
+      obstacle_points.push_back(point);
+    }
+  }
+  return {createPointCloud(raw_points), createPointCloud(obstacle_points)};
+}
+
+// The maps declare their parameters, so that each of them needs its own node
+std::shared_ptr<rclcpp::Node> createNode()
+{
+  rclcpp::NodeOptions node_options;
+  node_options.append_parameter_override("OccupancyGridMapFixedBlindSpot.distance_margin", 1.0);
+  node_options.append_parameter_override(
+    "OccupancyGridMapProjectiveBlindSpot.projection_dz_threshold", 0.01);
+  node_options.append_parameter_override(
+    "OccupancyGridMapProjectiveBlindSpot.obstacle_separation_threshold", 1.0);
+  return std::make_shared<rclcpp::Node>("occupancy_grid_map_host_benchmark", node_options);
+}
+
+template <typename GridMap>
+std::unique_ptr<OccupancyGridMapInterface> createMap()
+{
+  auto map = std::make_unique<GridMap>(false, num_cells, num_cells, map_resolution);
+  map->initRosParam(*createNode());
+  map->setHeightLimit(-1.0, 2.0);
+  return map;
+}
+
+void updateMap(OccupancyGridMapInterface & map, const Scene & scene, const std::size_t num_threads)
+{
+  Pose robot_pose;
+  robot_pose.orientation.w = 1.0;
+  map.setNumThreads(num_threads);
+  map.resetMaps();
+  map.updateOrigin(-map.getSizeInMetersX() / 2, -map.getSizeInMetersY() / 2);
+  map.updateWithPointCloud(
+    scene.raw_pointcloud, scene.obstacle_pointcloud, robot_pose, robot_pose);
+}
+
+std::vector<unsigned char> getCosts(const OccupancyGridMapInterface & map)
+{
+  const unsigned char * data = map.getCharMap();
+  return {data, data + map.getSizeInCellsX() * map.getSizeInCellsY()};
+}
+
+void run(const Scene & scene, const bool projective)
+{
+  const auto create_map = [&]() {
+    return projective ? createMap<OccupancyGridMapProjectiveBlindSpot>()
+                      : createMap<OccupancyGridMapFixedBlindSpot>();
+  };
+  std::vector<unsigned char> serial_costs;
+  for (const std::size_t num_threads : {1, 2, 4, 8}) {
+    auto map = create_map();
+    updateMap(*map, scene, num_threads);  // allocates the host tensors
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nb_iterations; ++i) {
+      updateMap(*map, scene, num_threads);
+    }
+    const double ms = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - start)
+                        .count() /
+                      nb_iterations;
+    const auto costs = getCosts(*map);
+    if (num_threads == 1) {
+      serial_costs = costs;
+    }
+    std::cout << (projective ? "projective" : "fixed") << ", " << num_threads
+              << " threads: " << ms << " ms, same costs: " << (costs == serial_costs ? "yes" : "NO")
+              << "\n";
+  }
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(0, nullptr);
+  const std::size_t num_random_points = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+  const auto scene = createScene(num_random_points);
+  std::cout << scene.raw_pointcloud.width * scene.raw_pointcloud.height << " points, "
+            << num_cells << " x " << num_cells << " cells\n";
+  for (const bool projective : {false, true}) {
+    run(scene, projective);
+  }
+  rclcpp::shutdown();
+  return 0;
+}
@@ -88,6 +88,12 @@ public:
     [[maybe_unused]] const Pose & robot_pose, [[maybe_unused]] const Pose & scan_origin) {};
 #endif
 
+  // Host version of updateWithPointCloud, used when cuda is disabled
+  virtual void updateWithPointCloud(
+    [[maybe_unused]] const PointCloud2 & raw_pointcloud,
+    [[maybe_unused]] const PointCloud2 & obstacle_pointcloud,
+    [[maybe_unused]] const Pose & robot_pose, [[maybe_unused]] const Pose & scan_origin) {};
+
   void updateOrigin(double new_origin_x, double new_origin_y) override;
 
   void resetMaps() override;
@@ -107,6 +113,9 @@ public:
 
   bool isCudaEnabled() const;
 
+  // Number of threads of the host processing, 0 uses all the hardware threads
+  void setNumThreads(const std::size_t num_threads);
+
 #ifdef USE_CUDA
   void setCudaStream(const cudaStream_t & stream);
 
@@ -122,6 +131,7 @@ protected:
   double resolution_inv_;
   bool use_cuda_;
   bool first_iteration_{true};
+  std::size_t num_threads_{1};
 
 #ifdef USE_CUDA
   cudaStream_t stream_;
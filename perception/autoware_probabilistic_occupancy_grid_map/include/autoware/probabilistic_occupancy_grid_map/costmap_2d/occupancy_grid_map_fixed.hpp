@@ -16,7 +16,14 @@
 #define AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__COSTMAP_2D__OCCUPANCY_GRID_MAP_FIXED_HPP_
 
 #include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_base.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/utils/utils_host.hpp"
+
+#ifdef USE_CUDA
 #include "autoware/probabilistic_occupancy_grid_map/utils/cuda_pointcloud.hpp"
+#endif
+
+#include <cstdint>
+#include <vector>
 
 namespace autoware::occupancy_grid_map
 {
@@ -32,17 +39,30 @@ public:
     const bool use_cuda, const unsigned int cells_size_x, const unsigned int cells_size_y,
     const float resolution);
 
+#ifdef USE_CUDA
   void updateWithPointCloud(
     const CudaPointCloud2 & raw_pointcloud, const CudaPointCloud2 & obstacle_pointcloud,
     const Pose & robot_pose, const Pose & scan_origin) override;
+#endif
+
+  void updateWithPointCloud(
+    const PointCloud2 & raw_pointcloud, const PointCloud2 & obstacle_pointcloud,
+    const Pose & robot_pose, const Pose & scan_origin) override;
 
   void initRosParam(rclcpp::Node & node) override;
 
 protected:
   double distance_margin_;
 
+#ifdef USE_CUDA
   autoware::cuda_utils::CudaUniquePtr<std::uint64_t[]> raw_points_tensor_;
   autoware::cuda_utils::CudaUniquePtr<std::uint64_t[]> obstacle_points_tensor_;
+#endif
+
+  // host tensors, allocated on the first host update
+  std::vector<std::uint64_t> host_raw_points_tensor_;
+  std::vector<std::uint64_t> host_obstacle_points_tensor_;
+  utils::HostWorkspace host_workspace_;
 };
 
 }  // namespace costmap_2d
@@ -16,11 +16,15 @@
 #define AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__COSTMAP_2D__OCCUPANCY_GRID_MAP_PROJECTIVE_HPP_
 
 #include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_base.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/utils/utils_host.hpp"
 
 #include <grid_map_core/GridMap.hpp>
 
 #include <grid_map_msgs/msg/grid_map.hpp>
 
+#include <cstdint>
+#include <vector>
+
 namespace autoware::occupancy_grid_map
 {
 namespace costmap_2d
@@ -35,9 +39,15 @@ public:
     const bool use_cuda, const unsigned int cells_size_x, const unsigned int cells_size_y,
     const float resolution);
 
+#ifdef USE_CUDA
   void updateWithPointCloud(
     const CudaPointCloud2 & raw_pointcloud, const CudaPointCloud2 & obstacle_pointcloud,
     const Pose & robot_pose, const Pose & scan_origin) override;
+#endif
+
+  void updateWithPointCloud(
+    const PointCloud2 & raw_pointcloud, const PointCloud2 & obstacle_pointcloud,
+    const Pose & robot_pose, const Pose & scan_origin) override;
 
   void initRosParam(rclcpp::Node & node) override;
 
@@ -45,9 +55,16 @@ private:
   float projection_dz_threshold_;
   float obstacle_separation_threshold_;
 
+#ifdef USE_CUDA
   autoware::cuda_utils::CudaUniquePtr<std::uint64_t[]> raw_points_tensor_;
   autoware::cuda_utils::CudaUniquePtr<std::uint64_t[]> obstacle_points_tensor_;
   autoware::cuda_utils::CudaUniquePtr<Eigen::Vector3f> device_translation_scan_origin_;
+#endif
+
+  // host tensors, allocated on the first host update
+  std::vector<std::uint64_t> host_raw_points_tensor_;
+  std::vector<std::uint64_t> host_obstacle_points_tensor_;
+  utils::HostWorkspace host_workspace_;
 };
 
 }  // namespace costmap_2d
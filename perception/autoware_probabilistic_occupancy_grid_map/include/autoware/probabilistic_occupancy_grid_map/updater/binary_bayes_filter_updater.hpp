@@ -24,6 +24,9 @@
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include <cstdint>
+#include <vector>
+
 namespace autoware::occupancy_grid_map
 {
 namespace costmap_2d
@@ -42,6 +45,8 @@ private:
   inline unsigned char applyBBF(const unsigned char & z, const unsigned char & o);
   Eigen::Matrix2f probability_matrix_;
   double v_ratio_;
+  // applyBBF for every (observation, occupancy) pair, used by the host update
+  std::vector<std::uint8_t> fusion_table_;
 
 #ifdef USE_CUDA
   autoware::cuda_utils::CudaUniquePtr<float[]> device_probability_matrix_;
@@ -0,0 +1,194 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UTILS__UTILS_HOST_HPP_
+#define AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UTILS__UTILS_HOST_HPP_
+
+#include <autoware/universe_utils/system/parallel_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+namespace autoware::occupancy_grid_map
+{
+namespace utils
+{
+
+// Below this many points or angle bins per worker the threads cost more than they save
+constexpr std::size_t min_points_per_worker = 4096;
+constexpr std::size_t min_angle_bins_per_worker = 64;
+constexpr std::size_t min_cells_per_worker = 1 << 16;
+
+/// Buffers reused by the host backend between the updates.
+struct HostWorkspace
+{
+  std::vector<std::uint32_t> bin_of_point;
+  std::vector<std::uint64_t> packed_points;
+  std::vector<std::vector<std::uint8_t>> layers;
+};
+
+/// Host version of the setCellValue device function.
+void setCellValueHost(
+  float wx, float wy, float origin_x, float origin_y, float resolution_inv, int size_x, int size_y,
+  std::uint8_t value, std::uint8_t * costmap_tensor);
+
+/// Host version of the raytrace device function.
+void raytraceHost(
+  const float source_x, const float source_y, const float target_x, const float target_y,
+  const float origin_x, float origin_y, const float resolution_inv, const int size_x,
+  const int size_y, const std::uint8_t cost, std::uint8_t * costmap_tensor);
+
+/// A cost value that is none of the given ones, used to mark the cells a worker did not write.
+std::uint8_t findUnusedCostValue(std::initializer_list<std::uint8_t> used_values);
+
+/// Size of a fusion table, indexed by (observation << 8) | occupancy.
+constexpr std::size_t fusion_table_size = 256 * 256;
+
+/// Fills a fusion table with fuse(observation, occupancy).
+template <typename Fuse>
+void buildFusionTable(Fuse && fuse, std::vector<std::uint8_t> & fusion_table)
+{
+  fusion_table.resize(fusion_table_size);
+  for (unsigned int z = 0; z < 256; ++z) {
+    for (unsigned int o = 0; o < 256; ++o) {
+      fusion_table[(z << 8) | o] =
+        fuse(static_cast<unsigned char>(z), static_cast<unsigned char>(o));
+    }
+  }
+}
+
+/// Host version of the updater kernels:
+/// costmap[i] = fusion_table[(observation[i] << 8) | costmap[i]]
+void applyFusionTableHost(
+  const std::vector<std::uint8_t> & fusion_table, const std::uint8_t * observation_tensor,
+  const std::size_t num_cells, const std::size_t num_threads, std::uint8_t * costmap_tensor);
+
+inline std::uint32_t floatAsUint(const float value)
+{
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline float uintAsFloat(const std::uint32_t bits)
+{
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+/**
+ * @brief Host version of the tensor preparation kernels. Every bin of points_tensor holds
+ * NumLanes values (range << 32 | bits) and keeps the minimum of each of them over the points of
+ * the bin, as the atomicMin of the kernels does.
+ *
+ * @param pack_point pack_point(point_index, lanes) writes the lanes of a point and returns its
+ * bin index, or a negative value if the point is dropped
+ */
+template <std::size_t NumLanes, typename PackPoint>
+void prepareTensorHost(
+  const std::size_t num_points, const std::size_t angle_bins, const std::size_t range_bins,
+  const std::size_t num_threads, PackPoint && pack_point, std::uint64_t * points_tensor,
+  HostWorkspace & workspace)
+{
+  constexpr auto no_bin = std::numeric_limits<std::uint32_t>::max();
+  auto & bin_of_point = workspace.bin_of_point;
+  auto & packed_points = workspace.packed_points;
+  bin_of_point.resize(num_points);
+  packed_points.resize(NumLanes * num_points);
+
+  // 1) Bin and pack the points independently
+  autoware::universe_utils::parallelFor(
+    num_points, num_threads, min_points_per_worker,
+    [&](std::size_t begin, std::size_t end, std::size_t) {
+      for (std::size_t i = begin; i < end; ++i) {
+        const int bin = pack_point(i, packed_points.data() + NumLanes * i);
+        bin_of_point[i] = bin < 0 ? no_bin : static_cast<std::uint32_t>(bin);
+      }
+    });
+
+  // 2) Each worker owns a range of angle bins, resets it and keeps the minimum of its points
+  autoware::universe_utils::parallelFor(
+    angle_bins, num_threads, min_angle_bins_per_worker,
+    [&](std::size_t begin, std::size_t end, std::size_t) {
+      const std::uint32_t bin_begin = begin * range_bins;
+      const std::uint32_t bin_end = end * range_bins;
+      std::fill(
+        points_tensor + NumLanes * bin_begin, points_tensor + NumLanes * bin_end,
+        std::numeric_limits<std::uint64_t>::max());
+      for (std::size_t i = 0; i < num_points; ++i) {
+        const std::uint32_t bin = bin_of_point[i];
+        if (bin < bin_begin || bin >= bin_end) {
+          continue;
+        }
+        std::uint64_t * element = points_tensor + NumLanes * bin;
+        const std::uint64_t * lanes = packed_points.data() + NumLanes * i;
+        for (std::size_t lane = 0; lane < NumLanes; ++lane) {
+          element[lane] = std::min(element[lane], lanes[lane]);
+        }
+      }
+    });
+}
+
+/**
+ * @brief Host version of the fill kernels. fill_bin(bin_index, costmap) is called for every bin
+ * of [0, angle_bins * range_bins) and writes into the costmap. The workers own ranges of angle
+ * bins, the first one writes into the costmap and the others into their own layer. The layers are
+ * applied in order, so that the result is the one of a pass over the bins in index order.
+ *
+ * @param unset_value a value that fill_bin never writes
+ */
+template <typename FillBin>
+void fillCostmapHost(
+  const std::size_t angle_bins, const std::size_t range_bins, const std::size_t num_cells,
+  const std::uint8_t unset_value, const std::size_t num_threads, FillBin && fill_bin,
+  std::uint8_t * costmap_tensor, HostWorkspace & workspace)
+{
+  auto & layers = workspace.layers;
+  const std::size_t num_workers = autoware::universe_utils::numParallelWorkers(
+    angle_bins, num_threads, min_angle_bins_per_worker);
+  if (layers.size() < num_workers) {
+    layers.resize(num_workers);
+  }
+
+  autoware::universe_utils::parallelFor(
+    angle_bins, num_threads, min_angle_bins_per_worker,
+    [&](std::size_t begin, std::size_t end, std::size_t worker) {
+      std::uint8_t * target = costmap_tensor;
+      if (worker > 0) {
+        layers[worker].assign(num_cells, unset_value);
+        target = layers[worker].data();
+      }
+      for (std::size_t bin = begin * range_bins; bin < end * range_bins; ++bin) {
+        fill_bin(bin, target);
+      }
+    });
+
+  for (std::size_t worker = 1; worker < num_workers; ++worker) {
+    const std::uint8_t * layer = layers[worker].data();
+    for (std::size_t i = 0; i < num_cells; ++i) {
+      costmap_tensor[i] = layer[i] == unset_value ? costmap_tensor[i] : layer[i];
+    }
+  }
+}
+
+}  // namespace utils
+}  // namespace autoware::occupancy_grid_map
+
+#endif  // AUTOWARE__PROBABILISTIC_OCCUPANCY_GRID_MAP__UTILS__UTILS_HOST_HPP_
@@ -54,6 +54,7 @@
 #include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
 #include "autoware/probabilistic_occupancy_grid_map/utils/utils.hpp"
 
+#include <autoware/universe_utils/system/parallel_for.hpp>
 #include <grid_map_costmap_2d/grid_map_costmap_2d.hpp>
 #include <pcl_ros/transforms.hpp>
 
@@ -69,6 +70,7 @@
 #endif
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 namespace autoware::occupancy_grid_map
@@ -83,12 +85,12 @@ OccupancyGridMapInterface::OccupancyGridMapInterface(
 : Costmap2D(cells_size_x, cells_size_y, resolution, 0.f, 0.f, cost_value::NO_INFORMATION),
   use_cuda_(use_cuda)
 {
+  min_height_ = -std::numeric_limits<double>::infinity();
+  max_height_ = std::numeric_limits<double>::infinity();
+  resolution_inv_ = 1.0 / resolution_;
+
 #ifdef USE_CUDA
   if (use_cuda_) {
-    min_height_ = -std::numeric_limits<double>::infinity();
-    max_height_ = std::numeric_limits<double>::infinity();
-    resolution_inv_ = 1.0 / resolution_;
-
     const auto num_cells_x = this->getSizeInCellsX();
     const auto num_cells_y = this->getSizeInCellsY();
 
@@ -236,6 +238,11 @@ bool OccupancyGridMapInterface::isCudaEnabled() const
   return use_cuda_;
 }
 
+void OccupancyGridMapInterface::setNumThreads(const std::size_t num_threads)
+{
+  num_threads_ = autoware::universe_utils::resolveNumThreads(num_threads);
+}
+
 #ifdef USE_CUDA
 void OccupancyGridMapInterface::setCudaStream(const cudaStream_t & stream)
 {
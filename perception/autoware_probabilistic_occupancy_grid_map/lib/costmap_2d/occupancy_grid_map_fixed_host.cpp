@@ -0,0 +1,337 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_fixed_host.hpp"
+
+#include "autoware/probabilistic_occupancy_grid_map/utils/utils_host.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace autoware::occupancy_grid_map
+{
+namespace costmap_2d::map_fixed
+{
+using utils::raytraceHost;
+using utils::setCellValueHost;
+using utils::uintAsFloat;
+
+static constexpr float RANGE_DISCRETIZATION_RESOLUTION = 0.001f;
+
+namespace
+{
+// The bodies below are the ones of the kernels of occupancy_grid_map_fixed_kernel.cu, with the
+// thread index as parameter
+
+void fillUnknownSpaceBin(
+  const std::size_t idx, const std::uint64_t * raw_points_tensor,
+  const std::uint64_t * obstacle_points_tensor, const float distance_margin,
+  const std::size_t range_bins, const float map_resolution_inv, const float map_origin_x,
+  const float map_origin_y, const int num_cells_x, const int num_cells_y,
+  std::uint8_t free_space_value, std::uint8_t no_information_value,
+  std::uint8_t * costmap_tensor)
+{
+  const std::size_t angle_bin_index = idx / range_bins;
+  const int range_bin_index = idx % range_bins;
+  const int last_range_bin_index = static_cast<int>(range_bins) - 1;
+
+  if (range_bin_index == last_range_bin_index) {
+    return;
+  }
+
+  const std::uint64_t * raw_row = raw_points_tensor + 2 * angle_bin_index * range_bins;
+  const std::uint64_t * obs_row = obstacle_points_tensor + 2 * angle_bin_index * range_bins;
+
+  std::uint64_t obs_range_and_x = obs_row[2 * range_bin_index + 0];
+  std::uint64_t obs_range_and_y = obs_row[2 * range_bin_index + 1];
+  std::uint32_t obs_range_int = obs_range_and_x >> 32;
+  float obs_range = obs_range_int * RANGE_DISCRETIZATION_RESOLUTION;
+  float obs_world_x = uintAsFloat(obs_range_and_x & 0xFFFFFFFF);
+  float obs_world_y = uintAsFloat(obs_range_and_y & 0xFFFFFFFF);
+
+  if (obs_range_int == 0xFFFFFFFF || obs_world_x < map_origin_x || obs_world_y < map_origin_y) {
+    return;
+  }
+
+  int next_raw_range_bin_index = range_bin_index + 1;
+  int next_obs_range_bin_index = range_bin_index + 1;
+
+  for (; next_raw_range_bin_index < last_range_bin_index; next_raw_range_bin_index++) {
+    std::uint64_t next_raw_range_and_x = raw_row[2 * next_raw_range_bin_index + 0];
+    std::uint32_t next_raw_range_int = next_raw_range_and_x >> 32;
+    float next_raw_range = next_raw_range_int * RANGE_DISCRETIZATION_RESOLUTION;
+
+    if (
+      next_raw_range_int != 0xFFFFFFFF && std::abs(next_raw_range - obs_range) > distance_margin) {
+      break;
+    }
+  }
+
+  for (; next_obs_range_bin_index < last_range_bin_index; next_obs_range_bin_index++) {
+    std::uint64_t next_obs_range_and_x = obs_row[2 * next_obs_range_bin_index + 0];
+    std::uint32_t next_obs_range_int = next_obs_range_and_x >> 32;
+
+    if (next_obs_range_int != 0xFFFFFFFF) {
+      break;
+    }
+  }
+
+  const std::uint64_t next_obs_range_and_x = obs_row[2 * next_obs_range_bin_index + 0];
+  const std::uint64_t next_obs_range_and_y = obs_row[2 * next_obs_range_bin_index + 1];
+  const std::uint32_t next_obs_range_int = next_obs_range_and_x >> 32;
+  const float next_obs_world_x = uintAsFloat(next_obs_range_and_x & 0xFFFFFFFF);
+  const float next_obs_world_y = uintAsFloat(next_obs_range_and_y & 0xFFFFFFFF);
+
+  const std::uint64_t next_raw_range_and_x = raw_row[2 * next_raw_range_bin_index + 0];
+  const std::uint64_t next_raw_range_and_y = raw_row[2 * next_raw_range_bin_index + 1];
+  const std::uint32_t next_raw_range_int = next_raw_range_and_x >> 32;
+  const float next_raw_world_x = uintAsFloat(next_raw_range_and_x & 0xFFFFFFFF);
+  const float next_raw_world_y = uintAsFloat(next_raw_range_and_y & 0xFFFFFFFF);
+
+  if (next_obs_range_int == 0xFFFFFFFF) {
+    if (
+      next_raw_range_int == 0xFFFFFFFF || next_raw_world_x < map_origin_x ||
+      next_raw_world_y < map_origin_y) {
+      return;
+    }
+
+    // if there is no more obstacles after the current one but there are more raw points
+    // the space between the current obstacle and the next raw point flagged as no_information_value
+    raytraceHost(
+      obs_world_x, obs_world_y, next_raw_world_x, next_raw_world_y, map_origin_x, map_origin_y,
+      map_resolution_inv, num_cells_x, num_cells_y, no_information_value, costmap_tensor);
+
+    setCellValueHost(
+      next_raw_world_x, next_raw_world_y, map_origin_x, map_origin_y, map_resolution_inv,
+      num_cells_x, num_cells_y, free_space_value, costmap_tensor);
+    return;
+  }
+
+  float next_obs_range = next_obs_range_int * RANGE_DISCRETIZATION_RESOLUTION;
+  float obs_to_obs_distance = next_obs_range - obs_range;
+
+  if (obs_to_obs_distance <= distance_margin) {
+    return;
+  } else if (next_raw_range_int == 0xFFFFFFFF) {
+    // fill with no information between obstacles
+
+    if (next_obs_world_x < map_origin_x || next_obs_world_y < map_origin_y) {
+      return;
+    }
+
+    raytraceHost(
+      obs_world_x, obs_world_y, next_obs_world_x, next_obs_world_y, map_origin_x, map_origin_y,
+      map_resolution_inv, num_cells_x, num_cells_y, no_information_value, costmap_tensor);
+
+    return;
+  }
+
+  float next_raw_range = next_raw_range_int * RANGE_DISCRETIZATION_RESOLUTION;
+  float raw_to_obs_distance = std::abs(next_raw_range - obs_range);
+
+  if (raw_to_obs_distance < obs_to_obs_distance) {
+    // fill with free space between raw and obstacle
+
+    if (next_raw_world_x < map_origin_x || next_raw_world_y < map_origin_y) {
+      return;
+    }
+
+    raytraceHost(
+      obs_world_x, obs_world_y, next_raw_world_x, next_raw_world_y, map_origin_x, map_origin_y,
+      map_resolution_inv, num_cells_x, num_cells_y, no_information_value, costmap_tensor);
+
+    setCellValueHost(
+      next_raw_world_x, next_raw_world_y, map_origin_x, map_origin_y, map_resolution_inv,
+      num_cells_x, num_cells_y, free_space_value, costmap_tensor);
+    return;
+  } else {
+    // fill with no information between obstacles
+
+    if (next_obs_world_x < map_origin_x || next_obs_world_y < map_origin_y) {
+      return;
+    }
+
+    raytraceHost(
+      obs_world_x, obs_world_y, next_obs_world_x, next_obs_world_y, map_origin_x, map_origin_y,
+      map_resolution_inv, num_cells_x, num_cells_y, no_information_value, costmap_tensor);
+
+    return;
+  }
+}
+
+void fillObstaclesBin(
+  const std::size_t idx, const std::uint64_t * obstacle_points_tensor, const float distance_margin,
+  const float map_resolution_inv, const float map_origin_x, const float map_origin_y,
+  const int num_cells_x, const int num_cells_y, std::uint8_t obstacle_value,
+  std::uint8_t * costmap_tensor)
+{
+  std::uint64_t range_and_x = obstacle_points_tensor[2 * idx + 0];
+  std::uint64_t range_and_y = obstacle_points_tensor[2 * idx + 1];
+
+  std::uint32_t range_int = range_and_x >> 32;
+  float range = range_int * RANGE_DISCRETIZATION_RESOLUTION;
+  float world_x = uintAsFloat(range_and_x & 0xFFFFFFFF);
+  float world_y = uintAsFloat(range_and_y & 0xFFFFFFFF);
+
+  if (range < 0.0 || range_int == 0xFFFFFFFF) {
+    return;
+  }
+
+  setCellValueHost(
+    world_x, world_y, map_origin_x, map_origin_y, map_resolution_inv, num_cells_x, num_cells_y,
+    obstacle_value, costmap_tensor);
+
+  // The kernel looks for the next obstacle point of the bin but then reads the current bin again,
+  // so that the ray below always goes from the point to itself. It is kept as is to produce the
+  // same cells.
+  std::uint64_t next_obs_range_and_x = range_and_x;
+  std::uint64_t next_obs_range_and_y = range_and_y;
+
+  std::uint32_t next_obs_range_int = next_obs_range_and_x >> 32;
+  float next_obs_range = next_obs_range_int * RANGE_DISCRETIZATION_RESOLUTION;
+  float next_obs_world_x = uintAsFloat(next_obs_range_and_x & 0xFFFFFFFF);
+  float next_obs_world_y = uintAsFloat(next_obs_range_and_y & 0xFFFFFFFF);
+
+  if (next_obs_range_int == 0xFFFFFFFF || std::abs(next_obs_range - range) > distance_margin) {
+    return;
+  }
+
+  if (next_obs_world_x < map_origin_x || next_obs_world_y < map_origin_y) {
+    return;
+  }
+
+  raytraceHost(
+    world_x, world_y, next_obs_world_x, next_obs_world_y, map_origin_x, map_origin_y,
+    map_resolution_inv, num_cells_x, num_cells_y, obstacle_value, costmap_tensor);
+}
+}  // namespace
+
+void prepareTensorHost(
+  const float * input_pointcloud, const std::size_t num_points, const std::size_t points_step,
+  const std::size_t angle_bins, const std::size_t range_bins, const float min_height,
+  const float max_height, const float min_angle, const float angle_increment_inv,
+  const float range_resolution_inv, const Eigen::Matrix3f & rotation_map,
+  const Eigen::Vector3f & translation_map, const Eigen::Matrix3f & rotation_scan,
+  const Eigen::Vector3f & translation_scan, std::uint64_t * points_tensor,
+  const std::size_t num_threads, utils::HostWorkspace & workspace)
+{
+  const auto pack_point = [&](const std::size_t idx, std::uint64_t * lanes) -> int {
+    Eigen::Map<const Eigen::Vector3f> point(input_pointcloud + idx * points_step);
+
+    if (
+      point.z() > max_height || point.z() < min_height || !std::isfinite(point.x()) ||
+      !std::isfinite(point.y()) || !std::isfinite(point.z())) {
+      return -1;
+    }
+
+    Eigen::Vector3f map_point = rotation_map * point + translation_map;
+    Eigen::Vector3f scan_point = rotation_scan * map_point + translation_scan;
+
+    float angle = std::atan2(scan_point.y(), scan_point.x());
+    int angle_bin_index = static_cast<int>((angle - min_angle) * angle_increment_inv);
+    float range = std::sqrt(scan_point.y() * scan_point.y() + scan_point.x() * scan_point.x());
+    int range_bin_index = static_cast<int>(range * range_resolution_inv);
+
+    if (
+      angle_bin_index < 0 || static_cast<std::size_t>(angle_bin_index) >= angle_bins ||
+      range_bin_index < 0 || static_cast<std::size_t>(range_bin_index) >= range_bins) {
+      return -1;
+    }
+
+    std::uint64_t range_int = static_cast<std::int64_t>(range / RANGE_DISCRETIZATION_RESOLUTION);
+    lanes[0] = (range_int << 32) | utils::floatAsUint(map_point.x());
+    lanes[1] = (range_int << 32) | utils::floatAsUint(map_point.y());
+    return angle_bin_index * static_cast<int>(range_bins) + range_bin_index;
+  };
+
+  utils::prepareTensorHost<2>(
+    num_points, angle_bins, range_bins, num_threads, pack_point, points_tensor, workspace);
+}
+
+void fillEmptySpaceHost(
+  const std::uint64_t * points_tensor, const std::size_t angle_bins, const std::size_t range_bins,
+  const float map_resolution_inv, const float scan_origin_x, const float scan_origin_y,
+  const float map_origin_x, const float map_origin_y, const int num_cells_x, const int num_cells_y,
+  std::uint8_t empty_value, std::uint8_t * costmap_tensor, const std::size_t num_threads,
+  utils::HostWorkspace & workspace)
+{
+  const auto fill_bin = [&](const std::size_t idx, std::uint8_t * target) {
+    std::uint64_t range_and_x = points_tensor[2 * idx + 0];
+    std::uint32_t range_int = range_and_x >> 32;
+
+    if (range_int == 0xFFFFFFFF) {
+      return;
+    }
+
+    std::uint64_t range_and_y = points_tensor[2 * idx + 1];
+    float world_x = uintAsFloat(range_and_x & 0xFFFFFFFF);
+    float world_y = uintAsFloat(range_and_y & 0xFFFFFFFF);
+
+    if (world_x < map_origin_x || world_y < map_origin_y) {
+      return;
+    }
+
+    raytraceHost(
+      scan_origin_x, scan_origin_y, world_x, world_y, map_origin_x, map_origin_y,
+      map_resolution_inv, num_cells_x, num_cells_y, empty_value, target);
+  };
+
+  utils::fillCostmapHost(
+    angle_bins, range_bins, num_cells_x * num_cells_y, utils::findUnusedCostValue({empty_value}),
+    num_threads, fill_bin, costmap_tensor, workspace);
+}
+
+void fillUnknownSpaceHost(
+  const std::uint64_t * raw_points_tensor, const std::uint64_t * obstacle_points_tensor,
+  const float distance_margin, const std::size_t angle_bins, const std::size_t range_bins,
+  const float map_resolution_inv, [[maybe_unused]] const float scan_origin_x,
+  [[maybe_unused]] const float scan_origin_y, const float map_origin_x, const float map_origin_y,
+  const int num_cells_x, const int num_cells_y, std::uint8_t free_space_value,
+  std::uint8_t no_information_value, std::uint8_t * costmap_tensor, const std::size_t num_threads,
+  utils::HostWorkspace & workspace)
+{
+  const auto fill_bin = [&](const std::size_t idx, std::uint8_t * target) {
+    fillUnknownSpaceBin(
+      idx, raw_points_tensor, obstacle_points_tensor, distance_margin, range_bins,
+      map_resolution_inv, map_origin_x, map_origin_y, num_cells_x, num_cells_y, free_space_value,
+      no_information_value, target);
+  };
+
+  utils::fillCostmapHost(
+    angle_bins, range_bins, num_cells_x * num_cells_y,
+    utils::findUnusedCostValue({free_space_value, no_information_value}), num_threads, fill_bin,
+    costmap_tensor, workspace);
+}
+
+void fillObstaclesHost(
+  const std::uint64_t * obstacle_points_tensor, const float distance_margin,
+  const std::size_t angle_bins, const std::size_t range_bins, const float map_resolution_inv,
+  const float map_origin_x, const float map_origin_y, const int num_cells_x, const int num_cells_y,
+  std::uint8_t obstacle_value, std::uint8_t * costmap_tensor, const std::size_t num_threads,
+  utils::HostWorkspace & workspace)
+{
+  const auto fill_bin = [&](const std::size_t idx, std::uint8_t * target) {
+    fillObstaclesBin(
+      idx, obstacle_points_tensor, distance_margin, map_resolution_inv, map_origin_x, map_origin_y,
+      num_cells_x, num_cells_y, obstacle_value, target);
+  };
+
+  utils::fillCostmapHost(
+    angle_bins, range_bins, num_cells_x * num_cells_y, utils::findUnusedCostValue({obstacle_value}),
+    num_threads, fill_bin, costmap_tensor, workspace);
+}
+
+}  // namespace costmap_2d::map_fixed
+}  // namespace autoware::occupancy_grid_map
@@ -15,6 +15,7 @@
 #include "autoware/probabilistic_occupancy_grid_map/updater/binary_bayes_filter_updater.hpp"
 
 #include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/utils/utils_host.hpp"
 
 #ifdef USE_CUDA
 #include "autoware/probabilistic_occupancy_grid_map/updater/binary_bayes_filter_updater_kernel.hpp"
@@ -47,6 +48,10 @@ void OccupancyGridMapBBFUpdater::initRosParam(rclcpp::Node & node)
     node.declare_parameter<double>("probability_matrix.free_to_occupied");
   v_ratio_ = node.declare_parameter<double>("v_ratio");
 
+  utils::buildFusionTable(
+    [this](const unsigned char z, const unsigned char o) { return applyBBF(z, o); },
+    fusion_table_);
+
 #ifdef USE_CUDA
   if (use_cuda_) {
     device_probability_matrix_ =
@@ -119,12 +124,9 @@ bool OccupancyGridMapBBFUpdater::update(
     return false;
 #endif
   } else {
-    for (unsigned int x = 0; x < getSizeInCellsX(); x++) {
-      for (unsigned int y = 0; y < getSizeInCellsY(); y++) {
-        unsigned int index = getIndex(x, y);
-        costmap_[index] = applyBBF(single_frame_occupancy_grid_map.getCost(x, y), costmap_[index]);
-      }
-    }
+    utils::applyFusionTableHost(
+      fusion_table_, single_frame_occupancy_grid_map.getCharMap(),
+      getSizeInCellsX() * getSizeInCellsY(), num_threads_, costmap_);
   }
 
   return true;
@@ -15,6 +15,7 @@
 #include "autoware/probabilistic_occupancy_grid_map/updater/log_odds_bayes_filter_updater.hpp"
 
 #include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/utils/utils_host.hpp"
 
 #ifdef USE_CUDA
 #include "autoware/probabilistic_occupancy_grid_map/updater/log_odds_bayes_filter_updater_kernel.hpp"
@@ -29,6 +30,16 @@ namespace autoware::occupancy_grid_map
 namespace costmap_2d
 {
 
+OccupancyGridMapLOBFUpdater::OccupancyGridMapLOBFUpdater(
+  const bool use_cuda, const unsigned int cells_size_x, const unsigned int cells_size_y,
+  const float resolution)
+: OccupancyGridMapUpdaterInterface(use_cuda, cells_size_x, cells_size_y, resolution)
+{
+  utils::buildFusionTable(
+    [this](const unsigned char z, const unsigned char o) { return applyLOBF(z, o); },
+    fusion_table_);
+}
+
 void OccupancyGridMapLOBFUpdater::initRosParam(rclcpp::Node & /*node*/)
 {
   // nothing to load
@@ -49,7 +60,8 @@ inline unsigned char OccupancyGridMapLOBFUpdater::applyLOBF(
 
   // if the observation is unknown, decay the estimation
   if (z >= unknown - unknown_margin && z <= unknown + unknown_margin) {
-    char diff = static_cast<char>(o) - static_cast<char>(unknown);
+    // int as in the kernel, char is unsigned on some platforms
+    const int diff = static_cast<int>(o) - static_cast<int>(unknown);
     const double decay = std::exp(-sample_time / tau);
     const double fused = static_cast<double>(unknown) + static_cast<double>(diff) * decay;
     return static_cast<unsigned char>(fused);
@@ -80,15 +92,12 @@ bool OccupancyGridMapLOBFUpdater::update(
 #else
   if (use_cuda_) {
     RCLCPP_ERROR(logger_, "The code was compiled without cuda.");
-    return;
+    return false;
 #endif
   } else {
-    for (unsigned int x = 0; x < getSizeInCellsX(); x++) {
-      for (unsigned int y = 0; y < getSizeInCellsY(); y++) {
-        unsigned int index = getIndex(x, y);
-        costmap_[index] = applyLOBF(single_frame_occupancy_grid_map.getCost(x, y), costmap_[index]);
-      }
-    }
+    utils::applyFusionTableHost(
+      fusion_table_, single_frame_occupancy_grid_map.getCharMap(),
+      getSizeInCellsX() * getSizeInCellsY(), num_threads_, costmap_);
   }
 
   return true;
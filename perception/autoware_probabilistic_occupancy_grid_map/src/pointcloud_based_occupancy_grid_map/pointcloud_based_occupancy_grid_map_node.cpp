@@ -70,6 +70,15 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
     this->declare_parameter<bool>("filter_obstacle_pointcloud_by_raw_pointcloud");
   const double map_length = this->declare_parameter<double>("map_length");
   const double map_resolution = this->declare_parameter<double>("map_resolution");
+  use_cuda_ = this->declare_parameter<bool>("use_cuda");
+  const auto num_threads =
+    static_cast<std::size_t>(std::max(0, this->declare_parameter<int>("num_threads")));
+#ifndef USE_CUDA
+  if (use_cuda_) {
+    RCLCPP_WARN(get_logger(), "The code was compiled without cuda, the cpu is used instead.");
+    use_cuda_ = false;
+  }
+#endif
 
   /* Subscriber and publisher */
   obstacle_pointcloud_sub_ptr_ = this->create_subscription<PointCloud2>(
@@ -84,26 +93,26 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
   const std::string updater_type = this->declare_parameter<std::string>("updater_type");
   if (updater_type == "binary_bayes_filter") {
     occupancy_grid_map_updater_ptr_ = std::make_unique<OccupancyGridMapBBFUpdater>(
-      true, map_length / map_resolution, map_length / map_resolution, map_resolution);
+      use_cuda_, map_length / map_resolution, map_length / map_resolution, map_resolution);
   } else {
     RCLCPP_WARN(
       get_logger(),
       "specified occupancy grid map updater type [%s] is not found, use binary_bayes_filter",
       updater_type.c_str());
     occupancy_grid_map_updater_ptr_ = std::make_unique<OccupancyGridMapBBFUpdater>(
-      true, map_length / map_resolution, map_length / map_resolution, map_resolution);
+      use_cuda_, map_length / map_resolution, map_length / map_resolution, map_resolution);
   }
 
   const std::string grid_map_type = this->declare_parameter<std::string>("grid_map_type");
 
   if (grid_map_type == "OccupancyGridMapProjectiveBlindSpot") {
     occupancy_grid_map_ptr_ = std::make_unique<OccupancyGridMapProjectiveBlindSpot>(
-      true, occupancy_grid_map_updater_ptr_->getSizeInCellsX(),
+      use_cuda_, occupancy_grid_map_updater_ptr_->getSizeInCellsX(),
       occupancy_grid_map_updater_ptr_->getSizeInCellsY(),
       occupancy_grid_map_updater_ptr_->getResolution());
   } else if (grid_map_type == "OccupancyGridMapFixedBlindSpot") {
     occupancy_grid_map_ptr_ = std::make_unique<OccupancyGridMapFixedBlindSpot>(
-      true, occupancy_grid_map_updater_ptr_->getSizeInCellsX(),
+      use_cuda_, occupancy_grid_map_updater_ptr_->getSizeInCellsX(),
       occupancy_grid_map_updater_ptr_->getSizeInCellsY(),
       occupancy_grid_map_updater_ptr_->getResolution());
   } else {
@@ -112,19 +121,25 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
       "specified occupancy grid map type [%s] is not found, use OccupancyGridMapFixedBlindSpot",
       grid_map_type.c_str());
     occupancy_grid_map_ptr_ = std::make_unique<OccupancyGridMapFixedBlindSpot>(
-      true, occupancy_grid_map_updater_ptr_->getSizeInCellsX(),
+      use_cuda_, occupancy_grid_map_updater_ptr_->getSizeInCellsX(),
       occupancy_grid_map_updater_ptr_->getSizeInCellsY(),
       occupancy_grid_map_updater_ptr_->getResolution());
   }
 
-  cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking);
-  raw_pointcloud_.stream = stream_;
-  obstacle_pointcloud_.stream = stream_;
-  occupancy_grid_map_ptr_->setCudaStream(stream_);
-  occupancy_grid_map_updater_ptr_->setCudaStream(stream_);
+#ifdef USE_CUDA
+  if (use_cuda_) {
+    cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking);
+    raw_pointcloud_.stream = stream_;
+    obstacle_pointcloud_.stream = stream_;
+    occupancy_grid_map_ptr_->setCudaStream(stream_);
+    occupancy_grid_map_updater_ptr_->setCudaStream(stream_);
 
-  device_rotation_ = autoware::cuda_utils::make_unique<Eigen::Matrix3f>();
-  device_translation_ = autoware::cuda_utils::make_unique<Eigen::Vector3f>();
+    device_rotation_ = autoware::cuda_utils::make_unique<Eigen::Matrix3f>();
+    device_translation_ = autoware::cuda_utils::make_unique<Eigen::Vector3f>();
+  }
+#endif
+  occupancy_grid_map_ptr_->setNumThreads(num_threads);
+  occupancy_grid_map_updater_ptr_->setNumThreads(num_threads);
 
   occupancy_grid_map_ptr_->initRosParam(*this);
   occupancy_grid_map_updater_ptr_->initRosParam(*this);
@@ -160,9 +175,17 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
 void PointcloudBasedOccupancyGridMapNode::obstaclePointcloudCallback(
   const PointCloud2::ConstSharedPtr & input_obstacle_msg)
 {
-  obstacle_pointcloud_.fromROSMsgAsync(input_obstacle_msg);
+  obstacle_pointcloud_header_ = input_obstacle_msg->header;
+#ifdef USE_CUDA
+  if (use_cuda_) {
+    obstacle_pointcloud_.fromROSMsgAsync(input_obstacle_msg);
+  }
+#endif
+  if (!use_cuda_) {
+    host_obstacle_pointcloud_ = input_obstacle_msg;
+  }
 
-  if (obstacle_pointcloud_.header.stamp == raw_pointcloud_.header.stamp) {
+  if (obstacle_pointcloud_header_.stamp == raw_pointcloud_header_.stamp) {
     onPointcloudWithObstacleAndRaw();
   }
 }
@@ -170,9 +193,17 @@ void PointcloudBasedOccupancyGridMapNode::obstaclePointcloudCallback(
 void PointcloudBasedOccupancyGridMapNode::rawPointcloudCallback(
   const PointCloud2::ConstSharedPtr & input_raw_msg)
 {
-  raw_pointcloud_.fromROSMsgAsync(input_raw_msg);
+  raw_pointcloud_header_ = input_raw_msg->header;
+#ifdef USE_CUDA
+  if (use_cuda_) {
+    raw_pointcloud_.fromROSMsgAsync(input_raw_msg);
+  }
+#endif
+  if (!use_cuda_) {
+    host_raw_pointcloud_ = input_raw_msg;
+  }
 
-  if (obstacle_pointcloud_.header.stamp == raw_pointcloud_.header.stamp) {
+  if (obstacle_pointcloud_header_.stamp == raw_pointcloud_header_.stamp) {
     onPointcloudWithObstacleAndRaw();
   }
 }
@@ -224,7 +255,7 @@ void PointcloudBasedOccupancyGridMapNode::checkProcessingTime(double processing_
     "is processing time consecutive excess duration within threshold",
     processing_consecutive_excess_time <= processing_time_consecutive_excess_tolerance_ms_);
   diagnostics_interface_ptr_->update_level_and_message(level, "[" + status_str + "] " + message);
-  diagnostics_interface_ptr_->publish(raw_pointcloud_.header.stamp);
+  diagnostics_interface_ptr_->publish(raw_pointcloud_header_.stamp);
 }
 
 void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw()
@@ -236,24 +267,49 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw()
     stop_watch_ptr_->toc("processing_time", true);
   }
 
-  // if scan_origin_frame_ is "", replace it with raw_pointcloud_.header.frame_id
+  // if scan_origin_frame_ is "", replace it with raw_pointcloud_header_.frame_id
   if (scan_origin_frame_.empty()) {
-    scan_origin_frame_ = raw_pointcloud_.header.frame_id;
+    scan_origin_frame_ = raw_pointcloud_header_.frame_id;
   }
 
+  const PointCloud2 * host_raw_pointcloud = host_raw_pointcloud_.get();
+  const PointCloud2 * host_obstacle_pointcloud = host_obstacle_pointcloud_.get();
+
   // Prepare for applying height filter
   if (use_height_filter_) {
     // Make sure that the frame is base_link
-    if (raw_pointcloud_.header.frame_id != base_link_frame_) {
-      if (!utils::transformPointcloudAsync(
-            raw_pointcloud_, *tf2_, base_link_frame_, device_rotation_, device_translation_)) {
-        return;
+#ifdef USE_CUDA
+    if (use_cuda_) {
+      if (raw_pointcloud_.header.frame_id != base_link_frame_) {
+        if (!utils::transformPointcloudAsync(
+              raw_pointcloud_, *tf2_, base_link_frame_, device_rotation_, device_translation_)) {
+          return;
+        }
+      }
+      if (obstacle_pointcloud_.header.frame_id != base_link_frame_) {
+        if (!utils::transformPointcloudAsync(
+              obstacle_pointcloud_, *tf2_, base_link_frame_, device_rotation_,
+              device_translation_)) {
+          return;
+        }
       }
     }
-    if (obstacle_pointcloud_.header.frame_id != base_link_frame_) {
-      if (!utils::transformPointcloudAsync(
-            obstacle_pointcloud_, *tf2_, base_link_frame_, device_rotation_, device_translation_)) {
-        return;
+#endif
+    if (!use_cuda_) {
+      if (host_raw_pointcloud->header.frame_id != base_link_frame_) {
+        if (!utils::transformPointcloud(
+              *host_raw_pointcloud, *tf2_, base_link_frame_, transformed_raw_pointcloud_)) {
+          return;
+        }
+        host_raw_pointcloud = &transformed_raw_pointcloud_;
+      }
+      if (host_obstacle_pointcloud->header.frame_id != base_link_frame_) {
+        if (!utils::transformPointcloud(
+              *host_obstacle_pointcloud, *tf2_, base_link_frame_,
+              transformed_obstacle_pointcloud_)) {
+          return;
+        }
+        host_obstacle_pointcloud = &transformed_obstacle_pointcloud_;
       }
     }
     occupancy_grid_map_ptr_->setHeightLimit(min_height_, max_height_);
@@ -267,11 +323,11 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw()
   Pose gridmap_origin{};
   Pose scan_origin{};
   try {
-    robot_pose = utils::getPose(raw_pointcloud_.header.stamp, *tf2_, base_link_frame_, map_frame_);
+    robot_pose = utils::getPose(raw_pointcloud_header_.stamp, *tf2_, base_link_frame_, map_frame_);
     gridmap_origin =
-      utils::getPose(raw_pointcloud_.header.stamp, *tf2_, gridmap_origin_frame_, map_frame_);
+      utils::getPose(raw_pointcloud_header_.stamp, *tf2_, gridmap_origin_frame_, map_frame_);
     scan_origin =
-      utils::getPose(raw_pointcloud_.header.stamp, *tf2_, scan_origin_frame_, map_frame_);
+      utils::getPose(raw_pointcloud_header_.stamp, *tf2_, scan_origin_frame_, map_frame_);
   } catch (tf2::TransformException & ex) {
     RCLCPP_WARN_STREAM(get_logger(), ex.what());
     return;
@@ -287,8 +343,16 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw()
     occupancy_grid_map_ptr_->updateOrigin(
       gridmap_origin.position.x - occupancy_grid_map_ptr_->getSizeInMetersX() / 2,
       gridmap_origin.position.y - occupancy_grid_map_ptr_->getSizeInMetersY() / 2);
-    occupancy_grid_map_ptr_->updateWithPointCloud(
-      raw_pointcloud_, obstacle_pointcloud_, robot_pose, scan_origin);
+#ifdef USE_CUDA
+    if (use_cuda_) {
+      occupancy_grid_map_ptr_->updateWithPointCloud(
+        raw_pointcloud_, obstacle_pointcloud_, robot_pose, scan_origin);
+    }
+#endif
+    if (!use_cuda_) {
+      occupancy_grid_map_ptr_->updateWithPointCloud(
+        *host_raw_pointcloud, *host_obstacle_pointcloud, robot_pose, scan_origin);
+    }
   }
 
   if (enable_single_frame_mode_) {
@@ -296,11 +360,15 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw()
     if (time_keeper_)
       inner_st_ptr = std::make_unique<ScopedTimeTrack>("publish_occupancy_grid_map", *time_keeper_);
 
-    occupancy_grid_map_ptr_->copyDeviceCostmapToHost();
+#ifdef USE_CUDA
+    if (use_cuda_) {
+      occupancy_grid_map_ptr_->copyDeviceCostmapToHost();
+    }
+#endif
 
     // publish
     occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
-      map_frame_, raw_pointcloud_.header.stamp, robot_pose.position.z,
+      map_frame_, raw_pointcloud_header_.stamp, robot_pose.position.z,
       *occupancy_grid_map_ptr_));  // (todo) robot_pose may be altered with gridmap_origin
   } else {
     std::unique_ptr<ScopedTimeTrack> inner_st_ptr;
@@ -310,11 +378,15 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw()
 
     // Update with bayes filter
     occupancy_grid_map_updater_ptr_->update(*occupancy_grid_map_ptr_);
-    occupancy_grid_map_updater_ptr_->copyDeviceCostmapToHost();
+#ifdef USE_CUDA
+    if (use_cuda_) {
+      occupancy_grid_map_updater_ptr_->copyDeviceCostmapToHost();
+    }
+#endif
 
     // publish
     occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
-      map_frame_, raw_pointcloud_.header.stamp, robot_pose.position.z,
+      map_frame_, raw_pointcloud_header_.stamp, robot_pose.position.z,
       *occupancy_grid_map_updater_ptr_));
   }
 
@@ -324,7 +396,7 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw()
     const double pipeline_latency_ms =
       std::chrono::duration<double, std::milli>(
         std::chrono::nanoseconds(
-          (this->get_clock()->now() - raw_pointcloud_.header.stamp).nanoseconds()))
+          (this->get_clock()->now() - raw_pointcloud_header_.stamp).nanoseconds()))
         .count();
     debug_publisher_ptr_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
       "debug/cyclic_time_ms", cyclic_time_ms);
@@ -18,7 +18,10 @@
 #include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_base.hpp"
 #include "autoware/probabilistic_occupancy_grid_map/updater/binary_bayes_filter_updater.hpp"
 #include "autoware/probabilistic_occupancy_grid_map/updater/ogm_updater_interface.hpp"
+
+#ifdef USE_CUDA
 #include "autoware/probabilistic_occupancy_grid_map/utils/cuda_pointcloud.hpp"
+#endif
 
 #include <autoware_utils/ros/debug_publisher.hpp>
 #include <autoware_utils/ros/diagnostics_interface.hpp>
@@ -30,8 +33,12 @@
 
 #include <sensor_msgs/msg/laser_scan.hpp>
 #include <sensor_msgs/point_cloud2_iterator.hpp>
+#include <std_msgs/msg/header.hpp>
 
+#ifdef USE_CUDA
 #include <cuda_runtime.h>
+#endif
+
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
@@ -79,12 +86,24 @@ private:
   std::unique_ptr<OccupancyGridMapInterface> occupancy_grid_map_ptr_;
   std::unique_ptr<OccupancyGridMapUpdaterInterface> occupancy_grid_map_updater_ptr_;
 
+  // headers of the latest input point clouds, as received
+  std_msgs::msg::Header raw_pointcloud_header_;
+  std_msgs::msg::Header obstacle_pointcloud_header_;
+
+#ifdef USE_CUDA
   cudaStream_t stream_;
   CudaPointCloud2 raw_pointcloud_;
   CudaPointCloud2 obstacle_pointcloud_;
 
   autoware::cuda_utils::CudaUniquePtr<Eigen::Matrix3f> device_rotation_;
   autoware::cuda_utils::CudaUniquePtr<Eigen::Vector3f> device_translation_;
+#endif
+
+  // input point clouds of the host processing, and their base_link copies for the height filter
+  PointCloud2::ConstSharedPtr host_raw_pointcloud_;
+  PointCloud2::ConstSharedPtr host_obstacle_pointcloud_;
+  PointCloud2 transformed_raw_pointcloud_;
+  PointCloud2 transformed_obstacle_pointcloud_;
 
   // ROS Parameters
   std::string map_frame_;
@@ -96,6 +115,7 @@ private:
   double max_height_;
   bool enable_single_frame_mode_;
   bool filter_obstacle_pointcloud_by_raw_pointcloud_;
+  bool use_cuda_;
 
   // time keeper
   rclcpp::Publisher<autoware_utils::ProcessingTimeDetail>::SharedPtr
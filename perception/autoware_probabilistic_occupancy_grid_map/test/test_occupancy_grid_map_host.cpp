@@ -0,0 +1,283 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/probabilistic_occupancy_grid_map/cost_value/cost_value.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_fixed.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/costmap_2d/occupancy_grid_map_projective.hpp"
+#include "autoware/probabilistic_occupancy_grid_map/updater/binary_bayes_filter_updater.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapBBFUpdater;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapFixedBlindSpot;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapInterface;
+using autoware::occupancy_grid_map::costmap_2d::OccupancyGridMapProjectiveBlindSpot;
+using geometry_msgs::msg::Pose;
+using sensor_msgs::msg::PointCloud2;
+namespace cost_value = autoware::occupancy_grid_map::cost_value;
+
+// Same map as the default parameters: 150 m x 150 m with a 0.5 m resolution
+constexpr double map_length = 150.0;
+constexpr double map_resolution = 0.5;
+constexpr unsigned int num_cells = map_length / map_resolution;
+
+// A wall at x = 20 m, |y| <= 5 m, and the ground points that the wall does not hide
+constexpr float wall_x = 20.0;
+constexpr float wall_half_width = 5.0;
+
+struct Scene
+{
+  PointCloud2 raw_pointcloud;
+  PointCloud2 obstacle_pointcloud;
+};
+
+PointCloud2 createPointCloud(const std::vector<std::array<float, 3>> & points)
+{
+  PointCloud2 pointcloud;
+  pointcloud.header.frame_id = "base_link";
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(points.size());
+  sensor_msgs::PointCloud2Iterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(pointcloud, "z");
+  for (const auto & point : points) {
+    *iter_x = point[0];
+    *iter_y = point[1];
+    *iter_z = point[2];
+    ++iter_x, ++iter_y, ++iter_z;
+  }
+  return pointcloud;
+}
+
+Scene createScene(const std::size_t num_random_points)
+{
+  std::vector<std::array<float, 3>> raw_points;
+  std::vector<std::array<float, 3>> obstacle_points;
+  for (float angle = 0.0; angle < 2.0 * M_PI; angle += 0.002) {
+    for (float range = 2.0; range < 60.0; range += 1.5) {
+      const float x = range * std::cos(angle);
+      const float y = range * std::sin(angle);
+      if (x >= wall_x && std::abs(y) <= (wall_half_width + 0.5) * x / wall_x) {
+        continue;  // hidden by the wall
+      }
+      raw_points.push_back({x, y, 0.0});
+    }
+  }
+  for (float y = -wall_half_width; y <= wall_half_width; y += 0.1) {
+    for (float z = 0.0; z < 2.0; z += 0.2) {
+      raw_points.push_back({wall_x, y, z});
+      obstacle_points.push_back({wall_x, y, z});
+    }
+  }
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> xy(-70.0, 70.0);
+  std::uniform_real_distribution<float> height(-0.5, 2.5);
+  for (std::size_t i = 0; i < num_random_points; ++i) {
+    const std::array<float, 3> point{xy(engine), xy(engine), height(engine)};
+    raw_points.push_back(point);
+    if (point[2] > 0.3) {
+      obstacle_points.push_back(point);
+    }
+  }
+  return {createPointCloud(raw_points), createPointCloud(obstacle_points)};
+}
+
+// The maps and the updaters declare their parameters, so that each of them needs its own node
+std::shared_ptr<rclcpp::Node> createNode()
+{
+  rclcpp::NodeOptions node_options;
+  node_options.append_parameter_override("OccupancyGridMapFixedBlindSpot.distance_margin", 1.0);
+  node_options.append_parameter_override(
+    "OccupancyGridMapProjectiveBlindSpot.projection_dz_threshold", 0.01);
+  node_options.append_parameter_override(
+    "OccupancyGridMapProjectiveBlindSpot.obstacle_separation_threshold", 1.0);
+  node_options.append_parameter_override("probability_matrix.occupied_to_occupied", 0.95);
+  node_options.append_parameter_override("probability_matrix.occupied_to_free", 0.05);
+  node_options.append_parameter_override("probability_matrix.free_to_occupied", 0.2);
+  node_options.append_parameter_override("probability_matrix.free_to_free", 0.8);
+  node_options.append_parameter_override("v_ratio", 10.0);
+  return std::make_shared<rclcpp::Node>("test_occupancy_grid_map_host", node_options);
+}
+
+template <typename GridMap>
+std::unique_ptr<OccupancyGridMapInterface> createMap(const bool use_cuda = false)
+{
+  auto map = std::make_unique<GridMap>(use_cuda, num_cells, num_cells, map_resolution);
+  map->initRosParam(*createNode());
+  map->setHeightLimit(-1.0, 2.0);
+  return map;
+}
+
+void updateMap(OccupancyGridMapInterface & map, const Scene & scene, const std::size_t num_threads)
+{
+  Pose robot_pose;
+  robot_pose.orientation.w = 1.0;
+  map.setNumThreads(num_threads);
+  map.resetMaps();
+  map.updateOrigin(-map.getSizeInMetersX() / 2, -map.getSizeInMetersY() / 2);
+  map.updateWithPointCloud(
+    scene.raw_pointcloud, scene.obstacle_pointcloud, robot_pose, robot_pose);
+}
+
+std::vector<unsigned char> getCosts(const OccupancyGridMapInterface & map)
+{
+  const unsigned char * data = map.getCharMap();
+  return {data, data + map.getSizeInCellsX() * map.getSizeInCellsY()};
+}
+
+unsigned char getCost(const OccupancyGridMapInterface & map, const double x, const double y)
+{
+  unsigned int mx{};
+  unsigned int my{};
+  EXPECT_TRUE(map.worldToMap(x, y, mx, my));
+  return map.getCost(mx, my);
+}
+
+class OccupancyGridMapHostTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { rclcpp::init(0, nullptr); }
+  void TearDown() override { rclcpp::shutdown(); }
+
+  template <typename GridMap>
+  void checkScene()
+  {
+    const auto scene = createScene(0);
+    auto map = createMap<GridMap>();
+    updateMap(*map, scene, 1);
+    for (double x = 3.0; x < wall_x - 1.0; x += 1.0) {
+      EXPECT_EQ(getCost(*map, x, 0.2), cost_value::FREE_SPACE) << "x = " << x;
+    }
+    EXPECT_EQ(getCost(*map, wall_x + 0.1, 0.2), cost_value::LETHAL_OBSTACLE);
+    for (double x = wall_x + 2.0; x < 30.0; x += 1.0) {
+      EXPECT_EQ(getCost(*map, x, 0.2), cost_value::NO_INFORMATION) << "x = " << x;
+    }
+  }
+
+  template <typename GridMap>
+  void checkThreads()
+  {
+    const auto scene = createScene(100000);
+    auto serial_map = createMap<GridMap>();
+    updateMap(*serial_map, scene, 1);
+    const auto serial_costs = getCosts(*serial_map);
+    for (const std::size_t num_threads : {2, 4, 8}) {
+      auto map = createMap<GridMap>();
+      updateMap(*map, scene, num_threads);
+      EXPECT_EQ(getCosts(*map), serial_costs) << num_threads << " threads";
+    }
+  }
+};
+}  // namespace
+
+TEST_F(OccupancyGridMapHostTest, FixedBlindSpotScene)
+{
+  checkScene<OccupancyGridMapFixedBlindSpot>();
+}
+
+TEST_F(OccupancyGridMapHostTest, ProjectiveBlindSpotScene)
+{
+  checkScene<OccupancyGridMapProjectiveBlindSpot>();
+}
+
+// The host maps do not depend on the number of threads
+TEST_F(OccupancyGridMapHostTest, FixedBlindSpotThreads)
+{
+  checkThreads<OccupancyGridMapFixedBlindSpot>();
+}
+
+TEST_F(OccupancyGridMapHostTest, ProjectiveBlindSpotThreads)
+{
+  checkThreads<OccupancyGridMapProjectiveBlindSpot>();
+}
+
+TEST_F(OccupancyGridMapHostTest, BinaryBayesFilterUpdater)
+{
+  const auto scene = createScene(100000);
+  auto map = createMap<OccupancyGridMapFixedBlindSpot>();
+  updateMap(*map, scene, 1);
+
+  OccupancyGridMapBBFUpdater serial_updater(false, num_cells, num_cells, map_resolution);
+  OccupancyGridMapBBFUpdater parallel_updater(false, num_cells, num_cells, map_resolution);
+  serial_updater.initRosParam(*createNode());
+  parallel_updater.initRosParam(*createNode());
+  parallel_updater.setNumThreads(4);
+
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_TRUE(serial_updater.update(*map));
+    ASSERT_TRUE(parallel_updater.update(*map));
+  }
+  EXPECT_EQ(getCosts(serial_updater), getCosts(parallel_updater));
+  EXPECT_GE(getCost(serial_updater, wall_x + 0.1, 0.2), cost_value::OCCUPIED_THRESHOLD);
+  EXPECT_LE(getCost(serial_updater, 10.0, 0.2), cost_value::FREE_THRESHOLD);
+}
+
+#ifdef USE_CUDA
+// The host and cuda maps differ on a few cells only: the kernels use fused multiply-adds and the
+// cuda atan2f, and the cuda unknown space fill writes the cells concurrently
+TEST_F(OccupancyGridMapHostTest, HostMatchesCuda)
+{
+  constexpr double max_mismatch_ratio = 0.01;
+  const auto scene = createScene(100000);
+  cudaStream_t stream;
+  cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking);
+  CudaPointCloud2 raw_pointcloud;
+  CudaPointCloud2 obstacle_pointcloud;
+  raw_pointcloud.stream = stream;
+  obstacle_pointcloud.stream = stream;
+  raw_pointcloud.fromROSMsgAsync(std::make_shared<PointCloud2>(scene.raw_pointcloud));
+  obstacle_pointcloud.fromROSMsgAsync(std::make_shared<PointCloud2>(scene.obstacle_pointcloud));
+
+  Pose robot_pose;
+  robot_pose.orientation.w = 1.0;
+  for (const bool projective : {false, true}) {
+    auto host_map = projective ? createMap<OccupancyGridMapProjectiveBlindSpot>()
+                               : createMap<OccupancyGridMapFixedBlindSpot>();
+    updateMap(*host_map, scene, 4);
+
+    auto cuda_map = projective ? createMap<OccupancyGridMapProjectiveBlindSpot>(true)
+                               : createMap<OccupancyGridMapFixedBlindSpot>(true);
+    cuda_map->setCudaStream(stream);
+    cuda_map->resetMaps();
+    cuda_map->updateOrigin(-cuda_map->getSizeInMetersX() / 2, -cuda_map->getSizeInMetersY() / 2);
+    cuda_map->updateWithPointCloud(raw_pointcloud, obstacle_pointcloud, robot_pose, robot_pose);
+    cuda_map->copyDeviceCostmapToHost();
+
+    const auto host_costs = getCosts(*host_map);
+    const auto cuda_costs = getCosts(*cuda_map);
+    std::size_t num_mismatches = 0;
+    for (std::size_t i = 0; i < host_costs.size(); ++i) {
+      num_mismatches += host_costs[i] != cuda_costs[i];
+    }
+    EXPECT_LE(num_mismatches, max_mismatch_ratio * host_costs.size())
+      << (projective ? "projective" : "fixed");
+  }
+  cudaStreamDestroy(stream);
+}
+#endif
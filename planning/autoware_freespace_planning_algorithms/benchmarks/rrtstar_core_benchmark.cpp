@@ -0,0 +1,96 @@
+// Copyright 2025 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Iterations per second of RRTStar::extend on the scene of test_freespace_planning_algorithms.cpp,
+// for the neighbor radius of the planner test (12 m) and a smaller one, with informed sampling.
+// The tree is never pruned, as in the RRTStar planner. Usage: rrtstar_core_benchmark
+
+#include "autoware/freespace_planning_algorithms/rrtstar_core.hpp"
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+namespace rrtstar_core = autoware::freespace_planning_algorithms::rrtstar_core;
+
+// Same scene as the costmap of test_freespace_planning_algorithms.cpp: a 30 m x 30 m area with
+// 2 m thick borders, a wall and four parked cars. The vehicle is approximated by a disc.
+constexpr double map_size = 30.0;
+constexpr double border = 2.0;
+constexpr double vehicle_radius = 1.0;
+constexpr double car_width = 2.75;
+constexpr double car_length = 5.5;
+
+bool isObstacleFree(const rrtstar_core::Pose & pose)
+{
+  const auto is_inside_box = [&pose](double x_min, double y_min, double x_max, double y_max) {
+    return x_min - vehicle_radius < pose.x && pose.x < x_max + vehicle_radius &&
+           y_min - vehicle_radius < pose.y && pose.y < y_max + vehicle_radius;
+  };
+  if (
+    pose.x < border + vehicle_radius || map_size - border - vehicle_radius < pose.x ||
+    pose.y < border + vehicle_radius || map_size - border - vehicle_radius < pose.y) {
+    return false;
+  }
+  const std::array<std::array<double, 2>, 4> car_origins{{{10.0, 22.0}, {13.5, 22.0}, {20.0, 22.0},
+                                                          {10.0, 10.0}}};
+  for (const auto & [x, y] : car_origins) {
+    if (is_inside_box(x, y, x + car_width, y + car_length)) {
+      return false;
+    }
+  }
+  return !is_inside_box(8.0, 9.0, 28.0, 9.5);  // wall
+}
+}  // namespace
+
+int main()
+{
+  using Clock = std::chrono::steady_clock;
+  const double pi = 3.1415926;
+  const rrtstar_core::Pose x_start{5.5, 4.0, pi * 0.5};
+  const std::array<rrtstar_core::Pose, 4> goals{{{8.0, 26.3, pi * 1.5},
+                                                 {15.0, 11.6, pi * 0.5},
+                                                 {18.4, 26.3, pi * 1.5},
+                                                 {25.0, 26.3, pi * 1.5}}};
+  const rrtstar_core::Pose lo{0, 0, 0};
+  const rrtstar_core::Pose hi{map_size, map_size, pi};
+  const double turning_radius = 3.0 / std::tan(0.7);
+  const double collision_check_resolution = 0.4;
+  const std::vector<int> checkpoints{500, 1000, 2000};
+
+  std::cout << "neighbor radius, goal, iterations, iterations per second, nodes" << std::endl;
+  for (const double neighbor_radius : {12.0, 4.0}) {
+    for (size_t goal_idx = 0; goal_idx < goals.size(); ++goal_idx) {
+      const auto cspace = rrtstar_core::CSpace(lo, hi, turning_radius, isObstacleFree);
+      auto algo = rrtstar_core::RRTStar(
+        x_start, goals.at(goal_idx), neighbor_radius, collision_check_resolution, true, cspace);
+      int iteration = 0;
+      for (const int checkpoint : checkpoints) {
+        const auto start = Clock::now();
+        const int num_iterations = checkpoint - iteration;
+        for (; iteration < checkpoint; ++iteration) {
+          algo.extend();
+        }
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        std::cout << neighbor_radius << ", " << goal_idx + 1 << ", " << checkpoint << ", "
+                  << num_iterations / seconds << ", " << algo.getNodes().size() << std::endl;
+      }
+    }
+  }
+  return 0;
+}
@@ -21,11 +21,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <optional>
 #include <random>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace autoware::freespace_planning_algorithms::rrtstar_core
@@ -85,38 +87,112 @@ private:
   std::mt19937 rand_gen_;
 };
 
-struct Node;
-using NodeSharedPtr = std::shared_ptr<Node>;
-using NodeConstSharedPtr = std::shared_ptr<const Node>;
-using NodeWeakPtr = std::weak_ptr<Node>;
-
 struct Node
 {
   Pose pose;
   std::optional<double> cost_from_start = std::nullopt;
   std::optional<double> cost_to_goal = std::nullopt;
   std::optional<double> cost_to_parent = std::nullopt;
-  NodeWeakPtr parent = NodeWeakPtr();
-  std::vector<NodeSharedPtr> childs = std::vector<NodeSharedPtr>();
+  // Index-based links into RRTStar::getNodes(), the root has no parent
+  std::optional<size_t> parent = std::nullopt;
+  std::vector<size_t> childs = std::vector<size_t>();
 
-  bool isRoot() const { return getParent() == nullptr; }
+  bool isRoot() const { return !parent; }
 
-  void addParent(const NodeSharedPtr & parent_, double cost_to_parent_)
+  void addParent(size_t parent_, double cost_to_parent_)
   {
     parent = parent_;
     cost_to_parent = cost_to_parent_;
   }
 
-  void deleteChild(const NodeSharedPtr & node)
+  void deleteChild(size_t node_idx)
+  {
+    childs.erase(std::find(childs.begin(), childs.end(), node_idx));
+  }
+};
+
+// Buckets the node indices on a grid over x and y. The yaw is not indexed, because the queries are
+// bounded with CSpace::distanceLowerBound, which is the euclidean distance on x and y.
+class NodeGrid
+{
+public:
+  explicit NodeGrid(double cell_size) : cell_size_(cell_size) {}
+
+  void insert(size_t node_idx, const Pose & pose);
+  void clear();
+
+  // Calls visit(node_idx) on the nodes of the cells overlapping the square of half side radius
+  // around pose
+  template <typename Visit>
+  void visitSquare(const Pose & pose, double radius, Visit && visit) const
+  {
+    const int ix_min = std::max(cellIndex(pose.x - radius), ix_min_);
+    const int ix_max = std::min(cellIndex(pose.x + radius), ix_max_);
+    const int iy_min = std::max(cellIndex(pose.y - radius), iy_min_);
+    const int iy_max = std::min(cellIndex(pose.y + radius), iy_max_);
+    for (int ix = ix_min; ix <= ix_max; ++ix) {
+      for (int iy = iy_min; iy <= iy_max; ++iy) {
+        visitCell(ix, iy, visit);
+      }
+    }
+  }
+
+  // Calls visit(node_idx) on the nodes of the cells at chebyshev distance ring from the cell of
+  // pose. Returns false if there is no occupied cell at ring or farther.
+  template <typename Visit>
+  bool visitRing(const Pose & pose, int ring, Visit && visit) const
   {
-    const auto & delete_iter = std::find_if(
-      childs.begin(), childs.end(), [&node](const NodeConstSharedPtr node_child) -> bool {
-        return node_child.get() == node.get();
-      });
-    childs.erase(delete_iter);
+    const int cx = cellIndex(pose.x);
+    const int cy = cellIndex(pose.y);
+    // the previous rings already covered all the occupied cells
+    const int covered = ring - 1;
+    if (
+      cells_.empty() || (covered >= 0 && cx - covered <= ix_min_ && ix_max_ <= cx + covered &&
+                         cy - covered <= iy_min_ && iy_max_ <= cy + covered)) {
+      return false;
+    }
+    const int iy_min = std::max(cy - ring, iy_min_);
+    const int iy_max = std::min(cy + ring, iy_max_);
+    for (int ix = std::max(cx - ring, ix_min_); ix <= std::min(cx + ring, ix_max_); ++ix) {
+      if (std::abs(ix - cx) == ring) {
+        for (int iy = iy_min; iy <= iy_max; ++iy) {
+          visitCell(ix, iy, visit);
+        }
+      } else {
+        if (cy - ring >= iy_min_) visitCell(ix, cy - ring, visit);
+        if (cy + ring <= iy_max_) visitCell(ix, cy + ring, visit);
+      }
+    }
+    return true;
   }
 
-  NodeSharedPtr getParent() const { return parent.lock(); }
+  // Lower bound of the euclidean distance between pose and the nodes of the given ring
+  double ringDistanceLowerBound(const Pose & pose, int ring) const;
+
+private:
+  int cellIndex(double v) const { return static_cast<int>(std::floor(v / cell_size_)); }
+  static int64_t cellKey(int ix, int iy)
+  {
+    return (static_cast<int64_t>(ix) << 32) | static_cast<uint32_t>(iy);
+  }
+
+  template <typename Visit>
+  void visitCell(int ix, int iy, Visit & visit) const
+  {
+    const auto it = cells_.find(cellKey(ix, iy));
+    if (it == cells_.end()) return;
+    for (const size_t node_idx : it->second) {
+      visit(node_idx);
+    }
+  }
+
+  const double cell_size_;
+  std::unordered_map<int64_t, std::vector<size_t>> cells_;
+  // bounds of the occupied cells
+  int ix_min_ = std::numeric_limits<int>::max();
+  int ix_max_ = std::numeric_limits<int>::min();
+  int iy_min_ = std::numeric_limits<int>::max();
+  int iy_max_ = std::numeric_limits<int>::min();
 };
 
 class RRTStar
@@ -130,26 +206,35 @@ public:
   void deleteNodeUsingBranchAndBound();
   std::vector<Pose> sampleSolutionWaypoints() const;
   void dumpState(std::string filename) const;
-  double getSolutionCost() const { return *node_goal_->cost_from_start; }
-  std::vector<NodeConstSharedPtr> getNodes() const;
+  double getSolutionCost() const { return *node_goal_.cost_from_start; }
+  // The start node is the first one, the links of the nodes are indices into this vector
+  const std::vector<Node> & getNodes() const { return nodes_; }
+
+  struct Neighbor
+  {
+    size_t node_idx;
+    double distance;  // reeds-shepp distance from the node to the queried pose
+  };
+
+  // Node of the smallest reeds-shepp distance to x_rand, the smallest index on ties
+  size_t findNearestNode(const Pose & x_rand) const;
+  // Nodes closer than mu to pose in reeds-shepp distance, in the order of getNodes()
+  std::vector<Neighbor> findNeighborNodes(const Pose & pose) const;
 
 private:
-  NodeConstSharedPtr findNearestNode(const Pose & x_rand) const;
-  std::vector<NodeConstSharedPtr> findNeighborNodes(const Pose & pose) const;
-  NodeSharedPtr addNewNode(const Pose & pose, NodeSharedPtr node_parent);
-  NodeConstSharedPtr getBestParentNode(
-    const Pose & pose_new, const NodeConstSharedPtr & node_nearest,
-    const std::vector<NodeConstSharedPtr> & neighbor_nodes) const;
-  void reconnect(const NodeSharedPtr & node_new, const NodeSharedPtr & node_reconnect);
-  NodeConstSharedPtr getReconnectTargeNode(
-    const NodeConstSharedPtr node_new,
-    const std::vector<NodeConstSharedPtr> & neighbor_nodes) const;
-
-  NodeSharedPtr node_start_;
-  NodeSharedPtr node_goal_;
-  std::vector<NodeSharedPtr> nodes_;
-  std::vector<NodeSharedPtr> reached_nodes_;
-  // std::vector<Node> nodes_;
+  size_t addNewNode(const Pose & pose, size_t parent_idx);
+  size_t getBestParentNode(
+    const Pose & pose_new, size_t nearest_idx, const std::vector<Neighbor> & neighbors) const;
+  void reconnect(size_t new_idx, size_t reconnect_idx);
+  std::optional<size_t> getReconnectTargeNode(
+    size_t new_idx, const std::vector<Neighbor> & neighbors) const;
+
+  // All the nodes of the tree, the start node is nodes_.front()
+  std::vector<Node> nodes_;
+  // The goal node is not part of the tree, its parent is the best reached node
+  Node node_goal_;
+  std::vector<size_t> reached_nodes_;
+  NodeGrid node_grid_;
   const double mu_;
   const double collision_check_resolution_;
   const bool is_informed_;
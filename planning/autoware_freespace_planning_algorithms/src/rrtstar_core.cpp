@@ -19,12 +19,13 @@
 #include <algorithm>
 #include <fstream>
 #include <functional>
-#include <memory>
+#include <limits>
+#include <optional>
 #include <queue>
 #include <stack>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 // cspell: ignore rsspace
@@ -130,17 +131,54 @@ bool CSpace::isValidPath_child2parent(
   return true;
 }
 
+void NodeGrid::insert(size_t node_idx, const Pose & pose)
+{
+  const int ix = cellIndex(pose.x);
+  const int iy = cellIndex(pose.y);
+  cells_[cellKey(ix, iy)].push_back(node_idx);
+  ix_min_ = std::min(ix_min_, ix);
+  ix_max_ = std::max(ix_max_, ix);
+  iy_min_ = std::min(iy_min_, iy);
+  iy_max_ = std::max(iy_max_, iy);
+}
+
+void NodeGrid::clear()
+{
+  cells_.clear();
+  ix_min_ = std::numeric_limits<int>::max();
+  ix_max_ = std::numeric_limits<int>::min();
+  iy_min_ = std::numeric_limits<int>::max();
+  iy_max_ = std::numeric_limits<int>::min();
+}
+
+double NodeGrid::ringDistanceLowerBound(const Pose & pose, int ring) const
+{
+  if (ring == 0) {
+    return 0.0;
+  }
+  // The ring is outside of the block of (2 * ring - 1)^2 cells around the cell of pose
+  const int cx = cellIndex(pose.x);
+  const int cy = cellIndex(pose.y);
+  const double dx = std::min(
+    pose.x - (cx - ring + 1) * cell_size_, (cx + ring) * cell_size_ - pose.x);
+  const double dy = std::min(
+    pose.y - (cy - ring + 1) * cell_size_, (cy + ring) * cell_size_ - pose.y);
+  return std::max(0.0, std::min(dx, dy));
+}
+
 RRTStar::RRTStar(
   Pose x_start, Pose x_goal, double mu, double collision_check_resolution, bool is_informed,
   CSpace cspace)
-: mu_(mu),
+: node_goal_(Node{x_goal, std::nullopt, 0.0}),
+  // The neighbor query visits about 5x5 cells, and the nearest query usually a few rings
+  node_grid_(mu * 0.5),
+  mu_(mu),
   collision_check_resolution_(collision_check_resolution),
   is_informed_(is_informed),
   cspace_(cspace)
 {
-  node_goal_ = std::make_shared<Node>(Node{x_goal, std::nullopt, 0.0});
-  node_start_ = std::make_shared<Node>(Node{x_start, 0.0});
-  nodes_.push_back(node_start_);
+  nodes_.push_back(Node{x_start, 0.0});
+  node_grid_.insert(0, x_start);
 }
 
 void RRTStar::extend()
@@ -149,54 +187,58 @@ void RRTStar::extend()
   Pose x_rand;
   if (isSolutionFound() && is_informed_) {
     x_rand = cspace_.ellipticInformedSampling(
-      *node_goal_->cost_from_start, node_start_->pose, node_goal_->pose);
+      *node_goal_.cost_from_start, nodes_.front().pose, node_goal_.pose);
   } else {
     x_rand = cspace_.uniformSampling();
   }
 
-  const auto node_nearest = findNearestNode(x_rand);
+  const size_t nearest_idx = findNearestNode(x_rand);
+  const Pose pose_nearest = nodes_.at(nearest_idx).pose;
 
   // NOTE: no child-parent relation here
-  const Pose x_new = cspace_.interpolate_child2parent(node_nearest->pose, x_rand, mu_);
+  const Pose x_new = cspace_.interpolate_child2parent(pose_nearest, x_rand, mu_);
 
-  if (!cspace_.isValidPath_child2parent(x_new, node_nearest->pose, collision_check_resolution_)) {
+  if (!cspace_.isValidPath_child2parent(x_new, pose_nearest, collision_check_resolution_)) {
     return;
   }
 
-  const auto & neighbor_nodes = findNeighborNodes(x_new);
+  const auto neighbors = findNeighborNodes(x_new);
 
-  const auto & node_best_parent = getBestParentNode(x_new, node_nearest, neighbor_nodes);
-  const auto & node_new = addNewNode(x_new, std::const_pointer_cast<Node>(node_best_parent));
+  const size_t best_parent_idx = getBestParentNode(x_new, nearest_idx, neighbors);
+  // NOTE: references to nodes_ are invalidated from here on, the nodes are accessed by index
+  const size_t new_idx = addNewNode(x_new, best_parent_idx);
 
   // Rewire
-  const auto node_reconnect = getReconnectTargeNode(node_new, neighbor_nodes);
-  if (node_reconnect) {
-    reconnect(node_new, std::const_pointer_cast<Node>(node_reconnect));
+  const auto reconnect_idx = getReconnectTargeNode(new_idx, neighbors);
+  if (reconnect_idx) {
+    reconnect(new_idx, *reconnect_idx);
   }
 
   // Check if reached
+  auto & node_new = nodes_.at(new_idx);
   bool is_reached =
-    cspace_.isValidPath_child2parent(node_goal_->pose, node_new->pose, collision_check_resolution_);
+    cspace_.isValidPath_child2parent(node_goal_.pose, node_new.pose, collision_check_resolution_);
   if (is_reached) {
-    node_new->cost_to_goal = cspace_.distance(node_new->pose, node_goal_->pose);
-    reached_nodes_.push_back(node_new);
+    node_new.cost_to_goal = cspace_.distance(node_new.pose, node_goal_.pose);
+    reached_nodes_.push_back(new_idx);
   }
 
   if (isSolutionFound()) {
     // This cannot be inside if(is_reached){...} because we must update this anytime after rewiring
     // takes place
     double cost_min = inf;
-    NodeSharedPtr reached_node_best_parent;
-    for (const auto & node : reached_nodes_) {
-      const double cost = *(node->cost_from_start) + *(node->cost_to_goal);
+    size_t reached_node_best_parent = reached_nodes_.front();
+    for (const size_t node_idx : reached_nodes_) {
+      const auto & node = nodes_.at(node_idx);
+      const double cost = *(node.cost_from_start) + *(node.cost_to_goal);
       if (cost < cost_min) {
         cost_min = cost;
-        reached_node_best_parent = node;
+        reached_node_best_parent = node_idx;
       }
     }
-    node_goal_->cost_from_start = cost_min;
-    node_goal_->parent = reached_node_best_parent;
-    node_goal_->cost_to_parent = reached_node_best_parent->cost_to_goal;
+    node_goal_.cost_from_start = cost_min;
+    node_goal_.parent = reached_node_best_parent;
+    node_goal_.cost_to_parent = nodes_.at(reached_node_best_parent).cost_to_goal;
   }
 }
 
@@ -208,110 +250,121 @@ void RRTStar::deleteNodeUsingBranchAndBound()
     return;
   }
 
-  std::unordered_map<NodeSharedPtr, int> node_index_map;
-  for (size_t i = 0; i < nodes_.size(); ++i) {
-    node_index_map[nodes_.at(i)] = i;
-  }
-
-  const auto optimal_cost_ubound = node_goal_->cost_from_start;
-  std::unordered_set<size_t> delete_indices;
+  const double optimal_cost_ubound = *node_goal_.cost_from_start;
+  std::vector<bool> is_deleted(nodes_.size(), false);
 
-  const auto is_deleted = [&](const auto & node) -> bool {
-    return delete_indices.find(node_index_map[node]) != delete_indices.end();
-  };
-
-  for (const auto & node : nodes_) {
-    if (is_deleted(node)) {
+  for (size_t node_idx = 0; node_idx < nodes_.size(); ++node_idx) {
+    const auto & node = nodes_.at(node_idx);
+    if (is_deleted.at(node_idx) || node.isRoot()) {
       continue;
     }
 
     // This cost_to_goal (cost_to_go in the paper) is originally defined by Euclidean distance.
     // But we use cspace_.distance (reeds-sheep by default)
-    const auto here_cost_to_goal_lbound = cspace_.distance(node->pose, node_goal_->pose);
-    const auto here_optimal_cost_lbound = here_cost_to_goal_lbound + *node->cost_from_start;
+    const auto here_cost_to_goal_lbound = cspace_.distance(node.pose, node_goal_.pose);
+    const auto here_optimal_cost_lbound = here_cost_to_goal_lbound + *node.cost_from_start;
 
     if (here_optimal_cost_lbound > optimal_cost_ubound) {
-      delete_indices.insert(node_index_map[node]);
-      const auto & node_parent = node->getParent();
-      node_parent->deleteChild(node);
+      nodes_.at(*node.parent).deleteChild(node_idx);
 
       // delete childs
-      std::stack<NodeSharedPtr> node_stack;
-      node_stack.push(node);
+      std::stack<size_t> node_stack;
+      node_stack.push(node_idx);
       while (!node_stack.empty()) {
-        auto node_here = node_stack.top();
-
+        const size_t here_idx = node_stack.top();
         node_stack.pop();
-        delete_indices.insert(node_index_map[node_here]);
+        is_deleted.at(here_idx) = true;
 
-        for (auto & node_child : node_here->childs) {
-          if (is_deleted(node_child)) {
+        for (const size_t child_idx : nodes_.at(here_idx).childs) {
+          if (is_deleted.at(child_idx)) {
             continue;
           }
-          node_stack.push(node_child);
+          node_stack.push(child_idx);
         }
       }
     }
   }
 
-  // Because nodes_ are shrinking in erasing, delete indices must be sorted
-  std::vector<size_t> delete_indices_vec(delete_indices.begin(), delete_indices.end());
-  std::sort(delete_indices_vec.begin(), delete_indices_vec.end(), std::greater<size_t>());
-  for (const size_t delete_idx : delete_indices_vec) {
-    nodes_.erase(nodes_.begin() + delete_idx);
+  // Compact the remaining nodes in their original order and remap the links. A deleted node only
+  // has deleted descendants, so the links of the remaining nodes always point to remaining nodes.
+  std::vector<size_t> new_indices(nodes_.size());
+  size_t num_remaining = 0;
+  for (size_t node_idx = 0; node_idx < nodes_.size(); ++node_idx) {
+    if (!is_deleted.at(node_idx)) {
+      new_indices.at(node_idx) = num_remaining++;
+    }
+  }
+  if (num_remaining == nodes_.size()) {
+    return;
+  }
+  for (size_t node_idx = 0; node_idx < nodes_.size(); ++node_idx) {
+    if (is_deleted.at(node_idx)) {
+      continue;
+    }
+    auto & node = nodes_.at(node_idx);
+    if (node.parent) {
+      node.parent = new_indices.at(*node.parent);
+    }
+    for (auto & child_idx : node.childs) {
+      child_idx = new_indices.at(child_idx);
+    }
+    if (new_indices.at(node_idx) != node_idx) {
+      nodes_.at(new_indices.at(node_idx)) = std::move(node);
+    }
+  }
+  nodes_.resize(num_remaining);
+
+  // The best reached node is never deleted, because its lower bound is the solution cost
+  node_goal_.parent = new_indices.at(*node_goal_.parent);
+  std::vector<size_t> reached_nodes;
+  for (const size_t node_idx : reached_nodes_) {
+    if (!is_deleted.at(node_idx)) {
+      reached_nodes.push_back(new_indices.at(node_idx));
+    }
+  }
+  reached_nodes_ = std::move(reached_nodes);
+
+  node_grid_.clear();
+  for (size_t node_idx = 0; node_idx < nodes_.size(); ++node_idx) {
+    node_grid_.insert(node_idx, nodes_.at(node_idx).pose);
   }
 }
 
 std::vector<Pose> RRTStar::sampleSolutionWaypoints() const
 {
   std::vector<Pose> poses;
-  NodeSharedPtr node = node_goal_;
+  const Node * node = &node_goal_;
   while (!node->isRoot()) {
-    const auto node_parent = node->getParent();
+    const auto & node_parent = nodes_.at(*node->parent);
     cspace_.sampleWayPoints_child2parent(
-      node->pose, node_parent->pose, collision_check_resolution_, poses);
-    node = node_parent;
+      node->pose, node_parent.pose, collision_check_resolution_, poses);
+    node = &node_parent;
   }
-  poses.push_back(node_start_->pose);
+  poses.push_back(nodes_.front().pose);
   std::reverse(poses.begin(), poses.end());
   return poses;
 }
 
-std::vector<NodeConstSharedPtr> RRTStar::getNodes() const
-{
-  std::vector<NodeConstSharedPtr> nodes;
-  for (const auto & node : nodes_) {
-    nodes.push_back(node);
-  }
-  return nodes;
-}
-
 void RRTStar::dumpState(std::string filename) const
 {
   // Dump information of all nodes
   using json = nlohmann::json;
 
-  std::unordered_map<NodeSharedPtr, int> node_index_map;
-  for (size_t i = 0; i < nodes_.size(); ++i) {
-    node_index_map[nodes_.at(i)] = i;
-  }
-  node_index_map[node_goal_] = node_index_map.size();
-
-  auto serialize_node = [&](const NodeSharedPtr & node) {
+  auto serialize_node = [&](const Node & node, size_t node_idx) {
     json j;
-    j["pose"] = {node->pose.x, node->pose.y, node->pose.yaw};
-    j["idx"] = node_index_map.at(node);
+    j["pose"] = {node.pose.x, node.pose.y, node.pose.yaw};
+    j["idx"] = node_idx;
 
-    const auto parent = node->getParent();
-    if (!parent) {
+    if (!node.parent) {
       j["parent_idx"] = -1;
     } else {
-      j["parent_idx"] = node_index_map.at(parent);
+      const auto & parent = nodes_.at(*node.parent);
+      j["parent_idx"] = *node.parent;
 
       // fill trajectory from parent to this node
       std::vector<Pose> poses;
       cspace_.sampleWayPoints_child2parent(
-        node->pose, parent->pose, collision_check_resolution_, poses);
+        node.pose, parent.pose, collision_check_resolution_, poses);
       for (const auto & pose : poses) {
         j["traj_piece"].push_back({pose.x, pose.y, pose.yaw});
       }
@@ -321,33 +374,42 @@ void RRTStar::dumpState(std::string filename) const
 
   json j;
   j["radius"] = cspace_.getReedsSheppRadius();
-  for (const auto & node : nodes_) {
-    j["nodes"].push_back(serialize_node(node));
+  for (size_t node_idx = 0; node_idx < nodes_.size(); ++node_idx) {
+    j["nodes"].push_back(serialize_node(nodes_.at(node_idx), node_idx));
   }
-  j["node_goal"] = serialize_node(node_goal_);
+  j["node_goal"] = serialize_node(node_goal_, nodes_.size());
   std::ofstream file;
   file.open(filename);
   file << j;
   file.close();
 }
 
-NodeConstSharedPtr RRTStar::findNearestNode(const Pose & x_rand) const
+size_t RRTStar::findNearestNode(const Pose & x_rand) const
 {
+  // Visit the rings of cells around x_rand until the next ring is farther than the nearest node.
+  // Ties are broken by the smallest index, as a linear scan over nodes_ would do.
   double dist_min = inf;
-  NodeConstSharedPtr node_nearest;
-  for (const auto & node : nodes_) {
-    if (cspace_.distanceLowerBound(node->pose, x_rand) < dist_min) {
-      const double dist_real = cspace_.distance(node->pose, x_rand);
-      if (dist_real < dist_min) {
-        dist_min = dist_real;
-        node_nearest = node;
-      }
+  size_t nearest_idx = 0;
+  const auto visit = [&](const size_t node_idx) {
+    const auto & pose = nodes_[node_idx].pose;
+    if (cspace_.distanceLowerBound(pose, x_rand) > dist_min) {
+      return;
+    }
+    const double dist_real = cspace_.distance(pose, x_rand);
+    if (dist_real < dist_min || (dist_real == dist_min && node_idx < nearest_idx)) {
+      dist_min = dist_real;
+      nearest_idx = node_idx;
+    }
+  };
+  for (int ring = 0; node_grid_.ringDistanceLowerBound(x_rand, ring) <= dist_min; ++ring) {
+    if (!node_grid_.visitRing(x_rand, ring, visit)) {
+      break;
     }
   }
-  return node_nearest;
+  return nearest_idx;
 }
 
-std::vector<NodeConstSharedPtr> RRTStar::findNeighborNodes(const Pose & x_new) const
+std::vector<RRTStar::Neighbor> RRTStar::findNeighborNodes(const Pose & x_new) const
 {
   // In the original paper of rrtstar, radius is shrinking over time.
   // However, because we use reeds-shepp distance metric instead of Euclidean metric,
@@ -362,68 +424,84 @@ std::vector<NodeConstSharedPtr> RRTStar::findNeighborNodes(const Pose & x_new) c
 
   const double radius_neighbor = mu_;
 
-  std::vector<NodeConstSharedPtr> nodes;
-  for (auto & node : nodes_) {
-    if (cspace_.distanceLowerBound(node->pose, x_new) > radius_neighbor) continue;
-    const bool is_neighbor = (cspace_.distance(node->pose, x_new) < radius_neighbor);
+  std::vector<Neighbor> neighbors;
+  node_grid_.visitSquare(x_new, radius_neighbor, [&](const size_t node_idx) {
+    const auto & pose = nodes_[node_idx].pose;
+    if (cspace_.distanceLowerBound(pose, x_new) > radius_neighbor) return;
+    const double distance = cspace_.distance(pose, x_new);
+    const bool is_neighbor = (distance < radius_neighbor);
     if (is_neighbor) {
-      nodes.push_back(node);
+      neighbors.push_back(Neighbor{node_idx, distance});
     }
-  }
-  return nodes;
+  });
+  // The best parent and the rewired node depend on the order of the neighbors, keep the node order
+  std::sort(neighbors.begin(), neighbors.end(), [](const auto & a, const auto & b) {
+    return a.node_idx < b.node_idx;
+  });
+  return neighbors;
 }
 
-NodeSharedPtr RRTStar::addNewNode(const Pose & pose, NodeSharedPtr node_parent)
+size_t RRTStar::addNewNode(const Pose & pose, size_t parent_idx)
 {
-  const double cost_to_parent = cspace_.distance(pose, node_parent->pose);
-  const double cost_from_start = *(node_parent->cost_from_start) + cost_to_parent;
-  auto node_new =
-    std::make_shared<Node>(Node{pose, cost_from_start, std::nullopt, cost_to_parent, node_parent});
-  nodes_.push_back(node_new);
-  node_parent->childs.push_back(node_new);
-  return node_new;
+  auto & node_parent = nodes_.at(parent_idx);
+  const double cost_to_parent = cspace_.distance(pose, node_parent.pose);
+  const double cost_from_start = *(node_parent.cost_from_start) + cost_to_parent;
+  const size_t new_idx = nodes_.size();
+  node_parent.childs.push_back(new_idx);
+  // NOTE: node_parent is invalidated by the push_back
+  nodes_.push_back(Node{pose, cost_from_start, std::nullopt, cost_to_parent, parent_idx});
+  node_grid_.insert(new_idx, pose);
+  return new_idx;
 }
 
-NodeConstSharedPtr RRTStar::getReconnectTargeNode(
-  const NodeConstSharedPtr node_new, const std::vector<NodeConstSharedPtr> & neighbor_nodes) const
+std::optional<size_t> RRTStar::getReconnectTargeNode(
+  size_t new_idx, const std::vector<Neighbor> & neighbors) const
 {
-  NodeConstSharedPtr node_reconnect = nullptr;
-
-  for (const auto & node_neighbor : neighbor_nodes) {
-    if (cspace_.isValidPath_child2parent(
-          node_neighbor->pose, node_new->pose, collision_check_resolution_)) {
-      const double cost_from_start_rewired =
-        *node_new->cost_from_start + cspace_.distance(node_new->pose, node_neighbor->pose);
-      if (cost_from_start_rewired < *node_neighbor->cost_from_start) {
-        node_reconnect = node_neighbor;
-      }
+  const auto & node_new = nodes_.at(new_idx);
+
+  // The last valid neighbor with a lower cost is the target, so search from the back and check the
+  // cost before the (more expensive) path validity
+  for (auto it = neighbors.rbegin(); it != neighbors.rend(); ++it) {
+    const auto & node_neighbor = nodes_.at(it->node_idx);
+    const double cost_from_start_rewired =
+      *node_new.cost_from_start + cspace_.distance(node_new.pose, node_neighbor.pose);
+    if (
+      cost_from_start_rewired < *node_neighbor.cost_from_start &&
+      cspace_.isValidPath_child2parent(
+        node_neighbor.pose, node_new.pose, collision_check_resolution_)) {
+      return it->node_idx;
     }
   }
-
-  return node_reconnect;
+  return std::nullopt;
 }
 
-NodeConstSharedPtr RRTStar::getBestParentNode(
-  const Pose & pose_new, const NodeConstSharedPtr & node_nearest,
-  const std::vector<NodeConstSharedPtr> & neighbor_nodes) const
+size_t RRTStar::getBestParentNode(
+  const Pose & pose_new, size_t nearest_idx, const std::vector<Neighbor> & neighbors) const
 {
-  NodeConstSharedPtr node_best = node_nearest;
-  double cost_min =
-    *(node_nearest->cost_from_start) + cspace_.distance(node_nearest->pose, pose_new);
-  for (const auto & node : neighbor_nodes) {
-    const double cost_start_to_new =
-      *(node->cost_from_start) + cspace_.distance(node->pose, pose_new);
-    if (cost_start_to_new < cost_min) {
-      if (cspace_.isValidPath_child2parent(pose_new, node->pose, collision_check_resolution_)) {
-        node_best = node;
-        cost_min = cost_start_to_new;
-      }
+  const auto & node_nearest = nodes_.at(nearest_idx);
+  const double cost_nearest =
+    *(node_nearest.cost_from_start) + cspace_.distance(node_nearest.pose, pose_new);
+
+  // The best parent is the valid neighbor with the lowest cost (the first one in node order on a
+  // tie), so check the path validity in ascending cost and stop at the first valid one
+  std::vector<std::pair<double, size_t>> candidates;
+  for (const auto & [node_idx, distance] : neighbors) {
+    const double cost_start_to_new = *(nodes_.at(node_idx).cost_from_start) + distance;
+    if (cost_start_to_new < cost_nearest) {
+      candidates.emplace_back(cost_start_to_new, node_idx);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  for (const auto & [cost_start_to_new, node_idx] : candidates) {
+    if (cspace_.isValidPath_child2parent(
+          pose_new, nodes_.at(node_idx).pose, collision_check_resolution_)) {
+      return node_idx;
     }
   }
-  return node_best;
+  return nearest_idx;
 }
 
-void RRTStar::reconnect(const NodeSharedPtr & node_new, const NodeSharedPtr & node_reconnect)
+void RRTStar::reconnect(size_t new_idx, size_t reconnect_idx)
 {
   // connect node_new (parent) -> node_reconnect (child)
 
@@ -431,33 +509,35 @@ void RRTStar::reconnect(const NodeSharedPtr & node_new, const NodeSharedPtr & no
   // node_new -> #nil;
   // node_reconnect_parent -> node_reconnect -> #nil
 
-  const auto node_reconnect_parent = node_reconnect->getParent();
-  node_reconnect_parent->deleteChild(node_reconnect);
-  node_reconnect->parent = std::weak_ptr<Node>();
-  node_reconnect->cost_to_parent = std::nullopt;
+  auto & node_new = nodes_.at(new_idx);
+  auto & node_reconnect = nodes_.at(reconnect_idx);
+  nodes_.at(*node_reconnect.parent).deleteChild(reconnect_idx);
+  node_reconnect.parent = std::nullopt;
+  node_reconnect.cost_to_parent = std::nullopt;
 
   // Current state:
   // node_new_parent -> node_new -> #nil
   // node_reconnect_parent -> #nil
   // node_reconnect -> #nil
-  const double cost_a2b = cspace_.distance(node_new->pose, node_reconnect->pose);
-  node_new->childs.push_back(node_reconnect);
-  node_reconnect->parent = node_new;
-  node_reconnect->cost_to_parent = cost_a2b;
-  node_reconnect->cost_from_start = *node_new->cost_from_start + cost_a2b;
+  const double cost_a2b = cspace_.distance(node_new.pose, node_reconnect.pose);
+  node_new.childs.push_back(reconnect_idx);
+  node_reconnect.parent = new_idx;
+  node_reconnect.cost_to_parent = cost_a2b;
+  node_reconnect.cost_from_start = *node_new.cost_from_start + cost_a2b;
   // Current state:
   // node_new_parent -> node_new -> node_reconnect -> #nil;
   // node_reconnect_parent -> #nil;
 
   // update cost of all descendents of node_reconnect
-  std::queue<NodeSharedPtr> bf_queue;
-  bf_queue.push(node_reconnect);
+  std::queue<size_t> bf_queue;
+  bf_queue.push(reconnect_idx);
   while (!bf_queue.empty()) {
-    const auto node = bf_queue.front();
+    const auto & node = nodes_.at(bf_queue.front());
     bf_queue.pop();
-    for (const auto & child : node->childs) {
-      child->cost_from_start = *node->cost_from_start + *child->cost_to_parent;
-      bf_queue.push(child);
+    for (const size_t child_idx : node.childs) {
+      auto & child = nodes_.at(child_idx);
+      child.cost_from_start = *node.cost_from_start + *child.cost_to_parent;
+      bf_queue.push(child_idx);
     }
   }
 }
@@ -25,18 +25,21 @@ namespace autoware::freespace_planning_algorithms::rrtstar_core
 bool checkAllNodeConnected(const rrtstar_core::RRTStar & tree)
 {
   const auto & nodes = tree.getNodes();
-  rrtstar_core::NodeConstSharedPtr root = nodes.front();
 
-  std::stack<rrtstar_core::NodeConstSharedPtr> node_stack;
-  node_stack.push(root);
+  std::stack<size_t> node_stack;
+  node_stack.push(0);
 
   size_t visit_count = 0;
   while (!node_stack.empty()) {
-    const auto & node_here = node_stack.top();
+    const size_t here_idx = node_stack.top();
     node_stack.pop();
     visit_count += 1;
-    for (const auto & child : node_here->childs) {
-      node_stack.push(child);
+    for (const auto child_idx : nodes.at(here_idx).childs) {
+      // the parent and child links must be consistent
+      if (nodes.at(child_idx).parent != here_idx) {
+        return false;
+      }
+      node_stack.push(child_idx);
     }
   }
   return nodes.size() == visit_count;
@@ -77,12 +80,12 @@ TEST(RRTStarCore, WithInformedOption)
     // check all path (including result path) feasibility
     bool is_all_path_feasible = true;
     for (const auto & node : nodes) {
-      const auto & node_parent = node->getParent();
-      if (!node_parent) {
+      if (node.isRoot()) {
         continue;
       }
+      const auto & node_parent = nodes.at(*node.parent);
       std::vector<rrtstar_core::Pose> mid_poses;
-      cspace.sampleWayPoints_child2parent(node->pose, node_parent->pose, resolution, mid_poses);
+      cspace.sampleWayPoints_child2parent(node.pose, node_parent.pose, resolution, mid_poses);
 
       // check feasibility
       for (const auto & pose : mid_poses) {
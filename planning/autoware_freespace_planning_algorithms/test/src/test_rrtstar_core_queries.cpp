@@ -0,0 +1,111 @@
+// Copyright 2025 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/freespace_planning_algorithms/rrtstar_core.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+namespace rrtstar_core = autoware::freespace_planning_algorithms::rrtstar_core;
+
+constexpr double map_size = 30.0;
+
+// A 30 m x 30 m area with a wall in the middle, so that the tree is not uniform
+bool isObstacleFree(const rrtstar_core::Pose & pose)
+{
+  return !(8.0 < pose.x && pose.x < 22.0 && 14.0 < pose.y && pose.y < 16.0);
+}
+
+// Linear scan over all the nodes, as RRTStar did before the nodes were indexed on a grid
+size_t bruteForceNearest(
+  const std::vector<rrtstar_core::Node> & nodes, const rrtstar_core::CSpace & cspace,
+  const rrtstar_core::Pose & pose)
+{
+  double dist_min = rrtstar_core::inf;
+  size_t nearest_idx = 0;
+  for (size_t node_idx = 0; node_idx < nodes.size(); ++node_idx) {
+    const double dist = cspace.distance(nodes.at(node_idx).pose, pose);
+    if (dist < dist_min) {
+      dist_min = dist;
+      nearest_idx = node_idx;
+    }
+  }
+  return nearest_idx;
+}
+
+std::vector<size_t> bruteForceNeighbors(
+  const std::vector<rrtstar_core::Node> & nodes, const rrtstar_core::CSpace & cspace,
+  const rrtstar_core::Pose & pose, const double radius)
+{
+  std::vector<size_t> neighbors;
+  for (size_t node_idx = 0; node_idx < nodes.size(); ++node_idx) {
+    if (cspace.distance(nodes.at(node_idx).pose, pose) < radius) {
+      neighbors.push_back(node_idx);
+    }
+  }
+  return neighbors;
+}
+
+void checkQueries(
+  const rrtstar_core::RRTStar & algo, const rrtstar_core::CSpace & cspace, const double radius,
+  std::mt19937 & rand_gen)
+{
+  const auto & nodes = algo.getNodes();
+  // Queries outside of the area too, the nearest search must then visit many rings
+  std::uniform_real_distribution<double> position(-10.0, map_size + 10.0);
+  std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+  for (int i = 0; i < 100; ++i) {
+    const rrtstar_core::Pose pose{position(rand_gen), position(rand_gen), yaw(rand_gen)};
+    EXPECT_EQ(algo.findNearestNode(pose), bruteForceNearest(nodes, cspace, pose));
+
+    const auto expected_neighbors = bruteForceNeighbors(nodes, cspace, pose, radius);
+    const auto neighbors = algo.findNeighborNodes(pose);
+    ASSERT_EQ(neighbors.size(), expected_neighbors.size());
+    for (size_t j = 0; j < neighbors.size(); ++j) {
+      EXPECT_EQ(neighbors.at(j).node_idx, expected_neighbors.at(j));
+      EXPECT_DOUBLE_EQ(
+        neighbors.at(j).distance, cspace.distance(nodes.at(neighbors.at(j).node_idx).pose, pose));
+    }
+  }
+}
+}  // namespace
+
+TEST(RRTStarCore, GridQueriesMatchLinearScan)
+{
+  const rrtstar_core::Pose x_start{3.0, 3.0, 0.0};
+  const rrtstar_core::Pose x_goal{27.0, 27.0, M_PI * 0.5};
+  const rrtstar_core::Pose lo{0, 0, -M_PI};
+  const rrtstar_core::Pose hi{map_size, map_size, M_PI};
+  const double turning_radius = 4.0;
+  std::mt19937 rand_gen(0);
+
+  for (const double radius : {8.0, 3.0}) {
+    const auto cspace = rrtstar_core::CSpace(lo, hi, turning_radius, isObstacleFree);
+    auto algo = rrtstar_core::RRTStar(x_start, x_goal, radius, 0.2, true, cspace);
+    for (int i = 1; i <= 1000; ++i) {
+      algo.extend();
+      if (i % 500 == 0) {
+        checkQueries(algo, cspace, radius, rand_gen);
+        // the deletion compacts the nodes and rebuilds the grid
+        algo.deleteNodeUsingBranchAndBound();
+        checkQueries(algo, cspace, radius, rand_gen);
+      }
+    }
+  }
+}
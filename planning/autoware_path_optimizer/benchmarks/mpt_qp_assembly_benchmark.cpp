@@ -0,0 +1,325 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare the assembly of the QP of MPTOptimizer before SparseMatrixAssembler (dense state
+// equation, hessian and constraint matrix converted with calCSCMatrixTrapezoidal and calCSCMatrix
+// every cycle) with the sparse assembly reusing the sparsity pattern, for 50 to 200 reference
+// points with the default constraints (soft collision-free constraint with l-inf norm, fixed points
+// and steer limit). Whether both give the same hessian and constraint matrix is printed next to the
+// timings.
+
+#include "autoware/path_optimizer/sparse_matrix_assembler.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/Sparse>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using autoware::osqp_interface::CSC_Matrix;
+using autoware::path_optimizer::SparseMatrixAssembler;
+using Eigen::MatrixXd;
+
+namespace
+{
+constexpr int nb_iterations = 100;
+constexpr size_t D_x = 2;
+constexpr size_t D_u = 1;
+constexpr size_t N_collision_check = 3;
+constexpr size_t N_fixed_points = 3;
+constexpr double wheel_base = 2.79;
+constexpr double offset = 0.8;
+
+struct Problem
+{
+  size_t N_ref;
+  std::vector<double> delta_arc_length;
+  std::vector<std::vector<double>> beta;  // for each vehicle circle
+  std::vector<double> lon_offsets;
+  Eigen::SparseMatrix<double> T;
+  Eigen::SparseMatrix<double> Q;
+  Eigen::SparseMatrix<double> R;
+
+  size_t N_x() const { return N_ref * D_x; }
+  size_t N_u() const { return (N_ref - 1) * D_u; }
+  size_t N_v() const { return N_x() + N_u() + N_ref; }  // one slack variable for l-inf norm
+  size_t A_rows() const
+  {
+    return N_x() + 3 * N_ref * N_collision_check + N_fixed_points * D_x + N_u();
+  }
+};
+
+// a curvy reference with the weights of the default parameters
+Problem makeProblem(const size_t N_ref)
+{
+  Problem p;
+  p.N_ref = N_ref;
+  p.lon_offsets = {-0.5, 1.5, 3.5};
+  p.beta.resize(N_collision_check);
+  std::vector<Eigen::Triplet<double>> T_triplets;
+  std::vector<Eigen::Triplet<double>> Q_triplets;
+  std::vector<Eigen::Triplet<double>> R_triplets;
+  for (size_t i = 0; i < N_ref; ++i) {
+    const double alpha = 0.1 * std::sin(0.05 * i);
+    T_triplets.emplace_back(i * D_x, i * D_x, std::cos(alpha));
+    T_triplets.emplace_back(i * D_x, i * D_x + 1, offset * std::cos(alpha));
+    T_triplets.emplace_back(i * D_x + 1, i * D_x + 1, 1.0);
+    Q_triplets.emplace_back(i * D_x, i * D_x, i + 1 == N_ref ? 100.0 : 1.0);
+    Q_triplets.emplace_back(i * D_x + 1, i * D_x + 1, i + 1 == N_ref ? 0.0 : 1.0);
+    p.delta_arc_length.push_back(1.0 + 0.01 * i);
+    for (size_t l = 0; l < N_collision_check; ++l) {
+      p.beta[l].push_back(0.05 * std::cos(0.1 * i + l));
+    }
+  }
+  const size_t N_u = (N_ref - 1) * D_u;
+  for (size_t i = 0; i < N_u; ++i) {
+    R_triplets.emplace_back(i, i, 1.0);
+  }
+  for (size_t i = 0; i + 1 < N_u; ++i) {
+    R_triplets.emplace_back(i, i, 1.0);
+    R_triplets.emplace_back(i + 1, i, -1.0);
+    R_triplets.emplace_back(i, i + 1, -1.0);
+    R_triplets.emplace_back(i + 1, i + 1, 1.0);
+  }
+  p.T.resize(N_ref * D_x, N_ref * D_x);
+  p.T.setFromTriplets(T_triplets.begin(), T_triplets.end());
+  p.Q.resize(N_ref * D_x, N_ref * D_x);
+  p.Q.setFromTriplets(Q_triplets.begin(), Q_triplets.end());
+  p.R.resize(N_u, N_u);
+  p.R.setFromTriplets(R_triplets.begin(), R_triplets.end());
+  return p;
+}
+
+void calcOneStepMatrix(const double ds, MatrixXd & Ad, MatrixXd & Bd)
+{
+  Ad << 1.0, ds, 0.0, 1.0;
+  Bd << 0.0, ds / wheel_base;
+}
+
+// the formulation of MPTOptimizer before SparseMatrixAssembler
+void assembleDense(const Problem & p, CSC_Matrix & P_csc, CSC_Matrix & A_csc)
+{
+  const size_t N_ref = p.N_ref;
+  const size_t N_x = p.N_x();
+  const size_t N_u = p.N_u();
+  const size_t N_v = p.N_v();
+
+  MatrixXd A_x = MatrixXd::Zero(N_x, N_x);
+  MatrixXd B_x = MatrixXd::Zero(N_x, N_u);
+  MatrixXd Ad(D_x, D_x);
+  MatrixXd Bd(D_x, D_u);
+  A_x.block(0, 0, D_x, D_x) = MatrixXd::Identity(D_x, D_x);
+  for (size_t i = 1; i < N_ref; ++i) {
+    calcOneStepMatrix(p.delta_arc_length[i - 1], Ad, Bd);
+    A_x.block(i * D_x, (i - 1) * D_x, D_x, D_x) = Ad;
+    B_x.block(i * D_x, (i - 1) * D_u, D_x, D_u) = Bd;
+  }
+
+  MatrixXd H_x = MatrixXd::Zero(N_x, N_x);
+  H_x.triangularView<Eigen::Upper>() = MatrixXd(p.T.transpose() * p.Q * p.T);
+  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
+  MatrixXd H = MatrixXd::Zero(N_v, N_v);
+  H.block(0, 0, N_x, N_x) = H_x;
+  H.block(N_x, N_x, N_u, N_u) = p.R;
+
+  MatrixXd A = MatrixXd::Zero(p.A_rows(), N_v);
+  A.block(0, 0, N_x, N_x) = MatrixXd::Identity(N_x, N_x) - A_x;
+  A.block(0, N_x, N_x, N_u) = -B_x;
+  size_t A_rows_end = N_x;
+  for (size_t l = 0; l < N_collision_check; ++l) {
+    Eigen::SparseMatrix<double> C(N_ref, N_x);
+    std::vector<Eigen::Triplet<double>> C_triplets;
+    for (size_t i = 0; i < N_ref; ++i) {
+      C_triplets.emplace_back(i, i * D_x, std::cos(p.beta[l][i]));
+      C_triplets.emplace_back(i, i * D_x + 1, p.lon_offsets[l] * std::cos(p.beta[l][i]));
+    }
+    C.setFromTriplets(C_triplets.begin(), C_triplets.end());
+    MatrixXd A_blk = MatrixXd::Zero(3 * N_ref, N_v);
+    A_blk.block(0, 0, N_ref, N_x) = C;
+    A_blk.block(N_ref, 0, N_ref, N_x) = -C;
+    A_blk.block(0, N_x + N_u, N_ref, N_ref) = MatrixXd::Identity(N_ref, N_ref);
+    A_blk.block(N_ref, N_x + N_u, N_ref, N_ref) = MatrixXd::Identity(N_ref, N_ref);
+    A_blk.block(2 * N_ref, N_x + N_u, N_ref, N_ref) = MatrixXd::Identity(N_ref, N_ref);
+    A.block(A_rows_end, 0, 3 * N_ref, N_v) = A_blk;
+    A_rows_end += 3 * N_ref;
+  }
+  for (size_t i = 0; i < N_fixed_points; ++i) {
+    A.block(A_rows_end, D_x * i, D_x, D_x) = MatrixXd::Identity(D_x, D_x);
+    A_rows_end += D_x;
+  }
+  A.block(A_rows_end, N_x, N_u, N_u) = MatrixXd::Identity(N_u, N_u);
+
+  P_csc = autoware::osqp_interface::calCSCMatrixTrapezoidal(H);
+  A_csc = autoware::osqp_interface::calCSCMatrix(A);
+}
+
+// the formulation of MPTOptimizer with SparseMatrixAssembler
+void assembleSparse(
+  const Problem & p, SparseMatrixAssembler & hessian_assembler,
+  SparseMatrixAssembler & constraint_assembler, CSC_Matrix & P_csc, CSC_Matrix & A_csc)
+{
+  const size_t N_ref = p.N_ref;
+  const size_t N_x = p.N_x();
+  const size_t N_u = p.N_u();
+  const size_t N_v = p.N_v();
+
+  std::vector<Eigen::Triplet<double>> A_x_triplets;
+  std::vector<Eigen::Triplet<double>> B_x_triplets;
+  A_x_triplets.reserve(D_x + (N_ref - 1) * D_x * D_x);
+  B_x_triplets.reserve((N_ref - 1) * D_x * D_u);
+  MatrixXd Ad(D_x, D_x);
+  MatrixXd Bd(D_x, D_u);
+  for (size_t j = 0; j < D_x; ++j) {
+    A_x_triplets.emplace_back(j, j, 1.0);
+  }
+  for (size_t i = 1; i < N_ref; ++i) {
+    calcOneStepMatrix(p.delta_arc_length[i - 1], Ad, Bd);
+    for (size_t k = 0; k < D_x; ++k) {
+      for (size_t j = 0; j < D_x; ++j) {
+        A_x_triplets.emplace_back(i * D_x + j, (i - 1) * D_x + k, Ad(j, k));
+      }
+      for (size_t j = 0; j < D_u; ++j) {
+        B_x_triplets.emplace_back(i * D_x + k, (i - 1) * D_u + j, Bd(k, j));
+      }
+    }
+  }
+  Eigen::SparseMatrix<double> A_x(N_x, N_x);
+  Eigen::SparseMatrix<double> B_x(N_x, N_u);
+  A_x.setFromTriplets(A_x_triplets.begin(), A_x_triplets.end());
+  B_x.setFromTriplets(B_x_triplets.begin(), B_x_triplets.end());
+
+  hessian_assembler.reset(N_v, N_v);
+  const Eigen::SparseMatrix<double> H_x = p.T.transpose() * p.Q * p.T;
+  for (Eigen::Index col = 0; col < H_x.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(H_x, col); itr; ++itr) {
+      if (itr.row() <= itr.col()) {
+        hessian_assembler.add(itr.row(), itr.col(), itr.value());
+      }
+    }
+  }
+  for (Eigen::Index col = 0; col < p.R.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(p.R, col); itr; ++itr) {
+      if (itr.row() <= itr.col()) {
+        hessian_assembler.add(N_x + itr.row(), N_x + itr.col(), itr.value());
+      }
+    }
+  }
+
+  constraint_assembler.reset(p.A_rows(), N_v);
+  for (size_t i = 0; i < N_x; ++i) {
+    constraint_assembler.add(i, i, 1.0);
+  }
+  for (Eigen::Index col = 0; col < A_x.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(A_x, col); itr; ++itr) {
+      constraint_assembler.add(itr.row(), itr.col(), -itr.value());
+    }
+  }
+  for (Eigen::Index col = 0; col < B_x.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(B_x, col); itr; ++itr) {
+      constraint_assembler.add(itr.row(), N_x + itr.col(), -itr.value());
+    }
+  }
+  size_t A_rows_end = N_x;
+  for (size_t l = 0; l < N_collision_check; ++l) {
+    for (size_t i = 0; i < N_ref; ++i) {
+      const double C_lat = std::cos(p.beta[l][i]);
+      const double C_yaw = p.lon_offsets[l] * std::cos(p.beta[l][i]);
+      constraint_assembler.add(A_rows_end + i, i * D_x, C_lat);
+      constraint_assembler.add(A_rows_end + i, i * D_x + 1, C_yaw);
+      constraint_assembler.add(A_rows_end + i, N_x + N_u + i, 1.0);
+      constraint_assembler.add(A_rows_end + N_ref + i, i * D_x, -C_lat);
+      constraint_assembler.add(A_rows_end + N_ref + i, i * D_x + 1, -C_yaw);
+      constraint_assembler.add(A_rows_end + N_ref + i, N_x + N_u + i, 1.0);
+      constraint_assembler.add(A_rows_end + 2 * N_ref + i, N_x + N_u + i, 1.0);
+    }
+    A_rows_end += 3 * N_ref;
+  }
+  for (size_t i = 0; i < N_fixed_points; ++i) {
+    for (size_t j = 0; j < D_x; ++j) {
+      constraint_assembler.add(A_rows_end + j, D_x * i + j, 1.0);
+    }
+    A_rows_end += D_x;
+  }
+  for (size_t i = 0; i < N_u; ++i) {
+    constraint_assembler.add(A_rows_end + i, N_x + i, 1.0);
+  }
+
+  P_csc = autoware::path_optimizer::toCSCMatrix(hessian_assembler.assemble());
+  A_csc = autoware::path_optimizer::toCSCMatrix(constraint_assembler.assemble());
+}
+
+MatrixXd toDense(const CSC_Matrix & csc, const Eigen::Index rows, const Eigen::Index cols)
+{
+  MatrixXd mat = MatrixXd::Zero(rows, cols);
+  for (Eigen::Index col = 0; col < cols; ++col) {
+    for (auto k = csc.m_col_idxs[col]; k < csc.m_col_idxs[col + 1]; ++k) {
+      mat(csc.m_row_idxs[k], col) += csc.m_vals[k];
+    }
+  }
+  return mat;
+}
+
+template <typename F>
+double averageMs(F && f)
+{
+  double total_ms = 0.0;
+  for (int i = 0; i <= nb_iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    const auto end = std::chrono::steady_clock::now();
+    if (i > 0) {  // the first run is a warm-up
+      total_ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+  }
+  return total_ms / nb_iterations;
+}
+}  // namespace
+
+int main()
+{
+  for (const size_t N_ref : {50, 100, 150, 200}) {
+    const auto problem = makeProblem(N_ref);
+    const auto N_v = static_cast<Eigen::Index>(problem.N_v());
+    const auto A_rows = static_cast<Eigen::Index>(problem.A_rows());
+
+    CSC_Matrix dense_P_csc;
+    CSC_Matrix dense_A_csc;
+    const double dense_ms =
+      averageMs([&]() { assembleDense(problem, dense_P_csc, dense_A_csc); });
+
+    SparseMatrixAssembler hessian_assembler;
+    SparseMatrixAssembler constraint_assembler;
+    CSC_Matrix sparse_P_csc;
+    CSC_Matrix sparse_A_csc;
+    const double sparse_ms = averageMs([&]() {
+      assembleSparse(problem, hessian_assembler, constraint_assembler, sparse_P_csc, sparse_A_csc);
+    });
+    const bool is_pattern_reused =
+      hessian_assembler.isPatternReused() && constraint_assembler.isPatternReused();
+
+    // the sparse assembly keeps the zeros of the pattern, so the matrices are compared as dense
+    const bool same = toDense(sparse_P_csc, N_v, N_v) == toDense(dense_P_csc, N_v, N_v) &&
+                      toDense(sparse_A_csc, A_rows, N_v) == toDense(dense_A_csc, A_rows, N_v);
+    std::cout << "N_ref = " << N_ref << " (H " << N_v << "x" << N_v << ", A " << A_rows << "x"
+              << N_v << "): dense " << dense_ms << " ms, sparse " << sparse_ms << " ms (x"
+              << dense_ms / sparse_ms << "), nnz P " << dense_P_csc.m_vals.size() << " / "
+              << sparse_P_csc.m_vals.size() << ", nnz A " << dense_A_csc.m_vals.size() << " / "
+              << sparse_A_csc.m_vals.size() << ", pattern reused: "
+              << (is_pattern_reused ? "yes" : "NO") << ", same: " << (same ? "yes" : "NO")
+              << "\n";
+  }
+  return 0;
+}
@@ -19,6 +19,7 @@
 #include "autoware/interpolation/spline_interpolation_points_2d.hpp"
 #include "autoware/osqp_interface/osqp_interface.hpp"
 #include "autoware/path_optimizer/common_structs.hpp"
+#include "autoware/path_optimizer/sparse_matrix_assembler.hpp"
 #include "autoware/path_optimizer/state_equation_generator.hpp"
 #include "autoware/path_optimizer/type_alias.hpp"
 #include "autoware/path_optimizer/utils/conditional_timer.hpp"
@@ -207,7 +208,8 @@ private:
 
   struct ObjectiveMatrix
   {
-    Eigen::MatrixXd hessian;
+    // NOTE: upper triangular part of the hessian
+    Eigen::SparseMatrix<double> hessian;
     Eigen::VectorXd gradient;
 
     friend std::ostream & operator<<(std::ostream & os, const ObjectiveMatrix & matrix)
@@ -222,7 +224,7 @@ private:
 
   struct ConstraintMatrix
   {
-    Eigen::MatrixXd linear;
+    Eigen::SparseMatrix<double> linear;
     Eigen::VectorXd lower_bound;
     Eigen::VectorXd upper_bound;
 
@@ -326,6 +328,10 @@ private:
   StateEquationGenerator state_equation_generator_;
   std::unique_ptr<autoware::osqp_interface::OSQPInterface> osqp_solver_ptr_;
 
+  // sparsity patterns of the hessian and the constraint matrix kept between the cycles
+  SparseMatrixAssembler hessian_assembler_;
+  SparseMatrixAssembler constraint_assembler_;
+
   const double osqp_epsilon_ = 1.0e-3;
 
   // vehicle circles
@@ -373,11 +379,11 @@ private:
 
   ObjectiveMatrix calcObjectiveMatrix(
     const StateEquationGenerator::Matrix & mpt_mat, const ValueMatrix & obj_mat,
-    const std::vector<ReferencePoint> & ref_points) const;
+    const std::vector<ReferencePoint> & ref_points);
 
   ConstraintMatrix calcConstraintMatrix(
     const StateEquationGenerator::Matrix & mpt_mat,
-    const std::vector<ReferencePoint> & ref_points) const;
+    const std::vector<ReferencePoint> & ref_points);
 
   std::optional<Eigen::VectorXd> calcOptimizedSteerAngles(
     const std::vector<ReferencePoint> & ref_points, const ObjectiveMatrix & obj_mat,
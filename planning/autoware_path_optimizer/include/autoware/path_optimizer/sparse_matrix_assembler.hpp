@@ -0,0 +1,88 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__PATH_OPTIMIZER__SPARSE_MATRIX_ASSEMBLER_HPP_
+#define AUTOWARE__PATH_OPTIMIZER__SPARSE_MATRIX_ASSEMBLER_HPP_
+
+#include "autoware/osqp_interface/osqp_interface.hpp"
+
+#include <Eigen/Sparse>
+
+#include <utility>
+#include <vector>
+
+namespace autoware::path_optimizer
+{
+/**
+ * @brief Assembler of a compressed column sparse matrix from its entries, which keeps the sparsity
+ * pattern of the previous assembly.
+ *
+ * The entries are added in the same order in every cycle, so the rows and columns of the entries
+ * only depend on the configuration of the optimization (number of reference points, slack
+ * variables, constraints). When they are the ones of the previous assembly, the values are
+ * scattered into the compressed storage without sorting the entries nor allocating. The entries
+ * at the same position are summed, and the entries whose value is zero are kept in the pattern.
+ */
+class SparseMatrixAssembler
+{
+public:
+  using StorageIndex = Eigen::SparseMatrix<double>::StorageIndex;
+
+  /**
+   * @brief Start the assembly of a new matrix.
+   * @param rows The number of rows of the matrix.
+   * @param cols The number of columns of the matrix.
+   */
+  void reset(const Eigen::Index rows, const Eigen::Index cols);
+
+  void add(const Eigen::Index row, const Eigen::Index col, const double value)
+  {
+    entries_.emplace_back(static_cast<StorageIndex>(row), static_cast<StorageIndex>(col));
+    values_.push_back(value);
+  }
+
+  /**
+   * @brief Compute the matrix from the entries added since reset().
+   * @return The compressed matrix. It is valid until the next call to assemble().
+   */
+  const Eigen::SparseMatrix<double> & assemble();
+
+  /**
+   * @brief Whether the last assemble() reused the sparsity pattern of the previous one.
+   */
+  bool isPatternReused() const { return is_pattern_reused_; }
+
+private:
+  void updatePattern();
+
+  Eigen::Index rows_{0};
+  Eigen::Index cols_{0};
+  std::vector<std::pair<StorageIndex, StorageIndex>> entries_;
+  std::vector<double> values_;
+
+  // rows and columns of the entries of the cached pattern, and index of each entry in the values
+  // of the compressed matrix
+  std::vector<std::pair<StorageIndex, StorageIndex>> pattern_entries_;
+  std::vector<StorageIndex> value_indices_;
+
+  Eigen::SparseMatrix<double> matrix_;
+  bool is_pattern_reused_{false};
+};
+
+/**
+ * @brief Copy a compressed sparse matrix to the CSC format of the OSQP interface.
+ */
+autoware::osqp_interface::CSC_Matrix toCSCMatrix(const Eigen::SparseMatrix<double> & matrix);
+}  // namespace autoware::path_optimizer
+#endif  // AUTOWARE__PATH_OPTIMIZER__SPARSE_MATRIX_ASSEMBLER_HPP_
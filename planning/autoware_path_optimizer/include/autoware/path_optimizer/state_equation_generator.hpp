@@ -20,6 +20,8 @@
 #include "autoware/path_optimizer/vehicle_model/vehicle_model_interface.hpp"
 #include "autoware_utils/system/time_keeper.hpp"
 
+#include <Eigen/Sparse>
+
 #include <memory>
 #include <vector>
 
@@ -32,8 +34,8 @@ class StateEquationGenerator
 public:
   struct Matrix
   {
-    Eigen::MatrixXd A;
-    Eigen::MatrixXd B;
+    Eigen::SparseMatrix<double> A;
+    Eigen::SparseMatrix<double> B;
     Eigen::VectorXd W;
   };
 
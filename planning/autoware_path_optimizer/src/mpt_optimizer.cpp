@@ -1216,7 +1216,7 @@ MPTOptimizer::ValueMatrix MPTOptimizer::calcValueMatrix(
 
 MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   [[maybe_unused]] const StateEquationGenerator::Matrix & mpt_mat, const ValueMatrix & val_mat,
-  const std::vector<ReferencePoint> & ref_points) const
+  const std::vector<ReferencePoint> & ref_points)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
@@ -1253,17 +1253,28 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   time_keeper_->end_track("objectiveMatrix_Tmatrix");
 
   // NOTE: min J(v) = min (v'Hv + v'g)
+  //       Only the upper triangular part of H, which is block diagonal with H_x and R, is built.
   time_keeper_->start_track("objectiveMatrix_Hx");
-  Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
-  H_x.triangularView<Eigen::Upper>() =
-    Eigen::MatrixXd(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat);
-  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
+  hessian_assembler_.reset(N_v, N_v);
+  const Eigen::SparseMatrix<double> H_x = sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat;
+  for (Eigen::Index col = 0; col < H_x.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(H_x, col); itr; ++itr) {
+      if (itr.row() <= itr.col()) {
+        hessian_assembler_.add(itr.row(), itr.col(), itr.value());
+      }
+    }
+  }
   time_keeper_->end_track("objectiveMatrix_Hx");
 
   time_keeper_->start_track("objectiveMatrix_Hg");
-  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
-  H.block(0, 0, N_x, N_x) = H_x;
-  H.block(N_x, N_x, N_u, N_u) = val_mat.R;
+  for (Eigen::Index col = 0; col < val_mat.R.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(val_mat.R, col); itr; ++itr) {
+      if (itr.row() <= itr.col()) {
+        hessian_assembler_.add(N_x + itr.row(), N_x + itr.col(), itr.value());
+      }
+    }
+  }
+  const Eigen::SparseMatrix<double> & H = hessian_assembler_.assemble();
 
   Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
   g.segment(0, N_x) = T_vec.transpose() * val_mat.Q * sparse_T_mat;
@@ -1273,7 +1284,9 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   time_keeper_->comment(
     "N_ref=" + std::to_string(N_ref) + ", N_x=" + std::to_string(N_x) + ", N_u=" +
     std::to_string(N_u) + ", N_s=" + std::to_string(N_s) + ", N_v=" + std::to_string(N_v) +
-    ", H=" + std::to_string(N_v) + "x" + std::to_string(N_v) + ", g=" + std::to_string(N_v));
+    ", H=" + std::to_string(N_v) + "x" + std::to_string(N_v) + " (nnz=" +
+    std::to_string(H.nonZeros()) + (hessian_assembler_.isPatternReused() ? ", reused" : "") +
+    "), g=" + std::to_string(N_v));
 
   ObjectiveMatrix obj_matrix;
   obj_matrix.hessian = H;
@@ -1286,8 +1299,7 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
 // decision variable
 // u := [initial state, steer angles, soft variables]
 MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
-  const StateEquationGenerator::Matrix & mpt_mat,
-  const std::vector<ReferencePoint> & ref_points) const
+  const StateEquationGenerator::Matrix & mpt_mat, const std::vector<ReferencePoint> & ref_points)
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
 
@@ -1330,9 +1342,8 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows += N_u;
   }
 
-  // NOTE: The following takes 1 [ms]
   time_keeper_->start_track("constraintMatrix_initialization");
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
+  constraint_assembler_.reset(A_rows, N_v);
   Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::osqp_interface::INF);
   Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::osqp_interface::INF);
   time_keeper_->comment("Initialized A, lb, ub");
@@ -1342,8 +1353,20 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
 
   // 1. State equation
   time_keeper_->start_track("constraintMatrix_stateEquation");
-  A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - mpt_mat.A;
-  A.block(0, N_x, N_x, N_u) = -mpt_mat.B;
+  // A := [I - A_x | -B_x | O]
+  for (size_t i = 0; i < N_x; ++i) {
+    constraint_assembler_.add(i, i, 1.0);
+  }
+  for (Eigen::Index col = 0; col < mpt_mat.A.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(mpt_mat.A, col); itr; ++itr) {
+      constraint_assembler_.add(itr.row(), itr.col(), -itr.value());
+    }
+  }
+  for (Eigen::Index col = 0; col < mpt_mat.B.outerSize(); ++col) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(mpt_mat.B, col); itr; ++itr) {
+      constraint_assembler_.add(itr.row(), N_x + itr.col(), -itr.value());
+    }
+  }
   lb.segment(0, N_x) = mpt_mat.W;
   ub.segment(0, N_x) = mpt_mat.W;
   A_rows_end += N_x;
@@ -1354,8 +1377,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   time_keeper_->start_track("constraintMatrix_collisionFree");
   for (size_t l_idx = 0; l_idx < N_collision_check; ++l_idx) {
     // create C := [cos(beta) | l cos(beta)]
-    Eigen::SparseMatrix<double> C_sparse_mat(N_ref, N_x);
-    std::vector<Eigen::Triplet<double>> C_triplet_vec;
+    // NOTE: C has two entries per row, which are stored in C_lat and C_yaw.
+    Eigen::VectorXd C_lat(N_ref);
+    Eigen::VectorXd C_yaw(N_ref);
     Eigen::VectorXd C_vec = Eigen::VectorXd::Zero(N_ref);
 
     // calculate C mat and vec
@@ -1363,11 +1387,10 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       const double beta = ref_points.at(i).beta.at(l_idx);
       const double lon_offset = vehicle_circle_longitudinal_offsets_.at(l_idx);
 
-      C_triplet_vec.push_back(Eigen::Triplet<double>(i, i * D_x, 1.0 * std::cos(beta)));
-      C_triplet_vec.push_back(Eigen::Triplet<double>(i, i * D_x + 1, lon_offset * std::cos(beta)));
+      C_lat(i) = 1.0 * std::cos(beta);
+      C_yaw(i) = lon_offset * std::cos(beta);
       C_vec(i) = lon_offset * std::sin(beta);
     }
-    C_sparse_mat.setFromTriplets(C_triplet_vec.begin(), C_triplet_vec.end());
 
     // calculate bounds
     const double bounds_offset =
@@ -1381,16 +1404,16 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       // A := [C | O | ... | O | I | O | ...
       //      -C | O | ... | O | I | O | ...
       //          O    | O | ... | O | I | O | ... ]
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_x) = C_sparse_mat;
-      A_blk.block(N_ref, 0, N_ref, N_x) = -C_sparse_mat;
-
       const size_t local_A_offset_cols = N_x + N_u + (!mpt_param_.l_inf_norm ? N_ref * l_idx : 0);
-      A_blk.block(0, local_A_offset_cols, N_ref, N_ref) = Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(2 * N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
+      for (size_t i = 0; i < N_ref; ++i) {
+        constraint_assembler_.add(A_rows_end + i, i * D_x, C_lat(i));
+        constraint_assembler_.add(A_rows_end + i, i * D_x + 1, C_yaw(i));
+        constraint_assembler_.add(A_rows_end + i, local_A_offset_cols + i, 1.0);
+        constraint_assembler_.add(A_rows_end + N_ref + i, i * D_x, -C_lat(i));
+        constraint_assembler_.add(A_rows_end + N_ref + i, i * D_x + 1, -C_yaw(i));
+        constraint_assembler_.add(A_rows_end + N_ref + i, local_A_offset_cols + i, 1.0);
+        constraint_assembler_.add(A_rows_end + 2 * N_ref + i, local_A_offset_cols + i, 1.0);
+      }
 
       // lb := [lower_bound - C
       //        C - upper_bound
@@ -1399,7 +1422,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       lb_blk.segment(0, N_ref) = -C_vec + part_lb;
       lb_blk.segment(N_ref, N_ref) = C_vec - part_ub;
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = lb_blk;
 
       A_rows_end += A_blk_rows;
@@ -1409,10 +1431,12 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     if (mpt_param_.hard_constraint) {
       const size_t A_blk_rows = N_ref;
 
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_ref) = C_sparse_mat;
+      // A := [C | O | ...]
+      for (size_t i = 0; i < N_ref; ++i) {
+        constraint_assembler_.add(A_rows_end + i, i * D_x, C_lat(i));
+        constraint_assembler_.add(A_rows_end + i, i * D_x + 1, C_yaw(i));
+      }
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = part_lb - C_vec;
       ub.segment(A_rows_end, A_blk_rows) = part_ub - C_vec;
 
@@ -1427,7 +1451,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   time_keeper_->comment(
     "[calcConstraintMatrix] Fixed points count: " + std::to_string(fixed_points_indices.size()));
   for (const size_t i : fixed_points_indices) {
-    A.block(A_rows_end, D_x * i, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    for (size_t j = 0; j < D_x; ++j) {
+      constraint_assembler_.add(A_rows_end + j, D_x * i + j, 1.0);
+    }
 
     lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
     ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
@@ -1439,7 +1465,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // 4. steer angle limit
   time_keeper_->start_track("constraintMatrix_steerLimit");
   if (mpt_param_.steer_limit_constraint) {
-    A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+    for (size_t i = 0; i < N_u; ++i) {
+      constraint_assembler_.add(A_rows_end + i, N_x + i, 1.0);
+    }
 
     // TODO(murooka) use curvature by stabling optimization
     // Currently, when using curvature, the optimization result is weird with sample_map.
@@ -1458,10 +1486,16 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   }
   time_keeper_->end_track("constraintMatrix_steerLimit");
 
+  time_keeper_->start_track("constraintMatrix_assemble");
+  const Eigen::SparseMatrix<double> & A = constraint_assembler_.assemble();
+  time_keeper_->end_track("constraintMatrix_assemble");
+
   time_keeper_->comment(
     "N_ref=" + std::to_string(N_ref) + ", N_col=" + std::to_string(N_collision_check) +
     ", fixed=" + std::to_string(fixed_points_indices.size()) + ", A=" + std::to_string(A_rows) +
-    "x" + std::to_string(N_v) + ", rows_end=" + std::to_string(A_rows_end));
+    "x" + std::to_string(N_v) + " (nnz=" + std::to_string(A.nonZeros()) +
+    (constraint_assembler_.isPatternReused() ? ", reused" : "") +
+    "), rows_end=" + std::to_string(A_rows_end));
 
   return ConstraintMatrix{A, lb, ub};
 }
@@ -1514,8 +1548,8 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     updateMatrixForManualWarmStart(obj_mat, const_mat, u0);
 
   // calculate matrices for qp
-  const Eigen::MatrixXd & H = updated_obj_mat.hessian;
-  const Eigen::MatrixXd & A = updated_const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = updated_obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = updated_const_mat.linear;
   const auto f = toStdVector(updated_obj_mat.gradient);
   const auto upper_bound = toStdVector(updated_const_mat.upper_bound);
   const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
@@ -1523,12 +1557,15 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   // initialize or update solver according to warm start
   time_keeper_->start_track("initOsqp");
 
-  const autoware::osqp_interface::CSC_Matrix P_csc =
-    autoware::osqp_interface::calCSCMatrixTrapezoidal(H);
-  const autoware::osqp_interface::CSC_Matrix A_csc = autoware::osqp_interface::calCSCMatrix(A);
+  const autoware::osqp_interface::CSC_Matrix P_csc = toCSCMatrix(H);
+  const autoware::osqp_interface::CSC_Matrix A_csc = toCSCMatrix(A);
+  // NOTE: updateCscP and updateCscA only update the values of P and A in the solver, which is
+  //       valid only when their sparsity patterns are the ones of the previous cycle.
+  const bool is_same_pattern =
+    hessian_assembler_.isPatternReused() && constraint_assembler_.isPatternReused();
   if (
     prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
+    prev_mat_m_ == A.rows() && is_same_pattern) {
     RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
     osqp_solver_ptr_->updateCscP(P_csc);
     osqp_solver_ptr_->updateQ(f);
@@ -1630,8 +1667,8 @@ MPTOptimizer::updateMatrixForManualWarmStart(
     return {obj_mat, const_mat};
   }
 
-  const Eigen::MatrixXd & H = obj_mat.hessian;
-  const Eigen::MatrixXd & A = const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = const_mat.linear;
 
   auto updated_obj_mat = obj_mat;
   auto updated_const_mat = const_mat;
@@ -1641,7 +1678,7 @@ MPTOptimizer::updateMatrixForManualWarmStart(
   Eigen::VectorXd & lb = updated_const_mat.lower_bound;
 
   // update gradient
-  f += H * *u0;
+  f += H.selfadjointView<Eigen::Upper>() * *u0;
 
   // update upper_bound and lower_bound
   const Eigen::VectorXd A_times_u0 = A * *u0;
@@ -0,0 +1,81 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/path_optimizer/sparse_matrix_assembler.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace autoware::path_optimizer
+{
+void SparseMatrixAssembler::reset(const Eigen::Index rows, const Eigen::Index cols)
+{
+  rows_ = rows;
+  cols_ = cols;
+  entries_.clear();
+  values_.clear();
+}
+
+const Eigen::SparseMatrix<double> & SparseMatrixAssembler::assemble()
+{
+  is_pattern_reused_ =
+    matrix_.rows() == rows_ && matrix_.cols() == cols_ && entries_ == pattern_entries_;
+  if (!is_pattern_reused_) {
+    updatePattern();
+  }
+
+  double * matrix_values = matrix_.valuePtr();
+  std::fill(matrix_values, matrix_values + matrix_.nonZeros(), 0.0);
+  for (size_t i = 0; i < values_.size(); ++i) {
+    matrix_values[value_indices_[i]] += values_[i];
+  }
+  return matrix_;
+}
+
+void SparseMatrixAssembler::updatePattern()
+{
+  std::vector<Eigen::Triplet<double, StorageIndex>> triplets;
+  triplets.reserve(entries_.size());
+  for (const auto & [row, col] : entries_) {
+    triplets.emplace_back(row, col, 0.0);
+  }
+  matrix_.resize(rows_, cols_);
+  matrix_.setFromTriplets(triplets.begin(), triplets.end());
+  matrix_.makeCompressed();
+
+  // the rows of each column are sorted in the compressed matrix
+  const StorageIndex * outer_indices = matrix_.outerIndexPtr();
+  const StorageIndex * inner_indices = matrix_.innerIndexPtr();
+  value_indices_.resize(entries_.size());
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    const auto & [row, col] = entries_[i];
+    const StorageIndex * col_begin = inner_indices + outer_indices[col];
+    const StorageIndex * col_end = inner_indices + outer_indices[col + 1];
+    value_indices_[i] =
+      static_cast<StorageIndex>(std::lower_bound(col_begin, col_end, row) - inner_indices);
+  }
+  pattern_entries_ = entries_;
+}
+
+autoware::osqp_interface::CSC_Matrix toCSCMatrix(const Eigen::SparseMatrix<double> & matrix)
+{
+  const Eigen::Index nnz = matrix.nonZeros();
+  autoware::osqp_interface::CSC_Matrix csc_matrix;
+  csc_matrix.m_vals.assign(matrix.valuePtr(), matrix.valuePtr() + nnz);
+  csc_matrix.m_row_idxs.assign(matrix.innerIndexPtr(), matrix.innerIndexPtr() + nnz);
+  csc_matrix.m_col_idxs.assign(
+    matrix.outerIndexPtr(), matrix.outerIndexPtr() + matrix.outerSize() + 1);
+  return csc_matrix;
+}
+}  // namespace autoware::path_optimizer
@@ -35,8 +35,12 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
   const size_t N_u = (N_ref - 1) * D_u;
 
   // matrices for whole state equation
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(N_x, N_x);
-  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(N_x, N_u);
+  // NOTE: A has the identity on the first block and Ad on the sub-diagonal blocks, B has Bd on the
+  //       sub-diagonal blocks. All the entries of the blocks are kept in the sparsity pattern.
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
+  std::vector<Eigen::Triplet<double>> B_triplet_vec;
+  A_triplet_vec.reserve(D_x + (N_ref - 1) * D_x * D_x);
+  B_triplet_vec.reserve((N_ref - 1) * D_x * D_u);
   Eigen::VectorXd W = Eigen::VectorXd::Zero(N_x);
 
   // matrices for one-step state equation
@@ -44,7 +48,9 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
   Eigen::MatrixXd Bd(D_x, D_u);
   Eigen::MatrixXd Wd(D_x, 1);
 
-  A.block(0, 0, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+  for (size_t j = 0; j < D_x; ++j) {
+    A_triplet_vec.emplace_back(j, j, 1.0);
+  }
 
   // calculate one-step state equation considering kinematics N_ref times
   for (size_t i = 1; i < N_ref; ++i) {
@@ -57,11 +63,22 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
     // p.delta_arc_length);
     vehicle_model_ptr_->calculateStateEquationMatrix(Ad, Bd, Wd, 0.0, p.delta_arc_length);
 
-    A.block(i * D_x, (i - 1) * D_x, D_x, D_x) = Ad;
-    B.block(i * D_x, (i - 1) * D_u, D_x, D_u) = Bd;
+    for (size_t k = 0; k < D_x; ++k) {
+      for (size_t j = 0; j < D_x; ++j) {
+        A_triplet_vec.emplace_back(i * D_x + j, (i - 1) * D_x + k, Ad(j, k));
+      }
+      for (size_t j = 0; j < D_u; ++j) {
+        B_triplet_vec.emplace_back(i * D_x + k, (i - 1) * D_u + j, Bd(k, j));
+      }
+    }
     W.segment(i * D_x, D_x) = Wd;
   }
 
+  Eigen::SparseMatrix<double> A(N_x, N_x);
+  Eigen::SparseMatrix<double> B(N_x, N_u);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+  B.setFromTriplets(B_triplet_vec.begin(), B_triplet_vec.end());
+
   return Matrix{A, B, W};
 }
 
@@ -0,0 +1,111 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/path_optimizer/sparse_matrix_assembler.hpp"
+
+#include <Eigen/Core>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using autoware::path_optimizer::SparseMatrixAssembler;
+using autoware::path_optimizer::toCSCMatrix;
+
+namespace
+{
+// tridiagonal matrix with the entries of the diagonal added twice
+void addTridiagonal(SparseMatrixAssembler & assembler, const int size, const double scale)
+{
+  assembler.reset(size, size);
+  for (int i = 0; i < size; ++i) {
+    assembler.add(i, i, scale * i);
+    if (0 < i) {
+      assembler.add(i, i - 1, -scale);
+      assembler.add(i - 1, i, -scale);
+    }
+    assembler.add(i, i, scale);
+  }
+}
+
+Eigen::MatrixXd calcTridiagonal(const int size, const double scale)
+{
+  Eigen::MatrixXd mat = Eigen::MatrixXd::Zero(size, size);
+  for (int i = 0; i < size; ++i) {
+    mat(i, i) = scale * i + scale;
+    if (0 < i) {
+      mat(i, i - 1) = -scale;
+      mat(i - 1, i) = -scale;
+    }
+  }
+  return mat;
+}
+}  // namespace
+
+TEST(SparseMatrixAssembler, ReusePattern)
+{
+  SparseMatrixAssembler assembler;
+
+  addTridiagonal(assembler, 5, 1.0);
+  EXPECT_EQ(Eigen::MatrixXd(assembler.assemble()), calcTridiagonal(5, 1.0));
+  EXPECT_FALSE(assembler.isPatternReused());
+
+  // same entries with other values
+  addTridiagonal(assembler, 5, 2.0);
+  EXPECT_EQ(Eigen::MatrixXd(assembler.assemble()), calcTridiagonal(5, 2.0));
+  EXPECT_TRUE(assembler.isPatternReused());
+
+  // the zero values are kept in the pattern
+  addTridiagonal(assembler, 5, 0.0);
+  EXPECT_EQ(assembler.assemble().nonZeros(), 13);
+  EXPECT_TRUE(assembler.isPatternReused());
+
+  // other size
+  addTridiagonal(assembler, 7, 1.0);
+  EXPECT_EQ(Eigen::MatrixXd(assembler.assemble()), calcTridiagonal(7, 1.0));
+  EXPECT_FALSE(assembler.isPatternReused());
+
+  // same size with other entries
+  assembler.reset(7, 7);
+  assembler.add(6, 0, 3.0);
+  assembler.add(0, 6, 4.0);
+  Eigen::MatrixXd expected = Eigen::MatrixXd::Zero(7, 7);
+  expected(6, 0) = 3.0;
+  expected(0, 6) = 4.0;
+  EXPECT_EQ(Eigen::MatrixXd(assembler.assemble()), expected);
+  EXPECT_FALSE(assembler.isPatternReused());
+}
+
+TEST(SparseMatrixAssembler, ToCSCMatrix)
+{
+  // [1 0 2
+  //  0 0 3]
+  SparseMatrixAssembler assembler;
+  assembler.reset(2, 3);
+  assembler.add(1, 2, 3.0);
+  assembler.add(0, 0, 1.0);
+  assembler.add(0, 2, 2.0);
+  const auto csc_matrix = toCSCMatrix(assembler.assemble());
+
+  EXPECT_EQ(csc_matrix.m_vals, (std::vector<double>{1.0, 2.0, 3.0}));
+  ASSERT_EQ(csc_matrix.m_row_idxs.size(), 3u);
+  EXPECT_EQ(csc_matrix.m_row_idxs.at(0), 0);
+  EXPECT_EQ(csc_matrix.m_row_idxs.at(1), 0);
+  EXPECT_EQ(csc_matrix.m_row_idxs.at(2), 1);
+  ASSERT_EQ(csc_matrix.m_col_idxs.size(), 4u);
+  EXPECT_EQ(csc_matrix.m_col_idxs.at(0), 0);
+  EXPECT_EQ(csc_matrix.m_col_idxs.at(1), 1);
+  EXPECT_EQ(csc_matrix.m_col_idxs.at(2), 1);
+  EXPECT_EQ(csc_matrix.m_col_idxs.at(3), 3);
+}
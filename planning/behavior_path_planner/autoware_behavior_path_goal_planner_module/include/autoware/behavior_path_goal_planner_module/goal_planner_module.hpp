@@ -179,6 +179,8 @@ private:
   LaneChangeContext::State lane_change_state_last_wakeup_{LaneChangeContext::NotLaneChanging{}};
 
   std::vector<std::shared_ptr<PullOverPlannerBase>> pull_over_planners_;
+  // planners of the other candidate generation workers, since the planners are not thread-safe
+  std::vector<std::vector<std::shared_ptr<PullOverPlannerBase>>> worker_pull_over_planners_;
   BehaviorModuleOutput
     original_upstream_module_output_;  //<! upstream_module_output used for generating last
                                        // pull_over_path_candidates(only updated when new candidates
@@ -191,7 +193,7 @@ private:
     const std::shared_ptr<PlannerData> planner_data, const GoalCandidates & goal_candidates,
     const BehaviorModuleOutput & upstream_module_output, const bool use_bus_stop_area,
     const lanelet::ConstLanelets current_lanelets, std::optional<Pose> & closest_start_pose,
-    std::vector<PullOverPath> & path_candidates);
+    std::vector<PullOverPath> & path_candidates, CandidateGenerationStats & stats);
   void bezier_planning_helper(
     const std::shared_ptr<PlannerData> planner_data, const GoalCandidates & goal_candidates,
     const BehaviorModuleOutput & upstream_module_output,
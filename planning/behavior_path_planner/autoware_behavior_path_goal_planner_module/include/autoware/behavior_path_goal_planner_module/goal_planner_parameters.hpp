@@ -101,6 +101,10 @@ struct GoalPlannerParameters
   std::vector<std::string> efficient_path_order{};
   double lane_departure_check_expansion_margin{0.0};
 
+  // candidate generation
+  int candidate_generation_num_threads{1};
+  int max_safe_path_candidates{0};  // 0 generates all the candidates
+
   // shift path
   bool enable_shift_parking{false};
   int shift_sampling_num{0};
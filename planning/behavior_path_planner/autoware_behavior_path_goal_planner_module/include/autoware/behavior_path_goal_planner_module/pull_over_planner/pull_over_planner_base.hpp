@@ -54,6 +54,7 @@ public:
   PullOverPlannerType type() const { return type_; }
   size_t goal_id() const { return modified_goal_pose_.id; }
   size_t id() const { return id_; }
+  void set_id(const size_t id) { id_ = id; }
   Pose start_pose() const { return start_pose_; }
   Pose modified_goal_pose() const { return modified_goal_pose_.goal_pose; }
   const GoalCandidate & modified_goal() const { return modified_goal_pose_; }
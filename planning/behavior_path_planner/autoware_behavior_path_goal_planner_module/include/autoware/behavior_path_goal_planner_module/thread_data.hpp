@@ -73,9 +73,23 @@ private:
   LaneChangeContext::State lane_change_state_{LaneChangeContext::NotLaneChanging{}};
 };
 
+struct CandidateGenerationStats
+{
+  size_t num_threads{1};
+  // (planner, goal candidate) pairs to plan, and those actually planned. fewer pairs are planned
+  // when enough safe candidates are found, but the workers may plan some pairs past the cutoff
+  size_t num_pairs{0};
+  size_t num_planned{0};
+  double elapsed_time{0.0};  // [s]
+
+  double throughput() const { return elapsed_time > 0.0 ? num_planned / elapsed_time : 0.0; }
+};
+
 struct LaneParkingResponse
 {
   std::vector<PullOverPath> pull_over_path_candidates;
+  // only set by the normal pull over planning, not by the bezier one
+  std::optional<CandidateGenerationStats> candidate_generation_stats;
   std::optional<Pose> closest_start_pose;
   std::optional<std::vector<size_t>> sorted_bezier_indices_opt;
   LaneChangeContext::State lane_change_state{LaneChangeContext::NotLaneChanging{}};
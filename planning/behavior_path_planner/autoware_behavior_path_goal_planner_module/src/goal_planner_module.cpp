@@ -30,6 +30,7 @@
 #include "autoware_utils/geometry/boost_polygon_utils.hpp"
 
 #include <autoware/lanelet2_utils/geometry.hpp>
+#include <autoware/universe_utils/system/parallel_for.hpp>
 #include <autoware_lanelet2_extension/utility/message_conversion.hpp>
 #include <autoware_lanelet2_extension/utility/query.hpp>
 #include <autoware_lanelet2_extension/utility/utilities.hpp>
@@ -49,6 +50,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -231,16 +233,24 @@ LaneParkingPlanner::LaneParkingPlanner(
   logger_(logger),
   pull_over_angle_threshold(parameters.bezier_parking.pull_over_angle_threshold)
 {
-  for (const std::string & planner_type : parameters.efficient_path_order) {
-    if (planner_type == "SHIFT" && parameters.enable_shift_parking) {
-      pull_over_planners_.push_back(std::make_shared<ShiftPullOver>(node, parameters));
-    } else if (planner_type == "ARC_FORWARD" && parameters.enable_arc_forward_parking) {
-      pull_over_planners_.push_back(
-        std::make_shared<GeometricPullOver>(node, parameters, /*is_forward*/ true));
-    } else if (planner_type == "ARC_BACKWARD" && parameters.enable_arc_backward_parking) {
-      pull_over_planners_.push_back(
-        std::make_shared<GeometricPullOver>(node, parameters, /*is_forward*/ false));
+  const auto create_pull_over_planners = [&]() {
+    std::vector<std::shared_ptr<PullOverPlannerBase>> planners;
+    for (const std::string & planner_type : parameters.efficient_path_order) {
+      if (planner_type == "SHIFT" && parameters.enable_shift_parking) {
+        planners.push_back(std::make_shared<ShiftPullOver>(node, parameters));
+      } else if (planner_type == "ARC_FORWARD" && parameters.enable_arc_forward_parking) {
+        planners.push_back(
+          std::make_shared<GeometricPullOver>(node, parameters, /*is_forward*/ true));
+      } else if (planner_type == "ARC_BACKWARD" && parameters.enable_arc_backward_parking) {
+        planners.push_back(
+          std::make_shared<GeometricPullOver>(node, parameters, /*is_forward*/ false));
+      }
     }
+    return planners;
+  };
+  pull_over_planners_ = create_pull_over_planners();
+  for (int i = 1; i < parameters.candidate_generation_num_threads; ++i) {
+    worker_pull_over_planners_.push_back(create_pull_over_planners());
   }
 
   bezier_pull_over_planner_ = std::make_shared<BezierPullOver>(node, parameters);
@@ -337,14 +347,16 @@ void LaneParkingPlanner::onTimer()
   std::vector<PullOverPath> path_candidates{};
   std::optional<Pose> closest_start_pose{};
   std::optional<std::vector<size_t>> sorted_indices_opt{std::nullopt};
+  std::optional<CandidateGenerationStats> candidate_generation_stats{std::nullopt};
   if (use_bus_stop_area && switch_bezier_) {
     bezier_planning_helper(
       local_planner_data, goal_candidates, upstream_module_output, current_lanes,
       closest_start_pose, path_candidates, sorted_indices_opt);
   } else {
+    candidate_generation_stats.emplace();
     normal_pullover_planning_helper(
       local_planner_data, goal_candidates, upstream_module_output, use_bus_stop_area, current_lanes,
-      closest_start_pose, path_candidates);
+      closest_start_pose, path_candidates, candidate_generation_stats.value());
   }
 
   // set response
@@ -355,9 +367,20 @@ void LaneParkingPlanner::onTimer()
     if (closest_start_pose) {
       response_.closest_start_pose = closest_start_pose;
     }
-    RCLCPP_INFO(
-      getLogger(), "generated %lu pull over path candidates",
-      response_.pull_over_path_candidates.size());
+    if (candidate_generation_stats) {
+      const auto & stats = candidate_generation_stats.value();
+      RCLCPP_INFO(
+        getLogger(),
+        "generated %lu pull over path candidates (planned %lu/%lu pairs with %lu threads in %f "
+        "[sec], %.1f pairs/s)",
+        response_.pull_over_path_candidates.size(), stats.num_planned, stats.num_pairs,
+        stats.num_threads, stats.elapsed_time, stats.throughput());
+    } else {
+      RCLCPP_INFO(
+        getLogger(), "generated %lu pull over path candidates",
+        response_.pull_over_path_candidates.size());
+    }
+    response_.candidate_generation_stats = candidate_generation_stats;
     response_.sorted_bezier_indices_opt = std::move(sorted_indices_opt);
     response_.lane_change_state = lane_change_state_req;
     response_.original_upstream_module_output = upstream_module_output;
@@ -368,8 +391,11 @@ void LaneParkingPlanner::normal_pullover_planning_helper(
   const std::shared_ptr<PlannerData> planner_data, const GoalCandidates & goal_candidates,
   const BehaviorModuleOutput & upstream_module_output, const bool use_bus_stop_area,
   const lanelet::ConstLanelets current_lanelets, std::optional<Pose> & closest_start_pose,
-  std::vector<PullOverPath> & path_candidates)
+  std::vector<PullOverPath> & path_candidates, CandidateGenerationStats & stats)
 {
+  autoware_utils::StopWatch timer;
+  timer.tic("candidate_generation");
+
   // todo: currently non centerline input path is supported only by shift pull over
   const bool is_center_line_input_path = goal_planner_utils::isReferencePath(
     upstream_module_output.reference_path, upstream_module_output.path, 0.1);
@@ -377,51 +403,108 @@ void LaneParkingPlanner::normal_pullover_planning_helper(
     getLogger(), "the input path of pull over planner is center line: %d",
     is_center_line_input_path);
 
-  double min_start_arc_length = std::numeric_limits<double>::infinity();
-  const auto planCandidatePaths = [&](
-                                    const std::shared_ptr<PullOverPlannerBase> & planner,
-                                    const GoalCandidate & goal_candidate) {
-    // normal pull_over
-    const auto pull_over_path =
-      planner->plan(goal_candidate, path_candidates.size(), planner_data, upstream_module_output);
-    if (pull_over_path) {
-      // calculate absolute maximum curvature of parking path(start pose to end pose) for path
-      // priority
-      path_candidates.push_back(*pull_over_path);
-      // calculate closest pull over start pose for stop path
-      const double start_arc_length =
-        lanelet::utils::getArcCoordinates(current_lanelets, pull_over_path->start_pose()).length;
-      if (start_arc_length < min_start_arc_length) {
-        min_start_arc_length = start_arc_length;
-        // closest start pose is stop point when not finding safe path
-        closest_start_pose = pull_over_path->start_pose();
-      }
-    }
+  // list the (planner index, goal candidate index) pairs in the order of the path priority
+  std::vector<std::pair<size_t, size_t>> pairs;
+  const auto is_available_planner = [&](const size_t planner_idx) {
+    // todo: temporary skip NON SHIFT planner when input path is not center line
+    return is_center_line_input_path ||
+           pull_over_planners_.at(planner_idx)->getPlannerType() == PullOverPlannerType::SHIFT;
   };
-
-  // plan candidate paths and set them to the member variable
   if (parameters_.path_priority == "efficient_path") {
-    for (const auto & planner : pull_over_planners_) {
-      // todo: temporary skip NON SHIFT planner when input path is not center line
-      if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
+    for (size_t planner_idx = 0; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+      if (!is_available_planner(planner_idx)) {
         continue;
       }
-      for (const auto & goal_candidate : goal_candidates) {
-        planCandidatePaths(planner, goal_candidate);
+      for (size_t goal_idx = 0; goal_idx < goal_candidates.size(); ++goal_idx) {
+        pairs.emplace_back(planner_idx, goal_idx);
       }
     }
   } else if (parameters_.path_priority == "close_goal") {
-    for (const auto & goal_candidate : goal_candidates) {
-      for (const auto & planner : pull_over_planners_) {
-        // todo: temporary skip NON SHIFT planner when input path is not center line
-        if (!is_center_line_input_path && planner->getPlannerType() != PullOverPlannerType::SHIFT) {
+    for (size_t goal_idx = 0; goal_idx < goal_candidates.size(); ++goal_idx) {
+      for (size_t planner_idx = 0; planner_idx < pull_over_planners_.size(); ++planner_idx) {
+        if (!is_available_planner(planner_idx)) {
+          continue;
+        }
+        pairs.emplace_back(planner_idx, goal_idx);
+      }
+    }
+  }
+
+  // The pairs are planned by the workers in any order. The generation ends after the shortest
+  // prefix of the pairs which has max_safe_path_candidates paths to a safe goal, which only
+  // depends on the results of the pairs, so that the candidates are the same as the serial ones.
+  const size_t max_safe_path_candidates =
+    static_cast<size_t>(std::max(0, parameters_.max_safe_path_candidates));
+  std::vector<std::optional<PullOverPath>> pair_paths(pairs.size());
+  std::vector<bool> is_pair_planned(pairs.size(), false);
+  std::atomic<size_t> next_pair_idx{0};
+  std::atomic<size_t> end_pair_idx{pairs.size()};
+  std::atomic<size_t> num_planned{0};
+  std::mutex planned_prefix_mutex;
+  size_t planned_prefix_size = 0;
+  size_t num_safe_paths_in_prefix = 0;
+  const auto plan_pairs = [&](const std::vector<std::shared_ptr<PullOverPlannerBase>> & planners) {
+    try {
+      for (size_t i = next_pair_idx++; i < end_pair_idx.load(); i = next_pair_idx++) {
+        const auto & [planner_idx, goal_idx] = pairs.at(i);
+        // the id is renumbered when the results are merged
+        const auto & planner = planners.at(planner_idx);
+        pair_paths.at(i) =
+          planner->plan(goal_candidates.at(goal_idx), i, planner_data, upstream_module_output);
+        ++num_planned;
+        if (max_safe_path_candidates == 0) {
           continue;
         }
-        planCandidatePaths(planner, goal_candidate);
+        std::lock_guard<std::mutex> guard(planned_prefix_mutex);
+        is_pair_planned.at(i) = true;
+        while (planned_prefix_size < end_pair_idx.load() &&
+               is_pair_planned.at(planned_prefix_size)) {
+          const auto & path = pair_paths.at(planned_prefix_size++);
+          if (path && path->modified_goal().is_safe) {
+            ++num_safe_paths_in_prefix;
+          }
+          if (num_safe_paths_in_prefix >= max_safe_path_candidates) {
+            end_pair_idx = planned_prefix_size;
+          }
+        }
       }
+    } catch (...) {
+      // stop the other workers, the exception is rethrown by parallelFor after the join
+      next_pair_idx = pairs.size();
+      throw;
     }
+  };
+
+  // one worker per planner set, the first one runs on this thread
+  const size_t num_workers = std::min(1 + worker_pull_over_planners_.size(), pairs.size());
+  autoware::universe_utils::parallelFor(
+    num_workers, num_workers, 1, [&](const size_t, const size_t, const size_t worker) {
+      plan_pairs(worker == 0 ? pull_over_planners_ : worker_pull_over_planners_.at(worker - 1));
+    });
+
+  // merge the results in the order of the pairs and calculate closest start pose
+  double min_start_arc_length = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < end_pair_idx.load(); ++i) {
+    auto & pull_over_path = pair_paths.at(i);
+    if (!pull_over_path) {
+      continue;
+    }
+    pull_over_path->set_id(path_candidates.size());
+    const double start_arc_length =
+      lanelet::utils::getArcCoordinates(current_lanelets, pull_over_path->start_pose()).length;
+    if (start_arc_length < min_start_arc_length) {
+      min_start_arc_length = start_arc_length;
+      // closest start pose is stop point when not finding safe path
+      closest_start_pose = pull_over_path->start_pose();
+    }
+    path_candidates.push_back(std::move(pull_over_path.value()));
   }
 
+  stats.num_threads = std::max<size_t>(1, num_workers);
+  stats.num_pairs = pairs.size();
+  stats.num_planned = num_planned.load();
+  stats.elapsed_time = timer.toc("candidate_generation");
+
   if (closest_start_pose) {
     const auto original_pose = planner_data->route_handler->getOriginalGoalPose();
     if (
@@ -2815,6 +2898,14 @@ void GoalPlannerModule::setDebugData(const PullOverContextData & context_data)
       marker.text +=
         "elapsed_time_from_safe_start: " + std::to_string(elapsed_time_from_safe_start) + "\n";
     }
+    const auto & stats_opt = context_data.lane_parking_response.candidate_generation_stats;
+    if (stats_opt) {
+      const auto & stats = stats_opt.value();
+      marker.text += "candidate_generation: " + std::to_string(stats.num_planned) + "/" +
+                     std::to_string(stats.num_pairs) + " pairs, " +
+                     std::to_string(stats.throughput()) + " pairs/s (" +
+                     std::to_string(stats.num_threads) + " threads)\n";
+    }
     marker_array.markers.push_back(marker);
     add_debug_marker(marker_array);
   }
@@ -158,6 +158,13 @@ GoalPlannerParameters GoalPlannerModuleManager::initGoalPlannerParameters(
       node->declare_parameter<double>(ns + "lane_departure_check_expansion_margin");
   }
 
+  // candidate generation
+  {
+    const std::string ns = base_ns + "pull_over.candidate_generation.";
+    p.candidate_generation_num_threads = node->declare_parameter<int>(ns + "num_threads");
+    p.max_safe_path_candidates = node->declare_parameter<int>(ns + "max_safe_path_candidates");
+  }
+
   // shift parking
   {
     const std::string ns = base_ns + "pull_over.shift_parking.";
@@ -0,0 +1,212 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <autoware/behavior_path_goal_planner_module/goal_planner_module.hpp>
+#include <autoware/behavior_path_goal_planner_module/goal_searcher.hpp>
+#include <autoware/behavior_path_goal_planner_module/manager.hpp>
+#include <autoware/behavior_path_planner_common/data_manager.hpp>
+#include <autoware/behavior_path_planner_common/utils/path_utils.hpp>
+#include <autoware/vehicle_info_utils/vehicle_info_utils.hpp>
+#include <autoware_test_utils/autoware_test_utils.hpp>
+#include <autoware_test_utils/mock_data_parser.hpp>
+
+#include <autoware_planning_msgs/msg/lanelet_route.hpp>
+#include <geometry_msgs/msg/accel_with_covariance_stamped.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+
+#include <gtest/gtest.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace autoware::behavior_path_planner
+{
+namespace
+{
+std::string getShareDirectory(const std::string & package_name)
+{
+  return ament_index_cpp::get_package_share_directory(package_name);
+}
+
+rclcpp::Node::SharedPtr makeNode()
+{
+  auto node_options = rclcpp::NodeOptions{};
+  node_options.parameter_overrides(
+    std::vector<rclcpp::Parameter>{{"launch_modules", std::vector<std::string>{}}});
+  node_options.arguments(
+    std::vector<std::string>{
+      "--ros-args", "--params-file",
+      getShareDirectory("autoware_behavior_path_planner") +
+        "/config/behavior_path_planner.param.yaml",
+      "--params-file",
+      getShareDirectory("autoware_behavior_path_planner") +
+        "/config/drivable_area_expansion.param.yaml",
+      "--params-file",
+      getShareDirectory("autoware_behavior_path_planner") +
+        "/config/scene_module_manager.param.yaml",
+      "--params-file",
+      getShareDirectory("autoware_test_utils") + "/config/test_common.param.yaml",
+      "--params-file",
+      getShareDirectory("autoware_test_utils") + "/config/test_nearest_search.param.yaml",
+      "--params-file",
+      getShareDirectory("autoware_test_utils") + "/config/test_vehicle_info.param.yaml",
+      "--params-file",
+      getShareDirectory("autoware_behavior_path_goal_planner_module") +
+        "/config/goal_planner.param.yaml"});
+  return rclcpp::Node::make_shared("test_candidate_generation", node_options);
+}
+
+std::shared_ptr<PlannerData> makePlannerData(rclcpp::Node & node)
+{
+  const auto map_bin_msg = autoware::test_utils::make_map_bin_msg(
+    autoware::test_utils::get_absolute_path_to_lanelet_map(
+      "autoware_test_utils", "road_shoulder/lanelet2_map.osm"),
+    0.5);
+  const YAML::Node config = YAML::LoadFile(
+    getShareDirectory("autoware_behavior_path_goal_planner_module") +
+    "/config/sample_planner_data_case1.yaml");
+
+  auto planner_data = std::make_shared<PlannerData>();
+  planner_data->init_parameters(node);
+  planner_data->route_handler->setMap(map_bin_msg);
+  auto route = autoware::test_utils::parse<autoware_planning_msgs::msg::LaneletRoute>(
+    config["route"]);
+  route.allow_modification = true;
+  planner_data->route_handler->setRoute(route);
+  planner_data->self_odometry = autoware::test_utils::create_const_shared_ptr(
+    autoware::test_utils::parse<nav_msgs::msg::Odometry>(config["self_odometry"]));
+  planner_data->self_acceleration = autoware::test_utils::create_const_shared_ptr(
+    autoware::test_utils::parse<geometry_msgs::msg::AccelWithCovarianceStamped>(
+      config["self_acceleration"]));
+  return planner_data;
+}
+
+LaneParkingResponse generateCandidates(
+  rclcpp::Node & node, const GoalPlannerParameters & parameters,
+  const LaneParkingRequest & request)
+{
+  std::mutex lane_parking_mutex;
+  const std::optional<LaneParkingRequest> request_opt{request};
+  LaneParkingResponse response;
+  std::atomic<bool> is_lane_parking_cb_running{false};
+  LaneParkingPlanner planner(
+    node, lane_parking_mutex, request_opt, response, is_lane_parking_cb_running,
+    node.get_logger(), parameters);
+  planner.onTimer();
+  return response;
+}
+
+void expectSameCandidates(
+  const LaneParkingResponse & response, const LaneParkingResponse & expected,
+  const std::string & message)
+{
+  const auto & candidates = response.pull_over_path_candidates;
+  const auto & expected_candidates = expected.pull_over_path_candidates;
+  ASSERT_EQ(candidates.size(), expected_candidates.size()) << message;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    EXPECT_EQ(candidates.at(i).id(), expected_candidates.at(i).id()) << message;
+    EXPECT_EQ(candidates.at(i).goal_id(), expected_candidates.at(i).goal_id()) << message;
+    EXPECT_EQ(candidates.at(i).type(), expected_candidates.at(i).type()) << message;
+    EXPECT_EQ(candidates.at(i).start_pose(), expected_candidates.at(i).start_pose()) << message;
+    EXPECT_EQ(
+      candidates.at(i).full_path().points.size(),
+      expected_candidates.at(i).full_path().points.size())
+      << message;
+  }
+  ASSERT_EQ(response.closest_start_pose.has_value(), expected.closest_start_pose.has_value())
+    << message;
+  if (expected.closest_start_pose) {
+    EXPECT_EQ(response.closest_start_pose.value(), expected.closest_start_pose.value()) << message;
+  }
+}
+}  // namespace
+
+TEST(CandidateGeneration, ParallelGenerationMatchesSerialGeneration)
+{
+  rclcpp::init(0, nullptr);
+  const auto node = makeNode();
+  const auto planner_data = makePlannerData(*node);
+  const auto base_parameters =
+    GoalPlannerModuleManager::initGoalPlannerParameters(node.get(), "goal_planner.");
+  const auto vehicle_footprint =
+    autoware::vehicle_info_utils::VehicleInfoUtils(*node).getVehicleInfo().createFootprint();
+
+  lanelet::ConstLanelet current_route_lanelet;
+  planner_data->route_handler->getClosestLaneletWithinRoute(
+    planner_data->self_odometry->pose.pose, &current_route_lanelet);
+  const auto upstream_module_output =
+    utils::getReferencePath(current_route_lanelet, planner_data);
+
+  const auto goal_searcher =
+    GoalSearcher::create(base_parameters, vehicle_footprint, planner_data);
+  const auto goal_candidates = goal_searcher.search(planner_data, false);
+  ASSERT_FALSE(goal_candidates.empty());
+
+  LaneParkingRequest request(vehicle_footprint, goal_candidates, upstream_module_output, false);
+  request.update(
+    *planner_data, ModuleStatus::RUNNING, upstream_module_output, std::nullopt,
+    PathDecisionState{}, true, LaneChangeContext::NotLaneChanging{});
+
+  for (const std::string path_priority : {"efficient_path", "close_goal"}) {
+    size_t num_safe_paths = 0;
+    for (const int max_safe_path_candidates : {0, 1, 3}) {
+      auto parameters = base_parameters;
+      parameters.path_priority = path_priority;
+      parameters.max_safe_path_candidates = max_safe_path_candidates;
+      parameters.candidate_generation_num_threads = 1;
+      const auto expected = generateCandidates(*node, parameters, request);
+      ASSERT_FALSE(expected.pull_over_path_candidates.empty()) << path_priority;
+      ASSERT_TRUE(expected.candidate_generation_stats.has_value()) << path_priority;
+      const auto & expected_stats = expected.candidate_generation_stats.value();
+
+      // all the pairs are planned without the limit, and fewer with a small limit
+      if (max_safe_path_candidates == 0) {
+        EXPECT_EQ(expected_stats.num_planned, expected_stats.num_pairs) << path_priority;
+        num_safe_paths = static_cast<size_t>(std::count_if(
+          expected.pull_over_path_candidates.begin(), expected.pull_over_path_candidates.end(),
+          [](const auto & path) { return path.modified_goal().is_safe; }));
+      } else if (static_cast<size_t>(max_safe_path_candidates) < num_safe_paths) {
+        EXPECT_LT(expected_stats.num_planned, expected_stats.num_pairs)
+          << path_priority << ", max_safe_path_candidates " << max_safe_path_candidates;
+      }
+
+      parameters.candidate_generation_num_threads = 4;
+      for (int trial = 0; trial < 3; ++trial) {
+        const auto message = path_priority + ", max_safe_path_candidates " +
+                             std::to_string(max_safe_path_candidates) + ", trial " +
+                             std::to_string(trial);
+        const auto response = generateCandidates(*node, parameters, request);
+        expectSameCandidates(response, expected, message);
+        // the workers may plan a few pairs past the cutoff of the serial generation
+        ASSERT_TRUE(response.candidate_generation_stats.has_value()) << message;
+        const auto & stats = response.candidate_generation_stats.value();
+        EXPECT_GE(stats.num_planned, expected_stats.num_planned) << message;
+        EXPECT_LE(stats.num_planned, stats.num_pairs) << message;
+      }
+    }
+    // the limit of 1 stops before the last pair only if there are several safe paths
+    EXPECT_GE(num_safe_paths, 2u) << path_priority;
+  }
+
+  rclcpp::shutdown();
+}
+
+}  // namespace autoware::behavior_path_planner
@@ -16,6 +16,7 @@
 
 #include "autoware/behavior_path_lane_change_module/base_class.hpp"
 #include "autoware/behavior_path_lane_change_module/structs/data.hpp"
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check_context.hpp"
 
 #include <memory>
 #include <string>
@@ -31,6 +32,8 @@ using autoware::behavior_path_planner::utils::path_safety_checker::
   PoseWithVelocityAndPolygonStamped;
 using autoware::behavior_path_planner::utils::path_safety_checker::PoseWithVelocityStamped;
 using autoware::behavior_path_planner::utils::path_safety_checker::PredictedPathWithPolygon;
+using autoware::behavior_path_planner::utils::path_safety_checker::SafetyCheckBroadPhase;
+using autoware::behavior_path_planner::utils::path_safety_checker::SafetyCheckContext;
 using autoware::route_handler::Direction;
 using autoware_internal_planning_msgs::msg::PathWithLaneId;
 using geometry_msgs::msg::Point;
@@ -141,17 +144,20 @@ protected:
   bool get_path_using_frenet(
     const std::vector<LaneChangePhaseMetrics> & prepare_metrics,
     const lane_change::TargetObjects & target_objects,
+    const SafetyCheckContext & safety_check_context,
     const std::vector<std::vector<int64_t>> & sorted_lane_ids,
     LaneChangePaths & candidate_paths) const;
 
   bool get_path_using_path_shifter(
     const std::vector<LaneChangePhaseMetrics> & prepare_metrics,
     const lane_change::TargetObjects & target_objects,
+    const SafetyCheckContext & safety_check_context,
     const std::vector<std::vector<int64_t>> & sorted_lane_ids,
     LaneChangePaths & candidate_paths) const;
 
   bool check_candidate_path_safety(
-    const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects) const;
+    const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects,
+    const SafetyCheckContext & safety_check_context) const;
 
   std::optional<PathWithLaneId> compute_terminal_lane_change_path() const;
 
@@ -162,19 +168,22 @@ protected:
     const std::vector<std::vector<PoseWithVelocityStamped>> & ego_predicted_paths,
     const ExtendedPredictedObjects & objects,
     const utils::path_safety_checker::RSSparams & rss_params,
-    CollisionCheckDebugMap & debug_dataconst, const bool is_approved) const;
+    CollisionCheckDebugMap & debug_dataconst, const bool is_approved,
+    const SafetyCheckContext * safety_check_context) const;
 
   PathSafetyStatus isLaneChangePathSafe(
     const LaneChangePath & lane_change_path,
     const std::vector<std::vector<PoseWithVelocityStamped>> & ego_predicted_paths,
     const lane_change::TargetObjects & collision_check_objects,
     const utils::path_safety_checker::RSSparams & rss_params, CollisionCheckDebugMap & debug_data,
-    const bool is_approved = false) const;
+    const bool is_approved = false,
+    const SafetyCheckContext * safety_check_context = nullptr) const;
 
   bool is_colliding(
     const LaneChangePath & lane_change_path, const ExtendedPredictedObject & obj,
     const std::vector<PoseWithVelocityStamped> & ego_predicted_path, const RSSparams & rss_param,
-    CollisionCheckDebugMap & debug_data, const bool is_approved) const;
+    CollisionCheckDebugMap & debug_data, const bool is_approved,
+    const SafetyCheckBroadPhase * broad_phase = nullptr) const;
 
   double get_max_velocity_for_safety_check() const;
 
@@ -1144,6 +1144,8 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
   const auto & current_lanes = get_current_lanes();
 
   const auto target_objects = get_target_objects(filtered_objects_, current_lanes);
+  // the objects are indexed once for the safety checks of all the candidate paths
+  const SafetyCheckContext safety_check_context{target_objects.leading, target_objects.trailing};
 
   const auto prepare_phase_metrics = get_prepare_metrics();
 
@@ -1152,16 +1154,18 @@ bool NormalLaneChange::get_lane_change_paths(LaneChangePaths & candidate_paths)
     common_data_ptr_->lc_param_ptr->frenet.enable &&
     common_data_ptr_->transient_data.is_ego_near_current_terminal_start) {
     return get_path_using_frenet(
-      prepare_phase_metrics, target_objects, sorted_lane_ids, candidate_paths);
+      prepare_phase_metrics, target_objects, safety_check_context, sorted_lane_ids,
+      candidate_paths);
   }
 
   return get_path_using_path_shifter(
-    prepare_phase_metrics, target_objects, sorted_lane_ids, candidate_paths);
+    prepare_phase_metrics, target_objects, safety_check_context, sorted_lane_ids, candidate_paths);
 }
 
 bool NormalLaneChange::get_path_using_frenet(
   const std::vector<LaneChangePhaseMetrics> & prepare_metrics,
   const lane_change::TargetObjects & target_objects,
+  const SafetyCheckContext & safety_check_context,
   const std::vector<std::vector<int64_t>> & sorted_lane_ids,
   LaneChangePaths & candidate_paths) const
 {
@@ -1198,7 +1202,7 @@ bool NormalLaneChange::get_path_using_frenet(
     }
 
     try {
-      if (check_candidate_path_safety(*candidate_path_opt, target_objects)) {
+      if (check_candidate_path_safety(*candidate_path_opt, target_objects, safety_check_context)) {
         RCLCPP_DEBUG(
           logger_, "Found safe path after %lu candidate(s). Total time: %2.2f[us]",
           frenet_candidates.size(), stop_watch_.toc(__func__));
@@ -1226,6 +1230,7 @@ bool NormalLaneChange::get_path_using_frenet(
 bool NormalLaneChange::get_path_using_path_shifter(
   const std::vector<LaneChangePhaseMetrics> & prepare_metrics,
   const lane_change::TargetObjects & target_objects,
+  const SafetyCheckContext & safety_check_context,
   const std::vector<std::vector<int64_t>> & sorted_lane_ids,
   LaneChangePaths & candidate_paths) const
 {
@@ -1326,7 +1331,7 @@ bool NormalLaneChange::get_path_using_path_shifter(
       debug_metrics.lc_metrics.back().second = static_cast<int>(candidate_paths.size()) - 1;
 
       try {
-        if (check_candidate_path_safety(candidate_path, target_objects)) {
+        if (check_candidate_path_safety(candidate_path, target_objects, safety_check_context)) {
           debug_print_lat("ACCEPT!!!: it is valid and safe!");
           return true;
         }
@@ -1344,7 +1349,8 @@ bool NormalLaneChange::get_path_using_path_shifter(
 }
 
 bool NormalLaneChange::check_candidate_path_safety(
-  const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects) const
+  const LaneChangePath & candidate_path, const lane_change::TargetObjects & target_objects,
+  const SafetyCheckContext & safety_check_context) const
 {
   const auto is_stuck = common_data_ptr_->transient_data.is_ego_stuck;
   if (utils::lane_change::has_overtaking_turn_lane_object(
@@ -1383,13 +1389,14 @@ bool NormalLaneChange::check_candidate_path_safety(
 
   const auto safety_check_with_normal_rss = isLaneChangePathSafe(
     candidate_path, ego_predicted_paths, target_objects,
-    common_data_ptr_->lc_param_ptr->safety.rss_params, lane_change_debug_.collision_check_objects);
+    common_data_ptr_->lc_param_ptr->safety.rss_params, lane_change_debug_.collision_check_objects,
+    false, &safety_check_context);
 
   if (!safety_check_with_normal_rss.is_safe && is_stuck) {
     const auto safety_check_with_stuck_rss = isLaneChangePathSafe(
       candidate_path, ego_predicted_paths, target_objects,
       common_data_ptr_->lc_param_ptr->safety.rss_params_for_stuck,
-      lane_change_debug_.collision_check_objects);
+      lane_change_debug_.collision_check_objects, false, &safety_check_context);
     return safety_check_with_stuck_rss.is_safe;
   }
 
@@ -1746,22 +1753,33 @@ NormalLaneChange::find_colliding_object_if_all_paths_collide(
   const std::vector<std::vector<PoseWithVelocityStamped>> & ego_predicted_paths,
   const ExtendedPredictedObjects & objects,
   const utils::path_safety_checker::RSSparams & rss_params, CollisionCheckDebugMap & debug_data,
-  const bool is_approved) const
+  const bool is_approved, const SafetyCheckContext * safety_check_context) const
 {
   std::vector<ExtendedPredictedObject> colliding_objects;
   std::unordered_set<size_t> objects_idx;
 
-  const auto check_for_collision = [&](const auto & ego_predicted_path, const auto & object) {
-    return is_colliding(
-      lane_change_path, object, ego_predicted_path, rss_params, debug_data, is_approved);
-  };
-
   const auto check_for_collisions = [&](const auto & ego_predicted_path) {
     std::vector<ExtendedPredictedObject> current_colliding_objects;
     current_colliding_objects.reserve(objects.size());
 
+    // same parameters as the checks of is_colliding()
+    const auto broad_phase_opt = std::invoke([&]() -> std::optional<SafetyCheckBroadPhase> {
+      if (!safety_check_context) {
+        return std::nullopt;
+      }
+      constexpr auto hysteresis_factor{1.0};
+      const auto & safety_params = common_data_ptr_->lc_param_ptr->safety;
+      return safety_check_context->query(
+        lane_change_path.path, ego_predicted_path, common_data_ptr_->bpp_param_ptr->vehicle_info,
+        {rss_params, safety_params.rss_params_for_prepare, safety_params.rss_params_for_parked},
+        hysteresis_factor, get_max_velocity_for_safety_check());
+    });
+    const auto * broad_phase = broad_phase_opt ? &broad_phase_opt.value() : nullptr;
+
     for (const auto & [idx, object] : objects | ranges::views::enumerate) {
-      const auto is_colliding_object = check_for_collision(ego_predicted_path, object);
+      const auto is_colliding_object = is_colliding(
+        lane_change_path, object, ego_predicted_path, rss_params, debug_data, is_approved,
+        broad_phase);
       if (!is_colliding_object) {
         continue;
       }
@@ -1794,7 +1812,7 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
   const std::vector<std::vector<PoseWithVelocityStamped>> & ego_predicted_paths,
   const lane_change::TargetObjects & collision_check_objects,
   const utils::path_safety_checker::RSSparams & rss_params, CollisionCheckDebugMap & debug_data,
-  const bool is_approved) const
+  const bool is_approved, const SafetyCheckContext * safety_check_context) const
 {
   autoware_utils::ScopedTimeTrack st(__func__, *time_keeper_);
   constexpr auto is_safe = true;
@@ -1806,7 +1824,8 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
   const auto check_for_colliding_objects =
     [&](decltype(ego_predicted_paths) & ego_pred_paths, const auto & objects) {
       return find_colliding_object_if_all_paths_collide(
-        lane_change_path, ego_pred_paths, objects, rss_params, debug_data, is_approved);
+        lane_change_path, ego_pred_paths, objects, rss_params, debug_data, is_approved,
+        safety_check_context);
     };
 
   const auto check_for_moving_objects = [this](const auto & object) {
@@ -1831,7 +1850,8 @@ PathSafetyStatus NormalLaneChange::isLaneChangePathSafe(
 bool NormalLaneChange::is_colliding(
   const LaneChangePath & lane_change_path, const ExtendedPredictedObject & obj,
   const std::vector<PoseWithVelocityStamped> & ego_predicted_path, const RSSparams & rss_param,
-  CollisionCheckDebugMap & debug_data, const bool is_approved) const
+  CollisionCheckDebugMap & debug_data, const bool is_approved,
+  const SafetyCheckBroadPhase * broad_phase) const
 {
   constexpr auto is_colliding{true};
 
@@ -1875,6 +1895,9 @@ bool NormalLaneChange::is_colliding(
     std::vector<autoware_utils_geometry::Polygon2d> collided_polygons{};
     collided_polygons.reserve(obj_path.path.size());
     for (const auto & obj_pose_with_poly : obj_path.path) {
+      if (broad_phase && !broad_phase->may_collide(obj, obj_pose_with_poly)) {
+        continue;
+      }
       CollisionCheckDebug * debug_ptr = collided_polygons.empty() ? &debug : nullptr;
       const auto & selected_rss_param =
         obj_pose_with_poly.time < prepare_duration
@@ -0,0 +1,215 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare checkSafetyWithRSS() without and with a SafetyCheckContext for 50 objects driving on a
+// multi-lane road in both directions and 30 lane change like candidate paths of ego, i.e. one
+// planning cycle of a module checking all its candidates. The context is built once per cycle and
+// its construction is included in the timings. Whether both give the same decision for every
+// candidate is printed next to the timings.
+
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check.hpp"
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check_context.hpp"
+
+#include <autoware_utils/geometry/boost_polygon_utils.hpp>
+#include <autoware_utils/geometry/geometry.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::behavior_path_planner::BehaviorPathPlannerParameters;
+using autoware::behavior_path_planner::utils::path_safety_checker::checkSafetyWithRSS;
+using autoware::behavior_path_planner::utils::path_safety_checker::CollisionCheckDebugMap;
+using autoware::behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObject;
+using autoware::behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObjects;
+using autoware::behavior_path_planner::utils::path_safety_checker::PoseWithVelocityStamped;
+using autoware::behavior_path_planner::utils::path_safety_checker::PredictedPathWithPolygon;
+using autoware::behavior_path_planner::utils::path_safety_checker::RSSparams;
+using autoware::behavior_path_planner::utils::path_safety_checker::SafetyCheckContext;
+using autoware_internal_planning_msgs::msg::PathPointWithLaneId;
+using autoware_internal_planning_msgs::msg::PathWithLaneId;
+using geometry_msgs::msg::Pose;
+
+namespace
+{
+constexpr int nb_iterations = 20;
+constexpr size_t nb_objects = 50;
+constexpr size_t nb_candidates = 30;
+constexpr double lane_width = 3.5;
+constexpr double time_horizon = 10.0;
+constexpr double time_resolution = 0.5;
+
+Pose make_pose(const double x, const double y, const double yaw)
+{
+  Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation = autoware_utils::create_quaternion_from_yaw(yaw);
+  return pose;
+}
+
+// 3 lanes in each direction along the x axis, the objects drive at a constant velocity
+ExtendedPredictedObjects make_objects(std::mt19937 & gen)
+{
+  std::uniform_real_distribution<double> x_dist(-300.0, 600.0);
+  std::uniform_int_distribution<int> lane_dist(-3, 2);
+  std::uniform_real_distribution<double> velocity_dist(0.0, 15.0);
+
+  ExtendedPredictedObjects objects;
+  for (size_t i = 0; i < nb_objects; ++i) {
+    ExtendedPredictedObject object;
+    object.uuid.uuid.at(0) = static_cast<uint8_t>(i + 1);
+    object.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = 4.5;
+    object.shape.dimensions.y = 1.8;
+    const int lane = lane_dist(gen);
+    const double y = (lane + 0.5) * lane_width;
+    const double yaw = lane < 0 ? M_PI : 0.0;
+    const double velocity = velocity_dist(gen);
+    object.initial_pose = make_pose(x_dist(gen), y, yaw);
+    object.initial_polygon = autoware_utils::to_polygon2d(object.initial_pose, object.shape);
+
+    PredictedPathWithPolygon predicted_path;
+    predicted_path.confidence = 1.0;
+    for (double t = 0.0; t <= time_horizon + 1e-3; t += time_resolution) {
+      const auto pose = make_pose(
+        object.initial_pose.position.x + std::cos(yaw) * velocity * t, y, yaw);
+      predicted_path.path.emplace_back(
+        t, pose, velocity, autoware_utils::to_polygon2d(pose, object.shape));
+    }
+    object.predicted_paths.push_back(predicted_path);
+    objects.push_back(object);
+  }
+  return objects;
+}
+
+// lane change from the first lane to the second one with various lengths and velocities
+std::vector<std::vector<PoseWithVelocityStamped>> make_candidates()
+{
+  std::vector<std::vector<PoseWithVelocityStamped>> candidates;
+  for (size_t i = 0; i < nb_candidates; ++i) {
+    const double velocity = 5.0 + static_cast<double>(i % 6);
+    const double lane_changing_time = 3.0 + static_cast<double>(i / 6);
+    std::vector<PoseWithVelocityStamped> path;
+    for (double t = 0.0; t <= time_horizon + 1e-3; t += time_resolution) {
+      const double ratio = std::min(t / lane_changing_time, 1.0);
+      const double y = 0.5 * lane_width + lane_width * (1.0 - std::cos(M_PI * ratio)) / 2.0;
+      path.emplace_back(t, make_pose(velocity * t, y, 0.0), velocity);
+    }
+    candidates.push_back(path);
+  }
+  return candidates;
+}
+
+PathWithLaneId make_planned_path()
+{
+  PathWithLaneId path;
+  for (double x = -50.0; x <= 200.0; x += 1.0) {
+    PathPointWithLaneId point;
+    point.point.pose = make_pose(x, 1.5 * lane_width, 0.0);
+    path.points.push_back(point);
+  }
+  return path;
+}
+}  // namespace
+
+int main()
+{
+  std::mt19937 gen(0);
+  const auto objects = make_objects(gen);
+  const auto candidates = make_candidates();
+  const auto planned_path = make_planned_path();
+
+  BehaviorPathPlannerParameters parameters;
+  parameters.vehicle_info.max_longitudinal_offset_m = 3.8;
+  parameters.vehicle_info.min_longitudinal_offset_m = -1.0;
+  parameters.vehicle_info.rear_overhang_m = 1.0;
+  parameters.vehicle_info.vehicle_width_m = 1.9;
+  parameters.vehicle_info.max_lateral_offset_m = 0.95;
+  parameters.vehicle_info.min_lateral_offset_m = -0.95;
+
+  // lane change execution parameters
+  RSSparams rss_params;
+  rss_params.rear_vehicle_reaction_time = 2.0;
+  rss_params.rear_vehicle_safety_time_margin = 1.0;
+  rss_params.lateral_distance_max_threshold = 2.0;
+  rss_params.longitudinal_distance_min_threshold = 3.0;
+  rss_params.front_vehicle_deceleration = -1.0;
+  rss_params.rear_vehicle_deceleration = -1.0;
+  const double hysteresis_factor = 1.0;
+  const double yaw_difference_th = M_PI_2;
+
+  for (const auto & policy : {"rectangle", "along_path"}) {
+    rss_params.extended_polygon_policy = policy;
+    std::vector<bool> is_safe_pairwise(nb_candidates);
+    std::vector<bool> is_safe_context(nb_candidates);
+
+    const auto pairwise_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nb_iterations; ++i) {
+      for (size_t c = 0; c < nb_candidates; ++c) {
+        CollisionCheckDebugMap debug_map;
+        is_safe_pairwise.at(c) = checkSafetyWithRSS(
+          planned_path, candidates.at(c), objects, debug_map, parameters, rss_params, true,
+          hysteresis_factor, yaw_difference_th);
+      }
+    }
+    const auto pairwise_end = std::chrono::steady_clock::now();
+
+    const auto context_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nb_iterations; ++i) {
+      const SafetyCheckContext context(objects);
+      for (size_t c = 0; c < nb_candidates; ++c) {
+        CollisionCheckDebugMap debug_map;
+        is_safe_context.at(c) = checkSafetyWithRSS(
+          planned_path, candidates.at(c), objects, debug_map, parameters, rss_params, true,
+          hysteresis_factor, yaw_difference_th, context);
+      }
+    }
+    const auto context_end = std::chrono::steady_clock::now();
+
+    const SafetyCheckContext context(objects);
+    size_t num_hits = 0;
+    for (const auto & candidate : candidates) {
+      num_hits += context
+                    .query(
+                      planned_path, candidate, parameters.vehicle_info, {rss_params},
+                      hysteresis_factor, std::numeric_limits<double>::max())
+                    .num_hits();
+    }
+
+    const auto to_ms = [](const auto duration) {
+      return std::chrono::duration<double, std::milli>(duration).count() / nb_iterations;
+    };
+    size_t nb_safe = 0;
+    for (const bool is_safe : is_safe_pairwise) {
+      nb_safe += is_safe ? 1 : 0;
+    }
+    std::cout << policy << " policy, " << nb_objects << " objects x " << nb_candidates
+              << " candidates (" << nb_safe << " safe):\n"
+              << "  pairwise: " << to_ms(pairwise_end - pairwise_start) << " ms/cycle\n"
+              << "  context : " << to_ms(context_end - context_start)
+              << " ms/cycle (broad phase hits: " << num_hits << " / "
+              << context.size() * nb_candidates << " object poses)\n"
+              << "  same decisions: " << (is_safe_pairwise == is_safe_context ? "yes" : "NO")
+              << std::endl;
+  }
+
+  return 0;
+}
@@ -21,6 +21,8 @@
 #include <geometry_msgs/msg/pose_array.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 
+#include <cstdint>
+#include <optional>
 #include <vector>
 
 namespace autoware::behavior_path_planner
@@ -91,6 +93,11 @@ struct OccupancyGridMapParam
   // costmap configs
   int theta_size{0};          // discretized angle table size [-]
   int obstacle_threshold{0};  // obstacle threshold on grid [-]
+
+  // resolve most poses with the distance transform of the costmap instead of walking the
+  // footprint, the result is the same. setMap takes longer, so it pays off when many poses are
+  // checked on the same map
+  bool use_distance_transform{false};
 };
 
 struct PlannerWaypoint
@@ -108,7 +115,12 @@ public:
   OccupancyGridBasedCollisionDetector & operator=(const OccupancyGridBasedCollisionDetector &) =
     default;
   OccupancyGridBasedCollisionDetector & operator=(OccupancyGridBasedCollisionDetector &&) = delete;
-  void setParam(const OccupancyGridMapParam & param) { param_ = param; };
+  void setParam(const OccupancyGridMapParam & param)
+  {
+    param_ = param;
+    footprint_bounds_table_.clear();
+    covering_circles_table_.clear();
+  };
   [[nodiscard]] OccupancyGridMapParam getParam() const { return param_; };
   void setMap(const nav_msgs::msg::OccupancyGrid & costmap);
   [[nodiscard]] nav_msgs::msg::OccupancyGrid getMap() const { return costmap_; };
@@ -143,6 +155,45 @@ protected:
    */
   void compute_collision_indexes(int theta_index, std::vector<IndexXY> & indexes);
 
+  struct CoveringCircle
+  {
+    IndexXY center;               // offset from the base index, a cell of the footprint
+    int64_t covering_radius_sq;   // squared distance to the farthest cell it covers [cell^2]
+    int64_t inscribed_radius_sq;  // squared distance to the nearest cell out of footprint [cell^2]
+  };
+
+  struct FootprintBounds
+  {
+    IndexXY min;
+    IndexXY max;
+  };
+
+  /**
+   * @brief Computes the squared Euclidean distance from each cell to the nearest obstacle cell.
+   * It is exact up to the largest radius of the covering circles and saturated beyond it.
+   */
+  void compute_distance_transform();
+
+  /**
+   * @brief Covers the footprint cells of a theta index with a few circles along the vehicle.
+   * @param theta_index The discretized orientation index for yaw.
+   * @param indexes_2d The footprint cells given by compute_collision_indexes().
+   * @param bounds The output bounding box of the footprint cells.
+   * @param circles The output circles, each footprint cell is covered by at least one of them.
+   */
+  void compute_covering_circles(
+    int theta_index, const std::vector<IndexXY> & indexes_2d, FootprintBounds & bounds,
+    std::vector<CoveringCircle> & circles) const;
+
+  /**
+   * @brief Detects a collision with the distance from the center of the covering circles to the
+   * nearest obstacle.
+   * @return The same result as walking the footprint, or std::nullopt if an obstacle is between
+   * the inscribed and the covering radius of a circle or the footprint is out of range.
+   */
+  [[nodiscard]] std::optional<bool> detect_collision_with_distance_transform(
+    const IndexXYT & base_index) const;
+
   [[nodiscard]] inline bool is_out_of_range(const IndexXYT & index) const
   {
     if (index.x < 0 || static_cast<int>(costmap_.info.width) <= index.x) {
@@ -171,6 +222,14 @@ protected:
 
   // is_obstacle's table
   std::vector<std::vector<bool>> is_obstacle_table_;
+
+  // squared distance to the nearest obstacle of each cell in row-major order [cell^2]
+  std::vector<int32_t> squared_distance_table_;
+
+  // footprint bounds and covering circles cache for each theta index
+  std::vector<FootprintBounds> footprint_bounds_table_;
+  std::vector<std::vector<CoveringCircle>> covering_circles_table_;
+  double covering_circles_resolution_{0.0};
 };
 }  // namespace autoware::behavior_path_planner
 
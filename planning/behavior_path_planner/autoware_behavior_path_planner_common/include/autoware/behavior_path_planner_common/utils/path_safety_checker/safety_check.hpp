@@ -17,6 +17,7 @@
 
 #include "autoware/behavior_path_planner_common/data_manager.hpp"
 #include "autoware/behavior_path_planner_common/utils/path_safety_checker/path_safety_checker_parameters.hpp"
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check_context.hpp"
 
 #include <autoware_utils/geometry/boost_geometry.hpp>
 #include <autoware_utils/geometry/geometry.hpp>
@@ -174,6 +175,19 @@ bool checkSafetyWithRSS(
   const bool check_all_predicted_path, const double hysteresis_factor,
   const double yaw_difference_th);
 
+/**
+ * @brief Same as above, but the exact collision checks only run on the poses of the objects which
+ *        may collide with the ego predicted path according to the broad phase of the context.
+ * @param context Safety check context built from the objects in the planning cycle.
+ */
+bool checkSafetyWithRSS(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
+  const std::vector<ExtendedPredictedObject> & objects, CollisionCheckDebugMap & debug_map,
+  const BehaviorPathPlannerParameters & parameters, const RSSparams & rss_params,
+  const bool check_all_predicted_path, const double hysteresis_factor,
+  const double yaw_difference_th, const SafetyCheckContext & context);
+
 /**
  * @brief Iterate the points in the ego and target's predicted path and
  *        perform safety check for each of the iterated points.
@@ -196,6 +210,20 @@ bool checkCollision(
   const BehaviorPathPlannerParameters & common_parameters, const RSSparams & rss_parameters,
   const double hysteresis_factor, const double yaw_difference_th, CollisionCheckDebug & debug);
 
+/**
+ * @brief Same as above, skipping the points of the target's predicted path which are far from the
+ *        ego predicted path according to the broad phase.
+ * @param broad_phase Result of SafetyCheckContext::query() for the predicted path of the ego.
+ */
+bool checkCollision(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
+  const ExtendedPredictedObject & target_object,
+  const PredictedPathWithPolygon & target_object_path,
+  const BehaviorPathPlannerParameters & common_parameters, const RSSparams & rss_parameters,
+  const double hysteresis_factor, const double yaw_difference_th, CollisionCheckDebug & debug,
+  const SafetyCheckBroadPhase & broad_phase);
+
 std::optional<Polygon2d> check_collision(
   const PathWithLaneId & planned_path, const VehicleInfo & vehicle_info,
   const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
@@ -226,6 +254,21 @@ std::vector<Polygon2d> get_collided_polygons(
   const RSSparams & rss_parameters, const double hysteresis_factor, const double max_velocity_limit,
   const double yaw_difference_th, CollisionCheckDebug & debug);
 
+/**
+ * @brief Same as above, skipping the points of the target's predicted path which are far from the
+ *        ego predicted path according to the broad phase.
+ * @param broad_phase Result of SafetyCheckContext::query() for the predicted path of the ego.
+ * @return List of polygon which collision is expected.
+ */
+std::vector<Polygon2d> get_collided_polygons(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
+  const ExtendedPredictedObject & target_object,
+  const PredictedPathWithPolygon & target_object_path, const VehicleInfo & vehicle_info,
+  const RSSparams & rss_parameters, const double hysteresis_factor, const double max_velocity_limit,
+  const double yaw_difference_th, CollisionCheckDebug & debug,
+  const SafetyCheckBroadPhase & broad_phase);
+
 bool checkPolygonsIntersects(
   const std::vector<Polygon2d> & polys_1, const std::vector<Polygon2d> & polys_2);
 
@@ -0,0 +1,140 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__SAFETY_CHECK_CONTEXT_HPP_  // NOLINT
+#define AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__SAFETY_CHECK_CONTEXT_HPP_  // NOLINT
+
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/path_safety_checker_parameters.hpp"
+
+#include <autoware_vehicle_info_utils/vehicle_info.hpp>
+
+#include <autoware_internal_planning_msgs/msg/path_with_lane_id.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/uuid/uuid_hash.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_path_planner::utils::path_safety_checker
+{
+
+using autoware::vehicle_info_utils::VehicleInfo;
+using autoware_internal_planning_msgs::msg::PathWithLaneId;
+
+class SafetyCheckContext;
+
+/**
+ * @brief Poses of the objects of a SafetyCheckContext which may collide with an ego predicted path.
+ *
+ * It refers to the context, which must outlive it.
+ */
+class SafetyCheckBroadPhase
+{
+public:
+  /**
+   * @brief Whether the exact collision check of the pose of a predicted path of the object is
+   * needed. It is false only for the poses of the context which are far from the ego predicted
+   * path, so poses which are not in the context, e.g. interpolated ones, are always checked.
+   */
+  [[nodiscard]] bool may_collide(
+    const ExtendedPredictedObject & object,
+    const PoseWithVelocityAndPolygonStamped & obj_pose_with_poly) const;
+
+  [[nodiscard]] size_t num_hits() const { return num_hits_; }
+
+private:
+  friend class SafetyCheckContext;
+
+  SafetyCheckBroadPhase(const SafetyCheckContext & context, std::vector<bool> is_hit);
+
+  const SafetyCheckContext * context_;
+  std::vector<bool> is_hit_;
+  size_t num_hits_{0};
+};
+
+/**
+ * @brief Object side of the RSS collision checks of a planning cycle.
+ *
+ * The poses of the predicted paths of the objects are indexed once by an R-tree over their bounding
+ * boxes in (x, y, time). For each candidate path, the segments of the ego predicted path, inflated
+ * by an upper bound of the RSS extension of the polygons, are queried in it, so that the exact
+ * boost::geometry checks only run on the poses which are close to ego at the same time.
+ */
+class SafetyCheckContext
+{
+public:
+  SafetyCheckContext() = default;
+  explicit SafetyCheckContext(const ExtendedPredictedObjects & objects);
+  SafetyCheckContext(
+    std::initializer_list<std::reference_wrapper<const ExtendedPredictedObjects>> objects_list);
+
+  /**
+   * @brief Find the poses of the objects which may collide with the ego predicted path in
+   * check_collision().
+   * @param planned_path The planned path of the ego vehicle, used by the "along_path" policy.
+   * @param ego_predicted_path Ego vehicle's predicted path.
+   * @param vehicle_info Ego vehicle information.
+   * @param rss_params_list The RSS parameters of the checks, the extension of the polygons is
+   * bounded for all of them.
+   * @param hysteresis_factor Hysteresis factor.
+   * @param max_velocity_limit Maximum velocity of ego vehicle.
+   */
+  [[nodiscard]] SafetyCheckBroadPhase query(
+    const PathWithLaneId & planned_path,
+    const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
+    const VehicleInfo & vehicle_info, const std::vector<RSSparams> & rss_params_list,
+    const double hysteresis_factor, const double max_velocity_limit) const;
+
+  [[nodiscard]] size_t size() const { return entries_.size(); }
+
+private:
+  friend class SafetyCheckBroadPhase;
+
+  using Point3d = boost::geometry::model::point<double, 3, boost::geometry::cs::cartesian>;
+  using Box3d = boost::geometry::model::box<Point3d>;
+  using Rtree =
+    boost::geometry::index::rtree<std::pair<Box3d, size_t>, boost::geometry::index::rstar<16>>;
+
+  struct Entry
+  {
+    boost::uuids::uuid uuid;
+    double time;
+    double x;
+    double y;
+    // distance from the pose which contains the polygon, and its bounding box in the object frame
+    double radius;
+  };
+
+  void add_objects(const ExtendedPredictedObjects & objects);
+  void build();
+
+  // sorted by uuid, time and position, so that the poses of an object are found by binary search
+  std::vector<Entry> entries_;
+  std::unordered_map<boost::uuids::uuid, std::pair<size_t, size_t>> object_ranges_;
+  Rtree rtree_;
+  double max_object_velocity_{0.0};
+};
+
+}  // namespace autoware::behavior_path_planner::utils::path_safety_checker
+
+// clang-format off
+#endif  // AUTOWARE__BEHAVIOR_PATH_PLANNER_COMMON__UTILS__PATH_SAFETY_CHECKER__SAFETY_CHECK_CONTEXT_HPP_  // NOLINT
+// clang-format on
@@ -17,6 +17,11 @@
 #include <autoware_utils/geometry/geometry.hpp>
 #include <autoware_utils/math/normalization.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace autoware::behavior_path_planner
@@ -96,6 +101,194 @@ void OccupancyGridBasedCollisionDetector::setMap(const nav_msgs::msg::OccupancyG
     compute_collision_indexes(i, indexes_2d);
     coll_indexes_table_.push_back(indexes_2d);
   }
+
+  squared_distance_table_.clear();
+  if (!param_.use_distance_transform) {
+    return;
+  }
+
+  // the covering circles only depend on the footprint, i.e. the resolution of the costmap
+  if (
+    static_cast<int>(covering_circles_table_.size()) != param_.theta_size ||
+    covering_circles_resolution_ != costmap_.info.resolution) {
+    covering_circles_resolution_ = costmap_.info.resolution;
+    footprint_bounds_table_.clear();
+    covering_circles_table_.clear();
+    for (int i = 0; i < param_.theta_size; i++) {
+      FootprintBounds bounds{};
+      std::vector<CoveringCircle> circles;
+      compute_covering_circles(i, coll_indexes_table_.at(i), bounds, circles);
+      footprint_bounds_table_.push_back(bounds);
+      covering_circles_table_.push_back(circles);
+    }
+  }
+  compute_distance_transform();
+}
+
+void OccupancyGridBasedCollisionDetector::compute_distance_transform()
+{
+  const int64_t width = costmap_.info.width;
+  const int64_t height = costmap_.info.height;
+  squared_distance_table_.resize(width * height);
+  if (width == 0 || height == 0) {
+    return;
+  }
+
+  // the distance only needs to be exact up to the largest radius of the covering circles
+  int64_t max_radius_sq = 0;
+  for (const auto & circles : covering_circles_table_) {
+    for (const auto & circle : circles) {
+      max_radius_sq =
+        std::max({max_radius_sq, circle.covering_radius_sq, circle.inscribed_radius_sq});
+    }
+  }
+  const auto saturated_distance_sq = static_cast<int32_t>(max_radius_sq + 1);
+  int32_t max_radius = 0;
+  while (static_cast<int64_t>(max_radius) * max_radius < max_radius_sq) {
+    max_radius++;
+  }
+  const int32_t far = max_radius + 1;
+
+  // distance to the nearest obstacle in the same column, scanned row by row to be cache friendly
+  std::vector<int32_t> column_distance(width * height);
+  for (int64_t y = 0; y < height; y++) {
+    for (int64_t x = 0; x < width; x++) {
+      const int cost = costmap_.data[y * width + x];
+      if (cost < 0 || param_.obstacle_threshold <= cost) {
+        column_distance[y * width + x] = 0;
+      } else {
+        column_distance[y * width + x] =
+          y == 0 ? far : std::min(far, column_distance[(y - 1) * width + x] + 1);
+      }
+    }
+  }
+  for (int64_t y = height - 2; 0 <= y; y--) {
+    for (int64_t x = 0; x < width; x++) {
+      column_distance[y * width + x] =
+        std::min(column_distance[y * width + x], column_distance[(y + 1) * width + x] + 1);
+    }
+  }
+
+  // lower envelope of the parabolas (x - i)^2 + g[i]^2 along each row, linear in the row width
+  // (Felzenszwalb and Huttenlocher, Distance Transforms of Sampled Functions). The columns farther
+  // than max_radius from an obstacle only give saturated distances, so their clamped value is fine.
+  std::vector<int64_t> parabola_index(width);
+  std::vector<double> boundary(width + 1);
+  for (int64_t y = 0; y < height; y++) {
+    const int32_t * g = &column_distance[y * width];
+    int32_t * row = &squared_distance_table_[y * width];
+    const auto vertex_height = [&](const int64_t i) { return static_cast<int64_t>(g[i]) * g[i]; };
+    // abscissa where the parabola of q gets lower than the one of p, for p < q
+    const auto intersection = [&](const int64_t p, const int64_t q) {
+      return static_cast<double>(vertex_height(q) + q * q - vertex_height(p) - p * p) /
+             static_cast<double>(2 * (q - p));
+    };
+
+    int64_t k = 0;
+    parabola_index[0] = 0;
+    boundary[0] = -std::numeric_limits<double>::infinity();
+    boundary[1] = std::numeric_limits<double>::infinity();
+    for (int64_t q = 1; q < width; q++) {
+      double s = intersection(parabola_index[k], q);
+      while (s <= boundary[k]) {
+        k--;
+        s = intersection(parabola_index[k], q);
+      }
+      k++;
+      parabola_index[k] = q;
+      boundary[k] = s;
+      boundary[k + 1] = std::numeric_limits<double>::infinity();
+    }
+
+    k = 0;
+    for (int64_t x = 0; x < width; x++) {
+      while (boundary[k + 1] < static_cast<double>(x)) {
+        k++;
+      }
+      const int64_t i = parabola_index[k];
+      row[x] = static_cast<int32_t>(
+        std::min<int64_t>((x - i) * (x - i) + vertex_height(i), saturated_distance_sq));
+    }
+  }
+}
+
+void OccupancyGridBasedCollisionDetector::compute_covering_circles(
+  int theta_index, const std::vector<IndexXY> & indexes_2d, FootprintBounds & bounds,
+  std::vector<CoveringCircle> & circles) const
+{
+  circles.clear();
+  bounds = FootprintBounds{{0, 0}, {-1, -1}};
+  if (indexes_2d.empty()) {
+    return;
+  }
+
+  bounds = FootprintBounds{indexes_2d.front(), indexes_2d.front()};
+  for (const auto & index : indexes_2d) {
+    bounds.min.x = std::min(bounds.min.x, index.x);
+    bounds.min.y = std::min(bounds.min.y, index.y);
+    bounds.max.x = std::max(bounds.max.x, index.x);
+    bounds.max.y = std::max(bounds.max.y, index.y);
+  }
+
+  // footprint cells in the bounds with a ring of one cell around them
+  const int footprint_width = bounds.max.x - bounds.min.x + 3;
+  const int footprint_height = bounds.max.y - bounds.min.y + 3;
+  std::vector<bool> is_footprint(footprint_width * footprint_height, false);
+  const auto footprint_index = [&](const int x, const int y) {
+    return (y - bounds.min.y + 1) * footprint_width + (x - bounds.min.x + 1);
+  };
+  std::vector<IndexXY> footprint;
+  for (const auto & index : indexes_2d) {
+    if (!is_footprint[footprint_index(index.x, index.y)]) {
+      is_footprint[footprint_index(index.x, index.y)] = true;
+      footprint.push_back(index);
+    }
+  }
+
+  const auto squared_distance = [](const IndexXY & a, const IndexXY & b) {
+    const int64_t dx = a.x - b.x;
+    const int64_t dy = a.y - b.y;
+    return dx * dx + dy * dy;
+  };
+
+  // split the vehicle along its length into pieces which are about narrower than its width
+  const VehicleShape & vehicle_shape = param_.vehicle_shape;
+  const int circle_num =
+    1 + static_cast<int>(std::ceil(vehicle_shape.length / std::max(vehicle_shape.width, 1e-3)));
+  const double theta = 2.0 * M_PI / param_.theta_size * theta_index;
+  for (int i = 0; i < circle_num; i++) {
+    const double x = -vehicle_shape.base2back + (i + 0.5) * vehicle_shape.length / circle_num;
+    const double ideal_x = std::cos(theta) * x / costmap_.info.resolution;
+    const double ideal_y = std::sin(theta) * x / costmap_.info.resolution;
+    // the center is the nearest cell of the footprint so that it is in range with the footprint
+    const auto center = *std::min_element(
+      footprint.begin(), footprint.end(), [&](const auto & a, const auto & b) {
+        return std::hypot(a.x - ideal_x, a.y - ideal_y) < std::hypot(b.x - ideal_x, b.y - ideal_y);
+      });
+    circles.push_back(CoveringCircle{center, 0, 0});
+  }
+
+  for (const auto & cell : footprint) {
+    auto nearest_circle = std::min_element(
+      circles.begin(), circles.end(), [&](const auto & a, const auto & b) {
+        return squared_distance(a.center, cell) < squared_distance(b.center, cell);
+      });
+    nearest_circle->covering_radius_sq =
+      std::max(nearest_circle->covering_radius_sq, squared_distance(nearest_circle->center, cell));
+  }
+
+  // the ring around the bounds is out of the footprint and nearer than the cells beyond it
+  for (auto & circle : circles) {
+    circle.inscribed_radius_sq = std::numeric_limits<int64_t>::max();
+    for (int x = bounds.min.x - 1; x <= bounds.max.x + 1; x++) {
+      for (int y = bounds.min.y - 1; y <= bounds.max.y + 1; y++) {
+        if (!is_footprint[footprint_index(x, y)]) {
+          circle.inscribed_radius_sq =
+            std::min(circle.inscribed_radius_sq, squared_distance(circle.center, IndexXY{x, y}));
+        }
+      }
+    }
+  }
 }
 
 static IndexXY position2index(
@@ -155,6 +348,11 @@ bool OccupancyGridBasedCollisionDetector::detectCollision(
               << std::endl;
     return false;
   }
+  if (param_.use_distance_transform) {
+    if (const auto has_collision = detect_collision_with_distance_transform(base_index)) {
+      return *has_collision;
+    }
+  }
   const auto & coll_indexes_2d = coll_indexes_table_[base_index.theta];
   for (const auto & coll_index_2d : coll_indexes_2d) {
     int idx_theta = 0;  // whatever. Yaw is nothing to do with collision detection between grids.
@@ -172,6 +370,44 @@ bool OccupancyGridBasedCollisionDetector::detectCollision(
   return false;
 }
 
+std::optional<bool> OccupancyGridBasedCollisionDetector::detect_collision_with_distance_transform(
+  const IndexXYT & base_index) const
+{
+  // setParam has been done after setMap
+  if (squared_distance_table_.empty() || covering_circles_table_.empty()) {
+    return std::nullopt;
+  }
+
+  // when the whole footprint is in range, the footprint walk only looks for an obstacle
+  const auto & bounds = footprint_bounds_table_[base_index.theta];
+  if (
+    base_index.x + bounds.min.x < 0 ||
+    static_cast<int>(costmap_.info.width) <= base_index.x + bounds.max.x ||
+    base_index.y + bounds.min.y < 0 ||
+    static_cast<int>(costmap_.info.height) <= base_index.y + bounds.max.y) {
+    return std::nullopt;
+  }
+
+  bool is_free = true;
+  for (const auto & circle : covering_circles_table_[base_index.theta]) {
+    const int64_t x = base_index.x + circle.center.x;
+    const int64_t y = base_index.y + circle.center.y;
+    const int64_t squared_distance = squared_distance_table_[y * costmap_.info.width + x];
+    // the nearest obstacle is in the footprint
+    if (squared_distance < circle.inscribed_radius_sq) {
+      return true;
+    }
+    // an obstacle may be in the circle
+    if (squared_distance <= circle.covering_radius_sq) {
+      is_free = false;
+    }
+  }
+  if (is_free) {
+    return false;
+  }
+  return std::nullopt;
+}
+
 bool OccupancyGridBasedCollisionDetector::hasObstacleOnPath(
   const autoware_internal_planning_msgs::msg::PathWithLaneId & path,
   const bool check_out_of_range) const
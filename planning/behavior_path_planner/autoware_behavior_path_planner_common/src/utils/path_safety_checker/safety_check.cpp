@@ -498,13 +498,15 @@ std::vector<PoseWithVelocityStamped> filterPredictedPathAfterTargetPose(
   return filtered_path;
 };
 
-bool checkSafetyWithRSS(
+namespace
+{
+bool check_safety_with_rss(
   const PathWithLaneId & planned_path,
   const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
   const std::vector<ExtendedPredictedObject> & objects, CollisionCheckDebugMap & debug_map,
   const BehaviorPathPlannerParameters & parameters, const RSSparams & rss_params,
   const bool check_all_predicted_path, const double hysteresis_factor,
-  const double yaw_difference_th)
+  const double yaw_difference_th, const SafetyCheckBroadPhase * broad_phase)
 {
   // Check for collisions with each predicted path of the object
   const bool is_safe = !std::any_of(objects.begin(), objects.end(), [&](const auto & object) {
@@ -515,9 +517,15 @@ bool checkSafetyWithRSS(
 
     return std::any_of(
       obj_predicted_paths.begin(), obj_predicted_paths.end(), [&](const auto & obj_path) {
-        const bool has_collision = !utils::path_safety_checker::checkCollision(
-          planned_path, ego_predicted_path, object, obj_path, parameters, rss_params,
-          hysteresis_factor, yaw_difference_th, current_debug_data.second);
+        const bool has_collision =
+          broad_phase ? !utils::path_safety_checker::checkCollision(
+                          planned_path, ego_predicted_path, object, obj_path, parameters,
+                          rss_params, hysteresis_factor, yaw_difference_th,
+                          current_debug_data.second, *broad_phase)
+                      : !utils::path_safety_checker::checkCollision(
+                          planned_path, ego_predicted_path, object, obj_path, parameters,
+                          rss_params, hysteresis_factor, yaw_difference_th,
+                          current_debug_data.second);
 
         utils::path_safety_checker::updateCollisionCheckDebugMap(
           debug_map, current_debug_data, !has_collision);
@@ -528,6 +536,37 @@ bool checkSafetyWithRSS(
 
   return is_safe;
 }
+}  // namespace
+
+bool checkSafetyWithRSS(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
+  const std::vector<ExtendedPredictedObject> & objects, CollisionCheckDebugMap & debug_map,
+  const BehaviorPathPlannerParameters & parameters, const RSSparams & rss_params,
+  const bool check_all_predicted_path, const double hysteresis_factor,
+  const double yaw_difference_th)
+{
+  return check_safety_with_rss(
+    planned_path, ego_predicted_path, objects, debug_map, parameters, rss_params,
+    check_all_predicted_path, hysteresis_factor, yaw_difference_th, nullptr);
+}
+
+bool checkSafetyWithRSS(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
+  const std::vector<ExtendedPredictedObject> & objects, CollisionCheckDebugMap & debug_map,
+  const BehaviorPathPlannerParameters & parameters, const RSSparams & rss_params,
+  const bool check_all_predicted_path, const double hysteresis_factor,
+  const double yaw_difference_th, const SafetyCheckContext & context)
+{
+  // checkCollision() does not limit the ego velocity
+  const auto broad_phase = context.query(
+    planned_path, ego_predicted_path, parameters.vehicle_info, {rss_params}, hysteresis_factor,
+    std::numeric_limits<double>::max());
+  return check_safety_with_rss(
+    planned_path, ego_predicted_path, objects, debug_map, parameters, rss_params,
+    check_all_predicted_path, hysteresis_factor, yaw_difference_th, &broad_phase);
+}
 
 bool checkSafetyWithIntegralPredictedPolygon(
   const std::vector<PoseWithVelocityStamped> & ego_predicted_path, const VehicleInfo & vehicle_info,
@@ -590,6 +629,22 @@ bool checkCollision(
   return collided_polygons.empty();
 }
 
+bool checkCollision(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
+  const ExtendedPredictedObject & target_object,
+  const PredictedPathWithPolygon & target_object_path,
+  const BehaviorPathPlannerParameters & common_parameters, const RSSparams & rss_parameters,
+  const double hysteresis_factor, const double yaw_difference_th, CollisionCheckDebug & debug,
+  const SafetyCheckBroadPhase & broad_phase)
+{
+  const auto collided_polygons = get_collided_polygons(
+    planned_path, predicted_ego_path, target_object, target_object_path,
+    common_parameters.vehicle_info, rss_parameters, hysteresis_factor,
+    std::numeric_limits<double>::max(), yaw_difference_th, debug, broad_phase);
+  return collided_polygons.empty();
+}
+
 std::optional<Polygon2d> extend_ego_polygon(
   const PathWithLaneId & planned_path, const Pose & ego_pose, const Polygon2d & ego_polygon,
   const VehicleInfo & vehicle_info, const double lon_offset, const double lat_margin,
@@ -703,13 +758,16 @@ std::optional<Polygon2d> check_collision(
   return obj_polygon;
 }
 
-std::vector<Polygon2d> get_collided_polygons(
-  [[maybe_unused]] const PathWithLaneId & planned_path,
+namespace
+{
+std::vector<Polygon2d> get_collided_polygons_impl(
+  const PathWithLaneId & planned_path,
   const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
   const ExtendedPredictedObject & target_object,
   const PredictedPathWithPolygon & target_object_path, const VehicleInfo & vehicle_info,
   const RSSparams & rss_parameters, double hysteresis_factor, const double max_velocity_limit,
-  const double yaw_difference_th, CollisionCheckDebug & debug)
+  const double yaw_difference_th, CollisionCheckDebug & debug,
+  const SafetyCheckBroadPhase * broad_phase)
 {
   {
     debug.ego_predicted_path = predicted_ego_path;
@@ -720,6 +778,9 @@ std::vector<Polygon2d> get_collided_polygons(
   std::vector<Polygon2d> collided_polygons{};
   collided_polygons.reserve(target_object_path.path.size());
   for (const auto & obj_pose_with_poly : target_object_path.path) {
+    if (broad_phase && !broad_phase->may_collide(target_object, obj_pose_with_poly)) {
+      continue;
+    }
     CollisionCheckDebug * debug_ptr = collided_polygons.empty() ? &debug : nullptr;
 
     if (
@@ -732,6 +793,35 @@ std::vector<Polygon2d> get_collided_polygons(
 
   return collided_polygons;
 }
+}  // namespace
+
+std::vector<Polygon2d> get_collided_polygons(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
+  const ExtendedPredictedObject & target_object,
+  const PredictedPathWithPolygon & target_object_path, const VehicleInfo & vehicle_info,
+  const RSSparams & rss_parameters, double hysteresis_factor, const double max_velocity_limit,
+  const double yaw_difference_th, CollisionCheckDebug & debug)
+{
+  return get_collided_polygons_impl(
+    planned_path, predicted_ego_path, target_object, target_object_path, vehicle_info,
+    rss_parameters, hysteresis_factor, max_velocity_limit, yaw_difference_th, debug, nullptr);
+}
+
+std::vector<Polygon2d> get_collided_polygons(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & predicted_ego_path,
+  const ExtendedPredictedObject & target_object,
+  const PredictedPathWithPolygon & target_object_path, const VehicleInfo & vehicle_info,
+  const RSSparams & rss_parameters, double hysteresis_factor, const double max_velocity_limit,
+  const double yaw_difference_th, CollisionCheckDebug & debug,
+  const SafetyCheckBroadPhase & broad_phase)
+{
+  return get_collided_polygons_impl(
+    planned_path, predicted_ego_path, target_object, target_object_path, vehicle_info,
+    rss_parameters, hysteresis_factor, max_velocity_limit, yaw_difference_th, debug,
+    &broad_phase);
+}
 
 bool checkPolygonsIntersects(
   const std::vector<Polygon2d> & polys_1, const std::vector<Polygon2d> & polys_2)
@@ -0,0 +1,269 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check_context.hpp"
+
+#include "autoware/motion_utils/trajectory/trajectory.hpp"
+#include "autoware_utils/geometry/geometry.hpp"
+#include "autoware_utils/ros/uuid_helper.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace autoware::behavior_path_planner::utils::path_safety_checker
+{
+
+namespace bgi = boost::geometry::index;
+
+namespace
+{
+// same as the time tolerance of calc_interpolated_pose_with_velocity()
+constexpr double time_epsilon = 1e-6;
+
+/**
+ * @brief Upper bound of the absolute longitudinal extension of the polygons in check_collision()
+ * when the absolute velocities of ego and the object are at most max_velocity.
+ */
+double calc_max_lon_offset(
+  const RSSparams & rss_params, const double max_velocity, const double hysteresis_factor)
+{
+  const auto deceleration = [](const double vehicle_accel) {
+    return (vehicle_accel < -1e-3) ? -vehicle_accel : 1.0;
+  };
+  const double reaction_time = std::abs(
+    rss_params.rear_vehicle_reaction_time + rss_params.rear_vehicle_safety_time_margin);
+  // the stopping length of the front object is subtracted from the rss distance
+  const double max_rss_distance =
+    max_velocity * reaction_time +
+    std::pow(max_velocity, 2) / (2.0 * deceleration(rss_params.rear_vehicle_deceleration));
+  const double lon_velocity_length =
+    std::abs(rss_params.longitudinal_velocity_delta_time) * max_velocity;
+  const double max_min_lon_length =
+    lon_velocity_length + rss_params.longitudinal_distance_min_threshold;
+  const double min_min_lon_length =
+    rss_params.longitudinal_distance_min_threshold - lon_velocity_length;
+  const double max_lon_offset =
+    std::max({max_rss_distance, max_min_lon_length, -min_min_lon_length, 0.0});
+  return max_lon_offset * std::abs(hysteresis_factor);
+}
+
+/**
+ * @brief Upper bound of the distance from the ego base link to the points of the polygon extended
+ * along the planned path, in addition to the one of the rectangle policy.
+ * @details The extension starts from the nearest segment of the planned path and its length along
+ * the path is the longitudinal offset, so its points are at most 2 * d + 3 * l farther, where d is
+ * the distance from ego to the nearest point of the path and l the longest segment of the path.
+ */
+double calc_along_path_margin(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & ego_predicted_path)
+{
+  const auto & points = planned_path.points;
+  if (points.size() < 2) {
+    return 0.0;
+  }
+
+  double max_segment_length = 0.0;
+  for (size_t i = 1; i < points.size(); ++i) {
+    max_segment_length = std::max(
+      max_segment_length, autoware_utils::calc_distance2d(points.at(i - 1), points.at(i)));
+  }
+
+  const auto distance_to_path = [&](const Pose & pose) {
+    const auto nearest_idx = autoware::motion_utils::findNearestIndex(points, pose.position);
+    return autoware_utils::calc_distance2d(points.at(nearest_idx), pose);
+  };
+  // the interpolated poses are at most half of the segment from the nearest end of the segment
+  double max_distance_to_path = 0.0;
+  double prev_distance_to_path = distance_to_path(ego_predicted_path.front().pose);
+  for (size_t i = 1; i < ego_predicted_path.size(); ++i) {
+    const double current_distance_to_path = distance_to_path(ego_predicted_path.at(i).pose);
+    const double half_segment_length =
+      autoware_utils::calc_distance2d(
+        ego_predicted_path.at(i - 1).pose, ego_predicted_path.at(i).pose) /
+      2.0;
+    max_distance_to_path = std::max(
+      max_distance_to_path,
+      std::max(prev_distance_to_path, current_distance_to_path) + half_segment_length);
+    prev_distance_to_path = current_distance_to_path;
+  }
+
+  return 2.0 * max_distance_to_path + 3.0 * max_segment_length;
+}
+}  // namespace
+
+SafetyCheckBroadPhase::SafetyCheckBroadPhase(
+  const SafetyCheckContext & context, std::vector<bool> is_hit)
+: context_(&context),
+  is_hit_(std::move(is_hit)),
+  num_hits_(static_cast<size_t>(std::count(is_hit_.begin(), is_hit_.end(), true)))
+{
+}
+
+bool SafetyCheckBroadPhase::may_collide(
+  const ExtendedPredictedObject & object,
+  const PoseWithVelocityAndPolygonStamped & obj_pose_with_poly) const
+{
+  const auto range_it = context_->object_ranges_.find(autoware_utils::to_boost_uuid(object.uuid));
+  if (range_it == context_->object_ranges_.end()) {
+    return true;
+  }
+
+  const auto & entries = context_->entries_;
+  const auto & [begin_idx, end_idx] = range_it->second;
+  const auto end = entries.begin() + static_cast<std::ptrdiff_t>(end_idx);
+  auto entry_it = std::lower_bound(
+    entries.begin() + static_cast<std::ptrdiff_t>(begin_idx), end, obj_pose_with_poly.time,
+    [](const auto & entry, const double time) { return entry.time < time; });
+  const auto & position = obj_pose_with_poly.pose.position;
+  for (; entry_it != end && entry_it->time == obj_pose_with_poly.time; ++entry_it) {
+    if (entry_it->x == position.x && entry_it->y == position.y) {
+      return is_hit_.at(static_cast<size_t>(entry_it - entries.begin()));
+    }
+  }
+  return true;
+}
+
+SafetyCheckContext::SafetyCheckContext(const ExtendedPredictedObjects & objects)
+{
+  add_objects(objects);
+  build();
+}
+
+SafetyCheckContext::SafetyCheckContext(
+  std::initializer_list<std::reference_wrapper<const ExtendedPredictedObjects>> objects_list)
+{
+  for (const auto & objects : objects_list) {
+    add_objects(objects.get());
+  }
+  build();
+}
+
+void SafetyCheckContext::add_objects(const ExtendedPredictedObjects & objects)
+{
+  for (const auto & object : objects) {
+    const auto uuid = autoware_utils::to_boost_uuid(object.uuid);
+    for (const auto & predicted_path : object.predicted_paths) {
+      for (const auto & pose_with_poly : predicted_path.path) {
+        const auto & position = pose_with_poly.pose.position;
+        double max_distance = 0.0;
+        for (const auto & point : pose_with_poly.poly.outer()) {
+          max_distance =
+            std::max(max_distance, std::hypot(point.x() - position.x, point.y() - position.y));
+        }
+        entries_.push_back(
+          Entry{uuid, pose_with_poly.time, position.x, position.y, std::sqrt(2.0) * max_distance});
+        max_object_velocity_ = std::max(max_object_velocity_, std::abs(pose_with_poly.velocity));
+      }
+    }
+  }
+}
+
+void SafetyCheckContext::build()
+{
+  std::sort(entries_.begin(), entries_.end(), [](const Entry & a, const Entry & b) {
+    return std::tie(a.uuid, a.time, a.x, a.y) < std::tie(b.uuid, b.time, b.x, b.y);
+  });
+
+  std::vector<std::pair<Box3d, size_t>> values;
+  values.reserve(entries_.size());
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    const auto & entry = entries_.at(i);
+    // the entries of an object are contiguous after the sort
+    auto & object_range = object_ranges_.try_emplace(entry.uuid, i, i).first->second;
+    object_range.second = i + 1;
+    values.emplace_back(
+      Box3d{
+        Point3d{entry.x - entry.radius, entry.y - entry.radius, entry.time},
+        Point3d{entry.x + entry.radius, entry.y + entry.radius, entry.time}},
+      i);
+  }
+  // packing algorithm
+  rtree_ = Rtree(values.begin(), values.end());
+}
+
+SafetyCheckBroadPhase SafetyCheckContext::query(
+  const PathWithLaneId & planned_path,
+  const std::vector<PoseWithVelocityStamped> & ego_predicted_path,
+  const VehicleInfo & vehicle_info, const std::vector<RSSparams> & rss_params_list,
+  const double hysteresis_factor, const double max_velocity_limit) const
+{
+  std::vector<bool> is_hit(entries_.size(), false);
+  // ego cannot be interpolated on a path with less than two poses
+  if (entries_.empty() || ego_predicted_path.size() < 2) {
+    return SafetyCheckBroadPhase{*this, std::move(is_hit)};
+  }
+
+  // the ego velocity is the interpolated one limited by max_velocity_limit
+  double max_velocity = max_object_velocity_;
+  for (const auto & ego_pose : ego_predicted_path) {
+    const double ego_velocity = std::min(ego_pose.velocity, max_velocity_limit);
+    max_velocity = std::max(max_velocity, std::abs(ego_velocity));
+  }
+
+  double max_extension = 0.0;
+  bool has_along_path_policy = false;
+  for (const auto & rss_params : rss_params_list) {
+    const double lon_offset = calc_max_lon_offset(rss_params, max_velocity, hysteresis_factor);
+    const double lat_margin =
+      std::abs(rss_params.lateral_distance_max_threshold * hysteresis_factor);
+    max_extension = std::max(max_extension, lon_offset + lat_margin);
+    has_along_path_policy |= rss_params.extended_polygon_policy == "along_path";
+  }
+  if (has_along_path_policy) {
+    max_extension += calc_along_path_margin(planned_path, ego_predicted_path);
+  }
+
+  const double ego_radius = std::hypot(
+    std::max(
+      {vehicle_info.max_longitudinal_offset_m, vehicle_info.rear_overhang_m,
+       -vehicle_info.min_longitudinal_offset_m}),
+    std::max(
+      {vehicle_info.vehicle_width_m / 2.0, vehicle_info.max_lateral_offset_m,
+       -vehicle_info.min_lateral_offset_m}));
+  const double margin = ego_radius + max_extension;
+
+  // calc_interpolated_pose_with_velocity() interpolates between the poses idx - 1 and idx at the
+  // times before the first pose idx such that time < ego_predicted_path.at(idx).time + epsilon
+  std::vector<std::pair<Box3d, size_t>> results;
+  double min_time = 0.0;
+  for (size_t idx = 1; idx < ego_predicted_path.size(); ++idx) {
+    const auto & prev_position = ego_predicted_path.at(idx - 1).pose.position;
+    const auto & position = ego_predicted_path.at(idx).pose.position;
+    const double max_time = ego_predicted_path.at(idx).time + time_epsilon;
+    if (min_time <= max_time) {
+      const Box3d segment_box{
+        Point3d{
+          std::min(prev_position.x, position.x) - margin,
+          std::min(prev_position.y, position.y) - margin, min_time},
+        Point3d{
+          std::max(prev_position.x, position.x) + margin,
+          std::max(prev_position.y, position.y) + margin, max_time}};
+      results.clear();
+      rtree_.query(bgi::intersects(segment_box), std::back_inserter(results));
+      for (const auto & result : results) {
+        is_hit.at(result.second) = true;
+      }
+    }
+    min_time = std::max(min_time, ego_predicted_path.at(idx).time);
+  }
+
+  return SafetyCheckBroadPhase{*this, std::move(is_hit)};
+}
+
+}  // namespace autoware::behavior_path_planner::utils::path_safety_checker
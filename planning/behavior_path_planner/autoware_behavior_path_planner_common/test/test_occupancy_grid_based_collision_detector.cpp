@@ -147,3 +147,42 @@ TEST_F(OccupancyGridBasedCollisionDetectorTest, hasObstacleOnPath)
   }
   EXPECT_TRUE(detector_.hasObstacleOnPath(path, false));
 }
+
+TEST_F(OccupancyGridBasedCollisionDetectorTest, detectCollisionWithDistanceTransform)
+{
+  using autoware::behavior_path_planner::IndexXYT;
+
+  // obstacles, unknown cells and cells below the threshold
+  for (size_t i = 0; i < costmap_.data.size(); i++) {
+    if (i % 37 == 0) {
+      costmap_.data.at(i) = 100;
+    } else if (i % 53 == 0) {
+      costmap_.data.at(i) = -1;
+    }
+  }
+  detector_.setMap(costmap_);
+
+  OccupancyGridBasedCollisionDetector detector_with_distance_transform;
+  param_.use_distance_transform = true;
+  detector_with_distance_transform.setParam(param_);
+  detector_with_distance_transform.setMap(costmap_);
+
+  // the same decision on every pose, including the ones partially out of range
+  for (int theta = 0; theta < param_.theta_size; theta++) {
+    for (int x = -10; x < 50; x++) {
+      for (int y = -10; y < 50; y++) {
+        const IndexXYT base_index{x, y, theta};
+        for (const bool check_out_of_range : {true, false}) {
+          EXPECT_EQ(
+            detector_.detectCollision(base_index, check_out_of_range),
+            detector_with_distance_transform.detectCollision(base_index, check_out_of_range));
+        }
+      }
+    }
+  }
+
+  // a map without obstacle
+  costmap_.data = std::vector<int8_t>(1600, 0);
+  detector_with_distance_transform.setMap(costmap_);
+  EXPECT_FALSE(detector_with_distance_transform.detectCollision(IndexXYT{20, 20, 0}, true));
+}
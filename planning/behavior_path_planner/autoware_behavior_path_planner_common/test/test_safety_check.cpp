@@ -29,9 +29,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <limits>
+#include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 constexpr double epsilon = 1e-6;
@@ -39,6 +43,7 @@ constexpr double epsilon = 1e-6;
 using autoware::behavior_path_planner::utils::path_safety_checker::CollisionCheckDebug;
 using autoware::behavior_path_planner::utils::path_safety_checker::CollisionCheckDebugMap;
 using autoware::behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObject;
+using autoware::behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObjects;
 using autoware::behavior_path_planner::utils::path_safety_checker::
   PoseWithVelocityAndPolygonStamped;
 using autoware::behavior_path_planner::utils::path_safety_checker::PoseWithVelocityStamped;
@@ -609,6 +614,250 @@ TEST(BehaviorPathPlanningSafetyUtilsTest, checkCollision)
   }
 }
 
+TEST(BehaviorPathPlanningSafetyUtilsTest, SafetyCheckContext)
+{
+  using autoware::behavior_path_planner::utils::path_safety_checker::checkSafetyWithRSS;
+  using autoware::behavior_path_planner::utils::path_safety_checker::get_collided_polygons;
+  using autoware::behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObjects;
+  using autoware::behavior_path_planner::utils::path_safety_checker::SafetyCheckContext;
+
+  auto planned_path = generateTrajectory<PathWithLaneId>(3, 1.0);
+  auto predicted_ego_path = create_test_path();
+  autoware::vehicle_info_utils::VehicleInfo vehicle_info{};
+  vehicle_info.max_longitudinal_offset_m = 4.0;
+  vehicle_info.rear_overhang_m = 1.0;
+  vehicle_info.vehicle_width_m = 2.0;
+  BehaviorPathPlannerParameters parameters;
+  parameters.vehicle_info = vehicle_info;
+  const double hysteresis_factor = 1.0;
+  const double max_velocity_limit = std::numeric_limits<double>::max();
+  const double yaw_difference_th = M_PI_2;
+
+  // objects beside ego, in front of it and far from it
+  ExtendedPredictedObjects objects;
+  const std::vector<std::pair<double, double>> initial_positions{
+    {0.0, 1.0}, {0.0, 4.0}, {10.0, 4.0}, {30.0, 0.0}, {200.0, 50.0}};
+  for (size_t i = 0; i < initial_positions.size(); ++i) {
+    const auto & [x, y] = initial_positions.at(i);
+    objects.push_back(create_extended_predicted_object(createPose(x, y, 0.0, 0.0, 0.0, 0.0), 1.0));
+    objects.back().uuid.uuid.at(0) = static_cast<uint8_t>(i + 1);
+  }
+  const SafetyCheckContext context(objects);
+  EXPECT_EQ(context.size(), 10 * objects.size());
+
+  for (const auto & policy : {"rectangle", "along_path"}) {
+    auto rss_params = create_rss_parameters();
+    rss_params.extended_polygon_policy = policy;
+    const auto broad_phase = context.query(
+      planned_path, predicted_ego_path, vehicle_info, {rss_params}, hysteresis_factor,
+      max_velocity_limit);
+    EXPECT_LT(broad_phase.num_hits(), context.size());
+
+    for (const auto & object : objects) {
+      const auto & object_path = object.predicted_paths.front();
+      CollisionCheckDebug debug;
+      const auto collided_polygons = get_collided_polygons(
+        planned_path, predicted_ego_path, object, object_path, vehicle_info, rss_params,
+        hysteresis_factor, max_velocity_limit, yaw_difference_th, debug);
+      const auto broad_phase_collided_polygons = get_collided_polygons(
+        planned_path, predicted_ego_path, object, object_path, vehicle_info, rss_params,
+        hysteresis_factor, max_velocity_limit, yaw_difference_th, debug, broad_phase);
+      EXPECT_EQ(collided_polygons.size(), broad_phase_collided_polygons.size());
+    }
+    // the far object is skipped
+    for (const auto & pose_with_poly : objects.back().predicted_paths.front().path) {
+      EXPECT_FALSE(broad_phase.may_collide(objects.back(), pose_with_poly));
+    }
+    // the poses which are not in the context are checked
+    auto unknown_object = objects.back();
+    unknown_object.uuid.uuid.at(0) = 0;
+    EXPECT_TRUE(broad_phase.may_collide(
+      unknown_object, unknown_object.predicted_paths.front().path.front()));
+
+    CollisionCheckDebugMap debug_map;
+    EXPECT_FALSE(checkSafetyWithRSS(
+      planned_path, predicted_ego_path, objects, debug_map, parameters, rss_params, true,
+      hysteresis_factor, yaw_difference_th, context));
+    const ExtendedPredictedObjects far_objects{objects.back()};
+    EXPECT_TRUE(checkSafetyWithRSS(
+      planned_path, predicted_ego_path, far_objects, debug_map, parameters, rss_params, true,
+      hysteresis_factor, yaw_difference_th, SafetyCheckContext(far_objects)));
+  }
+
+  // no pose is found with an empty context
+  const SafetyCheckContext empty_context;
+  const auto broad_phase = empty_context.query(
+    planned_path, predicted_ego_path, vehicle_info, {create_rss_parameters()}, hysteresis_factor,
+    max_velocity_limit);
+  EXPECT_EQ(broad_phase.num_hits(), 0u);
+}
+
+// A curved planned path, an ego predicted path beside it and objects driving around it in any
+// direction, with their own time resolution
+PathWithLaneId create_random_planned_path()
+{
+  PathWithLaneId path;
+  for (double x = -30.0; x <= 120.0; x += 1.0) {
+    autoware_internal_planning_msgs::msg::PathPointWithLaneId point;
+    point.point.pose =
+      createPose(x, 3.0 * std::sin(x / 20.0), 0.0, 0.0, 0.0, std::atan(0.15 * std::cos(x / 20.0)));
+    path.points.push_back(point);
+  }
+  return path;
+}
+
+std::vector<PoseWithVelocityStamped> create_random_ego_predicted_path(std::mt19937 & gen)
+{
+  std::uniform_real_distribution<double> velocity_dist(0.0, 15.0);
+  std::uniform_real_distribution<double> accel_dist(-2.0, 2.0);
+  std::uniform_real_distribution<double> offset_dist(-3.0, 3.0);
+  const double initial_velocity = velocity_dist(gen);
+  const double accel = accel_dist(gen);
+  const double lateral_offset = offset_dist(gen);
+  std::vector<PoseWithVelocityStamped> path;
+  for (double t = 0.0; t <= 8.0 + 1e-3; t += 0.5) {
+    const double velocity = std::max(initial_velocity + accel * t, 0.0);
+    const double x = (initial_velocity + velocity) / 2.0 * t;
+    const double y = 3.0 * std::sin(x / 20.0) + lateral_offset * std::min(t / 4.0, 1.0);
+    path.emplace_back(
+      t, createPose(x, y, 0.0, 0.0, 0.0, std::atan(0.15 * std::cos(x / 20.0))), velocity);
+  }
+  return path;
+}
+
+ExtendedPredictedObjects create_random_objects(std::mt19937 & gen)
+{
+  std::uniform_real_distribution<double> x_dist(-40.0, 100.0);
+  std::uniform_real_distribution<double> y_dist(-8.0, 8.0);
+  std::uniform_real_distribution<double> yaw_dist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> velocity_dist(0.0, 15.0);
+  std::uniform_real_distribution<double> length_dist(1.0, 5.0);
+  std::uniform_real_distribution<double> width_dist(0.5, 2.5);
+  std::uniform_int_distribution<int> kind_dist(0, 2);
+  const std::vector<double> time_resolutions{0.25, 0.5, 1.0};
+
+  ExtendedPredictedObjects objects;
+  for (size_t i = 0; i < 15; ++i) {
+    ExtendedPredictedObject object;
+    object.uuid.uuid.at(0) = static_cast<uint8_t>(i + 1);
+    object.shape.type = autoware_perception_msgs::msg::Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = length_dist(gen);
+    object.shape.dimensions.y = width_dist(gen);
+    // along the path, against it or in any direction
+    const int kind = kind_dist(gen);
+    const double yaw = kind == 0 ? 0.0 : kind == 1 ? M_PI : yaw_dist(gen);
+    const double velocity = velocity_dist(gen);
+    object.initial_pose = createPose(x_dist(gen), y_dist(gen), 0.0, 0.0, 0.0, yaw);
+    object.initial_polygon = autoware_utils::to_polygon2d(object.initial_pose, object.shape);
+
+    PredictedPathWithPolygon predicted_path;
+    predicted_path.confidence = 1.0;
+    const double time_resolution = time_resolutions.at(i % time_resolutions.size());
+    for (double t = 0.0; t <= 8.0 + 1e-3; t += time_resolution) {
+      const auto pose = createPose(
+        object.initial_pose.position.x + std::cos(yaw) * velocity * t,
+        object.initial_pose.position.y + std::sin(yaw) * velocity * t, 0.0, 0.0, 0.0, yaw);
+      predicted_path.path.emplace_back(
+        t, pose, velocity, autoware_utils::to_polygon2d(pose, object.shape));
+    }
+    object.predicted_paths.push_back(predicted_path);
+    objects.push_back(object);
+  }
+  return objects;
+}
+
+RSSparams create_random_rss_parameters(std::mt19937 & gen)
+{
+  std::uniform_real_distribution<double> time_dist(0.0, 2.0);
+  std::uniform_real_distribution<double> distance_dist(0.0, 5.0);
+  std::uniform_real_distribution<double> lateral_distance_dist(0.0, 2.5);
+  std::uniform_real_distribution<double> deceleration_dist(-3.0, -0.5);
+  auto rss_params = create_rss_parameters(
+    time_dist(gen) / 2.0, time_dist(gen), time_dist(gen), distance_dist(gen),
+    deceleration_dist(gen), deceleration_dist(gen));
+  rss_params.lateral_distance_max_threshold = lateral_distance_dist(gen);
+  return rss_params;
+}
+
+TEST(BehaviorPathPlanningSafetyUtilsTest, SafetyCheckContextMatchesPairwiseCheck)
+{
+  using autoware::behavior_path_planner::utils::path_safety_checker::checkSafetyWithRSS;
+  using autoware::behavior_path_planner::utils::path_safety_checker::get_collided_polygons;
+  using autoware::behavior_path_planner::utils::path_safety_checker::SafetyCheckContext;
+
+  autoware::vehicle_info_utils::VehicleInfo vehicle_info{};
+  vehicle_info.max_longitudinal_offset_m = 3.8;
+  vehicle_info.min_longitudinal_offset_m = -1.0;
+  vehicle_info.rear_overhang_m = 1.0;
+  vehicle_info.vehicle_width_m = 1.9;
+  vehicle_info.max_lateral_offset_m = 0.95;
+  vehicle_info.min_lateral_offset_m = -0.95;
+  BehaviorPathPlannerParameters parameters;
+  parameters.vehicle_info = vehicle_info;
+  const auto planned_path = create_random_planned_path();
+
+  std::mt19937 gen(0);
+  size_t num_safe = 0;
+  size_t num_unsafe = 0;
+  for (int trial = 0; trial < 50; ++trial) {
+    const auto ego_predicted_path = create_random_ego_predicted_path(gen);
+    const auto objects = create_random_objects(gen);
+    const SafetyCheckContext context(objects);
+
+    for (const auto & policy : {"rectangle", "along_path"}) {
+      for (const double hysteresis_factor : {1.0, 1.5, 2.0}) {
+        auto rss_params = create_random_rss_parameters(gen);
+        rss_params.extended_polygon_policy = policy;
+        const double yaw_difference_th = trial % 2 == 0 ? M_PI_2 : M_PI;
+        const double max_velocity_limit =
+          trial % 3 == 0 ? 5.0 : std::numeric_limits<double>::max();
+        const std::string message = std::string(policy) + ", hysteresis factor " +
+                                    std::to_string(hysteresis_factor) + ", trial " +
+                                    std::to_string(trial);
+
+        const auto broad_phase = context.query(
+          planned_path, ego_predicted_path, vehicle_info, {rss_params}, hysteresis_factor,
+          max_velocity_limit);
+        for (const auto & object : objects) {
+          const auto & object_path = object.predicted_paths.front();
+          CollisionCheckDebug debug;
+          const auto collided_polygons = get_collided_polygons(
+            planned_path, ego_predicted_path, object, object_path, vehicle_info, rss_params,
+            hysteresis_factor, max_velocity_limit, yaw_difference_th, debug);
+          const auto broad_phase_collided_polygons = get_collided_polygons(
+            planned_path, ego_predicted_path, object, object_path, vehicle_info, rss_params,
+            hysteresis_factor, max_velocity_limit, yaw_difference_th, debug, broad_phase);
+          ASSERT_EQ(broad_phase_collided_polygons.size(), collided_polygons.size()) << message;
+          for (size_t i = 0; i < collided_polygons.size(); ++i) {
+            EXPECT_TRUE(
+              boost::geometry::equals(broad_phase_collided_polygons.at(i), collided_polygons.at(i)))
+              << message;
+          }
+        }
+
+        CollisionCheckDebugMap debug_map;
+        const bool is_safe = checkSafetyWithRSS(
+          planned_path, ego_predicted_path, objects, debug_map, parameters, rss_params, true,
+          hysteresis_factor, yaw_difference_th);
+        EXPECT_EQ(
+          checkSafetyWithRSS(
+            planned_path, ego_predicted_path, objects, debug_map, parameters, rss_params, true,
+            hysteresis_factor, yaw_difference_th, context),
+          is_safe)
+          << message;
+        if (is_safe) {
+          ++num_safe;
+        } else {
+          ++num_unsafe;
+        }
+      }
+    }
+  }
+  // both decisions are covered
+  EXPECT_GT(num_safe, 0u);
+  EXPECT_GT(num_unsafe, 0u);
+}
+
 TEST(BehaviorPathPlanningSafetyUtilsTest, checkPolygonsIntersects)
 {
   using autoware::behavior_path_planner::utils::path_safety_checker::checkPolygonsIntersects;
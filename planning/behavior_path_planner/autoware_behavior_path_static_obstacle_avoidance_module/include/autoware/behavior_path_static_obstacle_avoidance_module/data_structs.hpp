@@ -26,6 +26,7 @@
 #include <lanelet2_core/primitives/LineString.h>
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
@@ -711,6 +712,16 @@ struct ShiftLineData
 /*
  * Debug information for marker array
  */
+struct ObjectAttributeCacheStatistics
+{
+  size_t hit{0};
+
+  size_t miss{0};
+
+  // total time to compute the missed attributes [ms]
+  double computation_time{0.0};
+};
+
 struct DebugData
 {
   std::vector<geometry_msgs::msg::Polygon> detection_areas;
@@ -771,6 +782,9 @@ struct DebugData
 
   // debug msg array
   AvoidanceDebugMsgArray avoidance_debug_msg_array;
+
+  // object attribute cache, key: attribute name
+  std::map<std::string, ObjectAttributeCacheStatistics> attribute_cache;
 };
 
 }  // namespace autoware::behavior_path_planner
@@ -0,0 +1,206 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_PATH_STATIC_OBSTACLE_AVOIDANCE_MODULE__OBJECT_ATTRIBUTE_CACHE_HPP_
+#define AUTOWARE__BEHAVIOR_PATH_STATIC_OBSTACLE_AVOIDANCE_MODULE__OBJECT_ATTRIBUTE_CACHE_HPP_
+
+#include "autoware/behavior_path_static_obstacle_avoidance_module/data_structs.hpp"
+#include "autoware/behavior_path_static_obstacle_avoidance_module/type_alias.hpp"
+
+#include <autoware/route_handler/route_handler.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/primitives/LineString.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace autoware::behavior_path_planner::utils::static_obstacle_avoidance
+{
+
+using autoware::route_handler::RouteHandler;
+
+/**
+ * @brief map-derived attributes of a stopped object. they only depend on the lanelet map, the
+ * route and the object pose, so they are kept across planning cycles while the object stays still.
+ */
+struct ObjectAttributes
+{
+  // object pose when the attributes were computed.
+  Pose pose;
+
+  // closest reference path pose which the overhang lanelet was computed with.
+  Pose reference_pose;
+
+  // overhang lanelet id which the lanelet dependent attributes were computed with.
+  lanelet::Id overhang_lanelet_id{lanelet::InvalId};
+
+  // closest lanelet within route, nullopt if there is no such lanelet.
+  std::optional<std::optional<lanelet::ConstLanelet>> overhang_lanelet;
+
+  std::optional<bool> is_within_freespace;
+
+  // followings depend on the overhang lanelet.
+  std::optional<Pose> centerline_pose;
+
+  std::optional<bool> is_within_crosswalk;
+
+  std::optional<bool> is_within_intersection;
+
+  std::optional<bool> is_on_ego_lane;
+
+  std::optional<std::optional<lanelet::ConstLineString3d>> nearest_intersection_road_border;
+};
+
+enum class ObjectAttribute {
+  OVERHANG_LANELET = 0,
+  WITHIN_FREESPACE,
+  CENTERLINE_POSE,
+  WITHIN_CROSSWALK,
+  WITHIN_INTERSECTION,
+  ON_EGO_LANE,
+  NEAREST_INTERSECTION_ROAD_BORDER,
+  SIZE,
+};
+
+/**
+ * @brief cache of the map queries in the target object filtering, keyed by the object uuid. an
+ * entry is invalidated when the object moves, and the whole cache is cleared when the lanelet map
+ * or the route changes.
+ */
+class ObjectAttributeCache
+{
+public:
+  ObjectAttributeCache() = default;
+
+  ObjectAttributeCache(const double th_distance, const double th_yaw)
+  : th_distance_{th_distance}, th_yaw_{th_yaw}
+  {
+  }
+
+  /**
+   * @brief call once per planning cycle before the object filtering. it clears the cache if the map
+   * or the route has been changed, drops the objects not seen in the last cycle and resets the
+   * statistics.
+   * @param route handler.
+   */
+  void update(const std::shared_ptr<RouteHandler> & route_handler);
+
+  /**
+   * @brief get the attribute of the object from the cache, or compute and store it.
+   * @param object data. lanelet dependent attributes use the overhang lanelet of it.
+   * @param attribute type, which is used for the statistics.
+   * @param member of ObjectAttributes to store the attribute.
+   * @param function to compute the attribute on a cache miss.
+   * @return attribute.
+   */
+  template <typename T, typename Func>
+  T get(
+    const ObjectData & object, const ObjectAttribute type,
+    std::optional<T> ObjectAttributes::*member, Func && compute)
+  {
+    auto & attributes = find(object, isLaneletDependent(type));
+    auto & statistics = statistics_.at(static_cast<size_t>(type));
+
+    auto & value = attributes.*member;
+    if (value.has_value()) {
+      statistics.hit++;
+      return value.value();
+    }
+
+    statistics.miss++;
+    const auto start = std::chrono::steady_clock::now();
+    value = compute();
+    statistics.computation_time +=
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return value.value();
+  }
+
+  /**
+   * @brief get the overhang lanelet of the object from the cache, or compute and store it. it is
+   * looked up from the closest pose on the reference path, so it is also recomputed when that pose
+   * moves, e.g. after a lane change, even if the object stays still.
+   * @param object data.
+   * @param closest pose on the reference path to the object.
+   * @param function to compute the overhang lanelet on a cache miss.
+   * @return overhang lanelet, nullopt if there is no lanelet within route.
+   */
+  template <typename Func>
+  std::optional<lanelet::ConstLanelet> getOverhangLanelet(
+    const ObjectData & object, const Pose & reference_pose, Func && compute)
+  {
+    auto & attributes = find(object, false);
+    if (
+      !attributes.overhang_lanelet.has_value() ||
+      isMoved(attributes.reference_pose, reference_pose)) {
+      attributes.reference_pose = reference_pose;
+      attributes.overhang_lanelet = std::nullopt;
+    }
+    return get(
+      object, ObjectAttribute::OVERHANG_LANELET, &ObjectAttributes::overhang_lanelet,
+      std::forward<Func>(compute));
+  }
+
+  void clear()
+  {
+    attributes_.clear();
+    seen_.clear();
+  }
+
+  size_t size() const { return attributes_.size(); }
+
+  /**
+   * @brief statistics of the current cycle, key: attribute name.
+   */
+  std::map<std::string, ObjectAttributeCacheStatistics> getStatistics() const;
+
+private:
+  static bool isLaneletDependent(const ObjectAttribute type)
+  {
+    return type != ObjectAttribute::OVERHANG_LANELET && type != ObjectAttribute::WITHIN_FREESPACE;
+  }
+
+  ObjectAttributes & find(const ObjectData & object, const bool is_lanelet_dependent);
+
+  bool isMoved(const Pose & prev, const Pose & current) const;
+
+  std::unordered_map<std::string, ObjectAttributes> attributes_;
+
+  // objects accessed since the last update.
+  std::unordered_set<std::string> seen_;
+
+  std::array<ObjectAttributeCacheStatistics, static_cast<size_t>(ObjectAttribute::SIZE)>
+    statistics_{};
+
+  lanelet::LaneletMapConstPtr lanelet_map_ptr_{nullptr};
+
+  std::optional<UUID> route_uuid_{std::nullopt};
+
+  double th_distance_{0.1};
+
+  double th_yaw_{0.05};
+};
+
+}  // namespace autoware::behavior_path_planner::utils::static_obstacle_avoidance
+
+#endif  // AUTOWARE__BEHAVIOR_PATH_STATIC_OBSTACLE_AVOIDANCE_MODULE__OBJECT_ATTRIBUTE_CACHE_HPP_
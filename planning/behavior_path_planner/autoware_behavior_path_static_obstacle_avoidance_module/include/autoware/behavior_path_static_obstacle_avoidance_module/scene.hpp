@@ -20,6 +20,7 @@
 #include "autoware/behavior_path_planner_common/utils/path_safety_checker/safety_check.hpp"
 #include "autoware/behavior_path_static_obstacle_avoidance_module/data_structs.hpp"
 #include "autoware/behavior_path_static_obstacle_avoidance_module/helper.hpp"
+#include "autoware/behavior_path_static_obstacle_avoidance_module/object_attribute_cache.hpp"
 #include "autoware/behavior_path_static_obstacle_avoidance_module/shift_line_generator.hpp"
 #include "autoware/behavior_path_static_obstacle_avoidance_module/type_alias.hpp"
 
@@ -544,6 +545,9 @@ private:
 
   mutable std::unordered_map<std::string, rclcpp::Time> unknown_type_object_first_seen_time_map_;
 
+  // map query results of the objects, kept across planning cycles.
+  mutable utils::static_obstacle_avoidance::ObjectAttributeCache attribute_cache_;
+
   mutable size_t safe_count_{0};
 
   mutable DebugData debug_data_;
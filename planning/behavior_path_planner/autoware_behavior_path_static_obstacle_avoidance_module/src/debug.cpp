@@ -23,6 +23,7 @@
 #include <std_msgs/msg/color_rgba.hpp>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -327,6 +328,36 @@ MarkerArray createTurnSignalMarkerArray(const TurnSignalInfo & turn_signal_info,
   return msg;
 }
 
+MarkerArray createAttributeCacheMarkerArray(
+  const std::map<std::string, ObjectAttributeCacheStatistics> & statistics, const Pose & pose,
+  std::string && ns)
+{
+  MarkerArray msg;
+
+  if (statistics.empty()) {
+    return msg;
+  }
+
+  auto marker = create_default_marker(
+    "map", rclcpp::Clock{RCL_ROS_TIME}.now(), ns, 0L, Marker::TEXT_VIEW_FACING,
+    create_marker_scale(0.5, 0.5, 0.5), create_marker_color(1.0, 1.0, 1.0, 0.999));
+
+  marker.pose = pose;
+  marker.pose.position.z += 3.0;
+  std::ostringstream string_stream;
+  string_stream << std::fixed << std::setprecision(2);
+  for (const auto & [name, s] : statistics) {
+    const auto total = s.hit + s.miss;
+    const auto hit_rate = total == 0 ? 0.0 : static_cast<double>(s.hit) / total;
+    string_stream << name << " hit:" << s.hit << "/" << total << " (" << hit_rate * 100.0
+                  << "%) time:" << s.computation_time << " [ms]\n";
+  }
+  marker.text = string_stream.str();
+  msg.markers.push_back(marker);
+
+  return msg;
+}
+
 }  // namespace
 
 MarkerArray createAvoidLineMarkerArray(
@@ -749,6 +780,8 @@ MarkerArray createDebugMarkerArray(
   if (parameters->enable_misc_marker) {
     add(createPathMarkerArray(path, "centerline_resampled", 0, 0.0, 0.9, 0.5));
     add(createTurnSignalMarkerArray(output.turn_signal_info, "turn_signal_info"));
+    add(createAttributeCacheMarkerArray(
+      debug.attribute_cache, data.reference_pose, "object_attribute_cache"));
   }
 
   return msg;
@@ -0,0 +1,103 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_path_static_obstacle_avoidance_module/object_attribute_cache.hpp"
+
+#include <autoware_utils/geometry/geometry.hpp>
+#include <autoware_utils/math/normalization.hpp>
+#include <magic_enum.hpp>
+
+#include <tf2/utils.h>
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace autoware::behavior_path_planner::utils::static_obstacle_avoidance
+{
+
+void ObjectAttributeCache::update(const std::shared_ptr<RouteHandler> & route_handler)
+{
+  statistics_.fill(ObjectAttributeCacheStatistics{});
+
+  const auto lanelet_map_ptr = route_handler->getLaneletMapPtr();
+  const auto route_uuid = route_handler->getRouteUuid();
+  if (lanelet_map_ptr != lanelet_map_ptr_ || route_uuid != route_uuid_) {
+    clear();
+    lanelet_map_ptr_ = lanelet_map_ptr;
+    route_uuid_ = route_uuid;
+    return;
+  }
+
+  // drop the objects which weren't filtered in the last cycle.
+  for (auto itr = attributes_.begin(); itr != attributes_.end();) {
+    if (seen_.count(itr->first) == 0) {
+      itr = attributes_.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+  seen_.clear();
+}
+
+std::map<std::string, ObjectAttributeCacheStatistics> ObjectAttributeCache::getStatistics() const
+{
+  std::map<std::string, ObjectAttributeCacheStatistics> ret;
+  for (size_t i = 0; i < statistics_.size(); ++i) {
+    const auto name = magic_enum::enum_name(static_cast<ObjectAttribute>(i));
+    ret.emplace(std::string(name), statistics_.at(i));
+  }
+  return ret;
+}
+
+ObjectAttributes & ObjectAttributeCache::find(
+  const ObjectData & object, const bool is_lanelet_dependent)
+{
+  const auto id = to_hex_string(object.object.object_id);
+  seen_.insert(id);
+
+  auto itr = attributes_.find(id);
+  if (itr == attributes_.end() || isMoved(itr->second.pose, object.getPose())) {
+    ObjectAttributes attributes;
+    attributes.pose = object.getPose();
+    attributes.overhang_lanelet_id = object.overhang_lanelet.id();
+    itr = attributes_.insert_or_assign(id, attributes).first;
+  }
+
+  auto & attributes = itr->second;
+  if (is_lanelet_dependent && attributes.overhang_lanelet_id != object.overhang_lanelet.id()) {
+    attributes.overhang_lanelet_id = object.overhang_lanelet.id();
+    attributes.centerline_pose = std::nullopt;
+    attributes.is_within_crosswalk = std::nullopt;
+    attributes.is_within_intersection = std::nullopt;
+    attributes.is_on_ego_lane = std::nullopt;
+    attributes.nearest_intersection_road_border = std::nullopt;
+  }
+
+  return attributes;
+}
+
+bool ObjectAttributeCache::isMoved(const Pose & prev, const Pose & current) const
+{
+  if (autoware_utils::calc_distance2d(prev, current) > th_distance_) {
+    return true;
+  }
+
+  const auto yaw_diff = autoware_utils::normalize_radian(
+    tf2::getYaw(current.orientation) - tf2::getYaw(prev.orientation));
+  return std::abs(yaw_diff) > th_yaw_;
+}
+
+}  // namespace autoware::behavior_path_planner::utils::static_obstacle_avoidance
@@ -409,8 +409,17 @@ void StaticObstacleAvoidanceModule::fillAvoidanceTargetObjects(
   }
 
   // Filter out the objects to determine the ones to be avoided.
-  filterTargetObjects(objects, data, forward_detection_range, planner_data_, parameters_);
-  updateRoadShoulderDistance(data, planner_data_, parameters_);
+  attribute_cache_.update(planner_data_->route_handler);
+  {
+    autoware_utils::ScopedTimeTrack st2("filterTargetObjects", *time_keeper_);
+    filterTargetObjects(
+      objects, data, forward_detection_range, planner_data_, parameters_, attribute_cache_);
+  }
+  {
+    autoware_utils::ScopedTimeTrack st2("updateRoadShoulderDistance", *time_keeper_);
+    updateRoadShoulderDistance(data, planner_data_, parameters_, attribute_cache_);
+  }
+  debug.attribute_cache = attribute_cache_.getStatistics();
 
   // debug
   {
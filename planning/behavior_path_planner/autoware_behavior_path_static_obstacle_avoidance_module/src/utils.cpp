@@ -19,6 +19,7 @@
 #include "autoware/behavior_path_planner_common/utils/path_utils.hpp"
 #include "autoware/behavior_path_planner_common/utils/traffic_light_utils.hpp"
 #include "autoware/behavior_path_static_obstacle_avoidance_module/data_structs.hpp"
+#include "autoware/behavior_path_static_obstacle_avoidance_module/object_attribute_cache.hpp"
 #include "autoware/behavior_path_static_obstacle_avoidance_module/utils.hpp"
 
 #include <Eigen/Dense>
@@ -617,11 +618,12 @@ std::optional<lanelet::ConstLineString3d> getNearestIntersectionRoadBorder(
  * @param object polygon.
  * @param route_handler.
  * @param parameters.
+ * @param cache of the nearest road border.
  * @return if the object is close to road shoulder of the lane, return true.
  */
 bool isParkingViolation(
   const ObjectData & object, const std::shared_ptr<RouteHandler> & route_handler,
-  const std::shared_ptr<AvoidanceParameters> & parameters)
+  const std::shared_ptr<AvoidanceParameters> & parameters, ObjectAttributeCache & attribute_cache)
 {
   // check parking violation area
   if (!object.is_within_intersection) {
@@ -629,7 +631,10 @@ bool isParkingViolation(
   }
 
   // mark a vehicle as an object to avoid if it is pulled to the side and oriented with the lane.
-  const auto nearest_road_border_opt = getNearestIntersectionRoadBorder(object, route_handler);
+  const auto nearest_road_border_opt = attribute_cache.get(
+    object, ObjectAttribute::NEAREST_INTERSECTION_ROAD_BORDER,
+    &ObjectAttributes::nearest_intersection_road_border,
+    [&]() { return getNearestIntersectionRoadBorder(object, route_handler); });
   if (!nearest_road_border_opt.has_value()) {
     return false;
   }
@@ -890,9 +895,13 @@ bool isNeverAvoidanceTarget(
 bool isObviousAvoidanceTarget(
   ObjectData & object, [[maybe_unused]] const AvoidancePlanningData & data,
   [[maybe_unused]] const std::shared_ptr<const PlannerData> & planner_data,
-  [[maybe_unused]] const std::shared_ptr<AvoidanceParameters> & parameters)
+  [[maybe_unused]] const std::shared_ptr<AvoidanceParameters> & parameters,
+  ObjectAttributeCache & attribute_cache)
 {
-  if (isWithinFreespace(object, planner_data->route_handler)) {
+  const auto is_within_freespace = attribute_cache.get(
+    object, ObjectAttribute::WITHIN_FREESPACE, &ObjectAttributes::is_within_freespace,
+    [&]() { return isWithinFreespace(object, planner_data->route_handler); });
+  if (is_within_freespace) {
     if (!object.is_on_ego_lane) {
       if (object.stop_time > parameters->freespace_condition_th_stopped_time) {
         return true;
@@ -1037,10 +1046,14 @@ bool isSatisfiedWithCommonCondition(
 bool isSatisfiedWithNonVehicleCondition(
   ObjectData & object, [[maybe_unused]] const AvoidancePlanningData & data,
   const std::shared_ptr<const PlannerData> & planner_data,
-  [[maybe_unused]] const std::shared_ptr<AvoidanceParameters> & parameters)
+  [[maybe_unused]] const std::shared_ptr<AvoidanceParameters> & parameters,
+  ObjectAttributeCache & attribute_cache)
 {
   // avoidance module ignore pedestrian and bicycle around crosswalk
-  if (isWithinCrosswalk(object, planner_data->route_handler->getOverallGraphPtr())) {
+  const auto is_within_crosswalk = attribute_cache.get(
+    object, ObjectAttribute::WITHIN_CROSSWALK, &ObjectAttributes::is_within_crosswalk,
+    [&]() { return isWithinCrosswalk(object, planner_data->route_handler->getOverallGraphPtr()); });
+  if (is_within_crosswalk) {
     object.info = ObjectInfo::CROSSWALK_USER;
     return false;
   }
@@ -1060,7 +1073,9 @@ bool isSatisfiedWithNonVehicleCondition(
     return false;
   }
 
-  object.is_on_ego_lane = isOnEgoLane(object, planner_data->route_handler);
+  object.is_on_ego_lane = attribute_cache.get(
+    object, ObjectAttribute::ON_EGO_LANE, &ObjectAttributes::is_on_ego_lane,
+    [&]() { return isOnEgoLane(object, planner_data->route_handler); });
   const auto right_lane =
     planner_data->route_handler->getRightLanelet(object.overhang_lanelet, true, true);
   const bool ignore_right_object = [&]() {
@@ -1139,13 +1154,13 @@ ObjectData::Behavior getObjectBehavior(
 bool isSatisfiedWithVehicleCondition(
   ObjectData & object, const AvoidancePlanningData & data,
   const std::shared_ptr<const PlannerData> & planner_data,
-  const std::shared_ptr<AvoidanceParameters> & parameters)
+  const std::shared_ptr<AvoidanceParameters> & parameters, ObjectAttributeCache & attribute_cache)
 {
   if (isNeverAvoidanceTarget(object, data, planner_data, parameters)) {
     return false;
   }
 
-  if (isObviousAvoidanceTarget(object, data, planner_data, parameters)) {
+  if (isObviousAvoidanceTarget(object, data, planner_data, parameters, attribute_cache)) {
     return true;
   }
 
@@ -1267,7 +1282,7 @@ std::optional<double> getAvoidMargin(
  */
 double getRoadShoulderDistance(
   ObjectData & object, const AvoidancePlanningData & data,
-  const std::shared_ptr<const PlannerData> & planner_data)
+  const std::shared_ptr<const PlannerData> & planner_data, ObjectAttributeCache & attribute_cache)
 {
   using autoware_utils::Point2d;
   using lanelet::utils::to2D;
@@ -1276,14 +1291,26 @@ double getRoadShoulderDistance(
     autoware::motion_utils::findNearestIndex(data.reference_path.points, object.getPosition());
   const auto object_closest_pose = data.reference_path.points.at(object_closest_index).point.pose;
 
-  const auto rh = planner_data->route_handler;
-  if (!rh->getClosestLaneletWithinRoute(object_closest_pose, &object.overhang_lanelet)) {
+  const auto overhang_lanelet = attribute_cache.getOverhangLanelet(
+    object, object_closest_pose, [&]() -> std::optional<lanelet::ConstLanelet> {
+      lanelet::ConstLanelet closest_lanelet;
+      if (!planner_data->route_handler->getClosestLaneletWithinRoute(
+            object_closest_pose, &closest_lanelet)) {
+        return std::nullopt;
+      }
+      return closest_lanelet;
+    });
+  if (!overhang_lanelet.has_value()) {
     return 0.0;
   }
+  object.overhang_lanelet = overhang_lanelet.value();
 
-  const auto centerline_pose = autoware::experimental::lanelet2_utils::get_closest_center_pose(
-    object.overhang_lanelet,
-    autoware::experimental::lanelet2_utils::from_ros(object.getPosition()));
+  const auto centerline_pose = attribute_cache.get(
+    object, ObjectAttribute::CENTERLINE_POSE, &ObjectAttributes::centerline_pose, [&]() {
+      return autoware::experimental::lanelet2_utils::get_closest_center_pose(
+        object.overhang_lanelet,
+        autoware::experimental::lanelet2_utils::from_ros(object.getPosition()));
+    });
   // TODO(Satoshi OTA): check if the basic point is on right or left of bound.
   const auto bound = isOnRight(object) ? data.left_bound : data.right_bound;
   const auto envelope_polygon_width = boost::geometry::area(object.envelope_poly) /
@@ -2191,7 +2218,7 @@ void updateClipObject(ObjectDataArray & clip_objects, AvoidancePlanningData & da
 
 void updateRoadShoulderDistance(
   AvoidancePlanningData & data, const std::shared_ptr<const PlannerData> & planner_data,
-  const std::shared_ptr<AvoidanceParameters> & parameters)
+  const std::shared_ptr<AvoidanceParameters> & parameters, ObjectAttributeCache & attribute_cache)
 {
   ObjectDataArray clip_objects;
   std::for_each(data.other_objects.begin(), data.other_objects.end(), [&](const auto & object) {
@@ -2224,7 +2251,8 @@ void updateRoadShoulderDistance(
   data.right_bound = tmp_path.right_bound;
 
   for (auto & o : data.target_objects) {
-    o.to_road_shoulder_distance = filtering_utils::getRoadShoulderDistance(o, data, planner_data);
+    o.to_road_shoulder_distance =
+      filtering_utils::getRoadShoulderDistance(o, data, planner_data, attribute_cache);
     o.avoid_margin = filtering_utils::getAvoidMargin(o, planner_data, parameters);
   }
 }
@@ -2232,7 +2260,7 @@ void updateRoadShoulderDistance(
 void filterTargetObjects(
   ObjectDataArray & objects, AvoidancePlanningData & data, const double forward_detection_range,
   const std::shared_ptr<const PlannerData> & planner_data,
-  const std::shared_ptr<AvoidanceParameters> & parameters)
+  const std::shared_ptr<AvoidanceParameters> & parameters, ObjectAttributeCache & attribute_cache)
 {
   if (data.current_lanelets.empty()) {
     return;
@@ -2267,7 +2295,8 @@ void filterTargetObjects(
       planner_data->parameters.vehicle_info.wheel_base_m +
         planner_data->parameters.vehicle_info.front_overhang_m,
       planner_data->parameters.vehicle_info.rear_overhang_m);
-    o.to_road_shoulder_distance = filtering_utils::getRoadShoulderDistance(o, data, planner_data);
+    o.to_road_shoulder_distance =
+      filtering_utils::getRoadShoulderDistance(o, data, planner_data, attribute_cache);
 
     if (filtering_utils::isUnknownTypeObject(o)) {
       if (o.is_classification_unstable) {
@@ -2279,15 +2308,18 @@ void filterTargetObjects(
     } else if (filtering_utils::isVehicleTypeObject(o)) {
       // TARGET: CAR, TRUCK, BUS, TRAILER, MOTORCYCLE
       o.behavior = filtering_utils::getObjectBehavior(o, parameters);
-      o.is_on_ego_lane = filtering_utils::isOnEgoLane(o, planner_data->route_handler);
+      o.is_on_ego_lane = attribute_cache.get(
+        o, ObjectAttribute::ON_EGO_LANE, &ObjectAttributes::is_on_ego_lane,
+        [&]() { return filtering_utils::isOnEgoLane(o, planner_data->route_handler); });
 
-      o.is_within_intersection =
-        filtering_utils::isWithinIntersection(o, planner_data->route_handler);
+      o.is_within_intersection = attribute_cache.get(
+        o, ObjectAttribute::WITHIN_INTERSECTION, &ObjectAttributes::is_within_intersection,
+        [&]() { return filtering_utils::isWithinIntersection(o, planner_data->route_handler); });
       o.shiftable_ratio =
         filtering_utils::getShiftableRatio(o, planner_data->route_handler, parameters);
       o.to_centerline = filtering_utils::getDistanceToCenterline(o, data);
-      o.is_parking_violation =
-        filtering_utils::isParkingViolation(o, planner_data->route_handler, parameters);
+      o.is_parking_violation = filtering_utils::isParkingViolation(
+        o, planner_data->route_handler, parameters, attribute_cache);
       o.is_parked = filtering_utils::isParkedVehicle(o, parameters);
       o.is_adjacent_lane_stop_vehicle = filtering_utils::isAdjacentLaneStopVehicle(o);
       o.avoid_margin = filtering_utils::getAvoidMargin(o, planner_data, parameters);
@@ -2297,15 +2329,17 @@ void filterTargetObjects(
         continue;
       }
 
-      if (!filtering_utils::isSatisfiedWithVehicleCondition(o, data, planner_data, parameters)) {
+      if (!filtering_utils::isSatisfiedWithVehicleCondition(
+            o, data, planner_data, parameters, attribute_cache)) {
         data.other_objects.push_back(o);
         continue;
       }
     } else {
       // TARGET: PEDESTRIAN, BICYCLE
 
-      o.is_within_intersection =
-        filtering_utils::isWithinIntersection(o, planner_data->route_handler);
+      o.is_within_intersection = attribute_cache.get(
+        o, ObjectAttribute::WITHIN_INTERSECTION, &ObjectAttributes::is_within_intersection,
+        [&]() { return filtering_utils::isWithinIntersection(o, planner_data->route_handler); });
       o.is_parked = false;
       o.avoid_margin = filtering_utils::getAvoidMargin(o, planner_data, parameters);
 
@@ -2314,7 +2348,8 @@ void filterTargetObjects(
         continue;
       }
 
-      if (!filtering_utils::isSatisfiedWithNonVehicleCondition(o, data, planner_data, parameters)) {
+      if (!filtering_utils::isSatisfiedWithNonVehicleCondition(
+            o, data, planner_data, parameters, attribute_cache)) {
         data.other_objects.push_back(o);
         continue;
       }
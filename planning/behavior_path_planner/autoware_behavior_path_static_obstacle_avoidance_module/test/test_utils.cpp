@@ -28,6 +28,7 @@
 
 #include <limits>
 #include <memory>
+#include <optional>
 
 namespace autoware::behavior_path_planner::utils::static_obstacle_avoidance
 {
@@ -1584,4 +1585,76 @@ TEST(TestUtils, calcErrorEclipseLongRadius)
 
   EXPECT_DOUBLE_EQ(calcErrorEclipseLongRadius(pose_with_covariance), 3.0);
 }
+
+TEST(TestUtils, ObjectAttributeCache)
+{
+  ObjectAttributeCache cache(0.1, deg2rad(3.0));
+
+  const auto pose = geometry_msgs::build<geometry_msgs::msg::Pose>()
+                      .position(create_point(3.0, 3.0, 0.0))
+                      .orientation(create_quaternion_from_rpy(0.0, 0.0, 0.0));
+  auto object =
+    create_test_object(pose, create_vector3(0.0, 0.0, 0.0), Shape{}, ObjectClassification::CAR);
+  object.object.object_id = generate_uuid();
+  object.overhang_lanelet =
+    lanelet::Lanelet(1, lanelet::LineString3d(2), lanelet::LineString3d(3));
+
+  int intersection_count = 0;
+  int freespace_count = 0;
+  const auto is_within_intersection = [&]() {
+    return cache.get(
+      object, ObjectAttribute::WITHIN_INTERSECTION, &ObjectAttributes::is_within_intersection,
+      [&]() {
+        intersection_count++;
+        return true;
+      });
+  };
+  const auto is_within_freespace = [&]() {
+    return cache.get(
+      object, ObjectAttribute::WITHIN_FREESPACE, &ObjectAttributes::is_within_freespace, [&]() {
+        freespace_count++;
+        return false;
+      });
+  };
+
+  // computed only once for the same object.
+  EXPECT_TRUE(is_within_intersection());
+  EXPECT_FALSE(is_within_freespace());
+  EXPECT_TRUE(is_within_intersection());
+  EXPECT_FALSE(is_within_freespace());
+  EXPECT_EQ(intersection_count, 1);
+  EXPECT_EQ(freespace_count, 1);
+
+  // small pose noise keeps the cache.
+  object.object.kinematics.initial_pose_with_covariance.pose.position.x += 0.05;
+  is_within_intersection();
+  EXPECT_EQ(intersection_count, 1);
+
+  // the lanelet dependent attributes are recomputed when the overhang lanelet changes.
+  object.overhang_lanelet =
+    lanelet::Lanelet(4, lanelet::LineString3d(5), lanelet::LineString3d(6));
+  is_within_intersection();
+  is_within_freespace();
+  EXPECT_EQ(intersection_count, 2);
+  EXPECT_EQ(freespace_count, 1);
+
+  // all attributes are recomputed when the object moves.
+  object.object.kinematics.initial_pose_with_covariance.pose.position.x += 0.5;
+  is_within_intersection();
+  is_within_freespace();
+  EXPECT_EQ(intersection_count, 3);
+  EXPECT_EQ(freespace_count, 2);
+
+  object.object.kinematics.initial_pose_with_covariance.pose.orientation =
+    create_quaternion_from_rpy(0.0, 0.0, deg2rad(10.0));
+  is_within_intersection();
+  EXPECT_EQ(intersection_count, 4);
+
+  const auto statistics = cache.getStatistics();
+  EXPECT_EQ(statistics.at("WITHIN_INTERSECTION").hit, 2u);
+  EXPECT_EQ(statistics.at("WITHIN_INTERSECTION").miss, 4u);
+  EXPECT_EQ(statistics.at("WITHIN_FREESPACE").hit, 2u);
+  EXPECT_EQ(statistics.at("WITHIN_FREESPACE").miss, 2u);
+  EXPECT_EQ(cache.size(), 1u);
+}
 }  // namespace autoware::behavior_path_planner::utils::static_obstacle_avoidance
@@ -0,0 +1,126 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__BEHAVIOR_VELOCITY_INTERSECTION_MODULE__OCCLUSION_RASTER_HPP_
+#define AUTOWARE__BEHAVIOR_VELOCITY_INTERSECTION_MODULE__OCCLUSION_RASTER_HPP_
+
+#include <opencv2/core.hpp>
+
+#include <nav_msgs/msg/occupancy_grid.hpp>
+
+#include <lanelet2_core/primitives/CompoundPolygon.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+
+#include <optional>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+
+/**
+ * @brief cache the attention area raster of an intersection for occlusion detection
+ *
+ * the attention area (occlusion attention area minus the adjacent lanes) is static for an
+ * intersection, so it is rasterized in map frame and copied to the occupancy grid only when the
+ * grid origin moves. the raster is aligned to the cells of the grid, and it is rasterized again
+ * only if the grid is not moved by whole cells (or the resolution is changed), so that the copy is
+ * the same as rasterizing the attention area on the grid. all the masks are limited to the bounding
+ * box of the attention area on the grid (ROI) and their buffers are reused across the cycles.
+ *
+ * NOTE: unlike the rasterization on the whole grid, the polygons are not clipped to the grid, so
+ * if the attention area crosses the border of the grid, the antialiased edges near the border and
+ * the slanted edges crossing it can be slightly different.
+ *
+ * the image coordinate follows detectOcclusion(), i.e. the cell (idx_x, idx_y) of the grid is the
+ * pixel (x = idx_x, y = height - 1 - idx_y) of the grid image. the masks are of the ROI size, so
+ * the pixel is (x - roi().x, y - roi().y) in them.
+ */
+class OcclusionRaster
+{
+public:
+  /**
+   * @brief set the attention area. it does nothing after the first call since the attention area
+   * of an intersection is static
+   */
+  void prepare(
+    const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+    const lanelet::ConstLanelets & adjacent_lanelets);
+
+  /**
+   * @brief copy the attention area to the grid if the grid has been changed, and allocate the
+   * masks of the ROI size
+   * @param margin the ROI is expanded by this number of cells so that the morphology on the ROI is
+   * the same as on the whole grid inside the attention area
+   * @return false if the attention area is out of the grid
+   */
+  bool update(const nav_msgs::msg::OccupancyGrid & occ_grid, const int margin);
+
+  //! ROI on the grid image
+  const cv::Rect & roi() const { return roi_; }
+
+  //! attention: 255, non-attention: 0
+  const cv::Mat & attention_mask() const { return attention_mask_; }
+
+  //! buffers of the ROI size, which are reused across the cycles
+  cv::Mat unknown_mask_raw;
+  cv::Mat unknown_mask;
+  cv::Mat occlusion_mask;
+  cv::Mat blocking_mask;
+
+private:
+  struct GridInfo
+  {
+    double origin_x{0.0};
+    double origin_y{0.0};
+    double resolution{0.0};
+    int width{0};
+    int height{0};
+    int margin{0};
+
+    bool operator==(const GridInfo & other) const
+    {
+      return origin_x == other.origin_x && origin_y == other.origin_y &&
+             resolution == other.resolution && width == other.width && height == other.height &&
+             margin == other.margin;
+    }
+  };
+
+  //! rasterize the attention area in map frame aligned to the cells of the grid
+  void rasterize(const GridInfo & grid_info);
+
+  //! whether the raster is aligned to the cells of the grid
+  bool isAligned(const GridInfo & grid_info) const;
+
+  bool is_prepared_{false};
+  std::vector<std::vector<cv::Point2d>> attention_polygons_;
+  std::vector<std::vector<cv::Point2d>> adjacent_polygons_;
+  cv::Point2d attention_min_;
+  cv::Point2d attention_max_;
+
+  //! attention area in map frame, whose bottom-left cell is (map_origin_x_, map_origin_y_)
+  cv::Mat map_attention_mask_;
+  double map_origin_x_{0.0};
+  double map_origin_y_{0.0};
+  double map_resolution_{0.0};
+
+  //! grid info of the last update()
+  std::optional<GridInfo> grid_info_{std::nullopt};
+  bool is_in_grid_{false};
+  cv::Rect roi_;
+  cv::Mat attention_mask_;
+};
+
+}  // namespace autoware::behavior_velocity_planner
+
+#endif  // AUTOWARE__BEHAVIOR_VELOCITY_INTERSECTION_MODULE__OCCLUSION_RASTER_HPP_
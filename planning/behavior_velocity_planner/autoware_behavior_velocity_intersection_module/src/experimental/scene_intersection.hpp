@@ -20,6 +20,7 @@
 #include "autoware/behavior_velocity_intersection_module/intersection_lanelets.hpp"
 #include "autoware/behavior_velocity_intersection_module/intersection_stoplines.hpp"
 #include "autoware/behavior_velocity_intersection_module/object_manager.hpp"
+#include "autoware/behavior_velocity_intersection_module/occlusion_raster.hpp"
 #include "autoware/behavior_velocity_intersection_module/result.hpp"
 
 #include <autoware/behavior_velocity_planner_common/utilization/state_machine.hpp>
@@ -387,6 +388,9 @@ private:
   std::optional<std::vector<lanelet::ConstLineString3d>> occlusion_attention_divisions_{
     std::nullopt};
 
+  //! cache rasterized occlusion attention area and the buffers for detectOcclusion()
+  mutable OcclusionRaster occlusion_raster_;
+
   //! save the time when ego observed green traffic light before entering the intersection
   std::optional<rclcpp::Time> initial_green_light_observed_time_{std::nullopt};
   /** @}*/
@@ -150,6 +150,14 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   grid_poly.outer().emplace_back(origin.x, origin.y);
   bg::correct(grid_poly);
 
+  // a cell of the grid on the ROI of occlusion_raster_
+  auto coord2roi = [&](const double x, const double y, const cv::Rect & roi) {
+    const auto [valid, idx_x, idx_y] = coord2index(x, y);
+    const cv::Point pixel(idx_x, height - 1 - idx_y);
+    if (!valid || !roi.contains(pixel)) return std::make_tuple(false, -1, -1);
+    return std::make_tuple(true, pixel.x - roi.x, pixel.y - roi.y);
+  };
+
   auto findCommonCvPolygons =
     [&](const auto & area2d, std::vector<std::vector<cv::Point>> & cv_polygons) -> void {
     autoware_utils::Polygon2d area2d_poly;
@@ -178,49 +186,45 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     }
   };
 
+  const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
+  for (const auto & blocking_attention_object_info : blocking_attention_objects) {
+    debug_data_.parked_targets.objects.push_back(
+      blocking_attention_object_info->predicted_object());
+  }
+
   // (1) prepare detection area mask
   // attention: 255
   // non-attention: 0
-  // NOTE: interesting area is set to 255 for later masking
-  cv::Mat attention_mask(width, height, CV_8UC1, cv::Scalar(0));
-  std::vector<std::vector<cv::Point>> attention_area_cv_polygons;
-  for (const auto & attention_area : attention_areas) {
-    const auto area2d = lanelet::utils::to2D(attention_area);
-    findCommonCvPolygons(area2d, attention_area_cv_polygons);
-  }
-  for (const auto & poly : attention_area_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(255), cv::LINE_AA);
-  }
-  // (1.1)
-  // reset adjacent_lanelets area to 0 on attention_mask
-  std::vector<std::vector<cv::Point>> adjacent_lane_cv_polygons;
-  for (const auto & adjacent_lanelet : adjacent_lanelets) {
-    const auto area2d = adjacent_lanelet.polygon2d().basicPolygon();
-    findCommonCvPolygons(area2d, adjacent_lane_cv_polygons);
-  }
-  for (const auto & poly : adjacent_lane_cv_polygons) {
-    cv::fillPoly(attention_mask, poly, cv::Scalar(0), cv::LINE_AA);
+  // NOTE: interesting area is set to 255 for later masking. the attention area without the
+  // adjacent lanes is rasterized only once, and all the masks below are limited to its bounding box
+  // (ROI) on the grid
+  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+  occlusion_raster_.prepare(attention_areas, adjacent_lanelets);
+  if (!occlusion_raster_.update(occ_grid, std::max(morph_size, 1))) {
+    return NotOccluded{std::numeric_limits<double>::infinity()};
   }
+  const auto & roi = occlusion_raster_.roi();
+  const auto & attention_mask = occlusion_raster_.attention_mask();
 
   // (2) prepare unknown mask
   // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
   // unknown: 255
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
-    for (int y = 0; y < height; y++) {
-      const int idx = y * width + x;
+  auto & unknown_mask_raw = occlusion_raster_.unknown_mask_raw;
+  auto & unknown_mask = occlusion_raster_.unknown_mask;
+  for (int y = 0; y < roi.height; y++) {
+    const int idx_y = height - 1 - (roi.y + y);
+    auto * unknown_mask_raw_row = unknown_mask_raw.ptr<unsigned char>(y);
+    for (int x = 0; x < roi.width; x++) {
+      const int idx = idx_y * width + roi.x + x;
       const unsigned char intensity = occ_grid.data.at(idx);
-      if (
-        planner_param_.occlusion.free_space_max <= intensity &&
-        intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
-      }
+      unknown_mask_raw_row[x] = (planner_param_.occlusion.free_space_max <= intensity &&
+                                 intensity < planner_param_.occlusion.occupied_min)
+                                  ? 255
+                                  : 0;
     }
   }
   // (2.1) apply morphologyEx
-  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
   cv::morphologyEx(
     unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
     cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
@@ -228,16 +232,11 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
   static constexpr unsigned char BLOCKED = 127;
-  cv::Mat occlusion_mask(width, height, CV_8UC1, cv::Scalar(0));
+  auto & occlusion_mask = occlusion_raster_.occlusion_mask;
   cv::bitwise_and(attention_mask, unknown_mask, occlusion_mask);
-  // re-use attention_mask
-  attention_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
-  // (3.1) draw all cells on attention_mask behind blocking vehicles as not occluded
-  const auto & blocking_attention_objects = object_info_manager_.parkedObjects();
-  for (const auto & blocking_attention_object_info : blocking_attention_objects) {
-    debug_data_.parked_targets.objects.push_back(
-      blocking_attention_object_info->predicted_object());
-  }
+  // (3.1) draw all cells on blocking_mask behind blocking vehicles as not occluded
+  auto & blocking_mask = occlusion_raster_.blocking_mask;
+  blocking_mask.setTo(cv::Scalar(0));
   std::vector<std::vector<cv::Point>> blocking_polygons;
   for (const auto & blocking_attention_object_info : blocking_attention_objects) {
     const Polygon2d obj_poly =
@@ -245,20 +244,21 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     findCommonCvPolygons(obj_poly.outer(), blocking_polygons);
   }
   for (const auto & blocking_polygon : blocking_polygons) {
-    cv::fillPoly(attention_mask, blocking_polygon, cv::Scalar(BLOCKED), cv::LINE_AA);
+    cv::fillPoly(
+      blocking_mask, blocking_polygon, cv::Scalar(BLOCKED), cv::LINE_AA, 0, -roi.tl());
   }
   for (const auto & division : lane_divisions) {
     bool blocking_vehicle_found = false;
     for (const auto & point_it : division) {
-      const auto [valid, idx_x, idx_y] = coord2index(point_it.x(), point_it.y());
+      const auto [valid, roi_x, roi_y] = coord2roi(point_it.x(), point_it.y(), roi);
       if (!valid) continue;
       if (blocking_vehicle_found) {
-        occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x) = 0;
+        occlusion_mask.at<unsigned char>(roi_y, roi_x) = 0;
         continue;
       }
-      if (attention_mask.at<unsigned char>(height - 1 - idx_y, idx_x) == BLOCKED) {
+      if (blocking_mask.at<unsigned char>(roi_y, roi_x) == BLOCKED) {
         blocking_vehicle_found = true;
-        occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x) = 0;
+        occlusion_mask.at<unsigned char>(roi_y, roi_x) = 0;
       }
     }
   }
@@ -269,7 +269,9 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
   const double possible_object_bbox_y = possible_object_bbox.at(1) / resolution;
   const double possible_object_area = possible_object_bbox_x * possible_object_bbox_y;
   std::vector<std::vector<cv::Point>> contours;
-  cv::findContours(occlusion_mask, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE);
+  // NOTE: contours are in the grid image coordinate
+  cv::findContours(
+    occlusion_mask, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_NONE, roi.tl());
   std::vector<std::vector<cv::Point>> valid_contours;
   for (const auto & contour : contours) {
     if (contour.size() <= 2) {
@@ -305,10 +307,11 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
     debug_data_.occlusion_polygons.push_back(polygon_msg);
   }
   // (4.1) re-draw occluded cells using valid_contours
-  occlusion_mask = cv::Mat(width, height, CV_8UC1, cv::Scalar(0));
+  occlusion_mask.setTo(cv::Scalar(0));
   for (const auto & valid_contour : valid_contours) {
     // NOTE: drawContour does not work well
-    cv::fillPoly(occlusion_mask, valid_contour, cv::Scalar(OCCLUDED), cv::LINE_AA);
+    cv::fillPoly(
+      occlusion_mask, valid_contour, cv::Scalar(OCCLUDED), cv::LINE_AA, 0, -roi.tl());
   }
 
   // (5) find distance
@@ -392,9 +395,9 @@ IntersectionModule::OcclusionType IntersectionModule::detectOcclusion(
         std::hypot(point_it->x() - acc_dist_it->x(), point_it->y() - acc_dist_it->y());
       acc_dist += dist;
       acc_dist_it = point_it;
-      const auto [valid, idx_x, idx_y] = coord2index(point_it->x(), point_it->y());
+      const auto [valid, roi_x, roi_y] = coord2roi(point_it->x(), point_it->y(), roi);
       if (!valid) continue;
-      const auto pixel = occlusion_mask.at<unsigned char>(height - 1 - idx_y, idx_x);
+      const auto pixel = occlusion_mask.at<unsigned char>(roi_y, roi_x);
       if (pixel == BLOCKED) {
         break;
       }
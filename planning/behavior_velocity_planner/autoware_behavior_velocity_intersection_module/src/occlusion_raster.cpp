@@ -0,0 +1,163 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_intersection_module/occlusion_raster.hpp"
+
+#include <opencv2/imgproc.hpp>
+
+#include <lanelet2_core/geometry/Polygon.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace autoware::behavior_velocity_planner
+{
+
+void OcclusionRaster::prepare(
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets)
+{
+  if (is_prepared_) {
+    return;
+  }
+  is_prepared_ = true;
+
+  attention_min_ = cv::Point2d(
+    std::numeric_limits<double>::max(), std::numeric_limits<double>::max());
+  attention_max_ = cv::Point2d(
+    std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest());
+  for (const auto & attention_area : attention_areas) {
+    std::vector<cv::Point2d> polygon;
+    for (const auto & p : lanelet::utils::to2D(attention_area)) {
+      polygon.emplace_back(p.x(), p.y());
+      attention_min_.x = std::min(attention_min_.x, p.x());
+      attention_min_.y = std::min(attention_min_.y, p.y());
+      attention_max_.x = std::max(attention_max_.x, p.x());
+      attention_max_.y = std::max(attention_max_.y, p.y());
+    }
+    attention_polygons_.push_back(polygon);
+  }
+  for (const auto & adjacent_lanelet : adjacent_lanelets) {
+    std::vector<cv::Point2d> polygon;
+    for (const auto & p : adjacent_lanelet.polygon2d().basicPolygon()) {
+      polygon.emplace_back(p.x(), p.y());
+    }
+    adjacent_polygons_.push_back(polygon);
+  }
+}
+
+bool OcclusionRaster::isAligned(const GridInfo & grid_info) const
+{
+  if (map_attention_mask_.empty() || map_resolution_ != grid_info.resolution) {
+    return false;
+  }
+  constexpr double eps = 1e-3;
+  const double offset_x = (map_origin_x_ - grid_info.origin_x) / grid_info.resolution;
+  const double offset_y = (map_origin_y_ - grid_info.origin_y) / grid_info.resolution;
+  return std::abs(offset_x - std::round(offset_x)) < eps &&
+         std::abs(offset_y - std::round(offset_y)) < eps;
+}
+
+void OcclusionRaster::rasterize(const GridInfo & grid_info)
+{
+  const double resolution = grid_info.resolution;
+
+  // NOTE: LINE_AA draws the edges of the polygons on the next cells, so the raster is padded
+  constexpr int padding = 2;
+  const auto align = [&](const double coord, const double origin) {
+    return origin + (std::floor((coord - origin) / resolution) - padding) * resolution;
+  };
+  map_origin_x_ = align(attention_min_.x, grid_info.origin_x);
+  map_origin_y_ = align(attention_min_.y, grid_info.origin_y);
+  map_resolution_ = resolution;
+  const int width =
+    static_cast<int>((attention_max_.x - map_origin_x_) / resolution) + 1 + padding;
+  const int height =
+    static_cast<int>((attention_max_.y - map_origin_y_) / resolution) + 1 + padding;
+  map_attention_mask_ = cv::Mat(height, width, CV_8UC1, cv::Scalar(0));
+
+  auto toCvPolygon = [&](const std::vector<cv::Point2d> & polygon) {
+    std::vector<cv::Point> cv_polygon;
+    for (const auto & p : polygon) {
+      const int idx_x = static_cast<int>(std::floor((p.x - map_origin_x_) / resolution));
+      const int idx_y = static_cast<int>(std::floor((p.y - map_origin_y_) / resolution));
+      cv_polygon.emplace_back(idx_x, height - 1 - idx_y);
+    }
+    return cv_polygon;
+  };
+
+  // attention: 255
+  // non-attention: 0
+  for (const auto & polygon : attention_polygons_) {
+    cv::fillPoly(map_attention_mask_, toCvPolygon(polygon), cv::Scalar(255), cv::LINE_AA);
+  }
+  // reset adjacent_lanelets area to 0
+  for (const auto & polygon : adjacent_polygons_) {
+    cv::fillPoly(map_attention_mask_, toCvPolygon(polygon), cv::Scalar(0), cv::LINE_AA);
+  }
+}
+
+bool OcclusionRaster::update(const nav_msgs::msg::OccupancyGrid & occ_grid, const int margin)
+{
+  const int width = occ_grid.info.width;
+  const int height = occ_grid.info.height;
+  const double resolution = occ_grid.info.resolution;
+  const auto & origin = occ_grid.info.origin.position;
+  const GridInfo grid_info{origin.x, origin.y, resolution, width, height, margin};
+  if (grid_info_ && grid_info_.value() == grid_info) {
+    return is_in_grid_;
+  }
+  grid_info_ = grid_info;
+  is_in_grid_ = false;
+
+  if (attention_polygons_.empty() || resolution <= 0.0) {
+    return false;
+  }
+  if (!isAligned(grid_info)) {
+    rasterize(grid_info);
+  }
+
+  // the raster on the grid image
+  const int shift_x = static_cast<int>(std::lround((map_origin_x_ - origin.x) / resolution));
+  const int shift_y = static_cast<int>(std::lround((map_origin_y_ - origin.y) / resolution));
+  const cv::Rect raster_rect(
+    shift_x, height - map_attention_mask_.rows - shift_y, map_attention_mask_.cols,
+    map_attention_mask_.rows);
+  const cv::Rect grid_rect(0, 0, width, height);
+  const cv::Rect attention_rect = raster_rect & grid_rect;
+  if (attention_rect.empty()) {
+    return false;
+  }
+
+  roi_ = cv::Rect(
+           attention_rect.x - margin, attention_rect.y - margin, attention_rect.width + 2 * margin,
+           attention_rect.height + 2 * margin) &
+         grid_rect;
+  attention_mask_.create(roi_.size(), CV_8UC1);
+  attention_mask_.setTo(cv::Scalar(0));
+  map_attention_mask_(attention_rect - raster_rect.tl())
+    .copyTo(attention_mask_(attention_rect - roi_.tl()));
+
+  unknown_mask_raw.create(roi_.size(), CV_8UC1);
+  unknown_mask.create(roi_.size(), CV_8UC1);
+  occlusion_mask.create(roi_.size(), CV_8UC1);
+  blocking_mask.create(roi_.size(), CV_8UC1);
+
+  is_in_grid_ = true;
+  return true;
+}
+
+}  // namespace autoware::behavior_velocity_planner
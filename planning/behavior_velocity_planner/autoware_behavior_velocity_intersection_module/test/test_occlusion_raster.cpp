@@ -0,0 +1,257 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/behavior_velocity_intersection_module/occlusion_raster.hpp"
+
+#include <autoware_utils/geometry/boost_geometry.hpp>
+#include <opencv2/imgproc.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+
+#include <nav_msgs/msg/occupancy_grid.hpp>
+
+#include <gtest/gtest.h>
+#include <lanelet2_core/geometry/Polygon.h>
+#include <lanelet2_core/primitives/Lanelet.h>
+#include <lanelet2_core/utility/Utilities.h>
+
+#include <utility>
+#include <vector>
+
+namespace
+{
+using autoware::behavior_velocity_planner::OcclusionRaster;
+using autoware_utils::Polygon2d;
+namespace bg = boost::geometry;
+
+lanelet::Lanelet createLanelet(const double x0, const double y0, const double x1, const double y1)
+{
+  const lanelet::LineString3d left(
+    lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), x0, y1, 0.0),
+                              lanelet::Point3d(lanelet::utils::getId(), x1, y1, 0.0)});
+  const lanelet::LineString3d right(
+    lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), x0, y0, 0.0),
+                              lanelet::Point3d(lanelet::utils::getId(), x1, y0, 0.0)});
+  return lanelet::Lanelet(lanelet::utils::getId(), left, right);
+}
+
+// lanelet whose bounds are the segments from start to end
+lanelet::Lanelet createLanelet(
+  const cv::Point2d & left_start, const cv::Point2d & left_end, const cv::Point2d & right_start,
+  const cv::Point2d & right_end)
+{
+  const auto createLineString = [](const cv::Point2d & start, const cv::Point2d & end) {
+    return lanelet::LineString3d(
+      lanelet::utils::getId(), {lanelet::Point3d(lanelet::utils::getId(), start.x, start.y, 0.0),
+                                lanelet::Point3d(lanelet::utils::getId(), end.x, end.y, 0.0)});
+  };
+  return lanelet::Lanelet(
+    lanelet::utils::getId(), createLineString(left_start, left_end),
+    createLineString(right_start, right_end));
+}
+
+nav_msgs::msg::OccupancyGrid createGrid(const double origin_x, const double origin_y)
+{
+  nav_msgs::msg::OccupancyGrid grid;
+  grid.info.width = 100;
+  grid.info.height = 100;
+  grid.info.resolution = 0.5;
+  grid.info.origin.position.x = origin_x;
+  grid.info.origin.position.y = origin_y;
+  grid.data.assign(grid.info.width * grid.info.height, 0);
+  return grid;
+}
+
+// value of the attention mask at (x, y) in map frame, or 0 if it is out of the ROI
+unsigned char attentionAt(
+  const OcclusionRaster & raster, const nav_msgs::msg::OccupancyGrid & grid, const double x,
+  const double y)
+{
+  const auto & origin = grid.info.origin.position;
+  const int idx_x = static_cast<int>((x - origin.x) / grid.info.resolution);
+  const int idx_y = static_cast<int>((y - origin.y) / grid.info.resolution);
+  const cv::Point pixel(idx_x, static_cast<int>(grid.info.height) - 1 - idx_y);
+  const auto & roi = raster.roi();
+  if (!roi.contains(pixel)) {
+    return 0;
+  }
+  return raster.attention_mask().at<unsigned char>(pixel.y - roi.y, pixel.x - roi.x);
+}
+// attention mask rasterized on the whole grid as detectOcclusion() did before OcclusionRaster, i.e.
+// the polygons are clipped to the grid by findCommonCvPolygons and filled on the grid image
+cv::Mat rasterizeOnGrid(
+  const nav_msgs::msg::OccupancyGrid & grid,
+  const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
+  const lanelet::ConstLanelets & adjacent_lanelets)
+{
+  const int width = grid.info.width;
+  const int height = grid.info.height;
+  const double resolution = grid.info.resolution;
+  const auto & origin = grid.info.origin.position;
+
+  Polygon2d grid_poly;
+  grid_poly.outer().emplace_back(origin.x, origin.y);
+  grid_poly.outer().emplace_back(origin.x + (width - 1) * resolution, origin.y);
+  grid_poly.outer().emplace_back(
+    origin.x + (width - 1) * resolution, origin.y + (height - 1) * resolution);
+  grid_poly.outer().emplace_back(origin.x, origin.y + (height - 1) * resolution);
+  grid_poly.outer().emplace_back(origin.x, origin.y);
+  bg::correct(grid_poly);
+
+  auto findCommonCvPolygons =
+    [&](const auto & area2d, std::vector<std::vector<cv::Point>> & cv_polygons) -> void {
+    Polygon2d area2d_poly;
+    for (const auto & p : area2d) {
+      area2d_poly.outer().emplace_back(p.x(), p.y());
+    }
+    area2d_poly.outer().push_back(area2d_poly.outer().front());
+    bg::correct(area2d_poly);
+    std::vector<Polygon2d> common_areas;
+    bg::intersection(area2d_poly, grid_poly, common_areas);
+    for (auto & common_area : common_areas) {
+      common_area.outer().push_back(common_area.outer().front());
+      bg::correct(common_area);
+      std::vector<cv::Point> cv_polygon;
+      for (const auto & p : common_area.outer()) {
+        const int idx_x = static_cast<int>((p.x() - origin.x) / resolution);
+        const int idx_y = static_cast<int>((p.y() - origin.y) / resolution);
+        cv_polygon.emplace_back(idx_x, height - 1 - idx_y);
+      }
+      cv_polygons.push_back(cv_polygon);
+    }
+  };
+
+  cv::Mat attention_mask(height, width, CV_8UC1, cv::Scalar(0));
+  std::vector<std::vector<cv::Point>> attention_area_cv_polygons;
+  for (const auto & attention_area : attention_areas) {
+    findCommonCvPolygons(lanelet::utils::to2D(attention_area), attention_area_cv_polygons);
+  }
+  for (const auto & poly : attention_area_cv_polygons) {
+    cv::fillPoly(attention_mask, poly, cv::Scalar(255), cv::LINE_AA);
+  }
+  std::vector<std::vector<cv::Point>> adjacent_lane_cv_polygons;
+  for (const auto & adjacent_lanelet : adjacent_lanelets) {
+    findCommonCvPolygons(adjacent_lanelet.polygon2d().basicPolygon(), adjacent_lane_cv_polygons);
+  }
+  for (const auto & poly : adjacent_lane_cv_polygons) {
+    cv::fillPoly(attention_mask, poly, cv::Scalar(0), cv::LINE_AA);
+  }
+  return attention_mask;
+}
+
+// number of the pixels of the attention mask of the raster which differ from expected in rect
+int countDifferentPixels(
+  const OcclusionRaster & raster, const cv::Mat & expected, const cv::Rect & rect)
+{
+  cv::Mat attention_mask(expected.size(), CV_8UC1, cv::Scalar(0));
+  raster.attention_mask().copyTo(attention_mask(raster.roi()));
+  cv::Mat diff;
+  cv::compare(attention_mask(rect), expected(rect), diff, cv::CMP_NE);
+  return cv::countNonZero(diff);
+}
+}  // namespace
+
+TEST(TestOcclusionRaster, attentionMask)
+{
+  const auto attention_lanelet = createLanelet(100.0, 50.0, 110.0, 54.0);
+  const auto adjacent_lanelet = createLanelet(107.0, 50.0, 110.0, 54.0);
+
+  OcclusionRaster raster;
+  raster.prepare({attention_lanelet.polygon3d()}, {adjacent_lanelet});
+
+  auto grid = createGrid(80.0, 40.0);
+  ASSERT_TRUE(raster.update(grid, 2));
+  const auto roi = raster.roi();
+  EXPECT_EQ(raster.attention_mask().cols, roi.width);
+  EXPECT_EQ(raster.attention_mask().rows, roi.height);
+  EXPECT_EQ(raster.occlusion_mask.cols, roi.width);
+  EXPECT_EQ(raster.occlusion_mask.rows, roi.height);
+  EXPECT_EQ(attentionAt(raster, grid, 103.0, 52.0), 255);
+  EXPECT_EQ(attentionAt(raster, grid, 95.0, 52.0), 0);
+  EXPECT_EQ(attentionAt(raster, grid, 103.0, 57.0), 0);
+  // adjacent lane is removed
+  EXPECT_EQ(attentionAt(raster, grid, 108.5, 52.0), 0);
+
+  // the raster moves with the grid
+  grid = createGrid(81.0, 39.5);
+  ASSERT_TRUE(raster.update(grid, 2));
+  EXPECT_EQ(raster.roi().x, roi.x - 2);
+  EXPECT_EQ(raster.roi().y, roi.y - 1);
+  EXPECT_EQ(attentionAt(raster, grid, 103.0, 52.0), 255);
+  EXPECT_EQ(attentionAt(raster, grid, 108.5, 52.0), 0);
+
+  // the grid is not moved by whole cells
+  grid = createGrid(80.25, 40.25);
+  ASSERT_TRUE(raster.update(grid, 2));
+  EXPECT_EQ(attentionAt(raster, grid, 103.0, 52.0), 255);
+  EXPECT_EQ(attentionAt(raster, grid, 95.0, 52.0), 0);
+
+  // the attention area is out of the grid
+  grid = createGrid(500.0, 500.0);
+  EXPECT_FALSE(raster.update(grid, 2));
+}
+
+TEST(TestOcclusionRaster, sameAsRasterizingOnGrid)
+{
+  const auto attention_lanelet = createLanelet(100.0, 50.0, 110.0, 54.0);
+  const auto slanted_lanelet =
+    createLanelet({102.3, 45.1}, {99.1, 55.7}, {108.7, 47.9}, {104.2, 60.3});
+  const auto adjacent_lanelet = createLanelet(107.0, 50.0, 110.0, 54.0);
+  const std::vector<lanelet::CompoundPolygon3d> attention_areas{
+    attention_lanelet.polygon3d(), slanted_lanelet.polygon3d()};
+  const lanelet::ConstLanelets adjacent_lanelets{adjacent_lanelet};
+
+  // the grid moves by whole cells (the raster is copied) and by sub-cells (it is rasterized again)
+  const std::vector<std::pair<double, double>> origins = {
+    {80.0, 40.0}, {81.0, 39.5}, {78.5, 41.0}, {70.0, 20.0}, {80.25, 40.25}, {81.75, 38.25},
+    {79.9, 40.3}, {76.9, 36.8}, {75.37, 33.81}, {80.1, 39.95}};
+  OcclusionRaster raster;
+  raster.prepare(attention_areas, adjacent_lanelets);
+  for (const auto & [origin_x, origin_y] : origins) {
+    const auto grid = createGrid(origin_x, origin_y);
+    ASSERT_TRUE(raster.update(grid, 2));
+    const auto expected = rasterizeOnGrid(grid, attention_areas, adjacent_lanelets);
+    EXPECT_EQ(countDifferentPixels(raster, expected, cv::Rect(0, 0, 100, 100)), 0)
+      << "origin: (" << origin_x << ", " << origin_y << ")";
+  }
+}
+
+TEST(TestOcclusionRaster, sameAsRasterizingOnClippedGrid)
+{
+  const auto attention_lanelet = createLanelet(100.0, 50.0, 110.0, 54.0);
+  const auto crossing_lanelet = createLanelet(104.0, 44.0, 107.0, 62.0);
+  const auto adjacent_lanelet = createLanelet(107.0, 50.0, 110.0, 54.0);
+  const std::vector<lanelet::CompoundPolygon3d> attention_areas{
+    attention_lanelet.polygon3d(), crossing_lanelet.polygon3d()};
+  const lanelet::ConstLanelets adjacent_lanelets{adjacent_lanelet};
+
+  // the border of the grid crosses the attention area on each side and at the corners
+  const std::vector<std::pair<double, double>> origins = {
+    {102.2, 30.0}, {103.2, 29.5}, {58.3, 30.0}, {57.8, 31.0}, {80.0, 47.6}, {79.5, 48.6},
+    {80.0, 5.35}, {80.5, 6.35}, {55.0, 30.0}, {104.1, 51.2}, {55.5, 29.0}};
+  OcclusionRaster raster;
+  raster.prepare(attention_areas, adjacent_lanelets);
+  for (const auto & [origin_x, origin_y] : origins) {
+    const auto grid = createGrid(origin_x, origin_y);
+    ASSERT_TRUE(raster.update(grid, 2));
+    const auto expected = rasterizeOnGrid(grid, attention_areas, adjacent_lanelets);
+    // NOTE: the rasterization on the grid clipped the polygons to the grid (whose far side was at
+    // (width - 1) * resolution) while OcclusionRaster does not, so the antialiased edges along the
+    // border of the grid differ. they are the same inside since the lanes are axis-aligned, a
+    // slanted edge crossing the border would be drawn from a different clipped vertex
+    EXPECT_EQ(countDifferentPixels(raster, expected, cv::Rect(3, 3, 94, 94)), 0)
+      << "origin: (" << origin_x << ", " << origin_y << ")";
+  }
+}
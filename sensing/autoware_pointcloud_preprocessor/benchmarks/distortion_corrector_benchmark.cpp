@@ -0,0 +1,194 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare the per-point distortion correction with the batched mode, for the 2D and the 3D
+// corrector. Usage: distortion_corrector_benchmark [time_slice_sec]
+// Synthetic 100 ms LiDAR sweeps of 50k, 200k and 500k points in base_link are used, so no TF is
+// needed. The maximum difference to the per-point result is printed next to the timings.
+
+#include "autoware/pointcloud_preprocessor/distortion_corrector/distortion_corrector.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <geometry_msgs/msg/twist_with_covariance_stamped.hpp>
+#include <sensor_msgs/msg/imu.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::DistortionCorrector2D;
+using autoware::pointcloud_preprocessor::DistortionCorrector3D;
+using sensor_msgs::msg::PointCloud2;
+
+namespace
+{
+constexpr int32_t stamp_seconds = 10;
+constexpr uint32_t sweep_duration_ns = 100000000;
+constexpr int nb_iterations = 20;
+
+PointCloud2 make_synthetic_sweep(size_t num_points)
+{
+  // 128-ring rotating LiDAR, points in firing order
+  constexpr size_t nb_rings = 128;
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> range(2.0f, 80.0f);
+
+  PointCloud2 pointcloud;
+  pointcloud.header.stamp = rclcpp::Time(stamp_seconds, 0, RCL_ROS_TIME);
+  pointcloud.header.frame_id = "base_link";
+  pointcloud.height = 1;
+  pointcloud.is_dense = true;
+  sensor_msgs::PointCloud2Modifier modifier(pointcloud);
+  modifier.setPointCloud2Fields(
+    10, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1,
+    sensor_msgs::msg::PointField::FLOAT32, "z", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "intensity", 1, sensor_msgs::msg::PointField::UINT8, "return_type", 1,
+    sensor_msgs::msg::PointField::UINT8, "channel", 1, sensor_msgs::msg::PointField::UINT16,
+    "azimuth", 1, sensor_msgs::msg::PointField::FLOAT32, "elevation", 1,
+    sensor_msgs::msg::PointField::FLOAT32, "distance", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "time_stamp", 1, sensor_msgs::msg::PointField::UINT32);
+  modifier.resize(num_points);
+
+  sensor_msgs::PointCloud2Iterator<float> iter_x(pointcloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(pointcloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(pointcloud, "z");
+  sensor_msgs::PointCloud2Iterator<std::uint32_t> iter_t(pointcloud, "time_stamp");
+  for (size_t i = 0; i < num_points; ++i, ++iter_x, ++iter_y, ++iter_z, ++iter_t) {
+    const size_t ring = i % nb_rings;
+    const float azimuth = 2.0f * static_cast<float>(M_PI) * static_cast<float>(i) /
+                          static_cast<float>(num_points);
+    const float elevation = -0.4f + 0.0045f * static_cast<float>(ring);
+    const float r = range(engine);
+    *iter_x = r * std::cos(elevation) * std::cos(azimuth);
+    *iter_y = r * std::cos(elevation) * std::sin(azimuth);
+    *iter_z = r * std::sin(elevation);
+    *iter_t = static_cast<std::uint32_t>(
+      static_cast<uint64_t>(i) * sweep_duration_ns / static_cast<uint64_t>(num_points));
+  }
+  return pointcloud;
+}
+
+template <typename T>
+void feed_motion(T & distortion_corrector)
+{
+  // 100 Hz twist and IMU around the sweep
+  for (int i = -2; i < 13; ++i) {
+    const rclcpp::Time stamp(stamp_seconds, 0, RCL_ROS_TIME);
+    const auto offset = rclcpp::Duration::from_seconds(0.01 * i);
+
+    auto twist_msg = std::make_shared<geometry_msgs::msg::TwistWithCovarianceStamped>();
+    twist_msg->header.stamp = stamp + offset;
+    twist_msg->header.frame_id = "base_link";
+    twist_msg->twist.twist.linear.x = 15.0 + 0.1 * i;
+    twist_msg->twist.twist.angular.z = 0.1;
+    distortion_corrector.process_twist_message(twist_msg);
+
+    auto imu_msg = std::make_shared<sensor_msgs::msg::Imu>();
+    imu_msg->header.stamp = stamp + offset;
+    imu_msg->header.frame_id = "base_link";
+    imu_msg->angular_velocity.x = 0.01;
+    imu_msg->angular_velocity.y = -0.02;
+    imu_msg->angular_velocity.z = 0.1 + 0.005 * i;
+    distortion_corrector.process_imu_message("base_link", imu_msg);
+  }
+}
+
+template <typename T>
+double undistort_ms(
+  rclcpp::Node & node, const PointCloud2 & input, double time_slice_sec, size_t num_threads,
+  PointCloud2 & output)
+{
+  T distortion_corrector(node);
+  distortion_corrector.set_batch_config(time_slice_sec, num_threads);
+  feed_motion(distortion_corrector);
+  distortion_corrector.set_pointcloud_transform("base_link", input.header.frame_id);
+
+  double total_ms = 0.0;
+  for (int i = 0; i <= nb_iterations; ++i) {
+    output = input;
+    distortion_corrector.initialize();
+    const auto start = std::chrono::steady_clock::now();
+    distortion_corrector.undistort_pointcloud(true, std::nullopt, output);
+    const auto end = std::chrono::steady_clock::now();
+    if (i > 0) {  // the first run is a warm-up
+      total_ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+  }
+  return total_ms / nb_iterations;
+}
+
+float max_difference(const PointCloud2 & a, const PointCloud2 & b)
+{
+  sensor_msgs::PointCloud2ConstIterator<float> a_x(a, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> a_y(a, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> a_z(a, "z");
+  sensor_msgs::PointCloud2ConstIterator<float> b_x(b, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> b_y(b, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> b_z(b, "z");
+  float result = 0.0f;
+  for (; a_x != a_x.end(); ++a_x, ++a_y, ++a_z, ++b_x, ++b_y, ++b_z) {
+    result = std::max(
+      result, std::max(
+                {std::abs(*a_x - *b_x), std::abs(*a_y - *b_y), std::abs(*a_z - *b_z)}));
+  }
+  return result;
+}
+
+template <typename T>
+void run(
+  rclcpp::Node & node, const std::string & name, const PointCloud2 & input,
+  double time_slice_sec)
+{
+  PointCloud2 per_point_output;
+  PointCloud2 batched_output;
+  std::cout << name << " (" << input.width << " points)\n";
+  std::cout << "  per-point:              "
+            << undistort_ms<T>(node, input, 0.0, 1, per_point_output) << " ms\n";
+  for (const size_t num_threads : {1u, 2u, 4u, 8u}) {
+    const double ms = undistort_ms<T>(node, input, time_slice_sec, num_threads, batched_output);
+    std::cout << "  batched (" << num_threads << " threads):   " << ms
+              << " ms, max difference " << max_difference(per_point_output, batched_output)
+              << " m\n";
+  }
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  int ret = 0;
+  try {
+    const double time_slice_sec = argc > 1 ? std::atof(argv[1]) : 1e-4;
+    auto node = std::make_shared<rclcpp::Node>("distortion_corrector_benchmark");
+    for (const size_t num_points : {50000u, 200000u, 500000u}) {
+      const auto input = make_synthetic_sweep(num_points);
+      run<DistortionCorrector2D>(*node, "2D", input, time_slice_sec);
+      run<DistortionCorrector3D>(*node, "3D", input, time_slice_sec);
+    }
+  } catch (const std::exception & e) {
+    std::cerr << "Exception in main(): " << e.what() << std::endl;
+    ret = 1;
+  }
+  rclcpp::shutdown();
+  return ret;
+}
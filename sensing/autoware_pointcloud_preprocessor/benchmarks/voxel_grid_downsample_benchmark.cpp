@@ -0,0 +1,212 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare the voxel centroid engine with the previous std::unordered_map implementation and with
+// pcl::VoxelGrid. Usage: voxel_grid_downsample_benchmark [cloud.pcd ...]
+// Without arguments, synthetic LiDAR-like clouds of 100k, 300k and 1M points are used.
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_centroid_engine.hpp"
+
+#include <pcl/filters/voxel_grid.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::VoxelCentroidEngine;
+
+namespace
+{
+struct Point
+{
+  float x;
+  float y;
+  float z;
+  uint8_t intensity;
+  uint8_t padding[3];
+};
+
+constexpr float voxel_size_xy = 0.3f;
+constexpr float voxel_size_z = 0.1f;
+constexpr int nb_iterations = 20;
+
+std::vector<Point> make_synthetic_cloud(size_t num_points)
+{
+  // 128-ring rotating LiDAR seeing the ground, stored in firing order like a driver output
+  constexpr size_t nb_rings = 128;
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<float> noise(-0.02f, 0.02f);
+  std::vector<Point> cloud(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const size_t ring = i % nb_rings;
+    const float azimuth = 2.0f * static_cast<float>(M_PI) * static_cast<float>(i / nb_rings) /
+                          static_cast<float>(num_points / nb_rings);
+    const float elevation = -0.4f + 0.0045f * static_cast<float>(ring);
+    const float range = std::min(80.0f, 1.8f / std::max(0.02f, -std::sin(elevation)));
+    auto & p = cloud[i];
+    p.x = range * std::cos(azimuth) + noise(engine);
+    p.y = range * std::sin(azimuth) + noise(engine);
+    p.z = range * std::sin(elevation) + 1.8f + noise(engine);
+    p.intensity = static_cast<uint8_t>(ring);
+  }
+  return cloud;
+}
+
+std::vector<Point> load_cloud(const std::string & path)
+{
+  pcl::PointCloud<pcl::PointXYZI> pcl_cloud;
+  std::vector<Point> cloud;
+  if (pcl::io::loadPCDFile(path, pcl_cloud) != 0) {
+    return cloud;
+  }
+  cloud.reserve(pcl_cloud.size());
+  for (const auto & p : pcl_cloud) {
+    cloud.push_back(Point{p.x, p.y, p.z, static_cast<uint8_t>(p.intensity), {}});
+  }
+  return cloud;
+}
+
+// Previous implementation: min/max pass, then accumulation in an std::unordered_map
+size_t legacy_unordered_map(const std::vector<Point> & cloud)
+{
+  const Eigen::Array3f inverse_voxel_size =
+    Eigen::Array3f::Ones() / Eigen::Array3f(voxel_size_xy, voxel_size_xy, voxel_size_z);
+  Eigen::Array3f min_point = Eigen::Array3f::Constant(std::numeric_limits<float>::max());
+  Eigen::Array3f max_point = Eigen::Array3f::Constant(-std::numeric_limits<float>::max());
+  for (const auto & p : cloud) {
+    min_point = min_point.min(Eigen::Array3f(p.x, p.y, p.z));
+    max_point = max_point.max(Eigen::Array3f(p.x, p.y, p.z));
+  }
+  const Eigen::Array3i min_voxel = (min_point * inverse_voxel_size).floor().cast<int>();
+  const Eigen::Array3i div_b =
+    (max_point * inverse_voxel_size).floor().cast<int>() - min_voxel + Eigen::Array3i::Ones();
+
+  struct Centroid
+  {
+    float x{0};
+    float y{0};
+    float z{0};
+    float intensity{0};
+    uint32_t count{0};
+  };
+  std::unordered_map<uint32_t, Centroid> map;
+  for (const auto & p : cloud) {
+    const Eigen::Array3i ijk =
+      (Eigen::Array3f(p.x, p.y, p.z) * inverse_voxel_size).floor().cast<int>() - min_voxel;
+    const uint32_t id = ijk[0] + ijk[1] * div_b[0] + ijk[2] * div_b[0] * div_b[1];
+    auto & c = map[id];
+    c.x += p.x;
+    c.y += p.y;
+    c.z += p.z;
+    c.intensity += p.intensity;
+    c.count++;
+  }
+  return map.size();
+}
+
+size_t pcl_voxel_grid(const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud)
+{
+  pcl::PointCloud<pcl::PointXYZ> output;
+  pcl::VoxelGrid<pcl::PointXYZ> filter;
+  filter.setInputCloud(cloud);
+  filter.setLeafSize(voxel_size_xy, voxel_size_xy, voxel_size_z);
+  filter.filter(output);
+  return output.size();
+}
+
+template <typename F>
+double average_ms(F && f, size_t & result)
+{
+  result = f();  // warm-up
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nb_iterations; ++i) {
+    result = f();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / nb_iterations;
+}
+
+void run(const std::string & name, const std::vector<Point> & cloud)
+{
+  VoxelCentroidEngine::FieldLayout layout;
+  layout.point_step = sizeof(Point);
+  layout.x_offset = offsetof(Point, x);
+  layout.y_offset = offsetof(Point, y);
+  layout.z_offset = offsetof(Point, z);
+  layout.intensity_offset = offsetof(Point, intensity);
+  const auto * data = reinterpret_cast<const uint8_t *>(cloud.data());
+
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_cloud(new pcl::PointCloud<pcl::PointXYZ>);
+  pcl_cloud->reserve(cloud.size());
+  for (const auto & p : cloud) {
+    pcl_cloud->push_back(pcl::PointXYZ(p.x, p.y, p.z));
+  }
+
+  size_t nb_voxels = 0;
+  std::cout << name << " (" << cloud.size() << " points)\n";
+  std::cout << "  unordered_map:        "
+            << average_ms([&] { return legacy_unordered_map(cloud); }, nb_voxels) << " ms, "
+            << nb_voxels << " voxels\n";
+  std::cout << "  pcl::VoxelGrid:       "
+            << average_ms([&] { return pcl_voxel_grid(pcl_cloud); }, nb_voxels) << " ms, "
+            << nb_voxels << " voxels\n";
+  for (const size_t num_threads : {1u, 2u, 4u, 8u}) {
+    VoxelCentroidEngine engine;
+    engine.set_voxel_size(voxel_size_xy, voxel_size_xy, voxel_size_z);
+    engine.set_num_threads(num_threads);
+    const double ms = average_ms(
+      [&] {
+        engine.compute(data, cloud.size(), layout);
+        return engine.voxels().size();
+      },
+      nb_voxels);
+    std::cout << "  engine (" << num_threads << " threads):   " << ms << " ms, " << nb_voxels
+              << " voxels\n";
+  }
+}
+}  // namespace
+
+int main(int argc, char * argv[])
+{
+  try {
+    if (argc > 1) {
+      for (int i = 1; i < argc; ++i) {
+        const auto cloud = load_cloud(argv[i]);
+        if (cloud.empty()) {
+          std::cerr << "Could not load " << argv[i] << std::endl;
+          continue;
+        }
+        run(argv[i], cloud);
+      }
+    } else {
+      for (const size_t num_points : {100000u, 300000u, 1000000u}) {
+        run("synthetic", make_synthetic_cloud(num_points));
+      }
+    }
+  } catch (const std::exception & e) {
+    std::cerr << "Exception in main(): " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -18,6 +18,7 @@
 
 #include <rclcpp/rclcpp.hpp>
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -112,7 +113,12 @@ void CloudCollector<MsgTraits>::concatenate_callback()
   // pointclouds in the collector.
   timer_->cancel();
 
+  const auto concatenation_start = std::chrono::steady_clock::now();
   auto concatenated_cloud_result = concatenate_pointclouds(topic_to_cloud_map_);
+  combine_cloud_handler_->record_concatenation_latency(
+    std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - concatenation_start)
+      .count());
 
   ros2_parent_node_->publish_clouds(std::move(concatenated_cloud_result), collector_info_);
 
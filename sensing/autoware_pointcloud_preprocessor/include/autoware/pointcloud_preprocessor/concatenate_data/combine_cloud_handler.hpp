@@ -18,6 +18,7 @@
 #include "combine_cloud_handler_base.hpp"
 #include "traits.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -41,12 +42,7 @@ public:
   CombineCloudHandler(
     rclcpp::Node & node, const std::vector<std::string> & input_topics, std::string output_frame,
     bool is_motion_compensated, bool publish_synchronized_pointcloud,
-    bool keep_input_frame_in_synchronized_pointcloud)
-  : CombineCloudHandlerBase(
-      node, input_topics, output_frame, is_motion_compensated, publish_synchronized_pointcloud,
-      keep_input_frame_in_synchronized_pointcloud)
-  {
-  }
+    bool keep_input_frame_in_synchronized_pointcloud);
 
   virtual ~CombineCloudHandler() = default;
 
@@ -55,7 +51,11 @@ public:
       topic_to_cloud_map,
     const std::shared_ptr<CollectorInfoBase> & collector_info);
 
-  void allocate_pointclouds() override {};
+  /// @brief Prepare the output buffers of the next cycle, sized to the largest cycle so far.
+  void allocate_pointclouds() override;
+
+  /// @brief Number of threads writing the points, 0 means one per hardware thread.
+  void set_num_threads(size_t num_threads);
 
 protected:
   /// @brief RclcppTimeHash structure defines a custom hash function for the rclcpp::Time type by
@@ -68,16 +68,52 @@ protected:
     }
   };
 
-  static void convert_to_xyzirc_cloud(
-    const typename PointCloud2Traits::PointCloudMessage::ConstSharedPtr & input_cloud,
-    typename PointCloud2Traits::PointCloudMessage::UniquePtr & xyzirc_cloud);
+  /// @brief Source cloud of one slice of the concatenated cloud, with its transforms.
+  struct CloudSlice
+  {
+    const PointCloud2Traits::PointCloudMessage * cloud{nullptr};
+    std::size_t start_index{0};
+    std::size_t num_points{0};
+    std::uint32_t x_offset{0};
+    std::uint32_t y_offset{0};
+    std::uint32_t z_offset{0};
+    /// Intensity, return type and channel are copied only if all three have the XYZIRC types
+    bool has_valid_irc_fields{false};
+    std::uint32_t intensity_offset{0};
+    std::uint32_t return_type_offset{0};
+    std::uint32_t channel_offset{0};
+    /// Sensor frame to the output frame at the oldest stamp
+    Eigen::Matrix4f concatenate_transform{Eigen::Matrix4f::Identity()};
+    /// Sensor frame to the frame of the synchronized cloud at the oldest stamp
+    Eigen::Matrix4f synchronized_transform{Eigen::Matrix4f::Identity()};
+    std::uint8_t * synchronized_output{nullptr};
+  };
+
+  Eigen::Matrix4f compute_motion_compensation_transform(
+    const rclcpp::Time & cloud_stamp, const std::vector<rclcpp::Time> & pc_stamps,
+    std::unordered_map<rclcpp::Time, Eigen::Matrix4f, RclcppTimeHash> & transform_memo);
+
+  /// @brief Transform the points [begin, end) of a slice and write them as PointXYZIRC.
+  static void write_slice_points(
+    const CloudSlice & slice, std::size_t begin, std::size_t end,
+    std::uint8_t * concatenated_output);
+
+  /// @brief Create an XYZIRC cloud whose data can hold num_points points without reallocation.
+  static std::unique_ptr<PointCloud2Traits::PointCloudMessage> make_xyzirc_cloud(
+    const std::string & frame_id, std::size_t num_points);
+
+  static constexpr std::size_t min_points_per_thread = 16384;
+
+  std::size_t num_threads_{1};
+
+  // Output buffers, handed over to the result and refilled by allocate_pointclouds(). The sizes
+  // are the largest number of points seen so far.
+  std::unique_ptr<PointCloud2Traits::PointCloudMessage> concatenated_cloud_ptr_;
+  std::size_t max_concat_pointcloud_size_{0};
 
-  void correct_pointcloud_motion(
-    const std::unique_ptr<PointCloud2Traits::PointCloudMessage> & transformed_cloud_ptr,
-    const std::vector<rclcpp::Time> & pc_stamps,
-    std::unordered_map<rclcpp::Time, Eigen::Matrix4f, RclcppTimeHash> & transform_memo,
-    std::unique_ptr<PointCloud2Traits::PointCloudMessage> &
-      transformed_delay_compensated_cloud_ptr);
+  std::unordered_map<std::string, std::unique_ptr<PointCloud2Traits::PointCloudMessage>>
+    topic_to_synchronized_cloud_map_;
+  std::unordered_map<std::string, std::size_t> topic_to_max_pointcloud_size_map_;
 };
 
 }  // namespace autoware::pointcloud_preprocessor
@@ -76,6 +76,12 @@ public:
 
   virtual void allocate_pointclouds() = 0;
 
+  /// @brief Record the time spent in one combine_pointclouds() call.
+  void record_concatenation_latency(double latency_ms);
+
+  /// @brief Percentiles of the latest recorded concatenation latencies.
+  [[nodiscard]] ConcatenationLatencyPercentiles get_concatenation_latency_percentiles() const;
+
 protected:
   rclcpp::Node & node_;
   std::vector<std::string> input_topics_;
@@ -90,6 +90,7 @@ private:
     std::vector<std::string> input_topics;
     std::string output_frame;
     std::string matching_strategy;
+    int num_threads;
   } params_;
 
   double current_concatenate_cloud_timestamp_{0.0};
@@ -62,6 +62,7 @@ PointCloudConcatenateDataSynchronizerComponentTemplated<MsgTraits>::
   params_.input_twist_topic_type = declare_parameter<std::string>("input_twist_topic_type");
   params_.input_topics = declare_parameter<std::vector<std::string>>("input_topics");
   params_.output_frame = declare_parameter<std::string>("output_frame");
+  params_.num_threads = declare_parameter<int>("num_threads");
 
   if (params_.input_topics.empty()) {
     throw std::runtime_error("Need a 'input_topics' parameter to be set before continuing.");
@@ -467,6 +468,17 @@ void PointCloudConcatenateDataSynchronizerComponentTemplated<MsgTraits>::check_c
   diagnostics_interface_->add_key_value("Processing time (ms)", diagnostic_info.processing_time);
   diagnostics_interface_->add_key_value("Pipeline latency (ms)", diagnostic_info.pipeline_latency);
 
+  const auto concatenation_latency =
+    combine_cloud_handler_->get_concatenation_latency_percentiles();
+  diagnostics_interface_->add_key_value(
+    "Concatenation time p50 (ms)", concatenation_latency.p50_ms);
+  diagnostics_interface_->add_key_value(
+    "Concatenation time p90 (ms)", concatenation_latency.p90_ms);
+  diagnostics_interface_->add_key_value(
+    "Concatenation time p99 (ms)", concatenation_latency.p99_ms);
+  diagnostics_interface_->add_key_value(
+    "Concatenation time max (ms)", concatenation_latency.max_ms);
+
   bool topic_miss = false;
   bool concatenation_success = true;
 
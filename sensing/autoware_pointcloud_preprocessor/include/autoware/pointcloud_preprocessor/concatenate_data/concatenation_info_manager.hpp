@@ -19,6 +19,8 @@
 #include <autoware_sensing_msgs/msg/source_point_cloud_info.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
@@ -139,6 +141,25 @@ const std::unordered_map<std::string, uint8_t> matching_strategy_name_map = {
   {"advanced", autoware_sensing_msgs::msg::ConcatenatedPointCloudInfo::STRATEGY_ADVANCED},
 };
 
+/**
+ * @brief Percentiles of the recent concatenation latencies.
+ *
+ * All values are zero until the first latency is recorded.
+ */
+struct ConcatenationLatencyPercentiles
+{
+  //! Median latency in milliseconds
+  double p50_ms{0.0};
+  //! 90th percentile latency in milliseconds
+  double p90_ms{0.0};
+  //! 99th percentile latency in milliseconds
+  double p99_ms{0.0};
+  //! Maximum latency in milliseconds
+  double max_ms{0.0};
+  //! Number of latencies the percentiles are computed from
+  std::size_t num_samples{0};
+};
+
 /**
  * @brief Manages concatenation information for point cloud preprocessing.
  *
@@ -199,15 +220,38 @@ public:
   void update_source_from_point_cloud(
     const sensor_msgs::msg::PointCloud2 & source_cloud, const std::string & topic, uint8_t status,
     autoware_sensing_msgs::msg::ConcatenatedPointCloudInfo & out_concatenated_point_cloud_info_msg)
+  {
+    update_source_from_header_and_length(
+      source_cloud.header, source_cloud.width * source_cloud.height, topic, status,
+      out_concatenated_point_cloud_info_msg);
+  }
+
+  /**
+   * @brief Update source information from a header and a number of points.
+   *
+   * Same as update_source_from_point_cloud(), for sources whose points are written directly
+   * into the concatenated point cloud without an intermediate point cloud message.
+   *
+   * @param header Header of the source, in the frame of the concatenated point cloud
+   * @param num_points Number of points of this source in the concatenated point cloud
+   * @param topic Topic name that this source belongs to
+   * @param status Status of this source
+   * @param out_concatenated_point_cloud_info_msg Output message to update
+   * @throws std::runtime_error if topic is not found or already has data
+   */
+  void update_source_from_header_and_length(
+    const std_msgs::msg::Header & header, uint32_t num_points, const std::string & topic,
+    uint8_t status,
+    autoware_sensing_msgs::msg::ConcatenatedPointCloudInfo & out_concatenated_point_cloud_info_msg)
   {
     auto [target_info, idx_begin] =
       find_source_info_and_next_idx(topic, out_concatenated_point_cloud_info_msg);
 
-    target_info->header = source_cloud.header;
+    target_info->header = header;
     target_info->status = status;
     if (status != autoware_sensing_msgs::msg::SourcePointCloudInfo::STATUS_OK) return;
     target_info->idx_begin = idx_begin;
-    target_info->length = source_cloud.width * source_cloud.height;
+    target_info->length = num_points;
     valid_cloud_count_++;
   }
 
@@ -295,6 +339,53 @@ public:
     out_concatenated_point_cloud_info_msg.matching_strategy_config = matching_strategy_config;
   }
 
+  /**
+   * @brief Record the latency of one concatenation.
+   *
+   * Only the latest latency_window_size latencies are kept, the oldest one is overwritten.
+   *
+   * @param latency_ms Time spent concatenating the point clouds of one cycle, in milliseconds
+   */
+  void record_concatenation_latency(double latency_ms)
+  {
+    if (latencies_ms_.size() < latency_window_size) {
+      latencies_ms_.push_back(latency_ms);
+    } else {
+      latencies_ms_[next_latency_idx_] = latency_ms;
+    }
+    next_latency_idx_ = (next_latency_idx_ + 1) % latency_window_size;
+  }
+
+  /**
+   * @brief Get the percentiles of the recorded concatenation latencies.
+   *
+   * Nearest-rank percentiles over the latest latency_window_size latencies.
+   *
+   * @return Percentiles of the recorded latencies, all zero if none has been recorded
+   */
+  [[nodiscard]] ConcatenationLatencyPercentiles get_concatenation_latency_percentiles() const
+  {
+    ConcatenationLatencyPercentiles percentiles;
+    percentiles.num_samples = latencies_ms_.size();
+    if (latencies_ms_.empty()) return percentiles;
+
+    std::vector<double> sorted_latencies_ms = latencies_ms_;
+    std::sort(sorted_latencies_ms.begin(), sorted_latencies_ms.end());
+    const auto nearest_rank = [&sorted_latencies_ms](double percentile) {
+      const auto rank = static_cast<std::size_t>(
+        std::ceil(percentile / 100.0 * static_cast<double>(sorted_latencies_ms.size())));
+      return sorted_latencies_ms[std::max<std::size_t>(rank, 1) - 1];
+    };
+    percentiles.p50_ms = nearest_rank(50.0);
+    percentiles.p90_ms = nearest_rank(90.0);
+    percentiles.p99_ms = nearest_rank(99.0);
+    percentiles.max_ms = sorted_latencies_ms.back();
+    return percentiles;
+  }
+
+  //! Number of latest concatenation latencies the percentiles are computed from
+  static constexpr std::size_t latency_window_size{1000};
+
 private:
   /**
    * @brief Helper struct for source cloud information lookup results.
@@ -391,6 +482,10 @@ private:
   const size_t num_expected_sources_{0};
   //! Current count of successfully processed source clouds (status == OK)
   std::size_t valid_cloud_count_{0};
+  //! Latest concatenation latencies in milliseconds, used as a ring buffer once full
+  std::vector<double> latencies_ms_;
+  //! Index in latencies_ms_ the next latency is written to
+  std::size_t next_latency_idx_{0};
 };
 
 }  // namespace autoware::pointcloud_preprocessor
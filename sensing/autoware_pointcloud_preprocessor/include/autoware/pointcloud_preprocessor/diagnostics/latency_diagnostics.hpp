@@ -20,6 +20,8 @@
 #include <rclcpp/time.hpp>
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace autoware::pointcloud_preprocessor
 {
@@ -37,12 +39,21 @@ public:
   {
   }
 
+  /** \brief Add the processing time of one stage of a node running several stages */
+  void add_stage_processing_time(const std::string & stage_name, double processing_time_ms)
+  {
+    stage_processing_times_ms_.emplace_back(stage_name, processing_time_ms);
+  }
+
   void add_to_interface(autoware_utils::DiagnosticsInterface & interface) const override
   {
     interface.add_key_value(
       "Pointcloud header timestamp", format_timestamp(cloud_header_timestamp_.seconds()));
     interface.add_key_value("Processing time (ms)", processing_time_ms_);
     interface.add_key_value("Pipeline latency (ms)", pipeline_latency_ms_);
+    for (const auto & [stage_name, stage_time_ms] : stage_processing_times_ms_) {
+      interface.add_key_value("Processing time " + stage_name + " (ms)", stage_time_ms);
+    }
   }
 
   [[nodiscard]] std::optional<std::pair<int, std::string>> evaluate_status() const override
@@ -61,6 +72,7 @@ private:
   double processing_time_ms_;
   double pipeline_latency_ms_;
   double processing_time_threshold_ms_;
+  std::vector<std::pair<std::string, double>> stage_processing_times_ms_;
 };
 
 }  // namespace autoware::pointcloud_preprocessor
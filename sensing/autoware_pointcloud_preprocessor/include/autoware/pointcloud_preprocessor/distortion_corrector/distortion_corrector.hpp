@@ -37,7 +37,9 @@
 
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace autoware::pointcloud_preprocessor
 {
@@ -69,6 +71,12 @@ protected:
   int timestamp_mismatch_count_{0};
   double timestamp_mismatch_fraction_{0.0};
 
+  // Batched mode, see set_batch_config(). The buffers keep their capacity across pointclouds.
+  double time_slice_sec_{0.0};
+  size_t num_threads_{1};
+  std::vector<Eigen::Matrix<float, 3, 4>> slice_transforms_;
+  std::vector<uint8_t> slice_mismatches_;
+
   rclcpp::Node & node_;
 
   void get_imu_transformation(const std::string & base_frame, const std::string & imu_frame);
@@ -104,6 +112,18 @@ public:
 
   bool is_pointcloud_valid(sensor_msgs::msg::PointCloud2 & pointcloud);
 
+  /** \brief Switch between the per-point and the batched undistortion.
+   *
+   * In the batched mode the time span of the pointcloud is split into slices of `time_slice_sec`.
+   * One transform is computed per slice, at its center time, and applied to all of its points.
+   * The points are then transformed in parallel. The position error compared to the per-point
+   * mode is bounded by the motion of the vehicle during half a slice.
+   *
+   * \param time_slice_sec duration of a slice [s], 0 selects the per-point mode
+   * \param num_threads number of worker threads in the batched mode, 0 uses all hardware threads
+   */
+  void set_batch_config(double time_slice_sec, size_t num_threads);
+
   [[nodiscard]] int get_timestamp_mismatch_count() const { return timestamp_mismatch_count_; }
   [[nodiscard]] double get_timestamp_mismatch_fraction() const
   {
@@ -138,6 +158,18 @@ public:
     static_cast<T *>(this)->undistort_point_implementation(
       it_x, it_y, it_z, it_twist, it_imu, time_offset, is_twist_valid, is_imu_valid);
   };
+
+  Eigen::Matrix4f advance_slice_transform(
+    const Eigen::Vector3f & linear, const Eigen::Vector3f & angular, const float & time_offset)
+  {
+    return static_cast<T *>(this)->advance_slice_transform_implementation(
+      linear, angular, time_offset);
+  };
+
+private:
+  void undistort_pointcloud_batched(
+    bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
+    sensor_msgs::msg::PointCloud2 & pointcloud);
 };
 
 class DistortionCorrector2D : public DistortionCorrector<DistortionCorrector2D>
@@ -155,6 +187,8 @@ private:
   // TF
   tf2::Transform tf2_lidar_to_base_link_;
   tf2::Transform tf2_base_link_to_lidar_;
+  Eigen::Matrix4f eigen_lidar_to_base_link_{Eigen::Matrix4f::Identity()};
+  Eigen::Matrix4f eigen_base_link_to_lidar_{Eigen::Matrix4f::Identity()};
 
 public:
   explicit DistortionCorrector2D(rclcpp::Node & node) : DistortionCorrector(node) {}
@@ -167,6 +201,11 @@ public:
     std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
     std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
     const bool & is_twist_valid, const bool & is_imu_valid);
+
+  /** \brief Advance the motion by time_offset and return the transform that undistorts the points
+   * of the current slice, in the pointcloud frame */
+  Eigen::Matrix4f advance_slice_transform_implementation(
+    const Eigen::Vector3f & linear, const Eigen::Vector3f & angular, const float & time_offset);
 };
 
 class DistortionCorrector3D : public DistortionCorrector<DistortionCorrector3D>
@@ -193,6 +232,11 @@ public:
     std::deque<geometry_msgs::msg::TwistStamped>::iterator & it_twist,
     std::deque<geometry_msgs::msg::Vector3Stamped>::iterator & it_imu, const float & time_offset,
     const bool & is_twist_valid, const bool & is_imu_valid);
+
+  /** \brief Advance the motion by time_offset and return the transform that undistorts the points
+   * of the current slice, in the pointcloud frame */
+  Eigen::Matrix4f advance_slice_transform_implementation(
+    const Eigen::Vector3f & linear, const Eigen::Vector3f & angular, const float & time_offset);
 };
 
 }  // namespace autoware::pointcloud_preprocessor
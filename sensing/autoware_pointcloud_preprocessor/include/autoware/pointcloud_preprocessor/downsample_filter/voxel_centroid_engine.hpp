@@ -0,0 +1,129 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__DOWNSAMPLE_FILTER__VOXEL_CENTROID_ENGINE_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__DOWNSAMPLE_FILTER__VOXEL_CENTROID_ENGINE_HPP_
+
+#include <Eigen/Core>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+
+/** \brief Accumulates points into voxels and computes one centroid per occupied voxel.
+ *
+ * The engine keeps one flat open-addressing hash table per worker. The tables are kept across
+ * calls so that, once warmed up, a frame does not allocate. The input buffer is split into
+ * contiguous ranges, each worker accumulates its range into its own table, and the partial sums
+ * are merged at the end. Voxels are emitted sorted by their packed (x, y, z) key, so the output
+ * order only depends on the input points and the number of threads.
+ */
+class VoxelCentroidEngine
+{
+public:
+  /** \brief Byte layout of a point inside a PointCloud2 data buffer */
+  struct FieldLayout
+  {
+    size_t point_step{0};
+    int x_offset{0};
+    int y_offset{0};
+    int z_offset{0};
+    /** \brief -1 if the cloud has no intensity field */
+    int intensity_offset{-1};
+  };
+
+  struct Voxel
+  {
+    uint64_t key;
+    float x;
+    float y;
+    float z;
+    float intensity;
+    uint32_t point_count;
+
+    Eigen::Vector4f calc_centroid() const
+    {
+      const float inv = 1.0f / static_cast<float>(point_count);
+      return {x * inv, y * inv, z * inv, intensity * inv};
+    }
+  };
+
+  /** \brief Voxel indices must fit in this many bits per axis (sign included) */
+  static constexpr int key_bits_per_axis = 21;
+
+  VoxelCentroidEngine();
+
+  void set_voxel_size(float voxel_size_x, float voxel_size_y, float voxel_size_z);
+
+  /** \brief Number of workers used for clouds large enough to benefit from it (0 = hardware) */
+  void set_num_threads(size_t num_threads);
+
+  /** \brief Accumulate `num_points` points of `data` into voxels.
+   * \return false if a voxel index does not fit in the key, in which case voxels() is empty.
+   */
+  bool compute(const uint8_t * data, size_t num_points, const FieldLayout & layout);
+
+  /** \brief Same as above for points stored as separate arrays, `intensity` may be nullptr */
+  bool compute(
+    const float * x, const float * y, const float * z, const uint8_t * intensity,
+    size_t num_points);
+
+  /** \brief Voxels of the last compute() call, sorted by key */
+  const std::vector<Voxel> & voxels() const { return voxels_; }
+
+private:
+  /** \brief Open-addressing (linear probing) table storing the voxel sums inline */
+  struct VoxelTable
+  {
+    static constexpr uint64_t empty_key = ~static_cast<uint64_t>(0);
+
+    std::vector<Voxel> slots;
+    size_t size{0};
+    size_t mask{0};
+    int shift{64};
+
+    void reset(size_t expected_voxels);
+    void add_point(uint64_t key, float x, float y, float z, float intensity);
+
+  private:
+    void rehash(size_t capacity);
+    void set_capacity(size_t capacity);
+    size_t slot_of(uint64_t key) const;
+  };
+
+  /** \brief Accumulate the points returned by `read_point(i, x, y, z, intensity)` in parallel
+   * \return false if a point has a voxel index that overflows the key
+   */
+  template <typename PointReader>
+  bool compute_impl(size_t num_points, const PointReader & read_point);
+
+  template <typename PointReader>
+  bool accumulate_range(
+    size_t begin, size_t end, const PointReader & read_point, VoxelTable & table) const;
+
+  void merge_tables(size_t num_tables);
+
+  Eigen::Array3f inverse_voxel_size_;
+  size_t num_threads_;
+  std::vector<VoxelTable> tables_;
+  std::vector<Voxel> voxels_;
+  size_t last_voxel_count_;
+};
+
+}  // namespace autoware::pointcloud_preprocessor
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__DOWNSAMPLE_FILTER__VOXEL_CENTROID_ENGINE_HPP_
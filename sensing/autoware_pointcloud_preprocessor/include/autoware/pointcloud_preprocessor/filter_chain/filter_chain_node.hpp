@@ -0,0 +1,81 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__FILTER_CHAIN_NODE_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__FILTER_CHAIN_NODE_HPP_
+
+#include "autoware/pointcloud_preprocessor/diagnostics/diagnostics_base.hpp"
+#include "autoware/pointcloud_preprocessor/distortion_corrector/distortion_corrector.hpp"
+#include "autoware/pointcloud_preprocessor/filter.hpp"
+#include "autoware/pointcloud_preprocessor/filter_chain/filter_stages.hpp"
+#include "autoware/pointcloud_preprocessor/filter_chain/point_soa_buffer.hpp"
+#include "autoware/pointcloud_preprocessor/transform_info.hpp"
+
+#include <autoware_utils/ros/polling_subscriber.hpp>
+
+#include <geometry_msgs/msg/twist_with_covariance_stamped.hpp>
+#include <sensor_msgs/msg/imu.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+
+/** \brief Runs crop box, distortion correction, ring outlier filter and voxel grid downsampling
+ * in process. The cloud is deserialized once into a structure-of-arrays buffer, every enabled
+ * stage works in place on it, and only the result of the last stage is serialized. */
+class PointCloudFilterChainComponent : public autoware::pointcloud_preprocessor::Filter
+{
+protected:
+  void filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output) override;
+
+  // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
+  // to new API
+  void faster_filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+    const TransformInfo & transform_info) override;
+
+private:
+  autoware_utils::InterProcessPollingSubscriber<
+    geometry_msgs::msg::TwistWithCovarianceStamped, autoware_utils::polling_policy::All>::SharedPtr
+    twist_sub_;
+  autoware_utils::InterProcessPollingSubscriber<
+    sensor_msgs::msg::Imu, autoware_utils::polling_policy::All>::SharedPtr imu_sub_;
+
+  std::string base_frame_;
+  bool use_imu_{false};
+  double processing_time_threshold_sec_{0.0};
+
+  PointSoABuffer points_;
+  std::vector<std::unique_ptr<FilterStage>> stages_;
+  CropBoxStage * crop_box_stage_{nullptr};
+  UndistortStage * undistort_stage_{nullptr};
+
+  /** \brief Only used to keep the twist and IMU queues, the points are undistorted by the stage */
+  std::unique_ptr<DistortionCorrectorBase> motion_queue_;
+
+  void update_undistort_stage(const PointCloud2 & input);
+  void publish_diagnostics(const std::vector<std::shared_ptr<const DiagnosticsBase>> & diagnostics);
+
+public:
+  PCL_MAKE_ALIGNED_OPERATOR_NEW
+  explicit PointCloudFilterChainComponent(const rclcpp::NodeOptions & options);
+};
+
+}  // namespace autoware::pointcloud_preprocessor
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__FILTER_CHAIN_NODE_HPP_
@@ -0,0 +1,158 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__FILTER_STAGES_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__FILTER_STAGES_HPP_
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_centroid_engine.hpp"
+#include "autoware/pointcloud_preprocessor/filter_chain/point_soa_buffer.hpp"
+
+#include <Eigen/Core>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+
+/** \brief One step of an in-process filter chain. A stage works in place on the shared buffer.
+ * The points stay in the sensor frame through the whole chain. */
+class FilterStage
+{
+public:
+  virtual ~FilterStage() = default;
+  [[nodiscard]] virtual std::string name() const = 0;
+  virtual void apply(PointSoABuffer & points) = 0;
+};
+
+/** \brief Same box test as CropBoxFilterComponent, evaluated in the crop box frame */
+class CropBoxStage : public FilterStage
+{
+public:
+  struct Param
+  {
+    float min_x;
+    float min_y;
+    float min_z;
+    float max_x;
+    float max_y;
+    float max_z;
+    bool negative;
+  };
+
+  explicit CropBoxStage(const Param & param) : param_(param) {}
+
+  [[nodiscard]] std::string name() const override { return "crop_box"; }
+  void apply(PointSoABuffer & points) override;
+
+  /** \brief Sensor to crop box frame transform, identity when unset */
+  void set_transform(const std::optional<Eigen::Matrix4f> & sensor_to_box);
+  [[nodiscard]] int skipped_nan_count() const { return skipped_nan_count_; }
+
+private:
+  Param param_;
+  std::optional<Eigen::Matrix4f> sensor_to_box_;
+  std::vector<uint8_t> keep_;
+  int skipped_nan_count_{0};
+};
+
+/** \brief Same motion compensation as DistortionCorrector2D / DistortionCorrector3D */
+class UndistortStage : public FilterStage
+{
+public:
+  struct TwistSample
+  {
+    double stamp;
+    Eigen::Vector3f linear;
+    Eigen::Vector3f angular;
+  };
+
+  struct AngularVelocitySample
+  {
+    double stamp;
+    Eigen::Vector3f angular;
+  };
+
+  explicit UndistortStage(bool use_3d) : use_3d_(use_3d) {}
+
+  [[nodiscard]] std::string name() const override { return "distortion_corrector"; }
+  void apply(PointSoABuffer & points) override;
+
+  /** \brief Motion samples and stamps of the cloud to undistort next.
+   * \param cloud_stamp header stamp, point stamps are relative to it [s]
+   * \param reference_stamp stamp the points are compensated to, usually the one of the first point
+   * of the sensor cloud before any point was removed [s]
+   * \param twists sorted by stamp
+   * \param angular_velocities sorted by stamp, empty when the IMU is not used
+   */
+  void set_frame(
+    double cloud_stamp, double reference_stamp, std::vector<TwistSample> twists,
+    std::vector<AngularVelocitySample> angular_velocities);
+
+  /** \brief Sensor to base_link transform, identity when unset */
+  void set_transform(const std::optional<Eigen::Matrix4f> & sensor_to_base_link);
+  [[nodiscard]] int timestamp_mismatch_count() const { return timestamp_mismatch_count_; }
+
+private:
+  bool use_3d_;
+  double cloud_stamp_{0.0};
+  double reference_stamp_{0.0};
+  std::vector<TwistSample> twists_;
+  std::vector<AngularVelocitySample> angular_velocities_;
+  std::optional<Eigen::Matrix4f> sensor_to_base_link_;
+  Eigen::Matrix4f base_link_to_sensor_{Eigen::Matrix4f::Identity()};
+  int timestamp_mismatch_count_{0};
+};
+
+/** \brief Same walk over each ring as RingOutlierFilterComponent */
+class RingOutlierStage : public FilterStage
+{
+public:
+  struct Param
+  {
+    double distance_ratio;
+    double object_length_threshold;
+    uint16_t max_rings_num;
+  };
+
+  explicit RingOutlierStage(const Param & param) : param_(param) {}
+
+  [[nodiscard]] std::string name() const override { return "ring_outlier_filter"; }
+  void apply(PointSoABuffer & points) override;
+
+private:
+  Param param_;
+  std::vector<uint8_t> keep_;
+  std::vector<size_t> ring_begin_;
+  std::vector<size_t> ring_order_;
+};
+
+/** \brief Centroid voxel grid on the VoxelCentroidEngine. Only x, y, z and intensity survive. */
+class VoxelDownsampleStage : public FilterStage
+{
+public:
+  VoxelDownsampleStage(
+    float voxel_size_x, float voxel_size_y, float voxel_size_z, size_t num_threads);
+
+  [[nodiscard]] std::string name() const override { return "voxel_grid_downsample_filter"; }
+  void apply(PointSoABuffer & points) override;
+
+private:
+  VoxelCentroidEngine engine_;
+};
+
+}  // namespace autoware::pointcloud_preprocessor
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__FILTER_STAGES_HPP_
@@ -0,0 +1,83 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__POINT_SOA_BUFFER_HPP_
+#define AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__POINT_SOA_BUFFER_HPP_
+
+#include <Eigen/Core>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+
+/** \brief Byte offsets of the PointXYZIRCAEDT fields inside a PointCloud2 data buffer.
+ * Optional fields are -1 when absent. */
+struct PointFieldLayout
+{
+  size_t point_step{0};
+  int x_offset{-1};
+  int y_offset{-1};
+  int z_offset{-1};
+  int intensity_offset{-1};
+  int return_type_offset{-1};
+  int channel_offset{-1};
+  int azimuth_offset{-1};
+  int distance_offset{-1};
+  int time_stamp_offset{-1};
+};
+
+/** \brief Structure-of-arrays point storage shared by the stages of a filter chain.
+ *
+ * The arrays keep their capacity across frames, so once the buffer has seen its largest cloud,
+ * loading, filtering and storing do not allocate.
+ */
+class PointSoABuffer
+{
+public:
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<uint8_t> intensity;
+  std::vector<uint8_t> return_type;
+  std::vector<uint16_t> channel;
+  std::vector<float> azimuth;
+  std::vector<float> distance;
+  /** \brief Relative to the cloud header stamp [ns] */
+  std::vector<uint32_t> time_stamp;
+
+  [[nodiscard]] size_t size() const { return x.size(); }
+  [[nodiscard]] bool empty() const { return x.empty(); }
+
+  void resize(size_t num_points);
+
+  /** \brief Scatter the fields of a PointCloud2 data buffer into the arrays */
+  void load(const uint8_t * data, size_t num_points, const PointFieldLayout & layout);
+
+  /** \brief Keep only the points whose `keep` flag is set, preserving their order */
+  void compact(const std::vector<uint8_t> & keep);
+
+  /** \brief Write the points as PointXYZIRC, optionally transformed.
+   * `output` must hold size() * sizeof(PointXYZIRC) bytes. */
+  void store_xyzirc(uint8_t * output, const Eigen::Matrix4f * transform) const;
+
+  /** \brief Size of a PointXYZIRC point in bytes */
+  static constexpr size_t xyzirc_point_step = 16;
+};
+
+}  // namespace autoware::pointcloud_preprocessor
+
+#endif  // AUTOWARE__POINTCLOUD_PREPROCESSOR__FILTER_CHAIN__POINT_SOA_BUFFER_HPP_
@@ -16,15 +16,14 @@
 
 #include "autoware/pointcloud_preprocessor/concatenate_data/concatenation_info_manager.hpp"
 
-#include <pcl_ros/transforms.hpp>
-
-#include <sensor_msgs/point_cloud2_iterator.hpp>
-
-#include <pcl_conversions/pcl_conversions.h>
+#include <autoware/universe_utils/system/parallel_for.hpp>
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -33,69 +32,78 @@
 namespace autoware::pointcloud_preprocessor
 {
 
-void CombineCloudHandler<PointCloud2Traits>::convert_to_xyzirc_cloud(
-  const typename PointCloud2Traits::PointCloudMessage::ConstSharedPtr & input_cloud,
-  typename PointCloud2Traits::PointCloudMessage::UniquePtr & xyzirc_cloud)
+namespace
 {
-  xyzirc_cloud->header = input_cloud->header;
-
-  PointCloud2Modifier<PointXYZIRC, autoware::point_types::PointXYZIRCGenerator> output_modifier{
-    *xyzirc_cloud, input_cloud->header.frame_id};
-  output_modifier.reserve(input_cloud->width);
-
-  bool has_valid_intensity =
-    std::any_of(input_cloud->fields.begin(), input_cloud->fields.end(), [](const auto & field) {
-      return field.name == "intensity" && field.datatype == sensor_msgs::msg::PointField::UINT8;
-    });
-
-  bool has_valid_return_type =
-    std::any_of(input_cloud->fields.begin(), input_cloud->fields.end(), [](const auto & field) {
-      return field.name == "return_type" && field.datatype == sensor_msgs::msg::PointField::UINT8;
-    });
-
-  bool has_valid_channel =
-    std::any_of(input_cloud->fields.begin(), input_cloud->fields.end(), [](const auto & field) {
-      return field.name == "channel" && field.datatype == sensor_msgs::msg::PointField::UINT16;
-    });
-
-  sensor_msgs::PointCloud2ConstIterator<float> it_x(*input_cloud, "x");
-  sensor_msgs::PointCloud2ConstIterator<float> it_y(*input_cloud, "y");
-  sensor_msgs::PointCloud2ConstIterator<float> it_z(*input_cloud, "z");
-
-  if (has_valid_intensity && has_valid_return_type && has_valid_channel) {
-    sensor_msgs::PointCloud2ConstIterator<std::uint8_t> it_i(*input_cloud, "intensity");
-    sensor_msgs::PointCloud2ConstIterator<std::uint8_t> it_r(*input_cloud, "return_type");
-    sensor_msgs::PointCloud2ConstIterator<std::uint16_t> it_c(*input_cloud, "channel");
-
-    for (; it_x != it_x.end(); ++it_x, ++it_y, ++it_z, ++it_i, ++it_r, ++it_c) {
-      PointXYZIRC point;
-      point.x = *it_x;
-      point.y = *it_y;
-      point.z = *it_z;
-      point.intensity = *it_i;
-      point.return_type = *it_r;
-      point.channel = *it_c;
-      output_modifier.push_back(std::move(point));
+std::optional<std::uint32_t> find_field_offset(
+  const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name, std::uint8_t datatype)
+{
+  for (const auto & field : cloud.fields) {
+    if (field.name == name && field.datatype == datatype) {
+      return field.offset;
     }
-  } else {
-    for (; it_x != it_x.end(); ++it_x, ++it_y, ++it_z) {
-      PointXYZIRC point;
-      point.x = *it_x;
-      point.y = *it_y;
-      point.z = *it_z;
-      output_modifier.push_back(std::move(point));
+  }
+  return std::nullopt;
+}
+}  // namespace
+
+CombineCloudHandler<PointCloud2Traits>::CombineCloudHandler(
+  rclcpp::Node & node, const std::vector<std::string> & input_topics, std::string output_frame,
+  bool is_motion_compensated, bool publish_synchronized_pointcloud,
+  bool keep_input_frame_in_synchronized_pointcloud)
+: CombineCloudHandlerBase(
+    node, input_topics, output_frame, is_motion_compensated, publish_synchronized_pointcloud,
+    keep_input_frame_in_synchronized_pointcloud)
+{
+  // Optional so that the handler can also be created for nodes that do not declare it
+  if (node.has_parameter("num_threads")) {
+    const int64_t num_threads = node.get_parameter("num_threads").as_int();
+    set_num_threads(static_cast<size_t>(std::max<int64_t>(0, num_threads)));
+  }
+}
+
+void CombineCloudHandler<PointCloud2Traits>::set_num_threads(size_t num_threads)
+{
+  num_threads_ = universe_utils::resolveNumThreads(num_threads);
+}
+
+std::unique_ptr<sensor_msgs::msg::PointCloud2>
+CombineCloudHandler<PointCloud2Traits>::make_xyzirc_cloud(
+  const std::string & frame_id, std::size_t num_points)
+{
+  auto cloud = std::make_unique<sensor_msgs::msg::PointCloud2>();
+  {
+    // Sets the XYZIRC fields, so that the cloud keeps this layout even if no point is written
+    PointCloud2Modifier<PointXYZIRC, autoware::point_types::PointXYZIRCGenerator> modifier{
+      *cloud, frame_id};
+  }
+  // Zero-filling the data here, outside of the concatenation, lets resize() only shrink it there
+  cloud->data.resize(num_points * sizeof(PointXYZIRC));
+  return cloud;
+}
+
+void CombineCloudHandler<PointCloud2Traits>::allocate_pointclouds()
+{
+  if (!concatenated_cloud_ptr_) {
+    concatenated_cloud_ptr_ = make_xyzirc_cloud(output_frame_, max_concat_pointcloud_size_);
+  }
+  if (!publish_synchronized_pointcloud_) return;
+
+  for (const auto & [topic, max_pointcloud_size] : topic_to_max_pointcloud_size_map_) {
+    auto & synchronized_cloud = topic_to_synchronized_cloud_map_[topic];
+    if (!synchronized_cloud) {
+      synchronized_cloud = make_xyzirc_cloud(output_frame_, max_pointcloud_size);
     }
   }
 }
 
-void CombineCloudHandler<PointCloud2Traits>::correct_pointcloud_motion(
-  const std::unique_ptr<PointCloud2Traits::PointCloudMessage> & transformed_cloud_ptr,
-  const std::vector<rclcpp::Time> & pc_stamps,
-  std::unordered_map<rclcpp::Time, Eigen::Matrix4f, RclcppTimeHash> & transform_memo,
-  std::unique_ptr<PointCloud2Traits::PointCloudMessage> & transformed_delay_compensated_cloud_ptr)
+Eigen::Matrix4f CombineCloudHandler<PointCloud2Traits>::compute_motion_compensation_transform(
+  const rclcpp::Time & cloud_stamp, const std::vector<rclcpp::Time> & pc_stamps,
+  std::unordered_map<rclcpp::Time, Eigen::Matrix4f, RclcppTimeHash> & transform_memo)
 {
+  // Chain the transforms between consecutive stamps down to the oldest one, so that the clouds
+  // share the intermediate transforms
   Eigen::Matrix4f adjust_to_old_data_transform = Eigen::Matrix4f::Identity();
-  rclcpp::Time current_cloud_stamp = rclcpp::Time(transformed_cloud_ptr->header.stamp);
+  rclcpp::Time current_cloud_stamp = cloud_stamp;
   for (const auto & stamp : pc_stamps) {
     if (stamp >= current_cloud_stamp) continue;
 
@@ -110,11 +118,50 @@ void CombineCloudHandler<PointCloud2Traits>::correct_pointcloud_motion(
     adjust_to_old_data_transform = new_to_old_transform * adjust_to_old_data_transform;
     current_cloud_stamp = stamp;
   }
-  pcl_ros::transformPointCloud(
-    adjust_to_old_data_transform, *transformed_cloud_ptr, *transformed_delay_compensated_cloud_ptr);
+  return adjust_to_old_data_transform;
+}
+
+void CombineCloudHandler<PointCloud2Traits>::write_slice_points(
+  const CloudSlice & slice, std::size_t begin, std::size_t end, std::uint8_t * concatenated_output)
+{
+  const std::uint8_t * input = slice.cloud->data.data();
+  const std::size_t point_step = slice.cloud->point_step;
+  const Eigen::Matrix4f concatenate_transform = slice.concatenate_transform;
+  const Eigen::Matrix4f synchronized_transform = slice.synchronized_transform;
+  auto * output = reinterpret_cast<PointXYZIRC *>(concatenated_output) + slice.start_index;
+  auto * synchronized_output = reinterpret_cast<PointXYZIRC *>(slice.synchronized_output);
+
+  for (std::size_t i = begin; i < end; ++i) {
+    const std::uint8_t * point = input + i * point_step;
+    Eigen::Vector4f xyz(0.0f, 0.0f, 0.0f, 1.0f);
+    std::memcpy(&xyz[0], point + slice.x_offset, sizeof(float));
+    std::memcpy(&xyz[1], point + slice.y_offset, sizeof(float));
+    std::memcpy(&xyz[2], point + slice.z_offset, sizeof(float));
+
+    PointXYZIRC output_point;
+    if (slice.has_valid_irc_fields) {
+      std::memcpy(&output_point.intensity, point + slice.intensity_offset, sizeof(std::uint8_t));
+      std::memcpy(
+        &output_point.return_type, point + slice.return_type_offset, sizeof(std::uint8_t));
+      std::memcpy(&output_point.channel, point + slice.channel_offset, sizeof(std::uint16_t));
+    }
+
+    const Eigen::Vector4f transformed = concatenate_transform * xyz;
+    output_point.x = transformed.x();
+    output_point.y = transformed.y();
+    output_point.z = transformed.z();
+    output[i] = output_point;
+
+    if (synchronized_output) {
+      const Eigen::Vector4f synchronized = synchronized_transform * xyz;
+      output_point.x = synchronized.x();
+      output_point.y = synchronized.y();
+      output_point.z = synchronized.z();
+      synchronized_output[i] = output_point;
+    }
+  }
 }
 
-// TODO(vividf): refactor this function for readability
 ConcatenatedCloudResult<PointCloud2Traits>
 CombineCloudHandler<PointCloud2Traits>::combine_pointclouds(
   std::unordered_map<std::string, PointCloud2Traits::PointCloudMessage::ConstSharedPtr> &
@@ -138,97 +185,151 @@ CombineCloudHandler<PointCloud2Traits>::combine_pointclouds(
 
   std::unordered_map<rclcpp::Time, Eigen::Matrix4f, RclcppTimeHash> transform_memo;
 
-  // Before combining the pointclouds, initialize and reserve space for the concatenated pointcloud
-  concatenate_cloud_result.concatenate_cloud_ptr =
-    std::make_unique<sensor_msgs::msg::PointCloud2>();
   concatenate_cloud_result.concatenation_info_ptr =
     std::make_unique<autoware_sensing_msgs::msg::ConcatenatedPointCloudInfo>(
       concatenation_info_manager_.reset_and_get_base_info());
-  {
-    // Normally, pcl::concatenatePointCloud() copies the field layout (e.g., XYZIRC)
-    // from the non-empty point cloud when given one empty and one non-empty input.
-    //
-    // However, if all input clouds in topic_to_cloud_map are empty,
-    // the function receives two empty point clouds and does nothing,
-    // resulting in concatenate_cloud_ptr not being compatible with the XYZIRC format.
-    //
-    // To avoid this, we explicitly set the fields of concatenate_cloud_ptr to XYZIRC here.
-    PointCloud2Modifier<PointXYZIRC, autoware::point_types::PointXYZIRCGenerator>
-      concatenate_cloud_modifier{*concatenate_cloud_result.concatenate_cloud_ptr, output_frame_};
-  }
-
-  // Reserve space based on the total size of the pointcloud data to speed up the concatenation
-  // process
-  size_t total_data_size = 0;
-  for (const auto & [topic, cloud] : topic_to_cloud_map) {
-    total_data_size += cloud->data.size();
-  }
-  concatenate_cloud_result.concatenate_cloud_ptr->data.reserve(total_data_size);
-
-  for (const auto & [topic, cloud] : topic_to_cloud_map) {
-    // convert to XYZIRC pointcloud if pointcloud is not empty
-    auto xyzirc_cloud = std::make_unique<sensor_msgs::msg::PointCloud2>();
-    convert_to_xyzirc_cloud(cloud, xyzirc_cloud);
 
-    auto transformed_cloud_ptr = std::make_unique<sensor_msgs::msg::PointCloud2>();
-    managed_tf_buffer_->transformPointcloud(
-      output_frame_, *xyzirc_cloud, *transformed_cloud_ptr, xyzirc_cloud->header.stamp,
+  // Look up all the transforms first, in the order of the input topics so that the slices of the
+  // concatenated cloud are deterministic. The points are then written directly into their slice.
+  std::vector<CloudSlice> slices;
+  std::vector<std::string> slice_topics;
+  slices.reserve(topic_to_cloud_map.size());
+  slice_topics.reserve(topic_to_cloud_map.size());
+  std::size_t total_num_points = 0;
+
+  for (const auto & topic : input_topics_) {
+    const auto cloud_it = topic_to_cloud_map.find(topic);
+    if (cloud_it == topic_to_cloud_map.end()) continue;
+    const auto & cloud = cloud_it->second;
+
+    CloudSlice slice;
+    slice.cloud = cloud.get();
+    slice.start_index = total_num_points;
+
+    const std::size_t num_points = static_cast<std::size_t>(cloud->width) * cloud->height;
+    auto transform_opt = managed_tf_buffer_->getTransform<Eigen::Matrix4f>(
+      output_frame_, cloud->header.frame_id, rclcpp::Time(cloud->header.stamp),
       rclcpp::Duration::from_seconds(1.0), node_.get_logger());
 
-    // compensate pointcloud
-    std::unique_ptr<sensor_msgs::msg::PointCloud2> transformed_delay_compensated_cloud_ptr;
-    if (is_motion_compensated_) {
-      transformed_delay_compensated_cloud_ptr = std::make_unique<sensor_msgs::msg::PointCloud2>();
-      correct_pointcloud_motion(
-        transformed_cloud_ptr, pc_stamps, transform_memo, transformed_delay_compensated_cloud_ptr);
-    } else {
-      transformed_delay_compensated_cloud_ptr = std::move(transformed_cloud_ptr);
+    // Without a transform the cloud cannot be placed in the output frame and gets no points
+    if (transform_opt && num_points > 0) {
+      const auto x_offset = find_field_offset(*cloud, "x", sensor_msgs::msg::PointField::FLOAT32);
+      const auto y_offset = find_field_offset(*cloud, "y", sensor_msgs::msg::PointField::FLOAT32);
+      const auto z_offset = find_field_offset(*cloud, "z", sensor_msgs::msg::PointField::FLOAT32);
+      if (!x_offset || !y_offset || !z_offset) {
+        throw std::runtime_error("Pointcloud of " + topic + " has no float x, y and z fields");
+      }
+      slice.num_points = num_points;
+      slice.x_offset = *x_offset;
+      slice.y_offset = *y_offset;
+      slice.z_offset = *z_offset;
+
+      const auto intensity_offset =
+        find_field_offset(*cloud, "intensity", sensor_msgs::msg::PointField::UINT8);
+      const auto return_type_offset =
+        find_field_offset(*cloud, "return_type", sensor_msgs::msg::PointField::UINT8);
+      const auto channel_offset =
+        find_field_offset(*cloud, "channel", sensor_msgs::msg::PointField::UINT16);
+      slice.has_valid_irc_fields = intensity_offset && return_type_offset && channel_offset;
+      if (slice.has_valid_irc_fields) {
+        slice.intensity_offset = *intensity_offset;
+        slice.return_type_offset = *return_type_offset;
+        slice.channel_offset = *channel_offset;
+      }
+
+      slice.concatenate_transform = *transform_opt;
+      if (is_motion_compensated_) {
+        slice.concatenate_transform =
+          compute_motion_compensation_transform(
+            rclcpp::Time(cloud->header.stamp), pc_stamps, transform_memo) *
+          slice.concatenate_transform;
+      }
+      // The synchronized cloud goes back to the sensor frame, keeping the motion compensation
+      slice.synchronized_transform =
+        keep_input_frame_in_synchronized_pointcloud_ && cloud->header.frame_id != output_frame_
+          ? Eigen::Matrix4f(transform_opt->inverse() * slice.concatenate_transform)
+          : slice.concatenate_transform;
     }
 
-    if (
-      transformed_delay_compensated_cloud_ptr->width *
-        transformed_delay_compensated_cloud_ptr->height >
-      0) {
-      pcl::concatenatePointCloud(
-        *concatenate_cloud_result.concatenate_cloud_ptr, *transformed_delay_compensated_cloud_ptr,
-        *concatenate_cloud_result.concatenate_cloud_ptr);
+    total_num_points += slice.num_points;
+    slices.push_back(slice);
+    slice_topics.push_back(topic);
+  }
+
+  // Take the output buffers prepared by allocate_pointclouds(), they only shrink here unless this
+  // cycle is the largest so far
+  if (!concatenated_cloud_ptr_) {
+    concatenated_cloud_ptr_ = make_xyzirc_cloud(output_frame_, total_num_points);
+  }
+  max_concat_pointcloud_size_ = std::max(max_concat_pointcloud_size_, total_num_points);
+  concatenate_cloud_result.concatenate_cloud_ptr = std::move(concatenated_cloud_ptr_);
+  auto & concatenate_cloud = *concatenate_cloud_result.concatenate_cloud_ptr;
+  concatenate_cloud.header.frame_id = output_frame_;
+  concatenate_cloud.height = 1;
+  concatenate_cloud.width = static_cast<std::uint32_t>(total_num_points);
+  concatenate_cloud.row_step = concatenate_cloud.width * concatenate_cloud.point_step;
+  concatenate_cloud.data.resize(total_num_points * sizeof(PointXYZIRC));
+
+  if (publish_synchronized_pointcloud_) {
+    concatenate_cloud_result.topic_to_transformed_cloud_map =
+      std::unordered_map<std::string, sensor_msgs::msg::PointCloud2::UniquePtr>();
+    for (std::size_t i = 0; i < slices.size(); ++i) {
+      const auto & topic = slice_topics[i];
+      auto & slice = slices[i];
+      auto & max_pointcloud_size = topic_to_max_pointcloud_size_map_[topic];
+      max_pointcloud_size = std::max(max_pointcloud_size, slice.num_points);
+
+      auto synchronized_cloud_it = topic_to_synchronized_cloud_map_.find(topic);
+      auto synchronized_cloud =
+        synchronized_cloud_it != topic_to_synchronized_cloud_map_.end() &&
+            synchronized_cloud_it->second
+          ? std::move(synchronized_cloud_it->second)
+          : make_xyzirc_cloud(output_frame_, slice.num_points);
+
+      const bool need_transform_to_sensor_frame = slice.cloud->header.frame_id != output_frame_;
+      synchronized_cloud->header.stamp = oldest_stamp;
+      synchronized_cloud->header.frame_id =
+        keep_input_frame_in_synchronized_pointcloud_ && need_transform_to_sensor_frame
+          ? slice.cloud->header.frame_id
+          : output_frame_;
+      synchronized_cloud->height = 1;
+      synchronized_cloud->width = static_cast<std::uint32_t>(slice.num_points);
+      synchronized_cloud->row_step = synchronized_cloud->width * synchronized_cloud->point_step;
+      synchronized_cloud->data.resize(slice.num_points * sizeof(PointXYZIRC));
+      slice.synchronized_output = synchronized_cloud->data.data();
+
+      (*concatenate_cloud_result.topic_to_transformed_cloud_map)[topic] =
+        std::move(synchronized_cloud);
     }
+  }
 
-    // update concatenation info
-    concatenation_info_manager_.update_source_from_point_cloud(
-      *transformed_delay_compensated_cloud_ptr, topic,
+  // Split the points evenly between the workers, a worker may span several slices
+  std::uint8_t * concatenated_output = concatenate_cloud.data.data();
+  const auto write_points = [&slices, concatenated_output](std::size_t begin, std::size_t end) {
+    for (const auto & slice : slices) {
+      const std::size_t slice_end = slice.start_index + slice.num_points;
+      if (slice_end <= begin || slice.start_index >= end) continue;
+      write_slice_points(
+        slice, std::max(begin, slice.start_index) - slice.start_index,
+        std::min(end, slice_end) - slice.start_index, concatenated_output);
+    }
+  };
+
+  universe_utils::parallelFor(
+    total_num_points, num_threads_, min_points_per_thread,
+    [&write_points](std::size_t begin, std::size_t end, std::size_t) { write_points(begin, end); });
+
+  // update concatenation info, in the order of the slices
+  for (std::size_t i = 0; i < slices.size(); ++i) {
+    std_msgs::msg::Header header;
+    header.stamp = slices[i].cloud->header.stamp;
+    header.frame_id = output_frame_;
+    concatenation_info_manager_.update_source_from_header_and_length(
+      header, static_cast<std::uint32_t>(slices[i].num_points), slice_topics[i],
       autoware_sensing_msgs::msg::SourcePointCloudInfo::STATUS_OK,
       *concatenate_cloud_result.concatenation_info_ptr);
-
-    if (publish_synchronized_pointcloud_) {
-      if (!concatenate_cloud_result.topic_to_transformed_cloud_map) {
-        // Initialize the map if it is not present
-        concatenate_cloud_result.topic_to_transformed_cloud_map =
-          std::unordered_map<std::string, sensor_msgs::msg::PointCloud2::UniquePtr>();
-      }
-      // convert to original sensor frame if necessary
-      bool need_transform_to_sensor_frame = (cloud->header.frame_id != output_frame_);
-      if (keep_input_frame_in_synchronized_pointcloud_ && need_transform_to_sensor_frame) {
-        auto transformed_cloud_ptr_in_sensor_frame =
-          std::make_unique<sensor_msgs::msg::PointCloud2>();
-        managed_tf_buffer_->transformPointcloud(
-          cloud->header.frame_id, *transformed_delay_compensated_cloud_ptr,
-          *transformed_cloud_ptr_in_sensor_frame,
-          transformed_cloud_ptr_in_sensor_frame->header.stamp, rclcpp::Duration::from_seconds(1.0),
-          node_.get_logger());
-        transformed_cloud_ptr_in_sensor_frame->header.stamp = oldest_stamp;
-        transformed_cloud_ptr_in_sensor_frame->header.frame_id = cloud->header.frame_id;
-
-        (*concatenate_cloud_result.topic_to_transformed_cloud_map)[topic] =
-          std::move(transformed_cloud_ptr_in_sensor_frame);
-      } else {
-        transformed_delay_compensated_cloud_ptr->header.stamp = oldest_stamp;
-        transformed_delay_compensated_cloud_ptr->header.frame_id = output_frame_;
-        (*concatenate_cloud_result.topic_to_transformed_cloud_map)[topic] =
-          std::move(transformed_delay_compensated_cloud_ptr);
-      }
-    }
   }
+
   concatenate_cloud_result.concatenate_cloud_ptr->header.stamp = oldest_stamp;
 
   if (const auto advanced_info = std::dynamic_pointer_cast<AdvancedCollectorInfo>(collector_info)) {
@@ -78,6 +78,17 @@ std::deque<geometry_msgs::msg::TwistStamped> CombineCloudHandlerBase::get_twist_
   return twist_queue_;
 }
 
+void CombineCloudHandlerBase::record_concatenation_latency(double latency_ms)
+{
+  concatenation_info_manager_.record_concatenation_latency(latency_ms);
+}
+
+ConcatenationLatencyPercentiles CombineCloudHandlerBase::get_concatenation_latency_percentiles()
+  const
+{
+  return concatenation_info_manager_.get_concatenation_latency_percentiles();
+}
+
 Eigen::Matrix4f CombineCloudHandlerBase::compute_transform_to_adjust_for_old_timestamp(
   const rclcpp::Time & old_stamp, const rclcpp::Time & new_stamp)
 {
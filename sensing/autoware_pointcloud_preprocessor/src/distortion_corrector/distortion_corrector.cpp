@@ -17,16 +17,53 @@
 #include "autoware/pointcloud_preprocessor/utility/memory.hpp"
 #include "autoware_utils/math/constants.hpp"
 
+#include <autoware/universe_utils/system/parallel_for.hpp>
 #include <autoware_utils/math/trigonometry.hpp>
 #include <tf2_eigen/tf2_eigen.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <deque>
+#include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace autoware::pointcloud_preprocessor
 {
 
+namespace
+{
+// Above this number of slices, the slice duration is enlarged to bound the per-slice overhead
+constexpr uint64_t max_num_slices = 65536;
+// Below this number of points per worker, spawning threads costs more than it saves
+constexpr size_t min_points_per_thread = 16384;
+
+size_t get_field_offset(const sensor_msgs::msg::PointCloud2 & pointcloud, const std::string & name)
+{
+  // The layout has been checked by is_pointcloud_valid()
+  const auto field_it = std::find_if(
+    std::cbegin(pointcloud.fields), std::cend(pointcloud.fields),
+    [&name](const sensor_msgs::msg::PointField & field) { return field.name == name; });
+  return field_it->offset;
+}
+
+template <typename U>
+inline U read_field(const uint8_t * point, size_t offset)
+{
+  U value;
+  std::memcpy(&value, point + offset, sizeof(U));
+  return value;
+}
+
+template <typename U>
+inline void write_field(uint8_t * point, size_t offset, const U & value)
+{
+  std::memcpy(point + offset, &value, sizeof(U));
+}
+}  // namespace
+
 bool DistortionCorrectorBase::pointcloud_transform_exists() const
 {
   return pointcloud_transform_exists_;
@@ -37,6 +74,12 @@ bool DistortionCorrectorBase::pointcloud_transform_needed() const
   return pointcloud_transform_needed_;
 }
 
+void DistortionCorrectorBase::set_batch_config(double time_slice_sec, size_t num_threads)
+{
+  time_slice_sec_ = std::max(0.0, time_slice_sec);
+  num_threads_ = universe_utils::resolveNumThreads(num_threads);
+}
+
 std::deque<geometry_msgs::msg::TwistStamped> DistortionCorrectorBase::get_twist_queue()
 {
   return twist_queue_;
@@ -324,6 +367,11 @@ void DistortionCorrector<T>::undistort_pointcloud(
     return;
   }
 
+  if (time_slice_sec_ > 0.0) {
+    undistort_pointcloud_batched(use_imu, angle_conversion_opt, pointcloud);
+    return;
+  }
+
   sensor_msgs::PointCloud2Iterator<float> it_x(pointcloud, "x");
   sensor_msgs::PointCloud2Iterator<float> it_y(pointcloud, "y");
   sensor_msgs::PointCloud2Iterator<float> it_z(pointcloud, "z");
@@ -425,6 +473,193 @@ void DistortionCorrector<T>::undistort_pointcloud(
   warn_if_timestamp_is_too_late(is_twist_time_stamp_too_late, is_imu_time_stamp_too_late);
 }
 
+template <class T>
+void DistortionCorrector<T>::undistort_pointcloud_batched(
+  bool use_imu, std::optional<AngleConversion> angle_conversion_opt,
+  sensor_msgs::msg::PointCloud2 & pointcloud)
+{
+  if (angle_conversion_opt.has_value() && !pointcloud_transform_needed_) {
+    throw std::runtime_error(
+      "The pointcloud is not in the sensor's frame and thus azimuth and distance cannot be "
+      "updated. "
+      "Please change the input pointcloud or set update_azimuth_and_distance to false.");
+  }
+
+  const size_t num_points = pointcloud.width * pointcloud.height;
+  const size_t point_step = pointcloud.point_step;
+  const size_t x_offset = get_field_offset(pointcloud, "x");
+  const size_t y_offset = get_field_offset(pointcloud, "y");
+  const size_t z_offset = get_field_offset(pointcloud, "z");
+  const size_t azimuth_offset = get_field_offset(pointcloud, "azimuth");
+  const size_t distance_offset = get_field_offset(pointcloud, "distance");
+  const size_t time_stamp_offset = get_field_offset(pointcloud, "time_stamp");
+  uint8_t * data = pointcloud.data.data();
+
+  // Slices cover the time span of the points, which are not required to be in firing order
+  uint32_t min_time_stamp = std::numeric_limits<uint32_t>::max();
+  uint32_t max_time_stamp = 0;
+  for (size_t i = 0; i < num_points; ++i) {
+    const auto time_stamp = read_field<uint32_t>(data + i * point_step, time_stamp_offset);
+    min_time_stamp = std::min(min_time_stamp, time_stamp);
+    max_time_stamp = std::max(max_time_stamp, time_stamp);
+  }
+  const uint64_t time_span_ns = max_time_stamp - min_time_stamp;
+  uint64_t slice_ns = std::max<uint64_t>(1, static_cast<uint64_t>(time_slice_sec_ * 1e9));
+  if (time_span_ns / slice_ns + 1 > max_num_slices) {
+    slice_ns = time_span_ns / max_num_slices + 1;
+  }
+  const size_t num_slices = time_span_ns / slice_ns + 1;
+
+  // One transform per slice, integrated from the first point like the per-point mode does
+  const auto point_stamp = [&pointcloud](uint64_t time_stamp) {
+    return pointcloud.header.stamp.sec + 1e-9 * (pointcloud.header.stamp.nanosec + time_stamp);
+  };
+  const auto first_time_stamp = read_field<uint32_t>(data, time_stamp_offset);
+  const double first_point_time_stamp_sec = point_stamp(first_time_stamp);
+
+  // For performance, do not instantiate `rclcpp::Time` for every slice
+  std::vector<double> twist_stamps;
+  twist_stamps.reserve(twist_queue_.size());
+  for (const auto & twist : twist_queue_) {
+    twist_stamps.push_back(rclcpp::Time(twist.header.stamp).seconds());
+  }
+  std::vector<double> imu_stamps;
+  if (use_imu) {
+    imu_stamps.reserve(angular_velocity_queue_.size());
+    for (const auto & angular_velocity : angular_velocity_queue_) {
+      imu_stamps.push_back(rclcpp::Time(angular_velocity.header.stamp).seconds());
+    }
+  }
+  // Same association as the per-point mode: first sample not older than the stamp, or the last one
+  const auto find_sample = [](const std::vector<double> & stamps, double stamp) {
+    const auto it = std::lower_bound(stamps.begin(), stamps.end(), stamp);
+    return it == stamps.end() ? stamps.size() - 1
+                              : static_cast<size_t>(std::distance(stamps.begin(), it));
+  };
+
+  bool is_twist_time_stamp_too_late = false;
+  bool is_imu_time_stamp_too_late = false;
+  constexpr double time_diff = 0.1;
+
+  slice_transforms_.resize(num_slices);
+  slice_mismatches_.resize(num_slices);
+  const auto compute_slice_transform = [&](size_t slice, double & prev_time_stamp_sec) {
+    const double slice_stamp = point_stamp(min_time_stamp + slice * slice_ns + slice_ns / 2);
+
+    Eigen::Vector3f linear = Eigen::Vector3f::Zero();
+    Eigen::Vector3f angular = Eigen::Vector3f::Zero();
+    const size_t twist_index = find_sample(twist_stamps, slice_stamp);
+    const bool is_twist_valid = std::abs(slice_stamp - twist_stamps[twist_index]) <= time_diff;
+    if (is_twist_valid) {
+      const auto & twist = twist_queue_[twist_index].twist;
+      linear << static_cast<float>(twist.linear.x), static_cast<float>(twist.linear.y),
+        static_cast<float>(twist.linear.z);
+      angular << static_cast<float>(twist.angular.x), static_cast<float>(twist.angular.y),
+        static_cast<float>(twist.angular.z);
+    } else {
+      is_twist_time_stamp_too_late = true;
+    }
+
+    bool is_imu_valid = false;
+    if (!imu_stamps.empty()) {
+      const size_t imu_index = find_sample(imu_stamps, slice_stamp);
+      is_imu_valid = std::abs(slice_stamp - imu_stamps[imu_index]) <= time_diff;
+      if (is_imu_valid) {
+        const auto & vector = angular_velocity_queue_[imu_index].vector;
+        angular << static_cast<float>(vector.x), static_cast<float>(vector.y),
+          static_cast<float>(vector.z);
+      } else {
+        is_imu_time_stamp_too_late = true;
+      }
+    }
+    slice_mismatches_[slice] = !is_twist_valid || (use_imu && !is_imu_valid);
+
+    const Eigen::Matrix4f transform = this->advance_slice_transform(
+      linear, angular, static_cast<float>(slice_stamp - prev_time_stamp_sec));
+    slice_transforms_[slice] = transform.topRows<3>();
+    prev_time_stamp_sec = slice_stamp;
+  };
+
+  // Slices after the first point are integrated forward, the ones before it (points out of
+  // firing order) backward
+  const size_t first_slice = (first_time_stamp - min_time_stamp) / slice_ns;
+  double prev_time_stamp_sec = first_point_time_stamp_sec;
+  initialize();
+  for (size_t slice = first_slice; slice < num_slices; ++slice) {
+    compute_slice_transform(slice, prev_time_stamp_sec);
+  }
+  prev_time_stamp_sec = first_point_time_stamp_sec;
+  initialize();
+  for (size_t slice = first_slice; slice-- > 0;) {
+    compute_slice_transform(slice, prev_time_stamp_sec);
+  }
+
+  // Points are transformed in place: a PointCloud2 is an array of structures, and gathering the
+  // coordinates of a slice into separate spans costs more than the transform itself. Consecutive
+  // points mostly share a slice, so the slice is only looked up when leaving the current one.
+  const auto undistort_points = [&](size_t first, size_t last, int & mismatch_count) {
+    uint64_t slice_first_ns = 1;
+    uint64_t slice_last_ns = 0;
+    // Local copies, the writes to the point data could otherwise alias them
+    Eigen::Matrix<float, 3, 4> transform;
+    int is_mismatch = 0;
+    int count = 0;
+    for (size_t i = first; i < last; ++i) {
+      uint8_t * point = data + i * point_step;
+      const uint64_t time_stamp = read_field<uint32_t>(point, time_stamp_offset);
+      if (time_stamp < slice_first_ns || time_stamp >= slice_last_ns) {
+        const size_t slice = (time_stamp - min_time_stamp) / slice_ns;
+        slice_first_ns = min_time_stamp + slice * slice_ns;
+        slice_last_ns = slice_first_ns + slice_ns;
+        transform = slice_transforms_[slice];
+        is_mismatch = slice_mismatches_[slice];
+      }
+      count += is_mismatch;
+
+      const Eigen::Vector3f distorted_point(
+        read_field<float>(point, x_offset), read_field<float>(point, y_offset),
+        read_field<float>(point, z_offset));
+      const Eigen::Vector3f undistorted_point =
+        transform.leftCols<3>() * distorted_point + transform.col(3);
+      write_field(point, x_offset, undistorted_point.x());
+      write_field(point, y_offset, undistorted_point.y());
+      write_field(point, z_offset, undistorted_point.z());
+
+      if (angle_conversion_opt.has_value()) {
+        float cartesian_coordinate_azimuth =
+          autoware_utils::opencv_fast_atan2(undistorted_point.y(), undistorted_point.x());
+        float updated_azimuth = angle_conversion_opt->offset_rad +
+                                angle_conversion_opt->sign * cartesian_coordinate_azimuth;
+        if (updated_azimuth < 0) {
+          updated_azimuth += autoware_utils::pi * 2;
+        } else if (updated_azimuth > 2 * autoware_utils::pi) {
+          updated_azimuth -= autoware_utils::pi * 2;
+        }
+        write_field(point, azimuth_offset, updated_azimuth);
+        write_field(point, distance_offset, undistorted_point.norm());
+      }
+    }
+    mismatch_count = count;
+  };
+
+  // The slice transforms are fixed now, so the points can be split evenly between the workers
+  std::vector<int> mismatch_counts(
+    universe_utils::numParallelWorkers(num_points, num_threads_, min_points_per_thread), 0);
+  universe_utils::parallelFor(
+    num_points, num_threads_, min_points_per_thread, [&](size_t first, size_t last, size_t worker) {
+      undistort_points(first, last, mismatch_counts[worker]);
+    });
+
+  for (const int mismatch_count : mismatch_counts) {
+    timestamp_mismatch_count_ += mismatch_count;
+  }
+  timestamp_mismatch_fraction_ = num_points > 0 ? static_cast<float>(timestamp_mismatch_count_) /
+                                                    static_cast<float>(num_points)
+                                                : 0.0f;
+
+  warn_if_timestamp_is_too_late(is_twist_time_stamp_too_late, is_imu_time_stamp_too_late);
+}
+
 ///////////////////////// Functions for different undistortion strategies /////////////////////////
 
 void DistortionCorrector2D::initialize()
@@ -455,6 +690,10 @@ void DistortionCorrector2D::set_pointcloud_transform(
   }
   tf2_lidar_to_base_link_ = convert_matrix_to_transform(eigen_lidar_to_base_link);
   tf2_base_link_to_lidar_ = tf2_lidar_to_base_link_.inverse();
+  if (pointcloud_transform_exists_) {
+    eigen_lidar_to_base_link_ = eigen_lidar_to_base_link;
+    eigen_base_link_to_lidar_ = eigen_lidar_to_base_link.inverse();
+  }
   pointcloud_transform_needed_ = base_frame != lidar_frame && pointcloud_transform_exists_;
 }
 
@@ -574,6 +813,46 @@ inline void DistortionCorrector3D::undistort_point_implementation(
   prev_transformation_matrix_ = transformation_matrix_;
 }
 
+Eigen::Matrix4f DistortionCorrector2D::advance_slice_transform_implementation(
+  const Eigen::Vector3f & linear, const Eigen::Vector3f & angular, const float & time_offset)
+{
+  // One evaluation per slice, so the exact functions are affordable here. The table based
+  // sin_and_cos of the per-point path is quantized to 2 * pi / 131072 rad.
+  theta_ += angular.z() * time_offset;
+  const float sin_theta = std::sin(theta_);
+  const float cos_theta = std::cos(theta_);
+  const float dis = linear.x() * time_offset;
+  x_ += dis * cos_theta;
+  y_ += dis * sin_theta;
+
+  Eigen::Matrix4f baselink_tf_odom = Eigen::Matrix4f::Identity();
+  baselink_tf_odom(0, 0) = cos_theta;
+  baselink_tf_odom(0, 1) = -sin_theta;
+  baselink_tf_odom(1, 0) = sin_theta;
+  baselink_tf_odom(1, 1) = cos_theta;
+  baselink_tf_odom(0, 3) = x_;
+  baselink_tf_odom(1, 3) = y_;
+
+  if (pointcloud_transform_needed_) {
+    return eigen_base_link_to_lidar_ * baselink_tf_odom * eigen_lidar_to_base_link_;
+  }
+  return baselink_tf_odom;
+}
+
+Eigen::Matrix4f DistortionCorrector3D::advance_slice_transform_implementation(
+  const Eigen::Vector3f & linear, const Eigen::Vector3f & angular, const float & time_offset)
+{
+  Sophus::SE3f::Tangent twist;
+  twist << linear, angular;
+  prev_transformation_matrix_ =
+    Sophus::SE3f::exp(twist * time_offset).matrix() * prev_transformation_matrix_;
+
+  if (pointcloud_transform_needed_) {
+    return eigen_base_link_to_lidar_ * prev_transformation_matrix_ * eigen_lidar_to_base_link_;
+  }
+  return prev_transformation_matrix_;
+}
+
 template class DistortionCorrector<DistortionCorrector2D>;
 template class DistortionCorrector<DistortionCorrector3D>;
 
@@ -47,6 +47,8 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
   processing_time_threshold_sec_ = declare_parameter<float>("processing_time_threshold_sec");
   timestamp_mismatch_fraction_threshold_ =
     declare_parameter<float>("timestamp_mismatch_fraction_threshold");
+  const auto time_slice_sec = declare_parameter<double>("time_slice_sec");
+  const auto num_threads = declare_parameter<int>("num_threads");
 
   // Publisher
   {
@@ -80,6 +82,8 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
   } else {
     distortion_corrector_ = std::make_unique<DistortionCorrector2D>(*this);
   }
+  distortion_corrector_->set_batch_config(
+    time_slice_sec, static_cast<size_t>(std::max(0, num_threads)));
 
   // Diagnostic
   diagnostics_interface_ =
@@ -0,0 +1,268 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_centroid_engine.hpp"
+
+#include <autoware/universe_utils/system/parallel_for.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+
+namespace
+{
+// Below this number of points per worker, spawning threads costs more than it saves
+constexpr size_t min_points_per_thread = 16384;
+constexpr int64_t key_bias = static_cast<int64_t>(1) << (VoxelCentroidEngine::key_bits_per_axis - 1);
+constexpr uint64_t key_axis_mask =
+  (static_cast<uint64_t>(1) << VoxelCentroidEngine::key_bits_per_axis) - 1;
+
+inline float read_float(const uint8_t * point, int offset)
+{
+  float value;
+  std::memcpy(&value, point + offset, sizeof(float));
+  return value;
+}
+
+// Pack the voxel index into a key whose ordering is (x, y, z) lexicographic
+inline bool make_key(const Eigen::Array3f & scaled, uint64_t & key)
+{
+  const int64_t ix = static_cast<int64_t>(std::floor(scaled[0])) + key_bias;
+  const int64_t iy = static_cast<int64_t>(std::floor(scaled[1])) + key_bias;
+  const int64_t iz = static_cast<int64_t>(std::floor(scaled[2])) + key_bias;
+  if (
+    (static_cast<uint64_t>(ix) | static_cast<uint64_t>(iy) | static_cast<uint64_t>(iz)) &
+    ~key_axis_mask) {
+    return false;
+  }
+  key = (static_cast<uint64_t>(ix) << (2 * VoxelCentroidEngine::key_bits_per_axis)) |
+        (static_cast<uint64_t>(iy) << VoxelCentroidEngine::key_bits_per_axis) |
+        static_cast<uint64_t>(iz);
+  return true;
+}
+}  // namespace
+
+void VoxelCentroidEngine::VoxelTable::set_capacity(size_t capacity)
+{
+  mask = capacity - 1;
+  shift = 64;
+  while (capacity > 1) {
+    capacity >>= 1;
+    --shift;
+  }
+}
+
+void VoxelCentroidEngine::VoxelTable::reset(size_t expected_voxels)
+{
+  // Keep the load factor at or below 0.5
+  size_t capacity = 64;
+  while (capacity < 2 * expected_voxels) {
+    capacity <<= 1;
+  }
+  if (capacity > slots.size()) {
+    slots.resize(capacity);
+  }
+  set_capacity(slots.size());
+  for (auto & slot : slots) {
+    slot.key = empty_key;
+  }
+  size = 0;
+}
+
+size_t VoxelCentroidEngine::VoxelTable::slot_of(uint64_t key) const
+{
+  // Fibonacci hashing: take the high bits of the product
+  return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> shift);
+}
+
+void VoxelCentroidEngine::VoxelTable::rehash(size_t capacity)
+{
+  std::vector<Voxel> old_slots(capacity, Voxel{empty_key, 0, 0, 0, 0, 0});
+  old_slots.swap(slots);
+  set_capacity(capacity);
+  for (const auto & voxel : old_slots) {
+    if (voxel.key == empty_key) {
+      continue;
+    }
+    size_t slot = slot_of(voxel.key);
+    while (slots[slot].key != empty_key) {
+      slot = (slot + 1) & mask;
+    }
+    slots[slot] = voxel;
+  }
+}
+
+void VoxelCentroidEngine::VoxelTable::add_point(
+  uint64_t key, float x, float y, float z, float intensity)
+{
+  size_t slot = slot_of(key);
+  while (true) {
+    Voxel & voxel = slots[slot];
+    if (voxel.key == key) {
+      voxel.x += x;
+      voxel.y += y;
+      voxel.z += z;
+      voxel.intensity += intensity;
+      voxel.point_count++;
+      return;
+    }
+    if (voxel.key == empty_key) {
+      voxel = Voxel{key, x, y, z, intensity, 1};
+      if (2 * ++size > slots.size()) {
+        rehash(2 * slots.size());
+      }
+      return;
+    }
+    slot = (slot + 1) & mask;
+  }
+}
+
+VoxelCentroidEngine::VoxelCentroidEngine()
+: inverse_voxel_size_(Eigen::Array3f::Ones()), num_threads_(1), last_voxel_count_(0)
+{
+}
+
+void VoxelCentroidEngine::set_voxel_size(float voxel_size_x, float voxel_size_y, float voxel_size_z)
+{
+  inverse_voxel_size_ =
+    Eigen::Array3f::Ones() / Eigen::Array3f(voxel_size_x, voxel_size_y, voxel_size_z);
+}
+
+void VoxelCentroidEngine::set_num_threads(size_t num_threads)
+{
+  num_threads_ = universe_utils::resolveNumThreads(num_threads);
+}
+
+template <typename PointReader>
+bool VoxelCentroidEngine::accumulate_range(
+  size_t begin, size_t end, const PointReader & read_point, VoxelTable & table) const
+{
+  float x;
+  float y;
+  float z;
+  float intensity;
+  for (size_t i = begin; i < end; ++i) {
+    read_point(i, x, y, z, intensity);
+    if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) {
+      continue;
+    }
+    uint64_t key;
+    if (!make_key(Eigen::Array3f(x, y, z) * inverse_voxel_size_, key)) {
+      return false;
+    }
+    table.add_point(key, x, y, z, intensity);
+  }
+  return true;
+}
+
+void VoxelCentroidEngine::merge_tables(size_t num_tables)
+{
+  voxels_.clear();
+  for (size_t t = 0; t < num_tables; ++t) {
+    for (const auto & voxel : tables_[t].slots) {
+      if (voxel.key != VoxelTable::empty_key) {
+        voxels_.push_back(voxel);
+      }
+    }
+  }
+  const auto key_less = [](const Voxel & a, const Voxel & b) { return a.key < b.key; };
+  if (num_tables == 1) {
+    // Keys are unique within a table
+    std::sort(voxels_.begin(), voxels_.end(), key_less);
+    return;
+  }
+
+  // Stable sort keeps the partial sums of a voxel in worker order, so the floating point
+  // summation order is reproducible
+  std::stable_sort(voxels_.begin(), voxels_.end(), key_less);
+  size_t out = 0;
+  for (size_t i = 0; i < voxels_.size(); ++i) {
+    if (out > 0 && voxels_[out - 1].key == voxels_[i].key) {
+      Voxel & voxel = voxels_[out - 1];
+      voxel.x += voxels_[i].x;
+      voxel.y += voxels_[i].y;
+      voxel.z += voxels_[i].z;
+      voxel.intensity += voxels_[i].intensity;
+      voxel.point_count += voxels_[i].point_count;
+    } else {
+      voxels_[out++] = voxels_[i];
+    }
+  }
+  voxels_.resize(out);
+}
+
+template <typename PointReader>
+bool VoxelCentroidEngine::compute_impl(size_t num_points, const PointReader & read_point)
+{
+  const size_t num_workers =
+    universe_utils::numParallelWorkers(num_points, num_threads_, min_points_per_thread);
+  if (tables_.size() < num_workers) {
+    tables_.resize(num_workers);
+  }
+
+  // Most voxels are shared between neighbouring frames, so the previous count is a good guess
+  const size_t expected_voxels = last_voxel_count_ / num_workers + 1;
+  std::atomic<bool> ok{true};
+  universe_utils::parallelFor(
+    num_points, num_threads_, min_points_per_thread, [&](size_t begin, size_t end, size_t worker) {
+      tables_[worker].reset(expected_voxels);
+      if (!accumulate_range(begin, end, read_point, tables_[worker])) {
+        ok = false;
+      }
+    });
+
+  if (!ok) {
+    voxels_.clear();
+    return false;
+  }
+
+  merge_tables(num_workers);
+  last_voxel_count_ = voxels_.size();
+  return true;
+}
+
+bool VoxelCentroidEngine::compute(
+  const uint8_t * data, size_t num_points, const FieldLayout & layout)
+{
+  return compute_impl(
+    num_points, [data, &layout](size_t i, float & x, float & y, float & z, float & intensity) {
+      const uint8_t * point = data + i * layout.point_step;
+      x = read_float(point, layout.x_offset);
+      y = read_float(point, layout.y_offset);
+      z = read_float(point, layout.z_offset);
+      intensity =
+        layout.intensity_offset >= 0 ? static_cast<float>(point[layout.intensity_offset]) : 0.0f;
+    });
+}
+
+bool VoxelCentroidEngine::compute(
+  const float * x, const float * y, const float * z, const uint8_t * intensity,
+  size_t num_points)
+{
+  return compute_impl(
+    num_points,
+    [x, y, z, intensity](size_t i, float & px, float & py, float & pz, float & pintensity) {
+      px = x[i];
+      py = y[i];
+      pz = z[i];
+      pintensity = intensity ? static_cast<float>(intensity[i]) : 0.0f;
+    });
+}
+
+}  // namespace autoware::pointcloud_preprocessor
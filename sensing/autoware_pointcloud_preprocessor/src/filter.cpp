@@ -130,7 +130,7 @@ void autoware::pointcloud_preprocessor::Filter::subscribe(const std::string & fi
   // When all the child classes support the faster version, this workaround is deleted.
   std::set<std::string> supported_nodes = {
     "CropBoxFilter", "RingOutlierFilter", "VoxelGridDownsampleFilter", "ScanGroundFilter",
-    "PointCloudDensifier"};
+    "PointCloudDensifier", "PointCloudFilterChain"};
   auto callback = supported_nodes.find(filter_name) != supported_nodes.end()
                     ? &Filter::faster_input_indices_callback
                     : &Filter::input_indices_callback;
@@ -0,0 +1,333 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/filter_chain/filter_chain_node.hpp"
+
+#include "autoware/pointcloud_preprocessor/diagnostics/latency_diagnostics.hpp"
+#include "autoware/pointcloud_preprocessor/diagnostics/pass_rate_diagnostics.hpp"
+
+#include <autoware/point_types/types.hpp>
+
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+using autoware::point_types::PointXYZIRC;
+
+namespace
+{
+int get_field_offset(const sensor_msgs::msg::PointCloud2 & cloud, const std::string & name)
+{
+  const int index = pcl::getFieldIndex(cloud, name);
+  return index < 0 ? -1 : static_cast<int>(cloud.fields[index].offset);
+}
+}  // namespace
+
+PointCloudFilterChainComponent::PointCloudFilterChainComponent(const rclcpp::NodeOptions & options)
+: Filter("PointCloudFilterChain", options)
+{
+  // initialize debug tool
+  {
+    using autoware_utils::DebugPublisher;
+    using autoware_utils::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, "pointcloud_filter_chain");
+    stop_watch_ptr_->tic("cyclic_time");
+    stop_watch_ptr_->tic("processing_time");
+  }
+
+  // set initial parameters and build the chain in its fixed order
+  {
+    processing_time_threshold_sec_ = declare_parameter<double>("processing_time_threshold_sec");
+
+    if (declare_parameter<bool>("crop_box.enable")) {
+      CropBoxStage::Param p{};
+      p.min_x = static_cast<float>(declare_parameter<double>("crop_box.min_x"));
+      p.min_y = static_cast<float>(declare_parameter<double>("crop_box.min_y"));
+      p.min_z = static_cast<float>(declare_parameter<double>("crop_box.min_z"));
+      p.max_x = static_cast<float>(declare_parameter<double>("crop_box.max_x"));
+      p.max_y = static_cast<float>(declare_parameter<double>("crop_box.max_y"));
+      p.max_z = static_cast<float>(declare_parameter<double>("crop_box.max_z"));
+      p.negative = declare_parameter<bool>("crop_box.negative");
+      auto stage = std::make_unique<CropBoxStage>(p);
+      crop_box_stage_ = stage.get();
+      stages_.push_back(std::move(stage));
+    }
+
+    if (declare_parameter<bool>("distortion_corrector.enable")) {
+      base_frame_ = declare_parameter<std::string>("distortion_corrector.base_frame");
+      use_imu_ = declare_parameter<bool>("distortion_corrector.use_imu");
+      const bool use_3d =
+        declare_parameter<bool>("distortion_corrector.use_3d_distortion_correction");
+      auto stage = std::make_unique<UndistortStage>(use_3d);
+      undistort_stage_ = stage.get();
+      stages_.push_back(std::move(stage));
+
+      // Same queue size rationale as DistortionCorrectorComponent
+      const uint16_t TWIST_QUEUE_SIZE = 100;
+      twist_sub_ = autoware_utils::InterProcessPollingSubscriber<
+        geometry_msgs::msg::TwistWithCovarianceStamped, autoware_utils::polling_policy::All>::
+        create_subscription(this, "~/input/twist", rclcpp::QoS(TWIST_QUEUE_SIZE));
+      imu_sub_ = autoware_utils::InterProcessPollingSubscriber<
+        sensor_msgs::msg::Imu, autoware_utils::polling_policy::All>::
+        create_subscription(this, "~/input/imu", rclcpp::QoS(TWIST_QUEUE_SIZE));
+      motion_queue_ = std::make_unique<DistortionCorrector2D>(*this);
+    }
+
+    if (declare_parameter<bool>("ring_outlier_filter.enable")) {
+      RingOutlierStage::Param p{};
+      p.distance_ratio = declare_parameter<double>("ring_outlier_filter.distance_ratio");
+      p.object_length_threshold =
+        declare_parameter<double>("ring_outlier_filter.object_length_threshold");
+      p.max_rings_num =
+        static_cast<uint16_t>(declare_parameter<int64_t>("ring_outlier_filter.max_rings_num"));
+      stages_.push_back(std::make_unique<RingOutlierStage>(p));
+    }
+
+    if (declare_parameter<bool>("voxel_grid_downsample_filter.enable")) {
+      const auto voxel_size_x =
+        static_cast<float>(declare_parameter<double>("voxel_grid_downsample_filter.voxel_size_x"));
+      const auto voxel_size_y =
+        static_cast<float>(declare_parameter<double>("voxel_grid_downsample_filter.voxel_size_y"));
+      const auto voxel_size_z =
+        static_cast<float>(declare_parameter<double>("voxel_grid_downsample_filter.voxel_size_z"));
+      const auto num_threads =
+        static_cast<size_t>(declare_parameter<int>("voxel_grid_downsample_filter.num_threads"));
+      stages_.push_back(std::make_unique<VoxelDownsampleStage>(
+        voxel_size_x, voxel_size_y, voxel_size_z, num_threads));
+    }
+  }
+
+  // Diagnostic
+  diagnostics_interface_ =
+    std::make_unique<autoware_utils::DiagnosticsInterface>(this, this->get_fully_qualified_name());
+}
+
+// TODO(sykwer): Temporary Implementation: Delete this function definition when all the filter nodes
+// conform to new API.
+void PointCloudFilterChainComponent::filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output)
+{
+  (void)input;
+  (void)indices;
+  (void)output;
+}
+
+void PointCloudFilterChainComponent::update_undistort_stage(const PointCloud2 & input)
+{
+  for (const auto & msg : twist_sub_->take_data()) {
+    motion_queue_->process_twist_message(msg);
+  }
+  if (use_imu_) {
+    for (const auto & msg : imu_sub_->take_data()) {
+      motion_queue_->process_imu_message(base_frame_, msg);
+    }
+  }
+
+  std::vector<UndistortStage::TwistSample> twists;
+  for (const auto & twist : motion_queue_->get_twist_queue()) {
+    const auto & l = twist.twist.linear;
+    const auto & a = twist.twist.angular;
+    twists.push_back(
+      {rclcpp::Time(twist.header.stamp).seconds(),
+       Eigen::Vector3f(static_cast<float>(l.x), static_cast<float>(l.y), static_cast<float>(l.z)),
+       Eigen::Vector3f(static_cast<float>(a.x), static_cast<float>(a.y), static_cast<float>(a.z))});
+  }
+  std::vector<UndistortStage::AngularVelocitySample> angular_velocities;
+  if (use_imu_) {
+    for (const auto & angular_velocity : motion_queue_->get_angular_velocity_queue()) {
+      const auto & v = angular_velocity.vector;
+      angular_velocities.push_back(
+        {rclcpp::Time(angular_velocity.header.stamp).seconds(),
+         Eigen::Vector3f(
+           static_cast<float>(v.x), static_cast<float>(v.y), static_cast<float>(v.z))});
+    }
+  }
+
+  if (twists.empty()) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      get_logger(), *get_clock(), 10000 /* ms */,
+      "Twist queue is empty. The pointcloud is not undistorted.");
+  }
+
+  // The points are compensated to the first point of the sensor cloud, as DistortionCorrector does
+  const double cloud_stamp = rclcpp::Time(input.header.stamp).seconds();
+  const double reference_stamp =
+    points_.empty() ? cloud_stamp : cloud_stamp + 1e-9 * points_.time_stamp.front();
+  undistort_stage_->set_frame(
+    cloud_stamp, reference_stamp, std::move(twists), std::move(angular_velocities));
+
+  std::optional<Eigen::Matrix4f> sensor_to_base_link;
+  if (input.header.frame_id != base_frame_) {
+    sensor_to_base_link = managed_tf_buffer_->getTransform<Eigen::Matrix4f>(
+      base_frame_, input.header.frame_id, input.header.stamp, rclcpp::Duration::from_seconds(1.0),
+      get_logger());
+    if (!sensor_to_base_link) {
+      RCLCPP_WARN_STREAM_THROTTLE(
+        get_logger(), *get_clock(), 10000 /* ms */,
+        "Failed to get the transform from " << input.header.frame_id << " to " << base_frame_
+                                            << ". The pointcloud is undistorted in its own frame.");
+    }
+  }
+  undistort_stage_->set_transform(sensor_to_base_link);
+}
+
+// TODO(sykwer): Temporary Implementation: Rename this function to `filter()` when all the filter
+// nodes conform to new API. Then delete the old `filter()` defined above.
+void PointCloudFilterChainComponent::faster_filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+  const TransformInfo & transform_info)
+{
+  std::scoped_lock lock(mutex_);
+  stop_watch_ptr_->toc("processing_time", true);
+
+  if (indices) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "Indices are not supported and will be ignored");
+  }
+
+  PointFieldLayout layout;
+  layout.point_step = input->point_step;
+  layout.x_offset = get_field_offset(*input, "x");
+  layout.y_offset = get_field_offset(*input, "y");
+  layout.z_offset = get_field_offset(*input, "z");
+  layout.intensity_offset = get_field_offset(*input, "intensity");
+  layout.return_type_offset = get_field_offset(*input, "return_type");
+  layout.channel_offset = get_field_offset(*input, "channel");
+  layout.azimuth_offset = get_field_offset(*input, "azimuth");
+  layout.distance_offset = get_field_offset(*input, "distance");
+  layout.time_stamp_offset = get_field_offset(*input, "time_stamp");
+  if (layout.x_offset < 0 || layout.y_offset < 0 || layout.z_offset < 0) {
+    RCLCPP_ERROR_THROTTLE(
+      get_logger(), *get_clock(), 1000, "The input pointcloud does not have x, y and z fields");
+    return;
+  }
+
+  const size_t input_size = input->width * input->height;
+  points_.load(input->data.data(), input_size, layout);
+
+  // The stages work in the sensor frame, the crop box is evaluated in tf_input_frame_
+  if (crop_box_stage_) {
+    crop_box_stage_->set_transform(
+      transform_info.need_transform ? std::make_optional(transform_info.eigen_transform)
+                                    : std::nullopt);
+  }
+  if (undistort_stage_) {
+    update_undistort_stage(*input);
+  }
+
+  std::vector<std::pair<std::string, double>> stage_processing_times_ms;
+  stage_processing_times_ms.reserve(stages_.size());
+  for (const auto & stage : stages_) {
+    stop_watch_ptr_->tic("stage");
+    stage->apply(points_);
+    stage_processing_times_ms.emplace_back(stage->name(), stop_watch_ptr_->toc("stage", true));
+  }
+
+  if (crop_box_stage_ && crop_box_stage_->skipped_nan_count() > 0) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "%d points contained NaN values and have been ignored",
+      crop_box_stage_->skipped_nan_count());
+  }
+
+  // Serialize once, directly in the frame the downstream nodes expect
+  output.data.resize(points_.size() * PointSoABuffer::xyzirc_point_step);
+  points_.store_xyzirc(
+    output.data.data(), transform_info.need_transform ? &transform_info.eigen_transform : nullptr);
+
+  // Set the fields of the output cloud. Converting an empty cloud into `output` itself would clear
+  // the data stored above, so only the fields are taken from it.
+  sensor_msgs::msg::PointCloud2 msg_aux;
+  pcl::toROSMsg(pcl::PointCloud<PointXYZIRC>(), msg_aux);
+  output.fields = msg_aux.fields;
+  output.header.frame_id = transform_info.need_transform ? tf_input_frame_ : input->header.frame_id;
+  output.height = 1;
+  output.width = static_cast<uint32_t>(points_.size());
+  output.is_bigendian = input->is_bigendian;
+  output.point_step = PointSoABuffer::xyzirc_point_step;
+  output.row_step = static_cast<uint32_t>(output.data.size());
+  output.is_dense = true;
+
+  const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+  const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+  const double pipeline_latency_ms =
+    std::chrono::duration<double, std::milli>(
+      std::chrono::nanoseconds((this->get_clock()->now() - input->header.stamp).nanoseconds()))
+      .count();
+
+  // Debug output
+  if (debug_publisher_) {
+    debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+    debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+      "debug/pipeline_latency_ms", pipeline_latency_ms);
+    for (const auto & [name, time_ms] : stage_processing_times_ms) {
+      debug_publisher_->publish<autoware_internal_debug_msgs::msg::Float64Stamped>(
+        "debug/" + name + "/processing_time_ms", time_ms);
+    }
+  }
+
+  auto latency_diagnostics = std::make_shared<LatencyDiagnostics>(
+    input->header.stamp, processing_time_ms, pipeline_latency_ms,
+    processing_time_threshold_sec_ * 1000.0);
+  for (const auto & [name, time_ms] : stage_processing_times_ms) {
+    latency_diagnostics->add_stage_processing_time(name, time_ms);
+  }
+  auto pass_rate_diagnostics = std::make_shared<PassRateDiagnostics>(
+    static_cast<int>(input_size), static_cast<int>(output.width * output.height));
+
+  publish_diagnostics({latency_diagnostics, pass_rate_diagnostics});
+}
+
+void PointCloudFilterChainComponent::publish_diagnostics(
+  const std::vector<std::shared_ptr<const DiagnosticsBase>> & diagnostics)
+{
+  diagnostics_interface_->clear();
+
+  std::string message;
+  int worst_level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+
+  for (const auto & diag : diagnostics) {
+    diag->add_to_interface(*diagnostics_interface_);
+    if (const auto status = diag->evaluate_status(); status.has_value()) {
+      worst_level = std::max(worst_level, status->first);
+      if (!message.empty()) {
+        message += " / ";
+      }
+      message += status->second;
+    }
+  }
+
+  if (message.empty()) {
+    message = "PointCloudFilterChain operating normally";
+  }
+
+  diagnostics_interface_->update_level_and_message(static_cast<int8_t>(worst_level), message);
+  diagnostics_interface_->publish(this->get_clock()->now());
+}
+
+}  // namespace autoware::pointcloud_preprocessor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(autoware::pointcloud_preprocessor::PointCloudFilterChainComponent)
@@ -0,0 +1,291 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/filter_chain/filter_stages.hpp"
+
+#include <Eigen/Geometry>
+#include <sophus/se3.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+
+void CropBoxStage::set_transform(const std::optional<Eigen::Matrix4f> & sensor_to_box)
+{
+  sensor_to_box_ = sensor_to_box;
+}
+
+void CropBoxStage::apply(PointSoABuffer & points)
+{
+  const size_t num_points = points.size();
+  keep_.resize(num_points);
+  skipped_nan_count_ = 0;
+
+  const Eigen::Matrix3f rotation =
+    sensor_to_box_ ? Eigen::Matrix3f(sensor_to_box_->topLeftCorner<3, 3>())
+                   : Eigen::Matrix3f::Identity();
+  const Eigen::Vector3f translation =
+    sensor_to_box_ ? Eigen::Vector3f(sensor_to_box_->topRightCorner<3, 1>())
+                   : Eigen::Vector3f::Zero();
+
+  for (size_t i = 0; i < num_points; ++i) {
+    if (!std::isfinite(points.x[i]) || !std::isfinite(points.y[i]) || !std::isfinite(points.z[i])) {
+      skipped_nan_count_++;
+      keep_[i] = 0;
+      continue;
+    }
+    const Eigen::Vector3f p =
+      rotation * Eigen::Vector3f(points.x[i], points.y[i], points.z[i]) + translation;
+    const bool point_is_inside = p.z() > param_.min_z && p.z() < param_.max_z &&
+                                 p.y() > param_.min_y && p.y() < param_.max_y &&
+                                 p.x() > param_.min_x && p.x() < param_.max_x;
+    keep_[i] = point_is_inside != param_.negative;
+  }
+  points.compact(keep_);
+}
+
+void UndistortStage::set_frame(
+  double cloud_stamp, double reference_stamp, std::vector<TwistSample> twists,
+  std::vector<AngularVelocitySample> angular_velocities)
+{
+  cloud_stamp_ = cloud_stamp;
+  reference_stamp_ = reference_stamp;
+  twists_ = std::move(twists);
+  angular_velocities_ = std::move(angular_velocities);
+}
+
+void UndistortStage::set_transform(const std::optional<Eigen::Matrix4f> & sensor_to_base_link)
+{
+  sensor_to_base_link_ = sensor_to_base_link;
+  base_link_to_sensor_ =
+    sensor_to_base_link ? Eigen::Matrix4f(sensor_to_base_link->inverse())
+                        : Eigen::Matrix4f::Identity();
+}
+
+void UndistortStage::apply(PointSoABuffer & points)
+{
+  timestamp_mismatch_count_ = 0;
+  if (points.empty() || twists_.empty()) {
+    return;
+  }
+
+  // The association between points and motion samples follows DistortionCorrector<T>
+  constexpr double time_diff = 0.1;
+  const auto first_not_before = [](const auto & samples, double stamp) {
+    auto it = std::lower_bound(
+      samples.begin(), samples.end(), stamp,
+      [](const auto & sample, double t) { return sample.stamp < t; });
+    return it == samples.end() ? samples.size() - 1
+                               : static_cast<size_t>(std::distance(samples.begin(), it));
+  };
+
+  const bool use_imu = !angular_velocities_.empty();
+  double prev_stamp = reference_stamp_;
+  size_t twist_idx = first_not_before(twists_, prev_stamp);
+  size_t imu_idx = use_imu ? first_not_before(angular_velocities_, prev_stamp) : 0;
+
+  // 2D state
+  float theta = 0.0f;
+  float x = 0.0f;
+  float y = 0.0f;
+  // 3D state
+  Eigen::Matrix4f transformation = Eigen::Matrix4f::Identity();
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    const double stamp = cloud_stamp_ + 1e-9 * points.time_stamp[i];
+
+    while (twist_idx + 1 < twists_.size() && stamp > twists_[twist_idx].stamp) {
+      ++twist_idx;
+    }
+    const bool is_twist_valid = std::abs(stamp - twists_[twist_idx].stamp) <= time_diff;
+
+    bool is_imu_valid = false;
+    if (use_imu) {
+      while (imu_idx + 1 < angular_velocities_.size() &&
+             stamp > angular_velocities_[imu_idx].stamp) {
+        ++imu_idx;
+      }
+      is_imu_valid = std::abs(stamp - angular_velocities_[imu_idx].stamp) <= time_diff;
+    }
+    if (!is_twist_valid || (use_imu && !is_imu_valid)) {
+      ++timestamp_mismatch_count_;
+    }
+
+    Eigen::Vector3f v = Eigen::Vector3f::Zero();
+    Eigen::Vector3f w = Eigen::Vector3f::Zero();
+    if (is_twist_valid) {
+      v = twists_[twist_idx].linear;
+      w = twists_[twist_idx].angular;
+    }
+    if (is_imu_valid) {
+      w = angular_velocities_[imu_idx].angular;
+    }
+
+    const auto time_offset = static_cast<float>(stamp - prev_stamp);
+    prev_stamp = stamp;
+
+    Eigen::Vector4f point(points.x[i], points.y[i], points.z[i], 1.0f);
+    if (sensor_to_base_link_) {
+      point = *sensor_to_base_link_ * point;
+    }
+
+    Eigen::Vector4f undistorted;
+    if (use_3d_) {
+      Sophus::SE3f::Tangent twist;
+      twist << v, w;
+      transformation = Sophus::SE3f::exp(twist * time_offset).matrix() * transformation;
+      undistorted = transformation * point;
+    } else {
+      theta += w.z() * time_offset;
+      const float dis = v.x() * time_offset;
+      x += dis * std::cos(theta);
+      y += dis * std::sin(theta);
+      const Eigen::Vector3f p =
+        Eigen::AngleAxisf(theta, Eigen::Vector3f::UnitZ()) * point.head<3>() +
+        Eigen::Vector3f(x, y, 0.0f);
+      undistorted << p, 1.0f;
+    }
+
+    if (sensor_to_base_link_) {
+      undistorted = base_link_to_sensor_ * undistorted;
+    }
+    points.x[i] = undistorted[0];
+    points.y[i] = undistorted[1];
+    points.z[i] = undistorted[2];
+  }
+}
+
+void RingOutlierStage::apply(PointSoABuffer & points)
+{
+  const size_t num_points = points.size();
+  const size_t num_rings = param_.max_rings_num;
+  keep_.assign(num_points, 0);
+
+  // Counting sort of the point indices by ring, keeping the firing order within a ring
+  ring_begin_.assign(num_rings + 1, 0);
+  for (size_t i = 0; i < num_points; ++i) {
+    if (points.channel[i] < num_rings) {
+      ring_begin_[points.channel[i] + 1]++;
+    } else {
+      // Points outside of the configured rings are not evaluated
+      keep_[i] = 1;
+    }
+  }
+  for (size_t ring = 0; ring < num_rings; ++ring) {
+    ring_begin_[ring + 1] += ring_begin_[ring];
+  }
+  ring_order_.resize(ring_begin_[num_rings]);
+  {
+    std::vector<size_t> & cursor = ring_begin_;
+    for (size_t i = 0; i < num_points; ++i) {
+      if (points.channel[i] < num_rings) {
+        ring_order_[cursor[points.channel[i]]++] = i;
+      }
+    }
+    // The cursors now point to the end of each ring, shift them back to the beginning
+    for (size_t ring = num_rings; ring > 0; --ring) {
+      cursor[ring] = cursor[ring - 1];
+    }
+    cursor[0] = 0;
+  }
+
+  const double length_threshold_sq =
+    param_.object_length_threshold * param_.object_length_threshold;
+  const auto is_cluster = [&](size_t first, size_t last) {
+    const float dx = points.x[first] - points.x[last];
+    const float dy = points.y[first] - points.y[last];
+    const float dz = points.z[first] - points.z[last];
+    return dx * dx + dy * dy + dz * dz >= length_threshold_sq;
+  };
+  const auto keep_walk = [&](const size_t * indices, size_t first, size_t last) {
+    if (is_cluster(indices[first], indices[last])) {
+      for (size_t k = first; k <= last; ++k) {
+        keep_[indices[k]] = 1;
+      }
+    }
+  };
+
+  for (size_t ring = 0; ring < num_rings; ++ring) {
+    const size_t * indices = ring_order_.data() + ring_begin_[ring];
+    const size_t ring_size = ring_begin_[ring + 1] - ring_begin_[ring];
+    if (ring_size < 2) continue;
+
+    // walk range: [walk_first_idx, walk_last_idx]
+    size_t walk_first_idx = 0;
+    size_t walk_last_idx = 0;
+    for (size_t idx = 0; idx < ring_size - 1; ++idx) {
+      const size_t current = indices[idx];
+      const size_t next = indices[idx + 1];
+      walk_last_idx = idx;
+
+      float azimuth_diff = points.azimuth[next] - points.azimuth[current];
+      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 2 * M_PI : azimuth_diff;
+
+      const float current_distance = points.distance[current];
+      const float next_distance = points.distance[next];
+      if (
+        std::max(current_distance, next_distance) <
+          std::min(current_distance, next_distance) * param_.distance_ratio &&
+        azimuth_diff < 1.0 * (180.0 / M_PI)) {
+        continue;  // Determined to be included in the same walk
+      }
+
+      keep_walk(indices, walk_first_idx, walk_last_idx);
+      walk_first_idx = idx + 1;
+    }
+
+    if (walk_first_idx > walk_last_idx) continue;
+    keep_walk(indices, walk_first_idx, walk_last_idx);
+  }
+
+  points.compact(keep_);
+}
+
+VoxelDownsampleStage::VoxelDownsampleStage(
+  float voxel_size_x, float voxel_size_y, float voxel_size_z, size_t num_threads)
+{
+  engine_.set_voxel_size(voxel_size_x, voxel_size_y, voxel_size_z);
+  engine_.set_num_threads(num_threads);
+}
+
+void VoxelDownsampleStage::apply(PointSoABuffer & points)
+{
+  if (!engine_.compute(
+        points.x.data(), points.y.data(), points.z.data(), points.intensity.data(),
+        points.size())) {
+    // Voxel indices would overflow, leave the cloud as it is
+    return;
+  }
+
+  const auto & voxels = engine_.voxels();
+  points.resize(voxels.size());
+  for (size_t i = 0; i < voxels.size(); ++i) {
+    const Eigen::Vector4f centroid = voxels[i].calc_centroid();
+    points.x[i] = centroid[0];
+    points.y[i] = centroid[1];
+    points.z[i] = centroid[2];
+    points.intensity[i] = static_cast<uint8_t>(centroid[3]);
+    points.return_type[i] = 0;
+    points.channel[i] = 0;
+    points.azimuth[i] = 0.0f;
+    points.distance[i] = 0.0f;
+    points.time_stamp[i] = 0;
+  }
+}
+
+}  // namespace autoware::pointcloud_preprocessor
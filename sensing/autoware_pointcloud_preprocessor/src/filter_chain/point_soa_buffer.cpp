@@ -0,0 +1,115 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/filter_chain/point_soa_buffer.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace autoware::pointcloud_preprocessor
+{
+
+namespace
+{
+template <typename T>
+inline T read_field(const uint8_t * point, int offset)
+{
+  T value;
+  std::memcpy(&value, point + offset, sizeof(T));
+  return value;
+}
+
+template <typename T>
+inline void write_field(uint8_t * point, size_t offset, const T & value)
+{
+  std::memcpy(point + offset, &value, sizeof(T));
+}
+}  // namespace
+
+void PointSoABuffer::resize(size_t num_points)
+{
+  x.resize(num_points);
+  y.resize(num_points);
+  z.resize(num_points);
+  intensity.resize(num_points);
+  return_type.resize(num_points);
+  channel.resize(num_points);
+  azimuth.resize(num_points);
+  distance.resize(num_points);
+  time_stamp.resize(num_points);
+}
+
+void PointSoABuffer::load(const uint8_t * data, size_t num_points, const PointFieldLayout & layout)
+{
+  resize(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    const uint8_t * point = data + i * layout.point_step;
+    x[i] = read_field<float>(point, layout.x_offset);
+    y[i] = read_field<float>(point, layout.y_offset);
+    z[i] = read_field<float>(point, layout.z_offset);
+    intensity[i] = layout.intensity_offset >= 0 ? point[layout.intensity_offset] : 0;
+    return_type[i] = layout.return_type_offset >= 0 ? point[layout.return_type_offset] : 0;
+    channel[i] =
+      layout.channel_offset >= 0 ? read_field<uint16_t>(point, layout.channel_offset) : 0;
+    azimuth[i] = layout.azimuth_offset >= 0 ? read_field<float>(point, layout.azimuth_offset) : 0;
+    distance[i] =
+      layout.distance_offset >= 0 ? read_field<float>(point, layout.distance_offset) : 0;
+    time_stamp[i] =
+      layout.time_stamp_offset >= 0 ? read_field<uint32_t>(point, layout.time_stamp_offset) : 0;
+  }
+}
+
+void PointSoABuffer::compact(const std::vector<uint8_t> & keep)
+{
+  size_t out = 0;
+  const size_t num_points = size();
+  for (size_t i = 0; i < num_points; ++i) {
+    if (!keep[i]) {
+      continue;
+    }
+    if (out != i) {
+      x[out] = x[i];
+      y[out] = y[i];
+      z[out] = z[i];
+      intensity[out] = intensity[i];
+      return_type[out] = return_type[i];
+      channel[out] = channel[i];
+      azimuth[out] = azimuth[i];
+      distance[out] = distance[i];
+      time_stamp[out] = time_stamp[i];
+    }
+    ++out;
+  }
+  resize(out);
+}
+
+void PointSoABuffer::store_xyzirc(uint8_t * output, const Eigen::Matrix4f * transform) const
+{
+  const size_t num_points = size();
+  for (size_t i = 0; i < num_points; ++i) {
+    Eigen::Vector3f p(x[i], y[i], z[i]);
+    if (transform) {
+      p = transform->topLeftCorner<3, 3>() * p + transform->topRightCorner<3, 1>();
+    }
+    uint8_t * point = output + i * xyzirc_point_step;
+    write_field(point, 0, p.x());
+    write_field(point, 4, p.y());
+    write_field(point, 8, p.z());
+    write_field(point, 12, intensity[i]);
+    write_field(point, 13, return_type[i]);
+    write_field(point, 14, channel[i]);
+  }
+}
+
+}  // namespace autoware::pointcloud_preprocessor
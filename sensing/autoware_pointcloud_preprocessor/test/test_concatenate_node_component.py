@@ -99,6 +99,7 @@ def generate_test_description():
                     "input_twist_topic_type": "twist",
                     "input_topics": INPUT_LIDAR_TOPICS,
                     "output_frame": "base_link",
+                    "num_threads": 1,
                     "matching_strategy.type": "advanced",
                     "matching_strategy.lidar_timestamp_offsets": TIMESTAMP_OFFSET,
                     "matching_strategy.lidar_timestamp_noise_window": [
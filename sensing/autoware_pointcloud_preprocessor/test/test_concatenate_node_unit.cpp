@@ -63,6 +63,7 @@ protected:
        {"input_twist_topic_type", "twist"},
        {"input_topics", input_topics},
        {"output_frame", "base_link"},
+       {"num_threads", 1},
        {"matching_strategy.type", "advanced"},
        {"matching_strategy.lidar_timestamp_offsets", std::vector<double>{0.0, 0.04, 0.08}},
        {"matching_strategy.lidar_timestamp_noise_window", std::vector<double>{0.01, 0.01, 0.01}}});
@@ -480,6 +481,70 @@ TEST_F(ConcatenateCloudTest, TestConcatenateClouds)
   EXPECT_FLOAT_EQ(right_timestamp.seconds(), topic_to_original_stamp_map["lidar_right"]);
 }
 
+TEST_F(ConcatenateCloudTest, TestConcatenateCloudsInSensorFrames)
+{
+  rclcpp::Time top_timestamp(timestamp_seconds, timestamp_nanoseconds, RCL_ROS_TIME);
+  rclcpp::Time left_timestamp(timestamp_seconds, timestamp_nanoseconds + 40'000'000, RCL_ROS_TIME);
+  std::unordered_map<std::string, sensor_msgs::msg::PointCloud2::ConstSharedPtr> topic_to_cloud_map;
+  topic_to_cloud_map["lidar_top"] = std::make_shared<sensor_msgs::msg::PointCloud2>(
+    generate_pointcloud_msg(true, true, "lidar_top", top_timestamp));
+  topic_to_cloud_map["lidar_left"] = std::make_shared<sensor_msgs::msg::PointCloud2>(
+    generate_pointcloud_msg(true, true, "lidar_left", left_timestamp));
+
+  const std::array<Eigen::Vector3f, number_of_points> points = {
+    {Eigen::Vector3f(10.0f, 0.0f, 0.0f), Eigen::Vector3f(0.0f, 10.0f, 0.0f),
+     Eigen::Vector3f(0.0f, 0.0f, 10.0f)}};
+  // The slices follow the order of the input topics
+  std::vector<Eigen::Affine3f> sensor_to_base_transforms;
+  for (const auto & tf_msg : generate_static_transform_msgs()) {
+    const auto & t = tf_msg.transform;
+    sensor_to_base_transforms.push_back(
+      Eigen::Translation3f(t.translation.x, t.translation.y, t.translation.z) *
+      Eigen::Quaternionf(t.rotation.w, t.rotation.x, t.rotation.y, t.rotation.z).normalized());
+  }
+
+  // The second cycle reuses the output buffers of the first one
+  for (int cycle = 0; cycle < 2; ++cycle) {
+    auto
+      [concatenate_cloud_ptr, concatenation_info_ptr, topic_to_transformed_cloud_map,
+       topic_to_original_stamp_map] = collector_->concatenate_pointclouds(topic_to_cloud_map);
+
+    EXPECT_EQ(topic_to_original_stamp_map.size(), 2u);
+    ASSERT_EQ(concatenate_cloud_ptr->width, 2 * number_of_points);
+    EXPECT_EQ(concatenate_cloud_ptr->header.frame_id, "base_link");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_x(*concatenate_cloud_ptr, "x");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_y(*concatenate_cloud_ptr, "y");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_z(*concatenate_cloud_ptr, "z");
+    for (size_t i = 0; i < 2 * number_of_points; ++i, ++iter_x, ++iter_y, ++iter_z) {
+      const Eigen::Vector3f expected =
+        sensor_to_base_transforms[i / number_of_points] * points[i % number_of_points];
+      EXPECT_NEAR(*iter_x, expected.x(), standard_tolerance);
+      EXPECT_NEAR(*iter_y, expected.y(), standard_tolerance);
+      EXPECT_NEAR(*iter_z, expected.z(), standard_tolerance);
+    }
+    EXPECT_EQ(concatenation_info_ptr->source_info[0].idx_begin, 0u);
+    EXPECT_EQ(concatenation_info_ptr->source_info[1].idx_begin, number_of_points);
+    EXPECT_EQ(concatenation_info_ptr->source_info[2].length, 0u);
+
+    // The synchronized clouds are kept in their sensor frame
+    for (const auto & topic : {"lidar_top", "lidar_left"}) {
+      const auto & cloud = *topic_to_transformed_cloud_map.value().at(topic);
+      EXPECT_EQ(cloud.header.frame_id, topic);
+      EXPECT_FLOAT_EQ(rclcpp::Time(cloud.header.stamp).seconds(), top_timestamp.seconds());
+      ASSERT_EQ(cloud.width, number_of_points);
+      sensor_msgs::PointCloud2ConstIterator<float> sync_x(cloud, "x");
+      sensor_msgs::PointCloud2ConstIterator<float> sync_y(cloud, "y");
+      sensor_msgs::PointCloud2ConstIterator<float> sync_z(cloud, "z");
+      for (size_t i = 0; i < number_of_points; ++i, ++sync_x, ++sync_y, ++sync_z) {
+        EXPECT_NEAR(*sync_x, points[i].x(), standard_tolerance);
+        EXPECT_NEAR(*sync_y, points[i].y(), standard_tolerance);
+        EXPECT_NEAR(*sync_z, points[i].z(), standard_tolerance);
+      }
+    }
+    combine_cloud_handler_->allocate_pointclouds();
+  }
+}
+
 TEST_F(ConcatenateCloudTest, TestProcessSingleCloud)
 {
   concatenate_node_->add_cloud_collector(collector_);
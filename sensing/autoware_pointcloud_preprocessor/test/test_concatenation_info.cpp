@@ -551,3 +551,62 @@ TEST_F(ConcatenationInfoTest, TwoIterationsOfSettingCloudInfo)
     concatenated_point_cloud_info_msg_2.source_info[1].length,
     test_cloud_2_.width * test_cloud_2_.height);
 }
+
+TEST_F(ConcatenationInfoTest, ApplySourceWithHeaderAndLength)
+{
+  ConcatenationInfoManager manager(strategy_name_, input_topics_);
+  auto concatenated_point_cloud_info_msg = manager.reset_and_get_base_info();
+
+  manager.update_source_from_header_and_length(
+    test_header_, 100, "/topic1", autoware_sensing_msgs::msg::SourcePointCloudInfo::STATUS_OK,
+    concatenated_point_cloud_info_msg);
+  manager.update_source_from_header_and_length(
+    test_header_, 150, "/topic2", autoware_sensing_msgs::msg::SourcePointCloudInfo::STATUS_OK,
+    concatenated_point_cloud_info_msg);
+
+  EXPECT_EQ(concatenated_point_cloud_info_msg.source_info[0].header.frame_id, "base_link");
+  EXPECT_EQ(concatenated_point_cloud_info_msg.source_info[0].idx_begin, 0u);
+  EXPECT_EQ(concatenated_point_cloud_info_msg.source_info[0].length, 100u);
+  EXPECT_EQ(concatenated_point_cloud_info_msg.source_info[1].idx_begin, 100u);
+  EXPECT_EQ(concatenated_point_cloud_info_msg.source_info[1].length, 150u);
+}
+
+TEST_F(ConcatenationInfoTest, ConcatenationLatencyPercentilesWithoutSamples)
+{
+  ConcatenationInfoManager manager(strategy_name_, input_topics_);
+  const auto percentiles = manager.get_concatenation_latency_percentiles();
+  EXPECT_EQ(percentiles.num_samples, 0u);
+  EXPECT_DOUBLE_EQ(percentiles.p50_ms, 0.0);
+  EXPECT_DOUBLE_EQ(percentiles.p99_ms, 0.0);
+  EXPECT_DOUBLE_EQ(percentiles.max_ms, 0.0);
+}
+
+TEST_F(ConcatenationInfoTest, ConcatenationLatencyPercentiles)
+{
+  ConcatenationInfoManager manager(strategy_name_, input_topics_);
+  // Recorded in a shuffled order, the percentiles must not depend on it
+  for (int i = 0; i < 100; ++i) {
+    manager.record_concatenation_latency(static_cast<double>((i * 37) % 100 + 1));
+  }
+  const auto percentiles = manager.get_concatenation_latency_percentiles();
+  EXPECT_EQ(percentiles.num_samples, 100u);
+  EXPECT_DOUBLE_EQ(percentiles.p50_ms, 50.0);
+  EXPECT_DOUBLE_EQ(percentiles.p90_ms, 90.0);
+  EXPECT_DOUBLE_EQ(percentiles.p99_ms, 99.0);
+  EXPECT_DOUBLE_EQ(percentiles.max_ms, 100.0);
+}
+
+TEST_F(ConcatenationInfoTest, ConcatenationLatencyPercentilesKeepLatestSamples)
+{
+  ConcatenationInfoManager manager(strategy_name_, input_topics_);
+  for (std::size_t i = 0; i < ConcatenationInfoManager::latency_window_size; ++i) {
+    manager.record_concatenation_latency(1000.0);
+  }
+  // Overwrites all the older latencies
+  for (std::size_t i = 0; i < ConcatenationInfoManager::latency_window_size; ++i) {
+    manager.record_concatenation_latency(1.0);
+  }
+  const auto percentiles = manager.get_concatenation_latency_percentiles();
+  EXPECT_EQ(percentiles.num_samples, ConcatenationInfoManager::latency_window_size);
+  EXPECT_DOUBLE_EQ(percentiles.max_ms, 1.0);
+}
@@ -40,6 +40,7 @@
 #include <gtest/gtest.h>
 #include <tf2_ros/static_transform_broadcaster.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <string>
@@ -294,6 +295,68 @@ protected:
     return timestamps;
   }
 
+  // Points on a circle, one every dense_points_interval_ns, instead of the ten default points
+  sensor_msgs::msg::PointCloud2 generate_dense_pointcloud_msg(
+    bool is_lidar_frame, const rclcpp::Time & stamp)
+  {
+    std::vector<Eigen::Vector3f> points;
+    std::vector<float> azimuths;
+    for (size_t i = 0; i < number_of_dense_points; ++i) {
+      const float azimuth = 2.0f * autoware_utils::pi * i / number_of_dense_points;
+      points.emplace_back(
+        20.0f * std::cos(azimuth), 20.0f * std::sin(azimuth), static_cast<float>(i % 16) - 8.0f);
+      azimuths.push_back(azimuth);
+    }
+    auto pointcloud_msg = generate_pointcloud_msg(is_lidar_frame, stamp, points, azimuths);
+    sensor_msgs::PointCloud2Iterator<std::uint32_t> iter_t(pointcloud_msg, "time_stamp");
+    for (size_t i = 0; i < number_of_dense_points; ++i, ++iter_t) {
+      *iter_t = static_cast<std::uint32_t>(i * dense_points_interval_ns);
+    }
+    return pointcloud_msg;
+  }
+
+  // Undistort with a fresh corrector, per point when time_slice_sec is 0
+  template <typename T>
+  std::vector<Eigen::Vector3f> undistort_dense_pointcloud(
+    sensor_msgs::msg::PointCloud2 pointcloud, bool use_imu, double time_slice_sec)
+  {
+    rclcpp::Time timestamp(timestamp_seconds, timestamp_nanoseconds, RCL_ROS_TIME);
+    auto distortion_corrector = std::make_shared<T>(*node_);
+    distortion_corrector->set_batch_config(time_slice_sec, 2);
+    generate_and_process_twist_msgs(distortion_corrector, timestamp);
+    if (use_imu) {
+      generate_and_process_imu_msgs(distortion_corrector, timestamp);
+    }
+    distortion_corrector->initialize();
+    distortion_corrector->set_pointcloud_transform("base_link", pointcloud.header.frame_id);
+    distortion_corrector->undistort_pointcloud(use_imu, std::nullopt, pointcloud);
+
+    std::vector<Eigen::Vector3f> points;
+    sensor_msgs::PointCloud2ConstIterator<float> iter_x(pointcloud, "x");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_y(pointcloud, "y");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_z(pointcloud, "z");
+    for (; iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+      points.emplace_back(*iter_x, *iter_y, *iter_z);
+    }
+    return points;
+  }
+
+  template <typename T>
+  void expect_batched_matches_per_point(bool is_lidar_frame, bool use_imu)
+  {
+    rclcpp::Time timestamp(timestamp_seconds, timestamp_nanoseconds, RCL_ROS_TIME);
+    const auto pointcloud = generate_dense_pointcloud_msg(is_lidar_frame, timestamp);
+    const auto expected = undistort_dense_pointcloud<T>(pointcloud, use_imu, 0.0);
+    const auto batched = undistort_dense_pointcloud<T>(pointcloud, use_imu, batch_time_slice_sec);
+
+    ASSERT_EQ(batched.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_NEAR(batched[i].x(), expected[i].x(), coarse_tolerance) << "point " << i;
+      EXPECT_NEAR(batched[i].y(), expected[i].y(), coarse_tolerance) << "point " << i;
+      EXPECT_NEAR(batched[i].z(), expected[i].z(), coarse_tolerance) << "point " << i;
+    }
+  }
+
   template <typename T>
   void generate_and_process_twist_msgs(
     const std::shared_ptr<T> & distortion_corrector, const rclcpp::Time & timestamp)
@@ -341,6 +404,10 @@ protected:
   static constexpr double imu_angular_y_increment{0.005};
   static constexpr double imu_angular_z_increment{0.005};
 
+  static constexpr size_t number_of_dense_points{1800};
+  static constexpr uint64_t dense_points_interval_ns{50000};
+  static constexpr double batch_time_slice_sec{1e-4};
+
   static constexpr int points_interval_ms{10};
   static constexpr int twist_msgs_interval_ms{24};
   static constexpr int imu_msgs_interval_ms{27};
@@ -759,6 +826,56 @@ TEST_F(DistortionCorrectorTest, TestUndistortPointcloud3dWithImuInLidarFrame)
   }
 }
 
+TEST_F(DistortionCorrectorTest, TestBatchedUndistortPointcloud2dMatchesPerPoint)
+{
+  using autoware::pointcloud_preprocessor::DistortionCorrector2D;
+  expect_batched_matches_per_point<DistortionCorrector2D>(false, false);
+  expect_batched_matches_per_point<DistortionCorrector2D>(false, true);
+  expect_batched_matches_per_point<DistortionCorrector2D>(true, false);
+  expect_batched_matches_per_point<DistortionCorrector2D>(true, true);
+}
+
+TEST_F(DistortionCorrectorTest, TestBatchedUndistortPointcloud3dMatchesPerPoint)
+{
+  using autoware::pointcloud_preprocessor::DistortionCorrector3D;
+  expect_batched_matches_per_point<DistortionCorrector3D>(false, false);
+  expect_batched_matches_per_point<DistortionCorrector3D>(false, true);
+  expect_batched_matches_per_point<DistortionCorrector3D>(true, false);
+  expect_batched_matches_per_point<DistortionCorrector3D>(true, true);
+}
+
+TEST_F(DistortionCorrectorTest, TestBatchedUndistortPointcloudWithUnsortedTimestamps)
+{
+  // The batched mode assigns the points to slices by their timestamp, so the storage order must
+  // not change the result. The first point stays in place since it is the reference of the
+  // correction.
+  using autoware::pointcloud_preprocessor::DistortionCorrector3D;
+  rclcpp::Time timestamp(timestamp_seconds, timestamp_nanoseconds, RCL_ROS_TIME);
+  const auto pointcloud = generate_dense_pointcloud_msg(true, timestamp);
+  const auto expected =
+    undistort_dense_pointcloud<DistortionCorrector3D>(pointcloud, true, batch_time_slice_sec);
+
+  // Reverse the order of the other points
+  const auto reversed_index = [](size_t i) { return i == 0 ? 0 : number_of_dense_points - i; };
+  auto reversed_pointcloud = pointcloud;
+  const size_t point_step = pointcloud.point_step;
+  for (size_t i = 0; i < number_of_dense_points; ++i) {
+    std::copy_n(
+      pointcloud.data.begin() + i * point_step, point_step,
+      reversed_pointcloud.data.begin() + reversed_index(i) * point_step);
+  }
+  const auto reversed = undistort_dense_pointcloud<DistortionCorrector3D>(
+    reversed_pointcloud, true, batch_time_slice_sec);
+
+  ASSERT_EQ(reversed.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    const auto & point = reversed[reversed_index(i)];
+    EXPECT_NEAR(point.x(), expected[i].x(), standard_tolerance);
+    EXPECT_NEAR(point.y(), expected[i].y(), standard_tolerance);
+    EXPECT_NEAR(point.z(), expected[i].z(), standard_tolerance);
+  }
+}
+
 TEST_F(DistortionCorrectorTest, TestUndistortPointcloudWithPureLinearMotion)
 {
   rclcpp::Time timestamp(timestamp_seconds, timestamp_nanoseconds, RCL_ROS_TIME);
@@ -0,0 +1,195 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/filter_chain/filter_chain_node.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::PointCloudFilterChainComponent;
+using autoware::pointcloud_preprocessor::TransformInfo;
+
+// Subclass to expose protected faster_filter() for testing
+class PointCloudFilterChainComponentPublic : public PointCloudFilterChainComponent
+{
+public:
+  using PointCloudFilterChainComponent::faster_filter;
+  explicit PointCloudFilterChainComponentPublic(const rclcpp::NodeOptions & options)
+  : PointCloudFilterChainComponent(options)
+  {
+  }
+};
+
+struct SimplePoint
+{
+  float x, y, z;
+  uint8_t intensity, return_type;
+  uint16_t channel;
+};
+
+sensor_msgs::msg::PointCloud2 make_cloud(const std::vector<SimplePoint> & points)
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  cloud.header.frame_id = "lidar";
+  cloud.height = 1;
+  cloud.is_dense = true;
+  cloud.is_bigendian = false;
+
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2Fields(
+    6, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "z", 1, sensor_msgs::msg::PointField::FLOAT32, "intensity", 1,
+    sensor_msgs::msg::PointField::UINT8, "return_type", 1, sensor_msgs::msg::PointField::UINT8,
+    "channel", 1, sensor_msgs::msg::PointField::UINT16);
+  modifier.resize(points.size());
+
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_intensity(cloud, "intensity");
+  sensor_msgs::PointCloud2Iterator<uint8_t> iter_return_type(cloud, "return_type");
+  sensor_msgs::PointCloud2Iterator<uint16_t> iter_channel(cloud, "channel");
+  for (const auto & p : points) {
+    *iter_x = p.x;
+    *iter_y = p.y;
+    *iter_z = p.z;
+    *iter_intensity = p.intensity;
+    *iter_return_type = p.return_type;
+    *iter_channel = p.channel;
+    ++iter_x, ++iter_y, ++iter_z, ++iter_intensity, ++iter_return_type, ++iter_channel;
+  }
+  return cloud;
+}
+
+std::vector<SimplePoint> extract_points(const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  std::vector<SimplePoint> points;
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud, "z");
+  sensor_msgs::PointCloud2ConstIterator<uint8_t> iter_intensity(cloud, "intensity");
+  sensor_msgs::PointCloud2ConstIterator<uint8_t> iter_return_type(cloud, "return_type");
+  sensor_msgs::PointCloud2ConstIterator<uint16_t> iter_channel(cloud, "channel");
+  for (; iter_x != iter_x.end();
+       ++iter_x, ++iter_y, ++iter_z, ++iter_intensity, ++iter_return_type, ++iter_channel) {
+    points.push_back(
+      {*iter_x, *iter_y, *iter_z, *iter_intensity, *iter_return_type, *iter_channel});
+  }
+  return points;
+}
+
+// Only the crop box is enabled, the other stages need the ring order or the TF and twist inputs
+rclcpp::NodeOptions make_node_options()
+{
+  return rclcpp::NodeOptions()
+    .append_parameter_override("processing_time_threshold_sec", 0.01)
+    .append_parameter_override("crop_box.enable", true)
+    .append_parameter_override("crop_box.min_x", -1.0)
+    .append_parameter_override("crop_box.min_y", -1.0)
+    .append_parameter_override("crop_box.min_z", -1.0)
+    .append_parameter_override("crop_box.max_x", 1.0)
+    .append_parameter_override("crop_box.max_y", 1.0)
+    .append_parameter_override("crop_box.max_z", 1.0)
+    .append_parameter_override("crop_box.negative", true)
+    .append_parameter_override("distortion_corrector.enable", false)
+    .append_parameter_override("ring_outlier_filter.enable", false)
+    .append_parameter_override("voxel_grid_downsample_filter.enable", false);
+}
+
+class PointCloudFilterChainTest : public ::testing::Test
+{
+};
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  int ret = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return ret;
+}
+
+TEST_F(PointCloudFilterChainTest, OutputDataMatchesPoints)
+{
+  PointCloudFilterChainComponentPublic node(make_node_options());
+
+  const std::vector<SimplePoint> input_points = {
+    {5.0f, 0.0f, 0.0f, 10, 1, 0},
+    {0.5f, 0.5f, 0.0f, 20, 1, 1},  // inside the crop box
+    {-3.0f, 2.0f, 1.5f, 30, 2, 2},
+    {0.0f, 7.0f, -0.5f, 40, 1, 3},
+  };
+  const auto input_ptr =
+    std::make_shared<sensor_msgs::msg::PointCloud2>(make_cloud(input_points));
+
+  sensor_msgs::msg::PointCloud2 output;
+  node.faster_filter(input_ptr, nullptr, output, TransformInfo());
+
+  ASSERT_EQ(output.width, 3u);
+  ASSERT_EQ(output.height, 1u);
+  ASSERT_EQ(output.data.size(), static_cast<size_t>(output.width) * output.point_step);
+  EXPECT_EQ(output.row_step, output.data.size());
+  EXPECT_EQ(output.header.frame_id, "lidar");
+
+  const auto output_points = extract_points(output);
+  ASSERT_EQ(output_points.size(), 3u);
+  const std::vector<SimplePoint> expected = {input_points[0], input_points[2], input_points[3]};
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_FLOAT_EQ(output_points[i].x, expected[i].x);
+    EXPECT_FLOAT_EQ(output_points[i].y, expected[i].y);
+    EXPECT_FLOAT_EQ(output_points[i].z, expected[i].z);
+    EXPECT_EQ(output_points[i].intensity, expected[i].intensity);
+    EXPECT_EQ(output_points[i].return_type, expected[i].return_type);
+    EXPECT_EQ(output_points[i].channel, expected[i].channel);
+  }
+}
+
+TEST_F(PointCloudFilterChainTest, OutputIsTransformed)
+{
+  auto options = make_node_options().append_parameter_override("crop_box.enable", false);
+  PointCloudFilterChainComponentPublic node(options);
+
+  const std::vector<SimplePoint> input_points = {
+    {5.0f, 0.0f, 0.0f, 10, 1, 0},
+    {-3.0f, 2.0f, 1.5f, 30, 2, 2},
+  };
+  const auto input_ptr =
+    std::make_shared<sensor_msgs::msg::PointCloud2>(make_cloud(input_points));
+
+  TransformInfo transform_info;
+  transform_info.need_transform = true;
+  transform_info.eigen_transform(0, 3) = 1.0f;
+  transform_info.eigen_transform(2, 3) = 2.0f;
+
+  sensor_msgs::msg::PointCloud2 output;
+  node.faster_filter(input_ptr, nullptr, output, transform_info);
+
+  ASSERT_EQ(output.data.size(), static_cast<size_t>(output.width) * output.point_step);
+  const auto output_points = extract_points(output);
+  ASSERT_EQ(output_points.size(), input_points.size());
+  for (size_t i = 0; i < input_points.size(); ++i) {
+    EXPECT_FLOAT_EQ(output_points[i].x, input_points[i].x + 1.0f);
+    EXPECT_FLOAT_EQ(output_points[i].y, input_points[i].y);
+    EXPECT_FLOAT_EQ(output_points[i].z, input_points[i].z + 2.0f);
+    EXPECT_EQ(output_points[i].intensity, input_points[i].intensity);
+  }
+}
@@ -0,0 +1,284 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/filter_chain/filter_stages.hpp"
+#include "autoware/pointcloud_preprocessor/filter_chain/point_soa_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::CropBoxStage;
+using autoware::pointcloud_preprocessor::PointFieldLayout;
+using autoware::pointcloud_preprocessor::PointSoABuffer;
+using autoware::pointcloud_preprocessor::RingOutlierStage;
+using autoware::pointcloud_preprocessor::UndistortStage;
+using autoware::pointcloud_preprocessor::VoxelDownsampleStage;
+
+namespace
+{
+// Same layout as PointXYZIRCAEDT
+struct TestPoint
+{
+  float x;
+  float y;
+  float z;
+  uint8_t intensity;
+  uint8_t return_type;
+  uint16_t channel;
+  float azimuth;
+  float elevation;
+  float distance;
+  uint32_t time_stamp;
+};
+
+PointFieldLayout make_layout()
+{
+  PointFieldLayout layout;
+  layout.point_step = sizeof(TestPoint);
+  layout.x_offset = offsetof(TestPoint, x);
+  layout.y_offset = offsetof(TestPoint, y);
+  layout.z_offset = offsetof(TestPoint, z);
+  layout.intensity_offset = offsetof(TestPoint, intensity);
+  layout.return_type_offset = offsetof(TestPoint, return_type);
+  layout.channel_offset = offsetof(TestPoint, channel);
+  layout.azimuth_offset = offsetof(TestPoint, azimuth);
+  layout.distance_offset = offsetof(TestPoint, distance);
+  layout.time_stamp_offset = offsetof(TestPoint, time_stamp);
+  return layout;
+}
+
+// Rings of points on circles, firing order by azimuth, with a few isolated spikes
+std::vector<TestPoint> make_scan(uint16_t num_rings, size_t points_per_ring)
+{
+  std::vector<TestPoint> cloud;
+  for (size_t step = 0; step < points_per_ring; ++step) {
+    for (uint16_t ring = 0; ring < num_rings; ++ring) {
+      const float azimuth = 2.0f * static_cast<float>(M_PI) * step / points_per_ring;
+      float distance = 10.0f + ring;
+      if (step % 37 == 0) {
+        distance *= 1.5f;  // isolated outlier
+      }
+      TestPoint p{};
+      p.x = distance * std::cos(azimuth);
+      p.y = distance * std::sin(azimuth);
+      p.z = 0.1f * ring;
+      p.intensity = static_cast<uint8_t>(step % 256);
+      p.return_type = 1;
+      p.channel = ring;
+      p.azimuth = azimuth;
+      p.distance = distance;
+      p.time_stamp = static_cast<uint32_t>(step * 10000);
+      cloud.push_back(p);
+    }
+  }
+  return cloud;
+}
+
+PointSoABuffer load(const std::vector<TestPoint> & cloud)
+{
+  PointSoABuffer buffer;
+  buffer.load(reinterpret_cast<const uint8_t *>(cloud.data()), cloud.size(), make_layout());
+  return buffer;
+}
+
+// Straightforward port of RingOutlierFilterComponent::faster_filter, returns the kept indices
+std::vector<size_t> reference_ring_outlier(
+  const std::vector<TestPoint> & cloud, const RingOutlierStage::Param & param)
+{
+  std::vector<std::vector<size_t>> ring2indices(param.max_rings_num);
+  std::vector<size_t> kept;
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    if (cloud[i].channel < param.max_rings_num) {
+      ring2indices[cloud[i].channel].push_back(i);
+    } else {
+      kept.push_back(i);
+    }
+  }
+  const auto is_cluster = [&](size_t first, size_t last) {
+    const float dx = cloud[first].x - cloud[last].x;
+    const float dy = cloud[first].y - cloud[last].y;
+    const float dz = cloud[first].z - cloud[last].z;
+    return dx * dx + dy * dy + dz * dz >=
+           param.object_length_threshold * param.object_length_threshold;
+  };
+  for (const auto & indices : ring2indices) {
+    if (indices.size() < 2) continue;
+    size_t walk_first_idx = 0;
+    size_t walk_last_idx = 0;
+    for (size_t idx = 0U; idx < indices.size() - 1; ++idx) {
+      const size_t current = indices[idx];
+      const size_t next = indices[idx + 1];
+      walk_last_idx = idx;
+      float azimuth_diff = cloud[next].azimuth - cloud[current].azimuth;
+      azimuth_diff = azimuth_diff < 0.f ? azimuth_diff + 2 * M_PI : azimuth_diff;
+      if (
+        std::max(cloud[current].distance, cloud[next].distance) <
+          std::min(cloud[current].distance, cloud[next].distance) * param.distance_ratio &&
+        azimuth_diff < 1.0 * (180.0 / M_PI)) {
+        continue;
+      }
+      if (is_cluster(indices[walk_first_idx], indices[walk_last_idx])) {
+        for (size_t i = walk_first_idx; i <= walk_last_idx; i++) kept.push_back(indices[i]);
+      }
+      walk_first_idx = idx + 1;
+    }
+    if (walk_first_idx > walk_last_idx) continue;
+    if (is_cluster(indices[walk_first_idx], indices[walk_last_idx])) {
+      for (size_t i = walk_first_idx; i <= walk_last_idx; i++) kept.push_back(indices[i]);
+    }
+  }
+  std::sort(kept.begin(), kept.end());
+  return kept;
+}
+}  // namespace
+
+TEST(PointSoABufferTest, LoadCompactStoreRoundTrip)
+{
+  const auto cloud = make_scan(4, 10);
+  auto buffer = load(cloud);
+  ASSERT_EQ(buffer.size(), cloud.size());
+
+  std::vector<uint8_t> keep(cloud.size());
+  for (size_t i = 0; i < keep.size(); ++i) keep[i] = i % 3 == 0;
+  buffer.compact(keep);
+
+  std::vector<uint8_t> out(buffer.size() * PointSoABuffer::xyzirc_point_step);
+  buffer.store_xyzirc(out.data(), nullptr);
+
+  size_t j = 0;
+  for (size_t i = 0; i < cloud.size(); i += 3, ++j) {
+    const uint8_t * p = out.data() + j * PointSoABuffer::xyzirc_point_step;
+    float xyz[3];
+    uint16_t channel;
+    std::memcpy(xyz, p, sizeof(xyz));
+    std::memcpy(&channel, p + 14, sizeof(channel));
+    EXPECT_EQ(xyz[0], cloud[i].x);
+    EXPECT_EQ(xyz[1], cloud[i].y);
+    EXPECT_EQ(xyz[2], cloud[i].z);
+    EXPECT_EQ(p[12], cloud[i].intensity);
+    EXPECT_EQ(p[13], cloud[i].return_type);
+    EXPECT_EQ(channel, cloud[i].channel);
+  }
+  EXPECT_EQ(j, buffer.size());
+}
+
+TEST(CropBoxStageTest, MatchesBoxTestAndSkipsNaN)
+{
+  auto cloud = make_scan(8, 100);
+  cloud[5].x = std::numeric_limits<float>::quiet_NaN();
+
+  CropBoxStage::Param param{-12.0f, -12.0f, -1.0f, 12.0f, 12.0f, 1.0f, false};
+  CropBoxStage stage(param);
+  auto buffer = load(cloud);
+  stage.apply(buffer);
+
+  size_t expected = 0;
+  for (const auto & p : cloud) {
+    expected += std::isfinite(p.x) && p.x > param.min_x && p.x < param.max_x &&
+                p.y > param.min_y && p.y < param.max_y && p.z > param.min_z && p.z < param.max_z;
+  }
+  EXPECT_EQ(buffer.size(), expected);
+  EXPECT_EQ(stage.skipped_nan_count(), 1);
+
+  // The negative box keeps exactly the complement of the finite points
+  param.negative = true;
+  CropBoxStage negative_stage(param);
+  auto negative_buffer = load(cloud);
+  negative_stage.apply(negative_buffer);
+  EXPECT_EQ(negative_buffer.size() + buffer.size(), cloud.size() - 1);
+}
+
+TEST(RingOutlierStageTest, MatchesRingOutlierFilter)
+{
+  auto cloud = make_scan(16, 900);
+  // Channels outside of the configured rings are passed through
+  cloud[3].channel = 200;
+
+  const RingOutlierStage::Param param{1.03, 0.05, 16};
+  RingOutlierStage stage(param);
+  auto buffer = load(cloud);
+  stage.apply(buffer);
+
+  const auto kept = reference_ring_outlier(cloud, param);
+  ASSERT_EQ(buffer.size(), kept.size());
+  for (size_t i = 0; i < kept.size(); ++i) {
+    EXPECT_EQ(buffer.x[i], cloud[kept[i]].x);
+    EXPECT_EQ(buffer.time_stamp[i], cloud[kept[i]].time_stamp);
+  }
+}
+
+TEST(UndistortStageTest, ConstantVelocity2D)
+{
+  const auto cloud = make_scan(2, 50);
+  auto buffer = load(cloud);
+
+  const double cloud_stamp = 100.0;
+  const float v = 10.0f;
+  UndistortStage stage(false);
+  std::vector<UndistortStage::TwistSample> twists;
+  for (int i = 0; i < 20; ++i) {
+    twists.push_back(
+      {cloud_stamp - 0.05 + 0.01 * i, Eigen::Vector3f(v, 0.0f, 0.0f), Eigen::Vector3f::Zero()});
+  }
+  stage.set_frame(cloud_stamp, cloud_stamp, twists, {});
+  stage.apply(buffer);
+
+  EXPECT_EQ(stage.timestamp_mismatch_count(), 0);
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    const float dt = 1e-9f * cloud[i].time_stamp;
+    EXPECT_NEAR(buffer.x[i], cloud[i].x + v * dt, 1e-4);
+    EXPECT_NEAR(buffer.y[i], cloud[i].y, 1e-4);
+    EXPECT_FLOAT_EQ(buffer.z[i], cloud[i].z);
+  }
+}
+
+TEST(UndistortStageTest, NoTwistLeavesPointsUnchanged)
+{
+  const auto cloud = make_scan(2, 50);
+  auto buffer = load(cloud);
+  UndistortStage stage(false);
+  stage.set_frame(0.0, 0.0, {}, {});
+  stage.apply(buffer);
+  for (size_t i = 0; i < cloud.size(); ++i) {
+    EXPECT_EQ(buffer.x[i], cloud[i].x);
+    EXPECT_EQ(buffer.y[i], cloud[i].y);
+  }
+}
+
+TEST(VoxelDownsampleStageTest, OnePointPerVoxel)
+{
+  const auto cloud = make_scan(16, 900);
+  auto buffer = load(cloud);
+  VoxelDownsampleStage stage(1.0f, 1.0f, 1.0f, 2);
+  stage.apply(buffer);
+
+  ASSERT_FALSE(buffer.empty());
+  EXPECT_LT(buffer.size(), cloud.size());
+  // Every centroid lies in a distinct voxel
+  std::vector<std::array<int, 3>> voxels;
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    voxels.push_back(
+      {static_cast<int>(std::floor(buffer.x[i])), static_cast<int>(std::floor(buffer.y[i])),
+       static_cast<int>(std::floor(buffer.z[i]))});
+  }
+  std::sort(voxels.begin(), voxels.end());
+  EXPECT_EQ(std::unique(voxels.begin(), voxels.end()), voxels.end());
+}
@@ -0,0 +1,158 @@
+// Copyright 2025 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/pointcloud_preprocessor/downsample_filter/voxel_centroid_engine.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+using autoware::pointcloud_preprocessor::VoxelCentroidEngine;
+
+namespace
+{
+// Same layout as PointXYZI with a UINT8 intensity
+struct TestPoint
+{
+  float x;
+  float y;
+  float z;
+  uint8_t intensity;
+  uint8_t padding[3];
+};
+
+VoxelCentroidEngine::FieldLayout make_layout()
+{
+  VoxelCentroidEngine::FieldLayout layout;
+  layout.point_step = sizeof(TestPoint);
+  layout.x_offset = offsetof(TestPoint, x);
+  layout.y_offset = offsetof(TestPoint, y);
+  layout.z_offset = offsetof(TestPoint, z);
+  layout.intensity_offset = offsetof(TestPoint, intensity);
+  return layout;
+}
+
+std::vector<TestPoint> make_random_cloud(size_t num_points, unsigned seed)
+{
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<float> xy(-50.0f, 50.0f);
+  std::uniform_real_distribution<float> z(-2.0f, 3.0f);
+  std::uniform_int_distribution<int> intensity(0, 255);
+  std::vector<TestPoint> cloud(num_points);
+  for (auto & p : cloud) {
+    p = TestPoint{xy(engine), xy(engine), z(engine), static_cast<uint8_t>(intensity(engine)), {}};
+  }
+  return cloud;
+}
+
+const uint8_t * as_bytes(const std::vector<TestPoint> & cloud)
+{
+  return reinterpret_cast<const uint8_t *>(cloud.data());
+}
+}  // namespace
+
+TEST(VoxelCentroidEngineTest, MatchesReferenceCentroids)
+{
+  const std::vector<TestPoint> cloud = {
+    {0.1f, 0.1f, 0.1f, 10, {}},   {0.2f, 0.2f, 0.2f, 20, {}},  {1.1f, 0.1f, 0.1f, 30, {}},
+    {-0.1f, 0.1f, 0.1f, 40, {}},  {-0.3f, 0.3f, 0.3f, 60, {}},
+    {std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f, 0, {}},
+    {0.0f, 0.0f, std::numeric_limits<float>::infinity(), 0, {}}};
+
+  VoxelCentroidEngine engine;
+  engine.set_voxel_size(1.0f, 1.0f, 1.0f);
+  ASSERT_TRUE(engine.compute(as_bytes(cloud), cloud.size(), make_layout()));
+
+  // Non-finite points are dropped, voxels are sorted by (x, y, z) index
+  const auto & voxels = engine.voxels();
+  ASSERT_EQ(voxels.size(), 3u);
+
+  const Eigen::Vector4f negative = voxels[0].calc_centroid();
+  EXPECT_EQ(voxels[0].point_count, 2u);
+  EXPECT_FLOAT_EQ(negative[0], -0.2f);
+  EXPECT_FLOAT_EQ(negative[1], 0.2f);
+  EXPECT_FLOAT_EQ(negative[3], 50.0f);
+
+  const Eigen::Vector4f origin = voxels[1].calc_centroid();
+  EXPECT_EQ(voxels[1].point_count, 2u);
+  EXPECT_FLOAT_EQ(origin[0], 0.15f);
+  EXPECT_FLOAT_EQ(origin[2], 0.15f);
+  EXPECT_FLOAT_EQ(origin[3], 15.0f);
+
+  EXPECT_EQ(voxels[2].point_count, 1u);
+  EXPECT_FLOAT_EQ(voxels[2].calc_centroid()[0], 1.1f);
+}
+
+TEST(VoxelCentroidEngineTest, MultiThreadedMatchesSingleThreaded)
+{
+  const auto cloud = make_random_cloud(200000, 0);
+  const auto layout = make_layout();
+
+  VoxelCentroidEngine single;
+  single.set_voxel_size(0.3f, 0.3f, 0.1f);
+  ASSERT_TRUE(single.compute(as_bytes(cloud), cloud.size(), layout));
+
+  VoxelCentroidEngine multi;
+  multi.set_voxel_size(0.3f, 0.3f, 0.1f);
+  multi.set_num_threads(4);
+  ASSERT_TRUE(multi.compute(as_bytes(cloud), cloud.size(), layout));
+
+  ASSERT_EQ(single.voxels().size(), multi.voxels().size());
+  for (size_t i = 0; i < single.voxels().size(); ++i) {
+    const auto & a = single.voxels()[i];
+    const auto & b = multi.voxels()[i];
+    ASSERT_EQ(a.key, b.key);
+    ASSERT_EQ(a.point_count, b.point_count);
+    EXPECT_NEAR(a.calc_centroid()[0], b.calc_centroid()[0], 1e-4);
+    EXPECT_NEAR(a.calc_centroid()[1], b.calc_centroid()[1], 1e-4);
+    EXPECT_NEAR(a.calc_centroid()[2], b.calc_centroid()[2], 1e-4);
+  }
+}
+
+TEST(VoxelCentroidEngineTest, OutputIsDeterministicAcrossFrames)
+{
+  const auto first = make_random_cloud(100000, 1);
+  const auto second = make_random_cloud(50000, 2);
+  const auto layout = make_layout();
+
+  VoxelCentroidEngine engine;
+  engine.set_voxel_size(0.5f, 0.5f, 0.5f);
+  engine.set_num_threads(3);
+  ASSERT_TRUE(engine.compute(as_bytes(first), first.size(), layout));
+  const auto expected = engine.voxels();
+
+  // Reusing the tables on another cloud must not leak state into the next frame
+  ASSERT_TRUE(engine.compute(as_bytes(second), second.size(), layout));
+  ASSERT_TRUE(engine.compute(as_bytes(first), first.size(), layout));
+
+  ASSERT_EQ(engine.voxels().size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(engine.voxels()[i].key, expected[i].key);
+    EXPECT_EQ(engine.voxels()[i].point_count, expected[i].point_count);
+    EXPECT_EQ(engine.voxels()[i].x, expected[i].x);
+  }
+}
+
+TEST(VoxelCentroidEngineTest, VoxelIndexOverflow)
+{
+  const std::vector<TestPoint> cloud = {{0.0f, 0.0f, 0.0f, 0, {}}, {1.0e6f, 0.0f, 0.0f, 0, {}}};
+
+  VoxelCentroidEngine engine;
+  engine.set_voxel_size(0.01f, 0.01f, 0.01f);
+  EXPECT_FALSE(engine.compute(as_bytes(cloud), cloud.size(), make_layout()));
+  EXPECT_TRUE(engine.voxels().empty());
+}
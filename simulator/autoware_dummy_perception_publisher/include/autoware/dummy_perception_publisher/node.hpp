@@ -40,6 +40,7 @@
 
 #include "autoware/dummy_perception_publisher/dummy_object_movement_base_plugin.hpp"
 #include "autoware/dummy_perception_publisher/object_info.hpp"
+#include "autoware/dummy_perception_publisher/synthetic_lidar.hpp"
 
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
@@ -63,6 +64,17 @@ public:
     const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
     std::mt19937 & random_generator,
     pcl::PointCloud<pcl::PointXYZ>::Ptr & merged_pointcloud) const = 0;
+
+  /**
+   * @brief Write the merged point cloud of the objects directly as a PointXYZIRC message.
+   * @return false if the creator does not support it, create_pointclouds is used instead.
+   */
+  virtual bool create_pointcloud_msg(
+    const std::vector<ObjectInfo> & /*obj_infos*/, const tf2::Transform & /*tf_base_link2map*/,
+    std::mt19937 & /*random_generator*/, sensor_msgs::msg::PointCloud2 & /*pointcloud_msg*/) const
+  {
+    return false;
+  }
 };
 
 class ObjectCentricPointCloudCreator : public PointCloudCreator
@@ -99,6 +111,30 @@ private:
   double visible_range_;
 };
 
+class SyntheticLidarPointCloudCreator : public PointCloudCreator
+{
+public:
+  SyntheticLidarPointCloudCreator(const LidarScanPattern & scan_pattern, size_t num_threads)
+  : lidar_(scan_pattern, num_threads)
+  {
+  }
+
+  std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> create_pointclouds(
+    const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+    std::mt19937 & random_generator,
+    pcl::PointCloud<pcl::PointXYZ>::Ptr & merged_pointcloud) const override;
+
+  bool create_pointcloud_msg(
+    const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+    std::mt19937 & random_generator, sensor_msgs::msg::PointCloud2 & pointcloud_msg) const override;
+
+private:
+  // the lidar and the buffers keep their storage between the frames
+  mutable SyntheticLidar lidar_;
+  mutable std::vector<LidarBox> boxes_;
+  mutable std::vector<LidarPoint> points_;
+};
+
 class DummyPerceptionPublisherNode : public rclcpp::Node
 {
 private:
@@ -123,6 +159,8 @@ private:
   std::vector<std::shared_ptr<pluginlib::DummyObjectMovementBasePlugin>> movement_plugins_;
   double angle_increment_;
   std::mt19937 random_generator_;
+  // reused so that the synthetic lidar writes the points without reallocating the data
+  sensor_msgs::msg::PointCloud2 output_pointcloud_msg_;
 
   void timerCallback();
   void objectCallback(const DummyObject::ConstSharedPtr msg);
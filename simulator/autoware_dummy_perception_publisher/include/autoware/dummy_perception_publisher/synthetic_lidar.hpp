@@ -0,0 +1,191 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE__DUMMY_PERCEPTION_PUBLISHER__SYNTHETIC_LIDAR_HPP_
+#define AUTOWARE__DUMMY_PERCEPTION_PUBLISHER__SYNTHETIC_LIDAR_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace autoware::dummy_perception_publisher
+{
+
+// Box of an object in the sensor frame, whose yaw is the only rotation
+struct LidarBox
+{
+  double x{0.0};
+  double y{0.0};
+  double yaw{0.0};
+  double length{0.0};
+  double width{0.0};
+  double min_z{0.0};
+  double max_z{0.0};
+  // standard deviations of the noise added to the points on the box
+  double std_dev_x{0.0};
+  double std_dev_y{0.0};
+  double std_dev_z{0.0};
+};
+
+struct LidarScanPattern
+{
+  // elevation angle of each ring [rad], the index is the channel of the points
+  std::vector<double> elevation_angles;
+  double azimuth_resolution{0.0};  // [rad]
+  double min_range{0.0};           // horizontal distance [m]
+  double max_range{0.0};           // horizontal distance [m]
+
+  static LidarScanPattern uniform(
+    size_t num_beams, double min_elevation_angle, double max_elevation_angle,
+    double azimuth_resolution, double min_range, double max_range);
+
+  [[nodiscard]] size_t num_azimuths() const;
+};
+
+struct LidarPoint
+{
+  float x;
+  float y;
+  float z;
+  uint16_t channel;
+  uint32_t box_index;
+};
+
+// Intersection of a horizontal ray from the sensor origin with the footprint of a box, in
+// horizontal distance along the ray
+struct RayBoxInterval
+{
+  double t_enter;
+  double t_exit;
+  uint32_t box_index;
+};
+
+/**
+ * @brief Bounding volume hierarchy over the axis aligned footprints of the boxes.
+ *
+ * It is rebuilt every frame by splitting the boxes at the median of the longest axis, and keeps its
+ * storage between the builds.
+ */
+class BoxBvh2d
+{
+public:
+  void build(const std::vector<LidarBox> & boxes);
+
+  /**
+   * @brief Compute the intervals of the ray from the origin in the direction (cos, sin) with the
+   * footprints of the boxes, entering them before max_range.
+   * @param intervals Output, sorted by t_enter.
+   * @param stack Traversal stack, kept by the caller to avoid allocations.
+   */
+  void intersect(
+    double cos, double sin, double max_range, std::vector<RayBoxInterval> & intervals,
+    std::vector<uint32_t> & stack) const;
+
+  [[nodiscard]] size_t size() const { return footprints_.size(); }
+
+private:
+  struct Footprint
+  {
+    double x;
+    double y;
+    double cos;
+    double sin;
+    double half_length;
+    double half_width;
+  };
+  struct Node
+  {
+    double min_x;
+    double min_y;
+    double max_x;
+    double max_y;
+    uint32_t begin;  // first child for inner nodes, first index of indices_ for leaves
+    uint32_t count;  // 0 for inner nodes
+  };
+  static constexpr uint32_t max_leaf_size = 4;
+
+  void buildNode(uint32_t node_index, uint32_t begin, uint32_t end);
+
+  std::vector<Footprint> footprints_;
+  std::vector<double> aabbs_;  // min_x, min_y, max_x, max_y of each footprint
+  std::vector<uint32_t> indices_;
+  std::vector<Node> nodes_;
+};
+
+/**
+ * @brief Multi-beam LiDAR casting the rays of a scan pattern against boxes.
+ *
+ * For each azimuth, the horizontal ray is intersected with the footprints through the BVH, then
+ * each ring keeps the nearest box whose height is crossed by its beam inside the footprint, which
+ * is the analytic intersection with the oriented box. The azimuths are split into sectors cast in
+ * parallel, each sector writing to its own part of the output.
+ */
+class SyntheticLidar
+{
+public:
+  SyntheticLidar(LidarScanPattern pattern, size_t num_threads);
+
+  /**
+   * @brief Cast the scan and write the points as PointXYZIRC, with the ring as channel.
+   * The data of the cloud is only reallocated when the maximum number of points of the pattern
+   * exceeds its capacity.
+   */
+  void cast(
+    const std::vector<LidarBox> & boxes, std::mt19937 & random_generator,
+    sensor_msgs::msg::PointCloud2 & cloud);
+
+  // Cast the scan and keep the box hit by each point
+  void cast(
+    const std::vector<LidarBox> & boxes, std::mt19937 & random_generator,
+    std::vector<LidarPoint> & points);
+
+  [[nodiscard]] const LidarScanPattern & pattern() const { return pattern_; }
+  [[nodiscard]] size_t max_num_points() const;
+
+private:
+  struct Sector
+  {
+    size_t azimuth_begin;
+    size_t azimuth_end;
+    uint32_t seed;
+    size_t num_points;
+    std::vector<RayBoxInterval> intervals;
+    std::vector<uint32_t> stack;
+  };
+
+  template <typename WritePoint>
+  void castSector(
+    const std::vector<LidarBox> & boxes, Sector & sector, size_t first_point,
+    const WritePoint & write_point) const;
+
+  template <typename WritePoint>
+  void castSectors(
+    const std::vector<LidarBox> & boxes, std::mt19937 & random_generator,
+    const WritePoint & write_point);
+
+  LidarScanPattern pattern_;
+  std::vector<double> tan_elevations_;
+  std::vector<double> cos_azimuths_;
+  std::vector<double> sin_azimuths_;
+  BoxBvh2d bvh_;
+  std::vector<Sector> sectors_;
+  size_t num_threads_{1};
+};
+
+}  // namespace autoware::dummy_perception_publisher
+
+#endif  // AUTOWARE__DUMMY_PERCEPTION_PUBLISHER__SYNTHETIC_LIDAR_HPP_
@@ -73,17 +73,39 @@ DummyPerceptionPublisherNode::DummyPerceptionPublisherNode()
     static_cast<unsigned int>(this->declare_parameter("random_seed", 0));
   const bool use_fixed_random_seed = this->declare_parameter("use_fixed_random_seed", false);
 
+  // parameters of the multi-beam synthetic lidar
+  const bool use_synthetic_lidar = this->declare_parameter<bool>("synthetic_lidar.enable");
+  const auto num_beams = this->declare_parameter<int>("synthetic_lidar.num_beams");
+  const double min_elevation_angle =
+    this->declare_parameter<double>("synthetic_lidar.min_elevation_angle");
+  const double max_elevation_angle =
+    this->declare_parameter<double>("synthetic_lidar.max_elevation_angle");
+  // optional, an empty list cannot be written in a parameter file
+  const auto elevation_angles = this->declare_parameter(
+    "synthetic_lidar.elevation_angles", std::vector<double>{});
+  const double min_range = this->declare_parameter<double>("synthetic_lidar.min_range");
+  const auto num_threads = this->declare_parameter<int>("synthetic_lidar.num_threads");
+
+  // parameters for vehicle centric point cloud generation
+  angle_increment_ = this->declare_parameter("angle_increment", 0.25 * M_PI / 180.0);
+
   if (object_centric_pointcloud) {
     pointcloud_creator_ =
       std::unique_ptr<PointCloudCreator>(new ObjectCentricPointCloudCreator(enable_ray_tracing_));
+  } else if (use_synthetic_lidar) {
+    auto scan_pattern = LidarScanPattern::uniform(
+      static_cast<size_t>(num_beams), min_elevation_angle, max_elevation_angle, angle_increment_,
+      min_range, visible_range_);
+    if (!elevation_angles.empty()) {
+      scan_pattern.elevation_angles = elevation_angles;
+    }
+    pointcloud_creator_ = std::unique_ptr<PointCloudCreator>(
+      new SyntheticLidarPointCloudCreator(scan_pattern, static_cast<size_t>(num_threads)));
   } else {
     pointcloud_creator_ =
       std::unique_ptr<PointCloudCreator>(new EgoCentricPointCloudCreator(visible_range_));
   }
 
-  // parameters for vehicle centric point cloud generation
-  angle_increment_ = this->declare_parameter("angle_increment", 0.25 * M_PI / 180.0);
-
   if (use_fixed_random_seed) {
     random_generator_.seed(random_seed);
   } else {
@@ -145,7 +167,7 @@ void DummyPerceptionPublisherNode::timerCallback()
   tier4_perception_msgs::msg::DetectedObjectsWithFeature output_dynamic_object_msg;
   autoware_perception_msgs::msg::TrackedObjects output_ground_truth_objects_msg;
   PoseStamped output_moved_object_pose;
-  sensor_msgs::msg::PointCloud2 output_pointcloud_msg;
+  sensor_msgs::msg::PointCloud2 & output_pointcloud_msg = output_pointcloud_msg_;
   std_msgs::msg::Header header;
   rclcpp::Time current_time = this->now();
 
@@ -214,7 +236,8 @@ void DummyPerceptionPublisherNode::timerCallback()
   if (all_objects.empty()) {
     const auto pointcloud_xyzirc = convertPointCloudXYZtoXYZIRC(merged_pointcloud_ptr);
     pcl::toROSMsg(pointcloud_xyzirc, output_pointcloud_msg);
-  } else {
+  } else if (!pointcloud_creator_->create_pointcloud_msg(
+               obj_infos, tf_base_link2map, random_generator_, output_pointcloud_msg)) {
     pointcloud_creator_->create_pointclouds(
       obj_infos, tf_base_link2map, random_generator_, merged_pointcloud_ptr);
     const auto pointcloud_xyzirc = convertPointCloudXYZtoXYZIRC(merged_pointcloud_ptr);
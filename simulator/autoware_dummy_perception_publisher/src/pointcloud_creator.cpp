@@ -19,6 +19,7 @@
 #include <pcl/impl/point_types.hpp>
 #include <tf2/LinearMath/Transform.hpp>
 #include <tf2/LinearMath/Vector3.hpp>
+#include <tf2/utils.hpp>
 
 #include <pcl/filters/voxel_grid_occlusion_estimation.h>
 
@@ -262,4 +263,59 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::cr
   return pointclouds;
 }
 
+namespace
+{
+void toLidarBoxes(
+  const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+  std::vector<LidarBox> & boxes)
+{
+  boxes.resize(obj_infos.size());
+  for (size_t i = 0; i < obj_infos.size(); ++i) {
+    const auto & obj_info = obj_infos.at(i);
+    const auto tf_base_link2moved_object = tf_base_link2map * obj_info.tf_map2moved_object;
+    auto & box = boxes.at(i);
+    box.x = tf_base_link2moved_object.getOrigin().x();
+    box.y = tf_base_link2moved_object.getOrigin().y();
+    box.yaw = tf2::getYaw(tf_base_link2moved_object.getRotation());
+    box.length = obj_info.length;
+    box.width = obj_info.width;
+    box.min_z = -1.0 * (obj_info.height / 2.0) + tf_base_link2moved_object.getOrigin().z();
+    box.max_z = 1.0 * (obj_info.height / 2.0) + tf_base_link2moved_object.getOrigin().z();
+    box.std_dev_x = obj_info.std_dev_x;
+    box.std_dev_y = obj_info.std_dev_y;
+    box.std_dev_z = obj_info.std_dev_z;
+  }
+}
+}  // namespace
+
+std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr>
+SyntheticLidarPointCloudCreator::create_pointclouds(
+  const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+  std::mt19937 & random_generator, pcl::PointCloud<pcl::PointXYZ>::Ptr & merged_pointcloud) const
+{
+  toLidarBoxes(obj_infos, tf_base_link2map, boxes_);
+  lidar_.cast(boxes_, random_generator, points_);
+
+  std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> pointclouds(obj_infos.size());
+  for (auto & pointcloud : pointclouds) {
+    pointcloud = pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>);
+  }
+  merged_pointcloud->reserve(merged_pointcloud->size() + points_.size());
+  for (const auto & point : points_) {
+    const pcl::PointXYZ point_xyz(point.x, point.y, point.z);
+    pointclouds.at(point.box_index)->push_back(point_xyz);
+    merged_pointcloud->push_back(point_xyz);
+  }
+  return pointclouds;
+}
+
+bool SyntheticLidarPointCloudCreator::create_pointcloud_msg(
+  const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+  std::mt19937 & random_generator, sensor_msgs::msg::PointCloud2 & pointcloud_msg) const
+{
+  toLidarBoxes(obj_infos, tf_base_link2map, boxes_);
+  lidar_.cast(boxes_, random_generator, pointcloud_msg);
+  return true;
+}
+
 }  // namespace autoware::dummy_perception_publisher
@@ -0,0 +1,397 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/dummy_perception_publisher/synthetic_lidar.hpp"
+
+#include <autoware/point_types/types.hpp>
+#include <autoware/universe_utils/system/parallel_for.hpp>
+#include <point_cloud_msg_wrapper/point_cloud_msg_wrapper.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace autoware::dummy_perception_publisher
+{
+using autoware::point_types::PointXYZIRC;
+
+namespace
+{
+constexpr size_t sectors_per_thread = 4;
+
+/*
+ * Clip [t_min, t_max] to the parameters t of the ray origin + t * direction inside the slab
+ * [slab_min, slab_max] of one axis.
+ */
+bool clipToSlab(
+  const double origin, const double direction, const double slab_min, const double slab_max,
+  double & t_min, double & t_max)
+{
+  if (direction == 0.0) {
+    return slab_min <= origin && origin <= slab_max;
+  }
+  const double inv_direction = 1.0 / direction;
+  double t_0 = (slab_min - origin) * inv_direction;
+  double t_1 = (slab_max - origin) * inv_direction;
+  if (t_1 < t_0) {
+    std::swap(t_0, t_1);
+  }
+  t_min = std::max(t_min, t_0);
+  t_max = std::min(t_max, t_1);
+  return t_min <= t_max;
+}
+}  // namespace
+
+LidarScanPattern LidarScanPattern::uniform(
+  const size_t num_beams, const double min_elevation_angle, const double max_elevation_angle,
+  const double azimuth_resolution, const double min_range, const double max_range)
+{
+  LidarScanPattern pattern;
+  pattern.elevation_angles.resize(num_beams);
+  for (size_t i = 0; i < num_beams; ++i) {
+    const double ratio = num_beams == 1 ? 0.0 : static_cast<double>(i) / (num_beams - 1);
+    pattern.elevation_angles.at(i) =
+      min_elevation_angle + ratio * (max_elevation_angle - min_elevation_angle);
+  }
+  pattern.azimuth_resolution = azimuth_resolution;
+  pattern.min_range = min_range;
+  pattern.max_range = max_range;
+  return pattern;
+}
+
+size_t LidarScanPattern::num_azimuths() const
+{
+  if (azimuth_resolution <= 0.0) {
+    return 0;
+  }
+  return static_cast<size_t>(std::floor(2 * M_PI / azimuth_resolution));
+}
+
+void BoxBvh2d::build(const std::vector<LidarBox> & boxes)
+{
+  const auto num_boxes = static_cast<uint32_t>(boxes.size());
+  footprints_.resize(num_boxes);
+  aabbs_.resize(4 * num_boxes);
+  indices_.resize(num_boxes);
+  std::iota(indices_.begin(), indices_.end(), 0U);
+  nodes_.clear();
+  if (num_boxes == 0) {
+    return;
+  }
+
+  for (uint32_t i = 0; i < num_boxes; ++i) {
+    const auto & box = boxes.at(i);
+    auto & footprint = footprints_.at(i);
+    footprint.x = box.x;
+    footprint.y = box.y;
+    footprint.cos = std::cos(box.yaw);
+    footprint.sin = std::sin(box.yaw);
+    footprint.half_length = 0.5 * box.length;
+    footprint.half_width = 0.5 * box.width;
+    const double extent_x = std::abs(footprint.cos) * footprint.half_length +
+                            std::abs(footprint.sin) * footprint.half_width;
+    const double extent_y = std::abs(footprint.sin) * footprint.half_length +
+                            std::abs(footprint.cos) * footprint.half_width;
+    aabbs_.at(4 * i) = box.x - extent_x;
+    aabbs_.at(4 * i + 1) = box.y - extent_y;
+    aabbs_.at(4 * i + 2) = box.x + extent_x;
+    aabbs_.at(4 * i + 3) = box.y + extent_y;
+  }
+
+  // a binary tree with leaves of at least one box has less than 2 * num_boxes nodes, so the nodes
+  // are not reallocated during the build
+  nodes_.reserve(2 * num_boxes);
+  nodes_.emplace_back();
+  buildNode(0, 0, num_boxes);
+}
+
+void BoxBvh2d::buildNode(const uint32_t node_index, const uint32_t begin, const uint32_t end)
+{
+  Node node{
+    std::numeric_limits<double>::max(),
+    std::numeric_limits<double>::max(),
+    std::numeric_limits<double>::lowest(),
+    std::numeric_limits<double>::lowest(),
+    begin,
+    end - begin};
+  double min_center_x = std::numeric_limits<double>::max();
+  double min_center_y = std::numeric_limits<double>::max();
+  double max_center_x = std::numeric_limits<double>::lowest();
+  double max_center_y = std::numeric_limits<double>::lowest();
+  for (uint32_t i = begin; i < end; ++i) {
+    const double * aabb = &aabbs_.at(4 * indices_.at(i));
+    node.min_x = std::min(node.min_x, aabb[0]);
+    node.min_y = std::min(node.min_y, aabb[1]);
+    node.max_x = std::max(node.max_x, aabb[2]);
+    node.max_y = std::max(node.max_y, aabb[3]);
+    const auto & footprint = footprints_.at(indices_.at(i));
+    min_center_x = std::min(min_center_x, footprint.x);
+    min_center_y = std::min(min_center_y, footprint.y);
+    max_center_x = std::max(max_center_x, footprint.x);
+    max_center_y = std::max(max_center_y, footprint.y);
+  }
+
+  if (end - begin <= max_leaf_size) {
+    nodes_.at(node_index) = node;
+    return;
+  }
+
+  // split at the median of the centers along the longest axis
+  const bool split_x = (max_center_x - min_center_x) >= (max_center_y - min_center_y);
+  const uint32_t middle = begin + (end - begin) / 2;
+  std::nth_element(
+    indices_.begin() + begin, indices_.begin() + middle, indices_.begin() + end,
+    [&](const uint32_t a, const uint32_t b) {
+      return split_x ? footprints_.at(a).x < footprints_.at(b).x
+                     : footprints_.at(a).y < footprints_.at(b).y;
+    });
+
+  const auto left_index = static_cast<uint32_t>(nodes_.size());
+  nodes_.emplace_back();
+  nodes_.emplace_back();
+  node.begin = left_index;
+  node.count = 0;
+  nodes_.at(node_index) = node;
+  buildNode(left_index, begin, middle);
+  buildNode(left_index + 1, middle, end);
+}
+
+void BoxBvh2d::intersect(
+  const double cos, const double sin, const double max_range,
+  std::vector<RayBoxInterval> & intervals, std::vector<uint32_t> & stack) const
+{
+  intervals.clear();
+  if (nodes_.empty()) {
+    return;
+  }
+
+  stack.clear();
+  stack.push_back(0);
+  while (!stack.empty()) {
+    const auto & node = nodes_[stack.back()];
+    stack.pop_back();
+    double t_min = 0.0;
+    double t_max = max_range;
+    if (
+      !clipToSlab(0.0, cos, node.min_x, node.max_x, t_min, t_max) ||
+      !clipToSlab(0.0, sin, node.min_y, node.max_y, t_min, t_max)) {
+      continue;
+    }
+    if (node.count == 0) {
+      stack.push_back(node.begin);
+      stack.push_back(node.begin + 1);
+      continue;
+    }
+
+    for (uint32_t i = node.begin; i < node.begin + node.count; ++i) {
+      const uint32_t box_index = indices_[i];
+      const auto & footprint = footprints_[box_index];
+      // ray in the frame of the box
+      const double origin_x = -(footprint.cos * footprint.x + footprint.sin * footprint.y);
+      const double origin_y = footprint.sin * footprint.x - footprint.cos * footprint.y;
+      const double direction_x = footprint.cos * cos + footprint.sin * sin;
+      const double direction_y = -footprint.sin * cos + footprint.cos * sin;
+      double t_enter = std::numeric_limits<double>::lowest();
+      double t_exit = std::numeric_limits<double>::max();
+      if (
+        clipToSlab(
+          origin_x, direction_x, -footprint.half_length, footprint.half_length, t_enter, t_exit) &&
+        clipToSlab(
+          origin_y, direction_y, -footprint.half_width, footprint.half_width, t_enter, t_exit) &&
+        0.0 <= t_exit && t_enter < max_range) {
+        intervals.push_back(RayBoxInterval{t_enter, t_exit, box_index});
+      }
+    }
+  }
+  std::sort(
+    intervals.begin(), intervals.end(),
+    [](const RayBoxInterval & a, const RayBoxInterval & b) { return a.t_enter < b.t_enter; });
+}
+
+SyntheticLidar::SyntheticLidar(LidarScanPattern pattern, const size_t num_threads)
+: pattern_(std::move(pattern)), num_threads_(std::max<size_t>(1, num_threads))
+{
+  tan_elevations_.resize(pattern_.elevation_angles.size());
+  for (size_t i = 0; i < tan_elevations_.size(); ++i) {
+    tan_elevations_.at(i) = std::tan(pattern_.elevation_angles.at(i));
+  }
+
+  const size_t num_azimuths = pattern_.num_azimuths();
+  cos_azimuths_.resize(num_azimuths);
+  sin_azimuths_.resize(num_azimuths);
+  for (size_t i = 0; i < num_azimuths; ++i) {
+    const double azimuth = static_cast<double>(i) * pattern_.azimuth_resolution;
+    cos_azimuths_.at(i) = std::cos(azimuth);
+    sin_azimuths_.at(i) = std::sin(azimuth);
+  }
+
+  const size_t num_sectors = std::min(num_azimuths, num_threads_ * sectors_per_thread);
+  sectors_.resize(num_sectors);
+  for (size_t i = 0; i < num_sectors; ++i) {
+    sectors_.at(i).azimuth_begin = i * num_azimuths / num_sectors;
+    sectors_.at(i).azimuth_end = (i + 1) * num_azimuths / num_sectors;
+  }
+}
+
+size_t SyntheticLidar::max_num_points() const
+{
+  return cos_azimuths_.size() * tan_elevations_.size();
+}
+
+template <typename WritePoint>
+void SyntheticLidar::castSector(
+  const std::vector<LidarBox> & boxes, Sector & sector, const size_t first_point,
+  const WritePoint & write_point) const
+{
+  std::mt19937 random_generator(sector.seed);
+  std::normal_distribution<> noise(0.0, 1.0);
+  sector.num_points = 0;
+  for (size_t azimuth = sector.azimuth_begin; azimuth < sector.azimuth_end; ++azimuth) {
+    const double cos = cos_azimuths_[azimuth];
+    const double sin = sin_azimuths_[azimuth];
+    bvh_.intersect(cos, sin, pattern_.max_range, sector.intervals, sector.stack);
+    if (sector.intervals.empty()) {
+      continue;
+    }
+
+    for (size_t ring = 0; ring < tan_elevations_.size(); ++ring) {
+      const double tan_elevation = tan_elevations_[ring];
+      double hit_distance = pattern_.max_range;
+      const LidarBox * hit_box = nullptr;
+      uint32_t hit_box_index = 0;
+      for (const auto & interval : sector.intervals) {
+        if (hit_distance <= interval.t_enter) {
+          break;
+        }
+        // the beam is at the height t * tan_elevation at the horizontal distance t
+        const auto & box = boxes[interval.box_index];
+        double t_min = interval.t_enter;
+        double t_max = interval.t_exit;
+        if (!clipToSlab(0.0, tan_elevation, box.min_z, box.max_z, t_min, t_max)) {
+          continue;
+        }
+        if (pattern_.min_range <= t_min && t_min < hit_distance) {
+          hit_distance = t_min;
+          hit_box = &box;
+          hit_box_index = interval.box_index;
+        }
+      }
+      if (!hit_box) {
+        continue;
+      }
+
+      LidarPoint point;
+      point.x =
+        static_cast<float>(hit_distance * cos + hit_box->std_dev_x * noise(random_generator));
+      point.y =
+        static_cast<float>(hit_distance * sin + hit_box->std_dev_y * noise(random_generator));
+      point.z = static_cast<float>(
+        hit_distance * tan_elevation + hit_box->std_dev_z * noise(random_generator));
+      point.channel = static_cast<uint16_t>(ring);
+      point.box_index = hit_box_index;
+      write_point(first_point + sector.num_points, point);
+      ++sector.num_points;
+    }
+  }
+}
+
+template <typename WritePoint>
+void SyntheticLidar::castSectors(
+  const std::vector<LidarBox> & boxes, std::mt19937 & random_generator,
+  const WritePoint & write_point)
+{
+  bvh_.build(boxes);
+  // the seeds are drawn in order, so that the noise does not depend on the scheduling
+  for (auto & sector : sectors_) {
+    sector.seed = random_generator();
+  }
+
+  const size_t num_rings = tan_elevations_.size();
+  universe_utils::parallelFor(
+    sectors_.size(), num_threads_, 1, [&](const size_t begin, const size_t end, const size_t) {
+      for (size_t i = begin; i < end; ++i) {
+        auto & sector = sectors_[i];
+        castSector(boxes, sector, sector.azimuth_begin * num_rings, write_point);
+      }
+    });
+}
+
+void SyntheticLidar::cast(
+  const std::vector<LidarBox> & boxes, std::mt19937 & random_generator,
+  sensor_msgs::msg::PointCloud2 & cloud)
+{
+  if (cloud.point_step != sizeof(PointXYZIRC) || cloud.fields.size() != 6) {
+    point_cloud_msg_wrapper::PointCloud2Modifier<
+      PointXYZIRC, autoware::point_types::PointXYZIRCGenerator>
+      modifier{cloud, cloud.header.frame_id};
+  }
+  // resize() only allocates on the first cast, it shrinks the data to the number of points after
+  cloud.data.resize(max_num_points() * sizeof(PointXYZIRC));
+
+  uint8_t * data = cloud.data.data();
+  castSectors(boxes, random_generator, [data](const size_t index, const LidarPoint & point) {
+    PointXYZIRC point_xyzirc;
+    point_xyzirc.x = point.x;
+    point_xyzirc.y = point.y;
+    point_xyzirc.z = point.z;
+    point_xyzirc.intensity = 0;
+    point_xyzirc.return_type = 0;
+    point_xyzirc.channel = point.channel;
+    std::memcpy(data + index * sizeof(PointXYZIRC), &point_xyzirc, sizeof(PointXYZIRC));
+  });
+
+  // pack the points of the sectors
+  const size_t num_rings = tan_elevations_.size();
+  size_t num_points = 0;
+  for (const auto & sector : sectors_) {
+    const size_t first_point = sector.azimuth_begin * num_rings;
+    if (first_point != num_points) {
+      std::memmove(
+        data + num_points * sizeof(PointXYZIRC), data + first_point * sizeof(PointXYZIRC),
+        sector.num_points * sizeof(PointXYZIRC));
+    }
+    num_points += sector.num_points;
+  }
+  cloud.data.resize(num_points * sizeof(PointXYZIRC));
+  cloud.height = 1;
+  cloud.width = static_cast<uint32_t>(num_points);
+  cloud.row_step = cloud.width * cloud.point_step;
+  cloud.is_dense = true;
+}
+
+void SyntheticLidar::cast(
+  const std::vector<LidarBox> & boxes, std::mt19937 & random_generator,
+  std::vector<LidarPoint> & points)
+{
+  points.resize(max_num_points());
+  LidarPoint * data = points.data();
+  castSectors(boxes, random_generator, [data](const size_t index, const LidarPoint & point) {
+    data[index] = point;
+  });
+
+  const size_t num_rings = tan_elevations_.size();
+  size_t num_points = 0;
+  for (const auto & sector : sectors_) {
+    const size_t first_point = sector.azimuth_begin * num_rings;
+    std::copy(data + first_point, data + first_point + sector.num_points, data + num_points);
+    num_points += sector.num_points;
+  }
+  points.resize(num_points);
+}
+
+}  // namespace autoware::dummy_perception_publisher
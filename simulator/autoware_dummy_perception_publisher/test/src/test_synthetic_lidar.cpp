@@ -0,0 +1,200 @@
+// Copyright 2025 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware/dummy_perception_publisher/synthetic_lidar.hpp"
+
+#include <autoware/point_types/types.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace autoware::dummy_perception_publisher
+{
+namespace
+{
+LidarBox createBox(const double x, const double y, const double yaw, const double max_z)
+{
+  LidarBox box;
+  box.x = x;
+  box.y = y;
+  box.yaw = yaw;
+  box.length = 2.0;
+  box.width = 2.0;
+  box.min_z = 0.0;
+  box.max_z = max_z;
+  return box;
+}
+
+// one horizontal ring and one ring at 45 degrees, with an azimuth every degree
+LidarScanPattern createPattern()
+{
+  LidarScanPattern pattern;
+  pattern.elevation_angles = {0.0, M_PI / 4.0};
+  pattern.azimuth_resolution = M_PI / 180.0;
+  pattern.min_range = 0.5;
+  pattern.max_range = 100.0;
+  return pattern;
+}
+}  // namespace
+
+TEST(SyntheticLidarTest, UniformPattern)
+{
+  const auto pattern = LidarScanPattern::uniform(5, -0.4, 0.4, M_PI / 180.0, 0.5, 100.0);
+  ASSERT_EQ(pattern.elevation_angles.size(), 5u);
+  EXPECT_DOUBLE_EQ(pattern.elevation_angles.front(), -0.4);
+  EXPECT_DOUBLE_EQ(pattern.elevation_angles.at(2), 0.0);
+  EXPECT_DOUBLE_EQ(pattern.elevation_angles.back(), 0.4);
+  EXPECT_EQ(pattern.num_azimuths(), 360u);
+}
+
+TEST(SyntheticLidarTest, BvhIntersection)
+{
+  // boxes along the x axis, and some away from it
+  std::vector<LidarBox> boxes;
+  for (int i = 0; i < 20; ++i) {
+    boxes.push_back(createBox(5.0 + 5.0 * i, 0.0, 0.1 * i, 1.0));
+    boxes.push_back(createBox(5.0 + 5.0 * i, 10.0, 0.0, 1.0));
+  }
+  BoxBvh2d bvh;
+  bvh.build(boxes);
+  EXPECT_EQ(bvh.size(), boxes.size());
+
+  std::vector<RayBoxInterval> intervals;
+  std::vector<uint32_t> stack;
+  bvh.intersect(1.0, 0.0, 52.0, intervals, stack);
+  // the boxes centered at 5, 10, ..., 50 and the one entered at 54 is beyond the max range
+  ASSERT_EQ(intervals.size(), 10u);
+  for (size_t i = 0; i < intervals.size(); ++i) {
+    EXPECT_EQ(intervals.at(i).box_index, 2 * i);
+    if (0 < i) {
+      EXPECT_LT(intervals.at(i - 1).t_enter, intervals.at(i).t_enter);
+    }
+  }
+  EXPECT_DOUBLE_EQ(intervals.front().t_enter, 4.0);
+  EXPECT_DOUBLE_EQ(intervals.front().t_exit, 6.0);
+
+  // no box behind the sensor
+  bvh.intersect(-1.0, 0.0, 100.0, intervals, stack);
+  EXPECT_TRUE(intervals.empty());
+}
+
+TEST(SyntheticLidarTest, NearestBoxHit)
+{
+  SyntheticLidar lidar(createPattern(), 1);
+  std::mt19937 random_generator(0);
+  std::vector<LidarPoint> points;
+
+  // a low box in front, whose top is below the ring at 45 degrees
+  std::vector<LidarBox> boxes{createBox(10.0, 0.0, M_PI / 4.0, 1.0)};
+  lidar.cast(boxes, random_generator, points);
+  ASSERT_FALSE(points.empty());
+  bool front_point_found = false;
+  for (const auto & point : points) {
+    EXPECT_EQ(point.channel, 0u);
+    EXPECT_EQ(point.box_index, 0u);
+    EXPECT_FLOAT_EQ(point.z, 0.0f);
+    if (point.y == 0.0f) {
+      // the corner of the box rotated by 45 degrees
+      EXPECT_NEAR(point.x, 10.0 - std::sqrt(2.0), 1e-5);
+      front_point_found = true;
+    }
+  }
+  EXPECT_TRUE(front_point_found);
+
+  // a tall box hidden behind a nearer one is not hit
+  boxes = {createBox(20.0, 0.0, 0.0, 30.0), createBox(5.0, 0.0, 0.0, 10.0)};
+  lidar.cast(boxes, random_generator, points);
+  ASSERT_FALSE(points.empty());
+  for (const auto & point : points) {
+    EXPECT_EQ(point.box_index, 1u);
+    EXPECT_LE(std::hypot(point.x, point.y), 6.0 * std::sqrt(2.0) + 1e-5);
+    if (point.y == 0.0f) {
+      EXPECT_NEAR(point.x, 4.0, 1e-5);
+      if (point.channel == 1u) {
+        EXPECT_NEAR(point.z, 4.0, 1e-5);
+      }
+    }
+  }
+}
+
+TEST(SyntheticLidarTest, SameCloudWithThreads)
+{
+  std::vector<LidarBox> boxes;
+  for (int i = 0; i < 50; ++i) {
+    auto box = createBox(20.0 * std::cos(0.3 * i), 20.0 * std::sin(0.3 * i), 0.2 * i, 2.0);
+    box.min_z = -1.0;
+    box.std_dev_x = 0.05;
+    box.std_dev_y = 0.05;
+    box.std_dev_z = 0.05;
+    boxes.push_back(box);
+  }
+  const auto pattern = LidarScanPattern::uniform(16, -0.3, 0.1, M_PI / 360.0, 0.5, 100.0);
+
+  SyntheticLidar single_thread_lidar(pattern, 1);
+  SyntheticLidar multi_thread_lidar(pattern, 4);
+  std::mt19937 single_thread_random_generator(0);
+  std::mt19937 multi_thread_random_generator(0);
+  std::vector<LidarPoint> single_thread_points;
+  std::vector<LidarPoint> multi_thread_points;
+  single_thread_lidar.cast(boxes, single_thread_random_generator, single_thread_points);
+  multi_thread_lidar.cast(boxes, multi_thread_random_generator, multi_thread_points);
+
+  ASSERT_FALSE(single_thread_points.empty());
+  ASSERT_EQ(single_thread_points.size(), multi_thread_points.size());
+  for (size_t i = 0; i < single_thread_points.size(); ++i) {
+    EXPECT_EQ(single_thread_points.at(i).channel, multi_thread_points.at(i).channel);
+    EXPECT_EQ(single_thread_points.at(i).box_index, multi_thread_points.at(i).box_index);
+  }
+}
+
+TEST(SyntheticLidarTest, PointCloud2Output)
+{
+  using autoware::point_types::PointXYZIRC;
+
+  SyntheticLidar lidar(createPattern(), 2);
+  const std::vector<LidarBox> boxes{
+    createBox(10.0, 0.0, 0.0, 20.0), createBox(0.0, -10.0, 0.0, 20.0)};
+  std::mt19937 random_generator(0);
+  std::vector<LidarPoint> points;
+  lidar.cast(boxes, random_generator, points);
+
+  random_generator.seed(0);
+  sensor_msgs::msg::PointCloud2 cloud;
+  lidar.cast(boxes, random_generator, cloud);
+  EXPECT_EQ(cloud.point_step, sizeof(PointXYZIRC));
+  EXPECT_EQ(cloud.fields.size(), 6u);
+  EXPECT_EQ(cloud.height, 1u);
+  ASSERT_EQ(cloud.width, points.size());
+  EXPECT_EQ(cloud.data.size(), cloud.width * sizeof(PointXYZIRC));
+  EXPECT_EQ(cloud.row_step, cloud.data.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    PointXYZIRC point;
+    std::memcpy(&point, &cloud.data.at(i * sizeof(PointXYZIRC)), sizeof(PointXYZIRC));
+    EXPECT_FLOAT_EQ(point.x, points.at(i).x);
+    EXPECT_FLOAT_EQ(point.y, points.at(i).y);
+    EXPECT_FLOAT_EQ(point.z, points.at(i).z);
+    EXPECT_EQ(point.channel, points.at(i).channel);
+  }
+
+  // the cloud is reused without objects
+  lidar.cast({}, random_generator, cloud);
+  EXPECT_EQ(cloud.width, 0u);
+  EXPECT_TRUE(cloud.data.empty());
+}
+
+}  // namespace autoware::dummy_perception_publisher
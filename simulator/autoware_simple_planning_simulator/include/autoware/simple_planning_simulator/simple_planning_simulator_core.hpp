@@ -42,7 +42,9 @@
 #include "geometry_msgs/msg/twist.hpp"
 #include "geometry_msgs/msg/twist_stamped.hpp"
 #include "nav_msgs/msg/odometry.hpp"
+#include "rosgraph_msgs/msg/clock.hpp"
 #include "sensor_msgs/msg/imu.hpp"
+#include "std_msgs/msg/u_int32.hpp"
 #include "tier4_external_api_msgs/srv/initialize_pose.hpp"
 #include "tier4_vehicle_msgs/msg/actuation_command_stamped.hpp"
 #include "tier4_vehicle_msgs/msg/actuation_status_stamped.hpp"
@@ -82,7 +84,9 @@ using geometry_msgs::msg::TransformStamped;
 using geometry_msgs::msg::Twist;
 using geometry_msgs::msg::TwistStamped;
 using nav_msgs::msg::Odometry;
+using rosgraph_msgs::msg::Clock;
 using sensor_msgs::msg::Imu;
+using std_msgs::msg::UInt32;
 using tier4_external_api_msgs::srv::InitializePose;
 using tier4_vehicle_msgs::msg::ActuationCommandStamped;
 using tier4_vehicle_msgs::msg::ActuationStatusStamped;
@@ -163,6 +167,18 @@ private:
   uint32_t timer_sampling_time_ms_;        //!< @brief timer sampling time
   rclcpp::TimerBase::SharedPtr on_timer_;  //!< @brief timer for simulation
 
+  /* lockstep: the simulation advances only with the step requests and publishes the clock */
+  rclcpp::Publisher<Clock>::SharedPtr pub_clock_;
+  rclcpp::Subscription<UInt32>::SharedPtr sub_lockstep_step_;
+  rclcpp::TimerBase::SharedPtr lockstep_timeout_timer_;  //!< @brief wall timer of command wait
+  bool enable_lockstep_ = false;
+  rclcpp::Time lockstep_time_{0, 0, RCL_ROS_TIME};
+  uint64_t lockstep_remaining_steps_ = 0;
+  bool lockstep_waiting_command_ = false;  //!< @brief waiting for the command of the last step
+  // a command is only waited for once its period has passed since the latest command stamp
+  rclcpp::Duration lockstep_command_period_{0, 0};
+  rclcpp::Time lockstep_last_command_time_{0, 0, RCL_ROS_TIME};
+
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
   rcl_interfaces::msg::SetParametersResult on_parameter(
     const std::vector<rclcpp::Parameter> & parameters);
@@ -315,6 +331,38 @@ private:
    */
   void on_timer();
 
+  /**
+   * @brief simulate one step and publish the vehicle state
+   * @param [in] dt delta time [s]
+   */
+  void simulate(const double dt);
+
+  /**
+   * @brief request the number of steps to simulate in lockstep mode
+   */
+  void on_lockstep_step(const UInt32::ConstSharedPtr msg);
+
+  /**
+   * @brief resume the lockstep simulation when the command for the last step is received
+   * @param [in] stamp timestamp of the received command
+   */
+  void on_lockstep_command(const builtin_interfaces::msg::Time & stamp);
+
+  /**
+   * @brief resume the lockstep simulation when no command is received in time
+   */
+  void on_lockstep_timeout();
+
+  /**
+   * @brief simulate the requested steps until the command for a step has to be waited
+   */
+  void advance_lockstep();
+
+  /**
+   * @brief get the stamp of the published messages, which is the simulation time in lockstep mode
+   */
+  rclcpp::Time get_current_time() const;
+
   /**
    * @brief initialize vehicle_model_ptr
    */
@@ -42,6 +42,9 @@ protected:
   //!< @brief gear command defined in autoware_vehicle_msgs/GearCommand
   uint8_t gear_ = autoware_vehicle_msgs::msg::GearCommand::DRIVE;
 
+  //!< @brief maximum time step of the integration, the update is not split if not positive
+  double max_integration_step_ = 0.0;
+
 public:
   /**
    * @brief constructor
@@ -79,6 +82,14 @@ public:
    */
   void setGear(const uint8_t gear);
 
+  /**
+   * @brief set maximum time step of the integration methods
+   * @details An update longer than this step is integrated in equal sub-steps, so that a large
+   * dt keeps the accuracy of the short steps.
+   * @param [in] max_integration_step maximum time step [s], not positive to disable the sub-steps
+   */
+  void setMaxIntegrationStep(const double max_integration_step);
+
   /**
    * @brief update vehicle states with Runge-Kutta methods
    * @param [in] dt delta time [s]
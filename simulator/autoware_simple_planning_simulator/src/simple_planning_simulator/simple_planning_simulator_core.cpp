@@ -103,6 +103,7 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
   simulate_motion_ = declare_parameter<bool>("initial_engage_state");
   enable_road_slope_simulation_ = declare_parameter("enable_road_slope_simulation", false);
   enable_pub_steer_ = declare_parameter("enable_pub_steer", true);
+  enable_lockstep_ = declare_parameter("lockstep.enable", false);
 
   using rclcpp::QoS;
   using std::placeholders::_1;
@@ -150,12 +151,18 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     current_input_command_ = ActuationCommandStamped();
     sub_actuation_cmd_ = create_subscription<ActuationCommandStamped>(
       "input/actuation_command", QoS{1},
-      [this](const ActuationCommandStamped::ConstSharedPtr msg) { current_input_command_ = *msg; });
+      [this](const ActuationCommandStamped::ConstSharedPtr msg) {
+        current_input_command_ = *msg;
+        on_lockstep_command(msg->header.stamp);
+      });
   } else {  // default command type is ACKERMANN
     current_input_command_ = Control();
     sub_ackermann_cmd_ = create_subscription<Control>(
       "input/ackermann_control_command", QoS{1},
-      [this](const Control::ConstSharedPtr msg) { current_input_command_ = *msg; });
+      [this](const Control::ConstSharedPtr msg) {
+        current_input_command_ = *msg;
+        on_lockstep_command(msg->stamp);
+      });
   }
 
   pub_control_mode_report_ =
@@ -182,9 +189,24 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     std::bind(&SimplePlanningSimulator::on_parameter, this, _1));
 
   timer_sampling_time_ms_ = static_cast<uint32_t>(declare_parameter("timer_sampling_time_ms", 25));
-  on_timer_ = rclcpp::create_timer(
-    this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
-    std::bind(&SimplePlanningSimulator::on_timer, this));
+  if (enable_lockstep_) {
+    // the simulation time starts from the current time and only advances with the step requests
+    lockstep_time_ = rclcpp::Time(rclcpp::Clock(RCL_SYSTEM_TIME).now().nanoseconds(), RCL_ROS_TIME);
+    pub_clock_ = create_publisher<Clock>("/clock", rclcpp::ClockQoS());
+    sub_lockstep_step_ = create_subscription<UInt32>(
+      "input/lockstep_step", QoS{10},
+      std::bind(&SimplePlanningSimulator::on_lockstep_step, this, _1));
+    const double command_timeout = declare_parameter("lockstep.command_timeout", 1.0);
+    lockstep_command_period_ =
+      rclcpp::Duration::from_seconds(declare_parameter("lockstep.command_period", 0.0));
+    lockstep_timeout_timer_ = create_wall_timer(
+      std::chrono::duration<double>(command_timeout),
+      std::bind(&SimplePlanningSimulator::on_lockstep_timeout, this));
+  } else {
+    on_timer_ = rclcpp::create_timer(
+      this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
+      std::bind(&SimplePlanningSimulator::on_timer, this));
+  }
 
   tier4_api_utils::ServiceProxyNodeInterface proxy(this);
   group_api_service_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
@@ -194,6 +216,7 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
 
   // set vehicle model type
   initialize_vehicle_model(vehicle_model_type_str);
+  vehicle_model_ptr_->setMaxIntegrationStep(declare_parameter("max_integration_step", 0.0));
 
   // set initialize source
   const auto initialize_source = declare_parameter("initialize_source", "INITIAL_POSE_TOPIC");
@@ -210,7 +233,8 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
   {
     std::random_device seed;
     auto & m = measurement_noise_;
-    m.rand_engine_ = std::make_shared<std::mt19937>(seed());
+    // the noise is reproducible in lockstep mode
+    m.rand_engine_ = std::make_shared<std::mt19937>(enable_lockstep_ ? 0U : seed());
     double pos_noise_stddev = declare_parameter("pos_noise_stddev", 1e-2);
     double vel_noise_stddev = declare_parameter("vel_noise_stddev", 1e-2);
     double rpy_noise_stddev = declare_parameter("rpy_noise_stddev", 1e-4);
@@ -462,6 +486,81 @@ void SimplePlanningSimulator::on_timer()
     return;
   }
 
+  simulate(delta_time_.get_dt(get_clock()->now()));
+}
+
+void SimplePlanningSimulator::on_lockstep_step(const UInt32::ConstSharedPtr msg)
+{
+  lockstep_remaining_steps_ += msg->data;
+  advance_lockstep();
+}
+
+void SimplePlanningSimulator::on_lockstep_command(const builtin_interfaces::msg::Time & stamp)
+{
+  if (!enable_lockstep_) {
+    return;
+  }
+  const rclcpp::Time command_time(stamp, RCL_ROS_TIME);
+  lockstep_last_command_time_ = std::max(lockstep_last_command_time_, command_time);
+  if (!lockstep_waiting_command_) {
+    return;
+  }
+  // ignore the commands calculated for the previous steps
+  if (command_time < lockstep_time_) {
+    return;
+  }
+  lockstep_waiting_command_ = false;
+  advance_lockstep();
+}
+
+void SimplePlanningSimulator::on_lockstep_timeout()
+{
+  if (!lockstep_waiting_command_) {
+    return;
+  }
+  RCLCPP_WARN_THROTTLE(
+    get_logger(), *get_clock(), 5000,
+    "no command received for the simulation step, continue with the previous command");
+  lockstep_waiting_command_ = false;
+  advance_lockstep();
+}
+
+void SimplePlanningSimulator::advance_lockstep()
+{
+  const double dt = timer_sampling_time_ms_ / 1000.0;
+  while (0 < lockstep_remaining_steps_ && !lockstep_waiting_command_) {
+    --lockstep_remaining_steps_;
+    lockstep_time_ += rclcpp::Duration(std::chrono::milliseconds(timer_sampling_time_ms_));
+    Clock clock;
+    clock.clock = lockstep_time_;
+    pub_clock_->publish(clock);
+
+    if (!is_initialized_) {
+      publish_control_mode_report();
+      RCLCPP_INFO_THROTTLE(get_logger(), *get_clock(), 5000, "waiting initialization...");
+      continue;
+    }
+
+    simulate(dt);
+
+    // the next step waits for the command calculated from the published state, if it is used and
+    // the controller is due to send one
+    lockstep_waiting_command_ =
+      simulate_motion_ && current_control_mode_.mode == ControlModeReport::AUTONOMOUS &&
+      lockstep_last_command_time_ + lockstep_command_period_ <= lockstep_time_;
+    if (lockstep_waiting_command_) {
+      lockstep_timeout_timer_->reset();
+    }
+  }
+}
+
+rclcpp::Time SimplePlanningSimulator::get_current_time() const
+{
+  return enable_lockstep_ ? lockstep_time_ : get_clock()->now();
+}
+
+void SimplePlanningSimulator::simulate(const double dt)
+{
   // calculate longitudinal acceleration by slope
   constexpr double gravity_acceleration = -9.81;
   const double ego_pitch_angle = calculate_ego_pitch();
@@ -470,8 +569,6 @@ void SimplePlanningSimulator::on_timer()
 
   // update vehicle dynamics
   {
-    const double dt = delta_time_.get_dt(get_clock()->now());
-
     if (current_control_mode_.mode == ControlModeReport::AUTONOMOUS) {
       vehicle_model_ptr_->setGear(current_gear_cmd_.command);
       set_input(current_input_command_, acc_by_slope);
@@ -809,7 +906,7 @@ TransformStamped SimplePlanningSimulator::get_transform_msg(
 void SimplePlanningSimulator::publish_velocity(const VelocityReport & velocity)
 {
   VelocityReport msg = velocity;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.header.frame_id = simulated_frame_id_;
   pub_velocity_->publish(msg);
 }
@@ -818,7 +915,7 @@ void SimplePlanningSimulator::publish_odometry(const Odometry & odometry)
 {
   Odometry msg = odometry;
   msg.header.frame_id = origin_frame_id_;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.child_frame_id = simulated_frame_id_;
   pub_odom_->publish(msg);
 }
@@ -839,14 +936,14 @@ void SimplePlanningSimulator::publish_pose(const Odometry & odometry)
   msg.pose.covariance.at(COV_IDX::YAW_YAW) = COV_ANGLE;
 
   msg.header.frame_id = origin_frame_id_;
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   pub_current_pose_->publish(msg);
 }
 
 void SimplePlanningSimulator::publish_steering(const SteeringReport & steer)
 {
   SteeringReport msg = steer;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   pub_steer_->publish(msg);
 }
 
@@ -854,7 +951,7 @@ void SimplePlanningSimulator::publish_acceleration()
 {
   AccelWithCovarianceStamped msg;
   msg.header.frame_id = "/base_link";
-  msg.header.stamp = get_clock()->now();
+  msg.header.stamp = get_current_time();
   msg.accel.accel.linear.x = vehicle_model_ptr_->getAx();
   msg.accel.accel.linear.y = vehicle_model_ptr_->getWz() * vehicle_model_ptr_->getVx();
 
@@ -875,7 +972,7 @@ void SimplePlanningSimulator::publish_imu()
 
   sensor_msgs::msg::Imu imu;
   imu.header.frame_id = "base_link";
-  imu.header.stamp = now();
+  imu.header.stamp = get_current_time();
   imu.linear_acceleration.x = vehicle_model_ptr_->getAx();
   imu.linear_acceleration.y = vehicle_model_ptr_->getWz() * vehicle_model_ptr_->getVx();
   constexpr auto COV = 0.001;
@@ -895,14 +992,14 @@ void SimplePlanningSimulator::publish_imu()
 
 void SimplePlanningSimulator::publish_control_mode_report()
 {
-  current_control_mode_.stamp = get_clock()->now();
+  current_control_mode_.stamp = get_current_time();
   pub_control_mode_report_->publish(current_control_mode_);
 }
 
 void SimplePlanningSimulator::publish_gear_report()
 {
   GearReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = vehicle_model_ptr_->getGear();
   pub_gear_report_->publish(msg);
 }
@@ -913,7 +1010,7 @@ void SimplePlanningSimulator::publish_turn_indicators_report()
     return;
   }
   TurnIndicatorsReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   if (current_turn_indicators_cmd_ptr_->command == TurnIndicatorsCommand::NO_COMMAND) {
     msg.report = TurnIndicatorsReport::DISABLE;
   } else {
@@ -928,7 +1025,7 @@ void SimplePlanningSimulator::publish_hazard_lights_report()
     return;
   }
   HazardLightsReport msg;
-  msg.stamp = get_clock()->now();
+  msg.stamp = get_current_time();
   msg.report = current_hazard_lights_cmd_ptr_->command;
   pub_hazard_lights_report_->publish(msg);
 }
@@ -936,7 +1033,7 @@ void SimplePlanningSimulator::publish_hazard_lights_report()
 void SimplePlanningSimulator::publish_tf(const Odometry & odometry)
 {
   TransformStamped tf;
-  tf.header.stamp = get_clock()->now();
+  tf.header.stamp = get_current_time();
   tf.header.frame_id = origin_frame_id_;
   tf.child_frame_id = simulated_frame_id_;
   tf.transform.translation.x = odometry.pose.pose.position.x;
@@ -956,7 +1053,7 @@ void SimplePlanningSimulator::publish_actuation_status()
     return;
   }
 
-  actuation_status.value().header.stamp = get_clock()->now();
+  actuation_status.value().header.stamp = get_current_time();
   actuation_status.value().header.frame_id = simulated_frame_id_;
   pub_actuation_status_->publish(actuation_status.value());
 }
@@ -14,6 +14,8 @@
 
 #include "autoware/simple_planning_simulator/vehicle_model/sim_model_interface.hpp"
 
+#include <cmath>
+
 namespace autoware::simulator::simple_planning_simulator
 {
 
@@ -23,18 +25,41 @@ SimModelInterface::SimModelInterface(int dim_x, int dim_u) : dim_x_(dim_x), dim_
   input_ = Eigen::VectorXd::Zero(dim_u_);
 }
 
+namespace
+{
+int calcNumSubSteps(const double dt, const double max_integration_step)
+{
+  if (max_integration_step <= 0.0 || dt <= max_integration_step) {
+    return 1;
+  }
+  return static_cast<int>(std::ceil(dt / max_integration_step));
+}
+}  // namespace
+
+void SimModelInterface::setMaxIntegrationStep(const double max_integration_step)
+{
+  max_integration_step_ = max_integration_step;
+}
 void SimModelInterface::updateRungeKutta(const double & dt, const Eigen::VectorXd & input)
 {
-  Eigen::VectorXd k1 = calcModel(state_, input);
-  Eigen::VectorXd k2 = calcModel(state_ + k1 * 0.5 * dt, input);
-  Eigen::VectorXd k3 = calcModel(state_ + k2 * 0.5 * dt, input);
-  Eigen::VectorXd k4 = calcModel(state_ + k3 * dt, input);
+  const int num_sub_steps = calcNumSubSteps(dt, max_integration_step_);
+  const double sub_dt = dt / num_sub_steps;
+  for (int i = 0; i < num_sub_steps; ++i) {
+    Eigen::VectorXd k1 = calcModel(state_, input);
+    Eigen::VectorXd k2 = calcModel(state_ + k1 * 0.5 * sub_dt, input);
+    Eigen::VectorXd k3 = calcModel(state_ + k2 * 0.5 * sub_dt, input);
+    Eigen::VectorXd k4 = calcModel(state_ + k3 * sub_dt, input);
 
-  state_ += 1.0 / 6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4) * dt;
+    state_ += 1.0 / 6.0 * (k1 + 2.0 * k2 + 2.0 * k3 + k4) * sub_dt;
+  }
 }
 void SimModelInterface::updateEuler(const double & dt, const Eigen::VectorXd & input)
 {
-  state_ += calcModel(state_, input) * dt;
+  const int num_sub_steps = calcNumSubSteps(dt, max_integration_step_);
+  const double sub_dt = dt / num_sub_steps;
+  for (int i = 0; i < num_sub_steps; ++i) {
+    state_ += calcModel(state_, input) * sub_dt;
+  }
 }
 void SimModelInterface::getState(Eigen::VectorXd & state)
 {
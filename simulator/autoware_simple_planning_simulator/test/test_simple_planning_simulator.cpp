@@ -14,6 +14,7 @@
 
 #include "ament_index_cpp/get_package_share_directory.hpp"
 #include "autoware/simple_planning_simulator/simple_planning_simulator_core.hpp"
+#include "autoware/simple_planning_simulator/vehicle_model/sim_model.hpp"
 #include "gtest/gtest.h"
 
 #include <tf2/utils.hpp>
@@ -24,6 +25,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #ifdef ROS_DISTRO_GALACTIC
 #include "tf2_geometry_msgs/tf2_geometry_msgs.h"
@@ -459,4 +461,154 @@ INSTANTIATE_TEST_SUITE_P(
     std::make_tuple(CommandType::Actuation, "ACTUATION_CMD_VGR"),
     std::make_tuple(CommandType::Actuation, "ACTUATION_CMD_MECHANICAL")));
 
+TEST(TestSimModelInterface, TestIntegrationSubSteps)
+{
+  Eigen::VectorXd input(2);
+  input << 5.0, 0.3;
+
+  const std::shared_ptr<SimModelInterface> model = std::make_shared<SimModelIdealSteerVel>(3.0);
+  model->setInput(input);
+  for (int i = 0; i < 4; ++i) {
+    model->update(0.03125);
+  }
+
+  // the long update is split in the same steps
+  const std::shared_ptr<SimModelInterface> sub_stepped_model =
+    std::make_shared<SimModelIdealSteerVel>(3.0);
+  sub_stepped_model->setMaxIntegrationStep(0.03125);
+  sub_stepped_model->setInput(input);
+  sub_stepped_model->update(0.125);
+
+  EXPECT_DOUBLE_EQ(sub_stepped_model->getX(), model->getX());
+  EXPECT_DOUBLE_EQ(sub_stepped_model->getY(), model->getY());
+  EXPECT_DOUBLE_EQ(sub_stepped_model->getYaw(), model->getYaw());
+}
+
+TEST(TestSimplePlanningSimulatorLockstep, TestLockstep)
+{
+  rclcpp::init(0, nullptr);
+
+  rclcpp::NodeOptions node_options;
+  node_options.append_parameter_override("initialize_source", "INITIAL_POSE_TOPIC");
+  node_options.append_parameter_override("vehicle_model_type", "IDEAL_STEER_VEL");
+  node_options.append_parameter_override("initial_engage_state", true);
+  node_options.append_parameter_override("add_measurement_noise", false);
+  node_options.append_parameter_override("timer_sampling_time_ms", 25);
+  node_options.append_parameter_override("lockstep.enable", true);
+  node_options.append_parameter_override("lockstep.command_timeout", 100.0);
+  declareVehicleInfoParams(node_options);
+  const auto sim_node = std::make_shared<SimplePlanningSimulator>(node_options);
+  const auto pub_sub_node = std::make_shared<PubSubNode>();
+
+  std::vector<rclcpp::Time> clocks;
+  const auto clock_sub = pub_sub_node->create_subscription<rosgraph_msgs::msg::Clock>(
+    "/clock", rclcpp::ClockQoS(), [&clocks](const rosgraph_msgs::msg::Clock::ConstSharedPtr msg) {
+      clocks.emplace_back(msg->clock, RCL_ROS_TIME);
+    });
+  const auto pub_step =
+    pub_sub_node->create_publisher<std_msgs::msg::UInt32>("input/lockstep_step", rclcpp::QoS{10});
+  const auto spin = [&]() {
+    for (int i = 0; i < 10; ++i) {
+      rclcpp::spin_some(sim_node);
+      rclcpp::spin_some(pub_sub_node);
+      std::this_thread::sleep_for(std::chrono::milliseconds{10LL});
+    }
+  };
+
+  resetInitialpose(sim_node, pub_sub_node);
+  EXPECT_TRUE(clocks.empty());
+
+  // the first step is simulated, then the command for its state is waited
+  std_msgs::msg::UInt32 steps;
+  steps.data = 4;
+  pub_step->publish(steps);
+  spin();
+  ASSERT_EQ(clocks.size(), 1u);
+  ASSERT_TRUE(pub_sub_node->current_odom_);
+  EXPECT_EQ(rclcpp::Time(pub_sub_node->current_odom_->header.stamp, RCL_ROS_TIME), clocks.back());
+
+  // a command calculated before the last step does not advance the simulation
+  auto cmd = ackermannCmdGen(
+    clocks.back() - rclcpp::Duration(std::chrono::milliseconds(1)),
+    Ackermann{0.0, 0.0, 5.0, 0.0, 0.0});
+  pub_sub_node->pub_ackermann_command_->publish(cmd);
+  spin();
+  EXPECT_EQ(clocks.size(), 1u);
+
+  // each command for the last step advances the simulation by the sampling time
+  for (size_t i = 1; i < 4; ++i) {
+    cmd.stamp = clocks.back();
+    pub_sub_node->pub_ackermann_command_->publish(cmd);
+    spin();
+    ASSERT_EQ(clocks.size(), i + 1);
+    EXPECT_EQ((clocks.at(i) - clocks.at(i - 1)).nanoseconds(), 25000000);
+  }
+
+  // all the requested steps are simulated
+  cmd.stamp = clocks.back();
+  pub_sub_node->pub_ackermann_command_->publish(cmd);
+  spin();
+  EXPECT_EQ(clocks.size(), 4u);
+  EXPECT_NEAR(pub_sub_node->current_odom_->pose.pose.position.x, 3 * 0.025 * 5.0, 1e-6);
+
+  rclcpp::shutdown();
+}
+
+TEST(TestSimplePlanningSimulatorLockstep, TestLockstepCommandPeriod)
+{
+  rclcpp::init(0, nullptr);
+
+  rclcpp::NodeOptions node_options;
+  node_options.append_parameter_override("initialize_source", "INITIAL_POSE_TOPIC");
+  node_options.append_parameter_override("vehicle_model_type", "IDEAL_STEER_VEL");
+  node_options.append_parameter_override("initial_engage_state", true);
+  node_options.append_parameter_override("add_measurement_noise", false);
+  node_options.append_parameter_override("timer_sampling_time_ms", 25);
+  node_options.append_parameter_override("lockstep.enable", true);
+  node_options.append_parameter_override("lockstep.command_timeout", 100.0);
+  node_options.append_parameter_override("lockstep.command_period", 0.075);
+  declareVehicleInfoParams(node_options);
+  const auto sim_node = std::make_shared<SimplePlanningSimulator>(node_options);
+  const auto pub_sub_node = std::make_shared<PubSubNode>();
+
+  std::vector<rclcpp::Time> clocks;
+  const auto clock_sub = pub_sub_node->create_subscription<rosgraph_msgs::msg::Clock>(
+    "/clock", rclcpp::ClockQoS(), [&clocks](const rosgraph_msgs::msg::Clock::ConstSharedPtr msg) {
+      clocks.emplace_back(msg->clock, RCL_ROS_TIME);
+    });
+  const auto pub_step =
+    pub_sub_node->create_publisher<std_msgs::msg::UInt32>("input/lockstep_step", rclcpp::QoS{10});
+  const auto spin = [&]() {
+    for (int i = 0; i < 10; ++i) {
+      rclcpp::spin_some(sim_node);
+      rclcpp::spin_some(pub_sub_node);
+      std::this_thread::sleep_for(std::chrono::milliseconds{10LL});
+    }
+  };
+
+  resetInitialpose(sim_node, pub_sub_node);
+
+  // no command has been received yet, so the first step waits for one
+  std_msgs::msg::UInt32 steps;
+  steps.data = 7;
+  pub_step->publish(steps);
+  spin();
+  ASSERT_EQ(clocks.size(), 1u);
+
+  // the controller runs every 3 steps, the steps in between do not wait
+  auto cmd = ackermannCmdGen(clocks.back(), Ackermann{0.0, 0.0, 5.0, 0.0, 0.0});
+  pub_sub_node->pub_ackermann_command_->publish(cmd);
+  spin();
+  ASSERT_EQ(clocks.size(), 4u);
+  EXPECT_EQ((clocks.back() - rclcpp::Time(cmd.stamp, RCL_ROS_TIME)).nanoseconds(), 75000000);
+
+  cmd.stamp = clocks.back();
+  pub_sub_node->pub_ackermann_command_->publish(cmd);
+  spin();
+  EXPECT_EQ(clocks.size(), 7u);
+  EXPECT_NEAR(pub_sub_node->current_odom_->pose.pose.position.x, 6 * 0.025 * 5.0, 1e-6);
+
+  rclcpp::shutdown();
+}
+
 }  // namespace autoware::simulator::simple_planning_simulator